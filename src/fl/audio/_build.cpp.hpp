@@ -15,6 +15,7 @@
 #include "fl/audio/signal_conditioner.cpp.hpp"
 #include "fl/audio/silence_envelope.cpp.hpp"
 #include "fl/audio/spectral_equalizer.cpp.hpp"
+#include "fl/audio/stft_framer.cpp.hpp"
 #include "fl/audio/synth.cpp.hpp"
 
 // begin sub directory includes
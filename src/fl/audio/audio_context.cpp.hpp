@@ -1,4 +1,5 @@
 #include "fl/audio/audio_context.h"
+#include "fl/math/math.h"
 #include "fl/stl/noexcept.h"
 
 namespace fl {
@@ -103,6 +104,50 @@ BandEnergy Context::getBandEnergy() {
     return out;
 }
 
+span<const float> Context::getChroma() {
+    if (mHasChroma) {
+        return span<const float>(mChroma, 12);
+    }
+    for (int i = 0; i < 12; i++) {
+        mChroma[i] = 0.0f;
+    }
+
+    // Map linearly-rebinned magnitudes to pitch classes:
+    // freq = fmin + (bin + 0.5) * binWidth, MIDI = 69 + 12 * log2(freq / 440).
+    auto fft = getFFT(32);
+    span<const float> linearBins = fft->linear();
+    const fl::size numBins = linearBins.size();
+    const float fmin = fft->linearFmin();
+    const float fmax = fft->linearFmax();
+    const float binWidth = (numBins > 0) ? (fmax - fmin) / static_cast<float>(numBins) : 1.0f;
+
+    for (fl::size bin = 0; bin < numBins; bin++) {
+        float magnitude = linearBins[bin];
+        if (magnitude < 1e-6f) continue;
+        float freq = fmin + (static_cast<float>(bin) + 0.5f) * binWidth;
+        // Below ~C2 there is too little pitch information to be useful.
+        if (freq < 60.0f) continue;
+        float midiNote = 69.0f + 12.0f * (fl::logf(freq / 440.0f) / fl::logf(2.0f));
+        int pitchClass = static_cast<int>(midiNote + 0.5f) % 12;
+        if (pitchClass < 0) pitchClass += 12;
+        mChroma[pitchClass] += magnitude;
+    }
+
+    float maxVal = 0.0f;
+    for (int i = 0; i < 12; i++) {
+        if (mChroma[i] > maxVal) {
+            maxVal = mChroma[i];
+        }
+    }
+    if (maxVal > 1e-6f) {
+        for (int i = 0; i < 12; i++) {
+            mChroma[i] /= maxVal;
+        }
+    }
+    mHasChroma = true;
+    return span<const float>(mChroma, 12);
+}
+
 shared_ptr<const fft::Bins> Context::getFFT16(fft::Mode mode, fft::Window window) {
     return getFFT(16, fft::Args::DefaultMinFrequency(),
                   fft::Args::DefaultMaxFrequency(), mode, window);
@@ -159,9 +204,12 @@ void Context::setSample(const Sample& sample) {
     mFFTCache.clear();
     // Reset silence flag — pipeline must re-populate after NFT update this frame.
     mIsSilent = false;
+    mFrameAdvance = 0;
+    mHasChroma = false;
 }
 
 void Context::clearCache() {
+    mHasChroma = false;
     mFFTCache.clear();
     mFFTCacheMap.clear();
     mRecyclePool.clear();
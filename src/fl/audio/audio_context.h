@@ -48,6 +48,12 @@ public:
     shared_ptr<const fft::Bins> getFFT16(fft::Mode mode = fft::Mode::LOG_REBIN,
                                        fft::Window window = fft::Window::BLACKMAN_HARRIS) FL_NOEXCEPT;
 
+    // ----- Shared Spectral Features (computed once per frame) -----
+    // 12-bin pitch-class profile (C, C#, ..., B) of the 32-band FFT,
+    // normalized so the strongest class is 1.0. Chord and key detection both
+    // read it, so the per-bin frequency-to-pitch mapping runs once per frame.
+    span<const float> getChroma() FL_NOEXCEPT;
+
     // ----- fft::FFT History (for temporal analysis) -----
     void setFFTHistoryDepth(int depth) FL_NOEXCEPT;
     const vector<fft::Bins>& getFFTHistory() const FL_NOEXCEPT { return mFFTHistory; }
@@ -58,6 +64,17 @@ public:
     void setSampleRate(int sampleRate) FL_NOEXCEPT { mSampleRate = sampleRate; }
     int getSampleRate() const FL_NOEXCEPT { return mSampleRate; }
 
+    // ----- Frame Advance -----
+    // Number of new samples this frame represents. Equal to the PCM size for
+    // back-to-back buffers; in STFT mode consecutive windows overlap, so the
+    // pipeline sets this to the hop size. Detectors that integrate over time
+    // must use this (not getPCM().size()) as their time step.
+    // Reset to 0 (meaning "PCM size") on each setSample().
+    void setFrameAdvance(fl::size samples) FL_NOEXCEPT { mFrameAdvance = samples; }
+    fl::size getFrameAdvance() const FL_NOEXCEPT {
+        return mFrameAdvance > 0 ? mFrameAdvance : mSample.size();
+    }
+
     // ----- Silence Flag -----
     // Populated per-frame by the pipeline owner (Processor / Reactive) from
     // NoiseFloorTracker::isAboveFloor(). Detectors read this to gate their
@@ -92,6 +109,9 @@ private:
     vector<fft::Bins> mFFTHistory;
     int mFFTHistoryDepth = 0;
     int mFFTHistoryIndex = 0;
+    float mChroma[12] = {};
+    bool mHasChroma = false;
+    fl::size mFrameAdvance = 0;
     bool mIsSilent = false;
 };
 
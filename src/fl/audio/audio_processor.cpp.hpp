@@ -1,5 +1,6 @@
 #include "fl/audio/audio_processor.h"
 #include "fl/stl/weak_ptr.h"
+#include "fl/stl/chrono.h"
 #include "fl/audio/input.h"
 #include "fl/audio/detector/beat.h"
 #include "fl/audio/detector/frequency_bands.h"
@@ -26,12 +27,113 @@
 namespace fl {
 namespace audio {
 
+constexpr u32 Processor::kPollKeepAliveFrames;
+
 Processor::Processor()
     : mContext(make_shared<Context>(Sample()))
 {}
 
-void Processor::registerDetector(shared_ptr<Detector> detector) {
-    mActiveDetectors.push_back(detector);
+void Processor::registerDetector(shared_ptr<Detector> detector,
+                                 fl::initializer_list<Detector*> dependsOn) {
+    DetectorNode node;
+    node.detector = detector;
+    for (Detector* dep : dependsOn) {
+        // Dependencies are created (and registered) by the getter first.
+        for (fl::size j = 0; j < mDetectors.size(); ++j) {
+            if (mDetectors[j].detector.get() == dep) {
+                node.dependsOn.push_back(j);
+                break;
+            }
+        }
+    }
+    node.stats.name = detector->getName();
+    node.lastPollFrame = mFrame;
+    mDetectors.push_back(fl::move(node));
+}
+
+Processor::DetectorNode* Processor::findNode(const Detector* detector) {
+    // A few dozen nodes at most, so a linear scan is cheapest.
+    for (auto& node : mDetectors) {
+        if (node.detector.get() == detector) {
+            return &node;
+        }
+    }
+    return nullptr;
+}
+
+void Processor::updateLiveness() {
+    for (auto& node : mDetectors) {
+        node.live = node.callbacks > 0 ||
+                    mFrame - node.lastPollFrame <= kPollKeepAliveFrames;
+    }
+    // Dependents sit after their dependencies, so one backwards pass
+    // reaches every transitive dependency of a live node.
+    for (fl::size i = mDetectors.size(); i-- > 0;) {
+        if (!mDetectors[i].live) {
+            continue;
+        }
+        for (fl::size dep : mDetectors[i].dependsOn) {
+            mDetectors[dep].live = true;
+        }
+    }
+}
+
+void Processor::runDetectors(const shared_ptr<Context>& context) {
+    ++mFrame;
+    updateLiveness();
+
+    // Phase 1: Compute state for all live detectors
+    for (auto& node : mDetectors) {
+        if (!node.live) {
+            continue;
+        }
+        if (!mProfileDetectors) {
+            node.detector->update(context);
+            continue;
+        }
+        const u32 start = fl::micros();
+        node.detector->update(context);
+        const u32 elapsed = fl::micros() - start;
+        node.stats.updates++;
+        node.stats.totalMicros += elapsed;
+        if (elapsed > node.stats.maxMicros) {
+            node.stats.maxMicros = elapsed;
+        }
+    }
+
+    // Phase 2: Fire callbacks for all live detectors
+    for (auto& node : mDetectors) {
+        if (node.live) {
+            node.detector->fireCallbacks();
+        }
+    }
+}
+
+fl::size Processor::getActiveDetectorCount() const {
+    fl::size count = 0;
+    for (const auto& node : mDetectors) {
+        if (node.live) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+vector<DetectorStats> Processor::getDetectorStats() const {
+    vector<DetectorStats> out;
+    out.reserve(mDetectors.size());
+    for (const auto& node : mDetectors) {
+        out.push_back(node.stats);
+    }
+    return out;
+}
+
+void Processor::resetDetectorStats() {
+    for (auto& node : mDetectors) {
+        const char* name = node.stats.name;
+        node.stats = DetectorStats();
+        node.stats.name = name;
+    }
 }
 
 Processor::~Processor() FL_NOEXCEPT = default;
@@ -58,7 +160,34 @@ void Processor::update(const Sample& sample) {
         mNoiseFloorTracker.update(conditioned.rms());
     }
 
-    mContext->setSample(conditioned);
+    if (!mStft.enabled()) {
+        analyzeFrame(conditioned, 0);
+        return;
+    }
+
+    // STFT mode: slice the conditioned stream into overlapping windows.
+    // Each frame is stamped with the time of its last sample, derived from
+    // how much of this buffer is still unconsumed.
+    span<const i16> pcm = conditioned.pcm();
+    fl::size used = 0;
+    while (used < pcm.size()) {
+        used += mStft.consume(pcm.subspan(used));
+        if (!mStft.frameReady()) {
+            continue;
+        }
+        const fl::size remaining = pcm.size() - used;
+        const u32 lagMs = mSampleRate > 0
+            ? static_cast<u32>((static_cast<u64>(remaining) * 1000u) /
+                               static_cast<u64>(mSampleRate))
+            : 0;
+        analyzeFrame(mStft.takeFrame(conditioned.timestamp() - lagMs),
+                     mStft.hopSize());
+    }
+}
+
+void Processor::analyzeFrame(const Sample& frame, fl::size advance) {
+    mContext->setSample(frame);
+    mContext->setFrameAdvance(advance);
 
     // Stage 4: Silence flag — detectors use this to gate outputs when audio stops.
     // Only populated when NFT is enabled; otherwise silence is unknowable and
@@ -68,250 +197,237 @@ void Processor::update(const Sample& sample) {
     // adaptive floor's first-sample init matches the current level, so
     // isAboveFloor() stays false for any steady signal. Absolute RMS is the
     // right silence primitive — a loud constant tone has large RMS.
-    if (mNoiseFloorTrackingEnabled && conditioned.isValid()) {
+    if (mNoiseFloorTrackingEnabled && frame.isValid()) {
         constexpr float kSilenceRmsThreshold = 10.0f;
-        mContext->setSilent(conditioned.rms() < kSilenceRmsThreshold);
-    }
-
-    // Phase 1: Compute state for all active detector
-    for (auto& d : mActiveDetectors) {
-        d->update(mContext);
+        mContext->setSilent(frame.rms() < kSilenceRmsThreshold);
     }
 
-    // Phase 2: Fire callbacks for all active detector
-    for (auto& d : mActiveDetectors) {
-        d->fireCallbacks();
-    }
+    runDetectors(mContext);
 }
 
 void Processor::updateFromContext(shared_ptr<Context> externalContext) {
     // Use externally-provided context (FFT already cached, signal already conditioned).
     // This avoids recomputing FFT when Reactive has already done it.
-    for (auto& d : mActiveDetectors) {
-        d->update(externalContext);
-    }
-    for (auto& d : mActiveDetectors) {
-        d->fireCallbacks();
-    }
+    runDetectors(externalContext);
 }
 
 void Processor::onBeat(function<void()> callback) {
-    auto detector = getBeatDetector();
+    auto detector = subscribe(getBeatDetector());
     detector->onBeat.add(callback);
 }
 
 void Processor::onBeatPhase(function<void(float)> callback) {
-    auto detector = getBeatDetector();
+    auto detector = subscribe(getBeatDetector());
     detector->onBeatPhase.add(callback);
 }
 
 void Processor::onOnset(function<void(float)> callback) {
-    auto detector = getBeatDetector();
+    auto detector = subscribe(getBeatDetector());
     detector->onOnset.add(callback);
 }
 
 void Processor::onTempoChange(function<void(float, float)> callback) {
-    auto detector = getBeatDetector();
+    auto detector = subscribe(getBeatDetector());
     detector->onTempoChange.add(callback);
 }
 
 void Processor::onTempo(function<void(float)> callback) {
-    auto detector = getTempoAnalyzer();
+    auto detector = subscribe(getTempoAnalyzer());
     detector->onTempo.add(callback);
 }
 
 void Processor::onTempoWithConfidence(function<void(float, float)> callback) {
-    auto detector = getTempoAnalyzer();
+    auto detector = subscribe(getTempoAnalyzer());
     detector->onTempoWithConfidence.add(callback);
 }
 
 void Processor::onTempoStable(function<void()> callback) {
-    auto detector = getTempoAnalyzer();
+    auto detector = subscribe(getTempoAnalyzer());
     detector->onTempoStable.add(callback);
 }
 
 void Processor::onTempoUnstable(function<void()> callback) {
-    auto detector = getTempoAnalyzer();
+    auto detector = subscribe(getTempoAnalyzer());
     detector->onTempoUnstable.add(callback);
 }
 
 void Processor::onBass(function<void(float)> callback) {
-    auto detector = getFrequencyBands();
+    auto detector = subscribe(getFrequencyBands());
     detector->onBassLevel.add(callback);
 }
 
 void Processor::onMid(function<void(float)> callback) {
-    auto detector = getFrequencyBands();
+    auto detector = subscribe(getFrequencyBands());
     detector->onMidLevel.add(callback);
 }
 
 void Processor::onTreble(function<void(float)> callback) {
-    auto detector = getFrequencyBands();
+    auto detector = subscribe(getFrequencyBands());
     detector->onTrebleLevel.add(callback);
 }
 
 void Processor::onFrequencyBands(function<void(float, float, float)> callback) {
-    auto detector = getFrequencyBands();
+    auto detector = subscribe(getFrequencyBands());
     detector->onLevelsUpdate.add(callback);
 }
 
 void Processor::onEqualizer(function<void(const detector::Equalizer&)> callback) {
-    auto detector = getEqualizerDetector();
+    auto detector = subscribe(getEqualizerDetector());
     detector->onEqualizer.add(callback);
 }
 
 void Processor::onEnergy(function<void(float)> callback) {
-    auto detector = getEnergyAnalyzer();
+    auto detector = subscribe(getEnergyAnalyzer());
     detector->onEnergy.add(callback);
 }
 
 void Processor::onNormalizedEnergy(function<void(float)> callback) {
-    auto detector = getEnergyAnalyzer();
+    auto detector = subscribe(getEnergyAnalyzer());
     detector->onNormalizedEnergy.add(callback);
 }
 
 void Processor::onPeak(function<void(float)> callback) {
-    auto detector = getEnergyAnalyzer();
+    auto detector = subscribe(getEnergyAnalyzer());
     detector->onPeak.add(callback);
 }
 
 void Processor::onAverageEnergy(function<void(float)> callback) {
-    auto detector = getEnergyAnalyzer();
+    auto detector = subscribe(getEnergyAnalyzer());
     detector->onAverageEnergy.add(callback);
 }
 
 void Processor::onTransient(function<void()> callback) {
-    auto detector = getTransientDetector();
+    auto detector = subscribe(getTransientDetector());
     detector->onTransient.add(callback);
 }
 
 void Processor::onTransientWithStrength(function<void(float)> callback) {
-    auto detector = getTransientDetector();
+    auto detector = subscribe(getTransientDetector());
     detector->onTransientWithStrength.add(callback);
 }
 
 void Processor::onAttack(function<void(float)> callback) {
-    auto detector = getTransientDetector();
+    auto detector = subscribe(getTransientDetector());
     detector->onAttack.add(callback);
 }
 
 void Processor::onSilence(function<void(u8)> callback) {
-    auto detector = getSilenceDetector();
+    auto detector = subscribe(getSilenceDetector());
     detector->onSilence.add(callback);
 }
 
 void Processor::onSilenceStart(function<void()> callback) {
-    auto detector = getSilenceDetector();
+    auto detector = subscribe(getSilenceDetector());
     detector->onSilenceStart.add(callback);
 }
 
 void Processor::onSilenceEnd(function<void()> callback) {
-    auto detector = getSilenceDetector();
+    auto detector = subscribe(getSilenceDetector());
     detector->onSilenceEnd.add(callback);
 }
 
 void Processor::onSilenceDuration(function<void(u32)> callback) {
-    auto detector = getSilenceDetector();
+    auto detector = subscribe(getSilenceDetector());
     detector->onSilenceDuration.add(callback);
 }
 
 void Processor::onCrescendo(function<void()> callback) {
-    auto detector = getDynamicsAnalyzer();
+    auto detector = subscribe(getDynamicsAnalyzer());
     detector->onCrescendo.add(callback);
 }
 
 void Processor::onDiminuendo(function<void()> callback) {
-    auto detector = getDynamicsAnalyzer();
+    auto detector = subscribe(getDynamicsAnalyzer());
     detector->onDiminuendo.add(callback);
 }
 
 void Processor::onDynamicTrend(function<void(float)> callback) {
-    auto detector = getDynamicsAnalyzer();
+    auto detector = subscribe(getDynamicsAnalyzer());
     detector->onDynamicTrend.add(callback);
 }
 
 void Processor::onCompressionRatio(function<void(float)> callback) {
-    auto detector = getDynamicsAnalyzer();
+    auto detector = subscribe(getDynamicsAnalyzer());
     detector->onCompressionRatio.add(callback);
 }
 
 void Processor::onPitch(function<void(float)> callback) {
-    auto detector = getPitchDetector();
+    auto detector = subscribe(getPitchDetector());
     detector->onPitch.add(callback);
 }
 
 void Processor::onPitchWithConfidence(function<void(float, float)> callback) {
-    auto detector = getPitchDetector();
+    auto detector = subscribe(getPitchDetector());
     detector->onPitchWithConfidence.add(callback);
 }
 
 void Processor::onPitchChange(function<void(float)> callback) {
-    auto detector = getPitchDetector();
+    auto detector = subscribe(getPitchDetector());
     detector->onPitchChange.add(callback);
 }
 
 void Processor::onVoiced(function<void(u8)> callback) {
-    auto detector = getPitchDetector();
+    auto detector = subscribe(getPitchDetector());
     detector->onVoiced.add(callback);
 }
 
 void Processor::onNoteOn(function<void(u8, u8)> callback) {
-    auto detector = getNoteDetector();
+    auto detector = subscribe(getNoteDetector());
     detector->onNoteOn.add(callback);
 }
 
 void Processor::onNoteOff(function<void(u8)> callback) {
-    auto detector = getNoteDetector();
+    auto detector = subscribe(getNoteDetector());
     detector->onNoteOff.add(callback);
 }
 
 void Processor::onNoteChange(function<void(u8, u8)> callback) {
-    auto detector = getNoteDetector();
+    auto detector = subscribe(getNoteDetector());
     detector->onNoteChange.add(callback);
 }
 
 void Processor::onDownbeat(function<void()> callback) {
-    auto detector = getDownbeatDetector();
+    auto detector = subscribe(getDownbeatDetector());
     detector->onDownbeat.add(callback);
 }
 
 void Processor::onMeasureBeat(function<void(u8)> callback) {
-    auto detector = getDownbeatDetector();
+    auto detector = subscribe(getDownbeatDetector());
     detector->onMeasureBeat.add(callback);
 }
 
 void Processor::onMeterChange(function<void(u8)> callback) {
-    auto detector = getDownbeatDetector();
+    auto detector = subscribe(getDownbeatDetector());
     detector->onMeterChange.add(callback);
 }
 
 void Processor::onMeasurePhase(function<void(float)> callback) {
-    auto detector = getDownbeatDetector();
+    auto detector = subscribe(getDownbeatDetector());
     detector->onMeasurePhase.add(callback);
 }
 
 void Processor::onBackbeat(function<void(u8 beatNumber, float confidence, float strength)> callback) {
-    auto detector = getBackbeatDetector();
+    auto detector = subscribe(getBackbeatDetector());
     detector->onBackbeat.add(callback);
 }
 
 void Processor::onVocal(function<void(u8)> callback) {
-    auto detector = getVocalDetector();
+    auto detector = subscribe(getVocalDetector());
     detector->onVocal.add(callback);
 }
 
 void Processor::onVocalStart(function<void()> callback) {
-    auto detector = getVocalDetector();
+    auto detector = subscribe(getVocalDetector());
     detector->onVocalStart.add(callback);
 }
 
 void Processor::onVocalEnd(function<void()> callback) {
-    auto detector = getVocalDetector();
+    auto detector = subscribe(getVocalDetector());
     detector->onVocalEnd.add(callback);
 }
 
 void Processor::onVocalConfidence(function<void(float)> callback) {
-    auto detector = getVocalDetector();
+    auto detector = subscribe(getVocalDetector());
     // This callback fires every frame with the current confidence
     // We need to wrap it since detector::Vocal doesn't have this callback built-in
     detector->onVocal.add([callback, detector](u8) {
@@ -322,132 +438,132 @@ void Processor::onVocalConfidence(function<void(float)> callback) {
 }
 
 void Processor::onPercussion(function<void(detector::PercussionType)> callback) {
-    auto detector = getPercussionDetector();
+    auto detector = subscribe(getPercussionDetector());
     detector->onPercussionHit.add(callback);
 }
 
 void Processor::onKick(function<void()> callback) {
-    auto detector = getPercussionDetector();
+    auto detector = subscribe(getPercussionDetector());
     detector->onKick.add(callback);
 }
 
 void Processor::onSnare(function<void()> callback) {
-    auto detector = getPercussionDetector();
+    auto detector = subscribe(getPercussionDetector());
     detector->onSnare.add(callback);
 }
 
 void Processor::onHiHat(function<void()> callback) {
-    auto detector = getPercussionDetector();
+    auto detector = subscribe(getPercussionDetector());
     detector->onHiHat.add(callback);
 }
 
 void Processor::onTom(function<void()> callback) {
-    auto detector = getPercussionDetector();
+    auto detector = subscribe(getPercussionDetector());
     detector->onTom.add(callback);
 }
 
 void Processor::onChord(function<void(const detector::Chord&)> callback) {
-    auto detector = getChordDetector();
+    auto detector = subscribe(getChordDetector());
     detector->onChord.add(callback);
 }
 
 void Processor::onChordChange(function<void(const detector::Chord&)> callback) {
-    auto detector = getChordDetector();
+    auto detector = subscribe(getChordDetector());
     detector->onChordChange.add(callback);
 }
 
 void Processor::onChordEnd(function<void()> callback) {
-    auto detector = getChordDetector();
+    auto detector = subscribe(getChordDetector());
     detector->onChordEnd.add(callback);
 }
 
 void Processor::onKey(function<void(const detector::Key&)> callback) {
-    auto detector = getKeyDetector();
+    auto detector = subscribe(getKeyDetector());
     detector->onKey.add(callback);
 }
 
 void Processor::onKeyChange(function<void(const detector::Key&)> callback) {
-    auto detector = getKeyDetector();
+    auto detector = subscribe(getKeyDetector());
     detector->onKeyChange.add(callback);
 }
 
 void Processor::onKeyEnd(function<void()> callback) {
-    auto detector = getKeyDetector();
+    auto detector = subscribe(getKeyDetector());
     detector->onKeyEnd.add(callback);
 }
 
 void Processor::onMood(function<void(const detector::Mood&)> callback) {
-    auto detector = getMoodAnalyzer();
+    auto detector = subscribe(getMoodAnalyzer());
     detector->onMood.add(callback);
 }
 
 void Processor::onMoodChange(function<void(const detector::Mood&)> callback) {
-    auto detector = getMoodAnalyzer();
+    auto detector = subscribe(getMoodAnalyzer());
     detector->onMoodChange.add(callback);
 }
 
 void Processor::onValenceArousal(function<void(float, float)> callback) {
-    auto detector = getMoodAnalyzer();
+    auto detector = subscribe(getMoodAnalyzer());
     detector->onValenceArousal.add(callback);
 }
 
 void Processor::onBuildupStart(function<void()> callback) {
-    auto detector = getBuildupDetector();
+    auto detector = subscribe(getBuildupDetector());
     detector->onBuildupStart.add(callback);
 }
 
 void Processor::onBuildupProgress(function<void(float)> callback) {
-    auto detector = getBuildupDetector();
+    auto detector = subscribe(getBuildupDetector());
     detector->onBuildupProgress.add(callback);
 }
 
 void Processor::onBuildupPeak(function<void()> callback) {
-    auto detector = getBuildupDetector();
+    auto detector = subscribe(getBuildupDetector());
     detector->onBuildupPeak.add(callback);
 }
 
 void Processor::onBuildupEnd(function<void()> callback) {
-    auto detector = getBuildupDetector();
+    auto detector = subscribe(getBuildupDetector());
     detector->onBuildupEnd.add(callback);
 }
 
 void Processor::onBuildup(function<void(const detector::Buildup&)> callback) {
-    auto detector = getBuildupDetector();
+    auto detector = subscribe(getBuildupDetector());
     detector->onBuildup.add(callback);
 }
 
 void Processor::onDrop(function<void()> callback) {
-    auto detector = getDropDetector();
+    auto detector = subscribe(getDropDetector());
     detector->onDrop.add(callback);
 }
 
 void Processor::onDropEvent(function<void(const detector::Drop&)> callback) {
-    auto detector = getDropDetector();
+    auto detector = subscribe(getDropDetector());
     detector->onDropEvent.add(callback);
 }
 
 void Processor::onDropImpact(function<void(float)> callback) {
-    auto detector = getDropDetector();
+    auto detector = subscribe(getDropDetector());
     detector->onDropImpact.add(callback);
 }
 
 void Processor::onVibeLevels(function<void(const detector::VibeLevels&)> callback) {
-    auto detector = getVibeDetector();
+    auto detector = subscribe(getVibeDetector());
     detector->onVibeLevels.add(callback);
 }
 
 void Processor::onVibeBassSpike(function<void()> callback) {
-    auto detector = getVibeDetector();
+    auto detector = subscribe(getVibeDetector());
     detector->onBassSpike.add(callback);
 }
 
 void Processor::onVibeMidSpike(function<void()> callback) {
-    auto detector = getVibeDetector();
+    auto detector = subscribe(getVibeDetector());
     detector->onMidSpike.add(callback);
 }
 
 void Processor::onVibeTrebSpike(function<void()> callback) {
-    auto detector = getVibeDetector();
+    auto detector = subscribe(getVibeDetector());
     detector->onTrebSpike.add(callback);
 }
 
@@ -468,255 +584,255 @@ static float clampNeg1To1(float v) {
 }
 
 float Processor::getVocalConfidence() {
-    return clamp01(getVocalDetector()->getConfidence());
+    return clamp01(poll(getVocalDetector())->getConfidence());
 }
 
 float Processor::getBeatConfidence() {
-    return clamp01(getBeatDetector()->getConfidence());
+    return clamp01(poll(getBeatDetector())->getConfidence());
 }
 
 float Processor::getBPM() {
-    return getBeatDetector()->getBPM();
+    return poll(getBeatDetector())->getBPM();
 }
 
 float Processor::getEnergy() {
-    return clamp01(getEnergyAnalyzer()->getNormalizedRMS());
+    return clamp01(poll(getEnergyAnalyzer())->getNormalizedRMS());
 }
 
 float Processor::getPeakLevel() {
-    return clamp01(getEnergyAnalyzer()->getPeak());
+    return clamp01(poll(getEnergyAnalyzer())->getPeak());
 }
 
 float Processor::getBassLevel() {
-    return clamp01(getFrequencyBands()->getBassNorm());
+    return clamp01(poll(getFrequencyBands())->getBassNorm());
 }
 
 float Processor::getMidLevel() {
-    return clamp01(getFrequencyBands()->getMidNorm());
+    return clamp01(poll(getFrequencyBands())->getMidNorm());
 }
 
 float Processor::getTrebleLevel() {
-    return clamp01(getFrequencyBands()->getTrebleNorm());
+    return clamp01(poll(getFrequencyBands())->getTrebleNorm());
 }
 
 float Processor::getBassRaw() {
-    return getFrequencyBands()->getBass();
+    return poll(getFrequencyBands())->getBass();
 }
 
 float Processor::getMidRaw() {
-    return getFrequencyBands()->getMid();
+    return poll(getFrequencyBands())->getMid();
 }
 
 float Processor::getTrebleRaw() {
-    return getFrequencyBands()->getTreble();
+    return poll(getFrequencyBands())->getTreble();
 }
 
 bool Processor::isSilent() {
-    return getSilenceDetector()->isSilent();
+    return poll(getSilenceDetector())->isSilent();
 }
 
 u32 Processor::getSilenceDuration() {
-    return getSilenceDetector()->getSilenceDuration();
+    return poll(getSilenceDetector())->getSilenceDuration();
 }
 
 float Processor::getTransientStrength() {
-    return clamp01(getTransientDetector()->getStrength());
+    return clamp01(poll(getTransientDetector())->getStrength());
 }
 
 float Processor::getDynamicTrend() {
-    return clampNeg1To1(getDynamicsAnalyzer()->getDynamicTrend());
+    return clampNeg1To1(poll(getDynamicsAnalyzer())->getDynamicTrend());
 }
 
 bool Processor::isCrescendo() {
-    return getDynamicsAnalyzer()->isCrescendo();
+    return poll(getDynamicsAnalyzer())->isCrescendo();
 }
 
 bool Processor::isDiminuendo() {
-    return getDynamicsAnalyzer()->isDiminuendo();
+    return poll(getDynamicsAnalyzer())->isDiminuendo();
 }
 
 float Processor::getPitchConfidence() {
-    return clamp01(getPitchDetector()->getConfidence());
+    return clamp01(poll(getPitchDetector())->getConfidence());
 }
 
 float Processor::getPitch() {
-    return getPitchDetector()->getPitch();
+    return poll(getPitchDetector())->getPitch();
 }
 
 float Processor::getTempoConfidence() {
-    return clamp01(getTempoAnalyzer()->getConfidence());
+    return clamp01(poll(getTempoAnalyzer())->getConfidence());
 }
 
 float Processor::getTempoBPM() {
-    return getTempoAnalyzer()->getBPM();
+    return poll(getTempoAnalyzer())->getBPM();
 }
 
 float Processor::getBuildupIntensity() {
-    return clamp01(getBuildupDetector()->getIntensity());
+    return clamp01(poll(getBuildupDetector())->getIntensity());
 }
 
 float Processor::getBuildupProgress() {
-    return clamp01(getBuildupDetector()->getProgress());
+    return clamp01(poll(getBuildupDetector())->getProgress());
 }
 
 float Processor::getDropImpact() {
-    return clamp01(getDropDetector()->getLastDrop().impact);
+    return clamp01(poll(getDropDetector())->getLastDrop().impact);
 }
 
 bool Processor::isKick() {
-    return getPercussionDetector()->isKick();
+    return poll(getPercussionDetector())->isKick();
 }
 
 bool Processor::isSnare() {
-    return getPercussionDetector()->isSnare();
+    return poll(getPercussionDetector())->isSnare();
 }
 
 bool Processor::isHiHat() {
-    return getPercussionDetector()->isHiHat();
+    return poll(getPercussionDetector())->isHiHat();
 }
 
 bool Processor::isTom() {
-    return getPercussionDetector()->isTom();
+    return poll(getPercussionDetector())->isTom();
 }
 
 u8 Processor::getCurrentNote() {
-    return getNoteDetector()->getCurrentNote();
+    return poll(getNoteDetector())->getCurrentNote();
 }
 
 float Processor::getNoteVelocity() {
-    return getNoteDetector()->getLastVelocity() / 255.0f;
+    return poll(getNoteDetector())->getLastVelocity() / 255.0f;
 }
 
 float Processor::getNoteConfidence() {
-    return getNoteDetector()->isNoteActive() ? (getNoteDetector()->getLastVelocity() / 255.0f) : 0.0f;
+    return poll(getNoteDetector())->isNoteActive() ? (poll(getNoteDetector())->getLastVelocity() / 255.0f) : 0.0f;
 }
 
 float Processor::getDownbeatConfidence() {
-    return clamp01(getDownbeatDetector()->getConfidence());
+    return clamp01(poll(getDownbeatDetector())->getConfidence());
 }
 
 float Processor::getMeasurePhase() {
-    return clamp01(getDownbeatDetector()->getMeasurePhase());
+    return clamp01(poll(getDownbeatDetector())->getMeasurePhase());
 }
 
 u8 Processor::getCurrentBeatNumber() {
-    return getDownbeatDetector()->getCurrentBeat();
+    return poll(getDownbeatDetector())->getCurrentBeat();
 }
 
 float Processor::getBackbeatConfidence() {
-    return clamp01(getBackbeatDetector()->getConfidence());
+    return clamp01(poll(getBackbeatDetector())->getConfidence());
 }
 
 float Processor::getBackbeatStrength() {
-    return clamp01(getBackbeatDetector()->getStrength());
+    return clamp01(poll(getBackbeatDetector())->getStrength());
 }
 
 float Processor::getChordConfidence() {
-    return clamp01(getChordDetector()->getCurrentChord().confidence);
+    return clamp01(poll(getChordDetector())->getCurrentChord().confidence);
 }
 
 float Processor::getKeyConfidence() {
-    return clamp01(getKeyDetector()->getCurrentKey().confidence);
+    return clamp01(poll(getKeyDetector())->getCurrentKey().confidence);
 }
 
 float Processor::getMoodArousal() {
-    return clamp01(getMoodAnalyzer()->getArousal());
+    return clamp01(poll(getMoodAnalyzer())->getArousal());
 }
 
 float Processor::getMoodValence() {
-    return clampNeg1To1(getMoodAnalyzer()->getValence());
+    return clampNeg1To1(poll(getMoodAnalyzer())->getValence());
 }
 
 float Processor::getVibeBass() {
-    return getVibeDetector()->getBass();
+    return poll(getVibeDetector())->getBass();
 }
 
 float Processor::getVibeMid() {
-    return getVibeDetector()->getMid();
+    return poll(getVibeDetector())->getMid();
 }
 
 float Processor::getVibeTreb() {
-    return getVibeDetector()->getTreb();
+    return poll(getVibeDetector())->getTreb();
 }
 
 float Processor::getVibeVol() {
-    return getVibeDetector()->getVol();
+    return poll(getVibeDetector())->getVol();
 }
 
 float Processor::getVibeBassAtt() {
-    return getVibeDetector()->getBassAtt();
+    return poll(getVibeDetector())->getBassAtt();
 }
 
 float Processor::getVibeMidAtt() {
-    return getVibeDetector()->getMidAtt();
+    return poll(getVibeDetector())->getMidAtt();
 }
 
 float Processor::getVibeTrebAtt() {
-    return getVibeDetector()->getTrebAtt();
+    return poll(getVibeDetector())->getTrebAtt();
 }
 
 float Processor::getVibeVolAtt() {
-    return getVibeDetector()->getVolAtt();
+    return poll(getVibeDetector())->getVolAtt();
 }
 
 bool Processor::isVibeBassSpike() {
-    return getVibeDetector()->isBassSpike();
+    return poll(getVibeDetector())->isBassSpike();
 }
 
 bool Processor::isVibeMidSpike() {
-    return getVibeDetector()->isMidSpike();
+    return poll(getVibeDetector())->isMidSpike();
 }
 
 bool Processor::isVibeTrebSpike() {
-    return getVibeDetector()->isTrebSpike();
+    return poll(getVibeDetector())->isTrebSpike();
 }
 
 float Processor::getEqBass() {
-    return clamp01(getEqualizerDetector()->getBass());
+    return clamp01(poll(getEqualizerDetector())->getBass());
 }
 
 float Processor::getEqMid() {
-    return clamp01(getEqualizerDetector()->getMid());
+    return clamp01(poll(getEqualizerDetector())->getMid());
 }
 
 float Processor::getEqTreble() {
-    return clamp01(getEqualizerDetector()->getTreble());
+    return clamp01(poll(getEqualizerDetector())->getTreble());
 }
 
 float Processor::getEqVolume() {
-    return clamp01(getEqualizerDetector()->getVolume());
+    return clamp01(poll(getEqualizerDetector())->getVolume());
 }
 
 float Processor::getEqVolumeNormFactor() {
-    return clamp01(getEqualizerDetector()->getVolumeNormFactor());
+    return clamp01(poll(getEqualizerDetector())->getVolumeNormFactor());
 }
 
 float Processor::getEqZcf() {
-    return clamp01(getEqualizerDetector()->getZcf());
+    return clamp01(poll(getEqualizerDetector())->getZcf());
 }
 
 float Processor::getEqBin(int index) {
-    return clamp01(getEqualizerDetector()->getBin(index));
+    return clamp01(poll(getEqualizerDetector())->getBin(index));
 }
 
 float Processor::getEqAutoGain() {
-    return getEqualizerDetector()->getAutoGain();
+    return poll(getEqualizerDetector())->getAutoGain();
 }
 
 bool Processor::getEqIsSilence() {
-    return getEqualizerDetector()->getIsSilence();
+    return poll(getEqualizerDetector())->getIsSilence();
 }
 
 float Processor::getEqDominantFreqHz() {
-    return getEqualizerDetector()->getDominantFreqHz();
+    return poll(getEqualizerDetector())->getDominantFreqHz();
 }
 
 float Processor::getEqDominantMagnitude() {
-    return clamp01(getEqualizerDetector()->getDominantMagnitude());
+    return clamp01(poll(getEqualizerDetector())->getDominantMagnitude());
 }
 
 float Processor::getEqVolumeDb() {
-    return getEqualizerDetector()->getVolumeDb();
+    return poll(getEqualizerDetector())->getVolumeDb();
 }
 
 void Processor::setSampleRate(int sampleRate) {
@@ -724,8 +840,8 @@ void Processor::setSampleRate(int sampleRate) {
     mContext->setSampleRate(sampleRate);
 
     // Propagate to all active detector that are sample-rate-aware
-    for (auto& d : mActiveDetectors) {
-        d->setSampleRate(sampleRate);
+    for (auto& node : mDetectors) {
+        node.detector->setSampleRate(sampleRate);
     }
 }
 
@@ -733,6 +849,23 @@ int Processor::getSampleRate() const {
     return mSampleRate;
 }
 
+void Processor::setStftMode(fl::size windowSize, fl::size hopSize) {
+    StftConfig config;
+    config.windowSize = windowSize;
+    config.hopSize = hopSize;
+    setStftMode(config);
+}
+
+void Processor::setStftMode(const StftConfig& config) {
+    mStft.configure(config);
+}
+
+void Processor::disableStft() {
+    StftConfig off;
+    off.windowSize = 0;
+    mStft.configure(off);
+}
+
 void Processor::setGain(float gain) {
     mGain = gain;
 }
@@ -777,12 +910,13 @@ const Sample& Processor::getSample() const {
 void Processor::reset() {
     mSignalConditioner.reset();
     mNoiseFloorTracker.reset();
+    mStft.reset();
     mContext->clearCache();
 
-    for (auto& d : mActiveDetectors) {
-        d->reset();
+    for (auto& node : mDetectors) {
+        node.detector->reset();
     }
-    mActiveDetectors.clear();
+    mDetectors.clear();
 
     // Null out all typed pointers so re-registration works on next use
     mBeatDetector.reset();
@@ -876,7 +1010,7 @@ shared_ptr<detector::Note> Processor::getNoteDetector() {
         // Share the detector::Pitch instance between Processor and detector::Note
         auto pitchDetector = getPitchDetector();
         mNoteDetector = make_shared<detector::Note>(pitchDetector);
-        registerDetector(mNoteDetector);
+        registerDetector(mNoteDetector, {pitchDetector.get()});
     }
     return mNoteDetector;
 }
@@ -886,7 +1020,7 @@ shared_ptr<detector::Downbeat> Processor::getDownbeatDetector() {
         // Share the detector::Beat instance between Processor and detector::Downbeat
         auto beatDetector = getBeatDetector();
         mDownbeatDetector = make_shared<detector::Downbeat>(beatDetector);
-        registerDetector(mDownbeatDetector);
+        registerDetector(mDownbeatDetector, {beatDetector.get()});
     }
     return mDownbeatDetector;
 }
@@ -897,7 +1031,7 @@ shared_ptr<detector::Backbeat> Processor::getBackbeatDetector() {
         auto beatDetector = getBeatDetector();
         auto downbeatDetector = getDownbeatDetector();
         mBackbeatDetector = make_shared<detector::Backbeat>(beatDetector, downbeatDetector);
-        registerDetector(mBackbeatDetector);
+        registerDetector(mBackbeatDetector, {beatDetector.get(), downbeatDetector.get()});
     }
     return mBackbeatDetector;
 }
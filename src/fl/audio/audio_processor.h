@@ -10,8 +10,10 @@
 #include "fl/audio/mic_profiles.h"
 #include "fl/audio/signal_conditioner.h"
 #include "fl/audio/noise_floor_tracker.h"
+#include "fl/audio/stft_framer.h"
 #include "fl/stl/shared_ptr.h"
 #include "fl/stl/function.h"  // IWYU pragma: keep
+#include "fl/stl/initializer_list.h"
 #include "fl/stl/vector.h"
 #include "fl/task/task.h"
 #include "fl/stl/noexcept.h"
@@ -54,6 +56,27 @@ struct EqualizerConfig;
 class Vibe;
 } // namespace detector
 
+/// Per-detector update cost, collected while detector profiling is enabled.
+struct DetectorStats {
+    const char* name = "";
+    u32 updates = 0;       ///< update() calls measured
+    u32 totalMicros = 0;   ///< Sum of update() wall time
+    u32 maxMicros = 0;     ///< Slowest single update()
+    float averageMicros() const FL_NOEXCEPT {
+        return updates > 0 ? static_cast<float>(totalMicros) / static_cast<float>(updates) : 0.0f;
+    }
+};
+
+/// Processor owns a lazily-built detector graph. A detector is created when a
+/// callback is subscribed or a getter polls it; detectors it consumes are
+/// created with it and are always updated first. A detector runs only while
+/// it is live: it has a callback, was polled within the last
+/// kPollKeepAliveFrames frames, or feeds a live detector. A detector that
+/// stopped being polled is skipped until the next poll, which returns its
+/// last values and wakes it for the following frame. Features several
+/// detectors need (FFT bins, band energy, chroma) come from the shared
+/// Context, which computes each once per frame, so skipped detectors also
+/// skip the features only they consume.
 class Processor {
 public:
     Processor() FL_NOEXCEPT;
@@ -319,10 +342,41 @@ public:
     /// Configure equalizer detector tuning parameters
     void configureEqualizer(const detector::EqualizerConfig& config) FL_NOEXCEPT;
 
+    // ----- Short-Time (STFT) Analysis -----
+    /// Analyse overlapping windows instead of whole input buffers. Incoming
+    /// audio is conditioned as usual, then buffered in a ring; every hopSize
+    /// new samples the last windowSize samples are handed to the detectors as
+    /// one frame (and pushed into the Context FFT history). 1024/256 gives 4x
+    /// the temporal resolution of plain 1024-sample buffers while each FFT
+    /// still sees a full window. update() may then run the detectors zero or
+    /// several times per call. A windowSize of 0 disables STFT mode.
+    void setStftMode(fl::size windowSize, fl::size hopSize) FL_NOEXCEPT;
+    void setStftMode(const StftConfig& config) FL_NOEXCEPT;
+    void disableStft() FL_NOEXCEPT;
+    bool isStftEnabled() const FL_NOEXCEPT { return mStft.enabled(); }
+    const StftConfig& getStftConfig() const FL_NOEXCEPT { return mStft.config(); }
+
     /// Access signal conditioning statistics
     const SignalConditioner::Stats& getSignalConditionerStats() const FL_NOEXCEPT { return mSignalConditioner.getStats(); }
     const NoiseFloorTracker::Stats& getNoiseFloorStats() const FL_NOEXCEPT { return mNoiseFloorTracker.getStats(); }
 
+    // ----- Detector Instrumentation -----
+    /// Time each detector's update() with fl::micros(). Off by default: the
+    /// counters cost two clock reads per detector per frame.
+    void setDetectorProfiling(bool enabled) FL_NOEXCEPT { mProfileDetectors = enabled; }
+    bool isDetectorProfiling() const FL_NOEXCEPT { return mProfileDetectors; }
+    /// Stats for every created detector, in update order.
+    vector<DetectorStats> getDetectorStats() const FL_NOEXCEPT;
+    void resetDetectorStats() FL_NOEXCEPT;
+    /// Number of detectors that run each frame (live as of the last frame,
+    /// plus any created since).
+    fl::size getActiveDetectorCount() const FL_NOEXCEPT;
+    /// Number of detectors created so far, live or idle.
+    fl::size getDetectorCount() const FL_NOEXCEPT { return mDetectors.size(); }
+
+    /// Frames a polled detector keeps running after its last poll.
+    static constexpr u32 kPollKeepAliveFrames = 256;
+
     // ----- State Access -----
     shared_ptr<Context> getContext() const FL_NOEXCEPT { return mContext; }
     const Sample& getSample() const FL_NOEXCEPT;
@@ -337,10 +391,51 @@ private:
     SignalConditioner mSignalConditioner;
     NoiseFloorTracker mNoiseFloorTracker;
     shared_ptr<Context> mContext;
-
-    // Active detector registry for two-phase update loop
-    vector<shared_ptr<Detector>> mActiveDetectors;
-    void registerDetector(shared_ptr<Detector> detector) FL_NOEXCEPT;
+    StftFramer mStft;  // disabled until setStftMode()
+
+    // Run silence gating and both detector phases on one analysis frame.
+    // advance: new samples since the previous frame (0 = the frame size).
+    void analyzeFrame(const Sample& frame, fl::size advance) FL_NOEXCEPT;
+
+    // Detector graph for the two-phase update loop. A getter creates a
+    // detector's dependencies before registering it, so registration order
+    // is already a dependency order: nodes run front to back, and liveness
+    // propagates back to front.
+    struct DetectorNode {
+        shared_ptr<Detector> detector;
+        vector<fl::size> dependsOn;  // indices of earlier nodes
+        DetectorStats stats;
+        u32 callbacks = 0;           // subscriptions; kept until reset()
+        u32 lastPollFrame = 0;       // mFrame of the most recent poll
+        bool live = true;
+    };
+    vector<DetectorNode> mDetectors;
+    u32 mFrame = 0;
+    bool mProfileDetectors = false;
+    void registerDetector(shared_ptr<Detector> detector,
+                          fl::initializer_list<Detector*> dependsOn = {}) FL_NOEXCEPT;
+    DetectorNode* findNode(const Detector* detector) FL_NOEXCEPT;
+    void updateLiveness() FL_NOEXCEPT;
+    void runDetectors(const shared_ptr<Context>& context) FL_NOEXCEPT;
+
+    // Wrap the lazy getters: subscribe() counts a callback on the node,
+    // poll() stamps it with the current frame.
+    template <typename T>
+    shared_ptr<T> subscribe(shared_ptr<T> detector) FL_NOEXCEPT {
+        if (DetectorNode* node = findNode(detector.get())) {
+            ++node->callbacks;
+            node->live = true;
+        }
+        return detector;
+    }
+    template <typename T>
+    T* poll(const shared_ptr<T>& detector) FL_NOEXCEPT {
+        if (DetectorNode* node = findNode(detector.get())) {
+            node->lastPollFrame = mFrame;
+            node->live = true;
+        }
+        return detector.get();
+    }
 
     // Lazy detector storage
     shared_ptr<detector::Beat> mBeatDetector;
@@ -59,12 +59,13 @@ void ChordDetector::initializeTemplateMap() {
 }
 
 void ChordDetector::update(shared_ptr<Context> context) {
-    mRetainedFFT = context->getFFT(32);  // Higher resolution for pitch detection
-    const fft::Bins& fft = *mRetainedFFT;
     u32 timestamp = context->getTimestamp();
 
-    // Calculate chroma features
-    calculateChroma(fft);
+    // Chroma features (shared with KeyDetector, computed once per frame)
+    span<const float> chroma = context->getChroma();
+    for (int i = 0; i < 12; i++) {
+        mChroma[i] = chroma[i];
+    }
 
     // Detect current chord
     Chord detected = detectChord(mChroma, timestamp);
@@ -138,45 +139,6 @@ void ChordDetector::reset() {
     }
 }
 
-void ChordDetector::calculateChroma(const fft::Bins& fft) {
-    // Clear chroma
-    for (int i = 0; i < 12; i++) {
-        mChroma[i] = 0.0f;
-    }
-
-    // Map fft::FFT bins to pitch classes (chroma) using linearly-rebinned magnitudes.
-    // Linear bins give evenly-spaced frequency mapping: freq = fmin + bin * binWidth.
-    fl::span<const float> linearBins = fft.linear();
-    const fl::size numBins = linearBins.size();
-    const float fmin = fft.linearFmin();
-    const float fmax = fft.linearFmax();
-    const float linearBinWidth = (numBins > 0) ? (fmax - fmin) / static_cast<float>(numBins) : 1.0f;
-
-    for (fl::size binIdx = 0; binIdx < numBins; binIdx++) {
-        float magnitude = linearBins[binIdx];
-        if (magnitude < 1e-6f) continue;
-
-        // Calculate frequency for this linearly-spaced bin
-        float freq = fmin + (static_cast<float>(binIdx) + 0.5f) * linearBinWidth;
-
-        // Skip frequencies below 60Hz (too low for chord detection)
-        if (freq < 60.0f) continue;
-
-        // Convert frequency to MIDI note number (A4 = 440Hz = MIDI 69)
-        float midiNote = 69.0f + 12.0f * (fl::logf(freq / 440.0f) / fl::logf(2.0f));
-
-        // Get pitch class (0-11)
-        int pitchClass = static_cast<int>(midiNote + 0.5f) % 12;
-        if (pitchClass < 0) pitchClass += 12;
-
-        // Accumulate magnitude into chroma
-        mChroma[pitchClass] += magnitude;
-    }
-
-    // Normalize chroma
-    normalizeChroma(mChroma);
-}
-
 Chord ChordDetector::detectChord(const float* chroma, u32 timestamp) {
     float bestScore = 0.0f;
     int bestRoot = -1;
@@ -255,23 +217,6 @@ bool ChordDetector::isSimilarChord(const Chord& a, const Chord& b) {
     return false;
 }
 
-void ChordDetector::normalizeChroma(float* chroma) {
-    // Find max value
-    float maxVal = 0.0f;
-    for (int i = 0; i < 12; i++) {
-        if (chroma[i] > maxVal) {
-            maxVal = chroma[i];
-        }
-    }
-
-    // Normalize to 0-1 range
-    if (maxVal > 1e-6f) {
-        for (int i = 0; i < 12; i++) {
-            chroma[i] /= maxVal;
-        }
-    }
-}
-
 float ChordDetector::chromaDistance(const float* a, const float* b) {
     float dist = 0.0f;
     for (int i = 0; i < 12; i++) {
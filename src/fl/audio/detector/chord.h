@@ -93,17 +93,13 @@ private:
     // Maps ChordType (as int) to ChordTemplate pointer for fast template lookups
     flat_map<int, const ChordTemplate*> mTemplateMap;
 
-    shared_ptr<const fft::Bins> mRetainedFFT;
-
     // Detection methods
     void initializeTemplateMap();  // Pre-compute template lookups
-    void calculateChroma(const fft::Bins& fft);
     Chord detectChord(const float* chroma, u32 timestamp);
     float matchChordPattern(const float* chroma, int root, ChordType type);
     bool isSimilarChord(const Chord& a, const Chord& b);
 
     // Helper methods
-    void normalizeChroma(float* chroma);
     float chromaDistance(const float* a, const float* b);
 };
 
@@ -39,7 +39,7 @@ void EnergyAnalyzer::update(shared_ptr<Context> context) {
 
     // Compute normalized 0-1 RMS using adaptive range tracking.
     // AttackDecayFilter: instant attack (0.001s), slow decay (2.0s).
-    const float dt = computeAudioDt(context->getPCM().size(), context->getSampleRate());
+    const float dt = computeAudioDt(context->getFrameAdvance(), context->getSampleRate());
     float runningMax = mRunningMaxFilter.update(mCurrentRMS, dt);
     // Ensure running max doesn't decay below a minimum threshold
     if (runningMax < 1.0f) {
@@ -134,7 +134,7 @@ void EqualizerDetector::update(shared_ptr<Context> context) {
     span<const i16> pcm = context->getPCM();
     if (pcm.size() == 0) return;
 
-    const float dt = computeAudioDt(pcm.size(), mSampleRate);
+    const float dt = computeAudioDt(context->getFrameAdvance(), mSampleRate);
 
     // Use Context's cached fft::FFT (shared across detector)
     mRetainedFFT = context->getFFT(kNumBins, mConfig.minFreq, mConfig.maxFreq);
@@ -51,15 +51,13 @@ void FrequencyBands::update(shared_ptr<Context> context) {
     const fft::Bins& fftBins = *mRetainedFFT;
     sFrequencyBandsFFTCount++;  // Diagnostic counter (no private fft::FFT anymore)
 
-    span<const i16> pcm = context->getPCM();
-
     // Calculate energy for each band using fractional bin overlap
     float bassEnergy = calculateBandEnergy(fftBins, mBassMin, mBassMax, kFFTMinFreq, kFFTMaxFreq);
     float midEnergy = calculateBandEnergy(fftBins, mMidMin, mMidMax, kFFTMinFreq, kFFTMaxFreq);
     float trebleEnergy = calculateBandEnergy(fftBins, mTrebleMin, mTrebleMax, kFFTMinFreq, kFFTMaxFreq);
 
-    // Compute dt from actual audio buffer duration: pcmSize / sampleRate
-    const float dt = computeAudioDt(pcm.size(), mSampleRate);
+    // Compute dt from the audio this frame advanced: samples / sampleRate
+    const float dt = computeAudioDt(context->getFrameAdvance(), mSampleRate);
     mBass = mBassSmoother.update(bassEnergy, dt);
     mMid = mMidSmoother.update(midEnergy, dt);
     mTreble = mTrebleSmoother.update(trebleEnergy, dt);
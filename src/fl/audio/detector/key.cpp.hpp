@@ -116,15 +116,14 @@ void KeyDetector::initializeProfileStats() {
 }
 
 void KeyDetector::update(shared_ptr<Context> context) {
-    // Get fft::FFT data
-    mRetainedFFT = context->getFFT(32);  // Use more bins for better pitch resolution
-    const fft::Bins& fft = *mRetainedFFT;
     u32 timestamp = context->getTimestamp();
 
-    // Extract chroma features
+    // Chroma features (shared with ChordDetector, computed once per frame)
     float chroma[12] = {0};
-    extractChroma(fft, chroma);
-    normalizeChroma(chroma);
+    span<const float> frameChroma = context->getChroma();
+    for (int i = 0; i < 12; i++) {
+        chroma[i] = frameChroma[i];
+    }
 
     // Update temporal averaging
     updateChromaHistory(chroma);
@@ -203,64 +202,9 @@ void KeyDetector::reset() {
 }
 
 //------------------------------------------------------------------------------
-// Chroma extraction and processing
+// Chroma temporal averaging
 //------------------------------------------------------------------------------
 
-void KeyDetector::extractChroma(const fft::Bins& fft, float* chroma) {
-    // Initialize chroma to zero
-    for (int i = 0; i < 12; i++) {
-        chroma[i] = 0.0f;
-    }
-
-    // Map fft::FFT bins to pitch classes using linearly-rebinned magnitudes.
-    // Linear bins give evenly-spaced frequency mapping: freq = fmin + bin * binWidth.
-    fl::span<const float> linearBins = fft.linear();
-    const int numBins = static_cast<int>(linearBins.size());
-    const float fmin = fft.linearFmin();
-    const float fmax = fft.linearFmax();
-    const float linearBinWidth = (numBins > 0) ? (fmax - fmin) / static_cast<float>(numBins) : 1.0f;
-
-    // Process each linear bin
-    for (int bin = 0; bin < numBins; bin++) {
-        float magnitude = linearBins[bin];
-        if (magnitude < 1e-6f) continue;
-
-        // Calculate frequency for this linearly-spaced bin
-        float freq = fmin + (static_cast<float>(bin) + 0.5f) * linearBinWidth;
-
-        // Skip frequencies below 60 Hz (below C2)
-        if (freq < 60.0f) continue;
-
-        // Convert frequency to MIDI note number
-        // MIDI note = 69 + 12 * log2(freq / 440)
-        float midiNote = 69.0f + 12.0f * (fl::logf(freq / 440.0f) / fl::logf(2.0f));
-
-        // Get pitch class (0-11)
-        int pitchClass = static_cast<int>(midiNote + 0.5f) % 12;
-        if (pitchClass < 0) pitchClass += 12;
-
-        // Accumulate magnitude into pitch class
-        chroma[pitchClass] += magnitude;
-    }
-}
-
-void KeyDetector::normalizeChroma(float* chroma) {
-    // Find maximum value
-    float maxVal = 0.0f;
-    for (int i = 0; i < 12; i++) {
-        if (chroma[i] > maxVal) {
-            maxVal = chroma[i];
-        }
-    }
-
-    // Normalize to 0-1 range
-    if (maxVal > 1e-6f) {
-        for (int i = 0; i < 12; i++) {
-            chroma[i] /= maxVal;
-        }
-    }
-}
-
 void KeyDetector::updateChromaHistory(const float* chroma) {
     // Add current chroma to history (circular buffer)
     for (int i = 0; i < 12; i++) {
@@ -131,12 +131,8 @@ private:
     float mMinorProfileMean = 0.0f;
     float mMinorProfileStdDev = 0.0f;
 
-    shared_ptr<const fft::Bins> mRetainedFFT;
-
     // Helper methods
     void initializeProfileStats();  // Pre-compute profile statistics once
-    void extractChroma(const fft::Bins& fft, float* chroma);
-    void normalizeChroma(float* chroma);
     void updateChromaHistory(const float* chroma);
     void getAveragedChroma(float* chroma);
     Key detectKey(const float* chroma, u32 timestamp);
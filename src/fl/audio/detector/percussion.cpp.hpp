@@ -55,7 +55,7 @@ void Percussion::update(shared_ptr<Context> context) {
     for (fl::size i = 0; i < fft.raw().size(); ++i) {
         totalEnergy += fft.raw()[i];
     }
-    const float dt = computeAudioDt(context->getPCM().size(), context->getSampleRate());
+    const float dt = computeAudioDt(context->getFrameAdvance(), context->getSampleRate());
     float envValue = mTotalEnvelope.update(totalEnergy, dt);
     float flux = fl::max(0.0f, totalEnergy - envValue);
     mOnsetSharpness = (totalEnergy > 1e-6f) ? flux / totalEnergy : 0.0f;
@@ -35,7 +35,7 @@ void Pitch::update(shared_ptr<Context> context) {
     size numSamples = pcm.size();
 
     // Compute dt from actual audio buffer duration
-    mLastDt = computeAudioDt(pcm.size(), static_cast<int>(mSampleRate));
+    mLastDt = computeAudioDt(context->getFrameAdvance(), static_cast<int>(mSampleRate));
 
     // Need at least 2x max period for autocorrelation
     if (numSamples < static_cast<size>(mMaxPeriod * 2)) {
@@ -54,8 +54,6 @@ void Vibe::update(shared_ptr<Context> context) {
     BandEnergy energy = context->getBandEnergy();
     sVibeFFTCount++;
 
-    span<const i16> pcm = context->getPCM();
-
     // --- Step 2: Read bass/mid/treb directly ---
     mImm[0] = energy.bass;
     mImm[1] = energy.mid;
@@ -63,7 +61,7 @@ void Vibe::update(shared_ptr<Context> context) {
 
     // --- Step 3: Temporal blending (MilkDrop v2.25c algorithm) ---
     // Compute effective FPS from audio buffer duration
-    float dt = computeAudioDt(pcm.size(), mSampleRate);
+    float dt = computeAudioDt(context->getFrameAdvance(), mSampleRate);
     float actualFps = (dt > 0.0f) ? (1.0f / dt) : mTargetFps;
 
     if (mFrameCount == 1) {
@@ -48,7 +48,7 @@ void Vocal::update(shared_ptr<Context> context) {
 
     // Calculate time-domain features from raw PCM
     span<const i16> pcm = context->getPCM();
-    const float dt = computeAudioDt(pcm.size(), context->getSampleRate());
+    const float dt = computeAudioDt(context->getFrameAdvance(), context->getSampleRate());
     // Fused pass: envelope jitter + zero-crossing CV in one PCM traversal
     computePCMTimeDomainFeatures(pcm);
     mEnvelopeJitter = mEnvelopeJitterSmoother.update(mEnvelopeJitter, dt);
@@ -3,4 +3,5 @@
 /// Includes all implementation files in alphabetical order
 
 #include "fl/audio/fft/fft.cpp.hpp"
+#include "fl/audio/fft/fft_batch.cpp.hpp"
 #include "fl/audio/fft/fft_impl.cpp.hpp"
@@ -256,6 +256,49 @@ void FFT::run(const span<const fl::i16> &sample, Bins *out,
     impl->run(sample, out);
 }
 
+void FFT::runBatch(span<const span<const fl::i16>> samples,
+                   span<Bins *> outs, const Args &args) {
+    if (samples.empty()) {
+        return;
+    }
+    Args args2 = args;
+    args2.samples = samples[0].size();
+    fl::shared_ptr<Impl> impl = globalCache().get_or_create(args2);
+    impl->runBatch(samples, outs);
+}
+
+void FFT::runBatch(span<const Job> jobs) {
+    // Group jobs by configuration so each group costs one cache lookup and
+    // shares SIMD lanes. Batches are small, so a quadratic scan is fine.
+    fl::vector_inlined<fl::u8, 16> done;
+    done.resize(jobs.size());
+    fl::vector_inlined<span<const fl::i16>, 8> samples;
+    fl::vector_inlined<Bins *, 8> outs;
+    for (fl::size i = 0; i < jobs.size(); ++i) {
+        if (done[i]) {
+            continue;
+        }
+        Args key = jobs[i].args;
+        key.samples = jobs[i].samples.size();
+        samples.clear();
+        outs.clear();
+        for (fl::size j = i; j < jobs.size(); ++j) {
+            if (done[j]) {
+                continue;
+            }
+            Args other = jobs[j].args;
+            other.samples = jobs[j].samples.size();
+            if (other == key) {
+                samples.push_back(jobs[j].samples);
+                outs.push_back(jobs[j].out);
+                done[j] = 1;
+            }
+        }
+        fl::shared_ptr<Impl> impl = globalCache().get_or_create(key);
+        impl->runBatch(samples, outs);
+    }
+}
+
 void FFT::clear() { globalCache().clear(); }
 
 fl::size FFT::size() const { return globalCache().size(); }
@@ -168,6 +168,29 @@ class FFT {
     void run(const span<const i16> &sample, Bins *out,
              const Args &args = Args()) FL_NOEXCEPT;
 
+    // One analysis request for runBatch(). As with run(), samples.size()
+    // overrides args.samples.
+    struct Job {
+        span<const i16> samples;
+        Bins *out = nullptr;
+        Args args;
+
+        Job() FL_NOEXCEPT = default;
+        Job(span<const i16> samples, Bins *out, const Args &args = Args())
+            FL_NOEXCEPT : samples(samples), out(out), args(args) {}
+    };
+
+    // Transforms several buffers in one pass (stereo channels, overlapping
+    // hops). All buffers share one cached Impl — twiddles, window and CQ
+    // kernels — and are processed four at a time on SIMD lanes.
+    // samples[i] is written to outs[i].
+    void runBatch(span<const span<const i16>> samples, span<Bins *> outs,
+                  const Args &args = Args()) FL_NOEXCEPT;
+
+    // Mixed configurations: jobs with equal Args are grouped and batched
+    // together; output order follows the jobs.
+    void runBatch(span<const Job> jobs) FL_NOEXCEPT;
+
     void clear() FL_NOEXCEPT;
     fl::size size() const FL_NOEXCEPT;
 
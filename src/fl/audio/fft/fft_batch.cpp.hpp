@@ -0,0 +1,253 @@
+#include "fl/audio/fft/fft_batch.h"
+#include "fl/math/math.h"
+#include "fl/math/simd/f32x4.h"
+#include "fl/stl/noexcept.h"
+#include "fl/stl/singleton.h"
+
+namespace fl {
+namespace audio {
+namespace fft {
+
+namespace {
+
+using fl::simd::simd_f32x4;
+using fl::simd::add_f32_4;
+using fl::simd::sub_f32_4;
+using fl::simd::mul_f32_4;
+using fl::simd::set1_f32_4;
+using fl::simd::load_f32_4;
+using fl::simd::store_f32_4;
+
+// (ar + i*ai) * (c - i*s), i.e. multiplication by the forward twiddle
+// W^k = exp(-2*pi*i*k/N) given c = cos, s = sin.
+inline void batchTwiddleMul(simd_f32x4 ar, simd_f32x4 ai, simd_f32x4 c,
+                            simd_f32x4 s, simd_f32x4 &outR,
+                            simd_f32x4 &outI) FL_NOEXCEPT {
+    outR = add_f32_4(mul_f32_4(ar, c), mul_f32_4(ai, s));
+    outI = sub_f32_4(mul_f32_4(ai, c), mul_f32_4(ar, s));
+}
+
+inline kiss_fft_scalar batchToScalar(float v) FL_NOEXCEPT {
+#ifdef FIXED_POINT
+    float r = (v >= 0.0f) ? v + 0.5f : v - 0.5f;
+    if (r > 32767.0f) return 32767;
+    if (r < -32768.0f) return -32768;
+    return static_cast<kiss_fft_scalar>(static_cast<i32>(r));
+#else
+    return static_cast<kiss_fft_scalar>(v);
+#endif
+}
+
+// Split complex work buffers, lane-interleaved: element k of lane l is at
+// [k * kLanes + l], so one load_f32_4 fetches element k of all lanes.
+struct BatchFftWork {
+    fl::vector<float> re;
+    fl::vector<float> im;
+};
+
+} // namespace
+
+bool BatchRealFFT::supports(int n) FL_NOEXCEPT {
+    return n >= 8 && n <= 32768 && (n & (n - 1)) == 0;
+}
+
+BatchRealFFT::BatchRealFFT(int n) FL_NOEXCEPT : mN(n), mHalf(n / 2) {
+    const int half = mHalf;
+    mCos.resize(half);
+    mSin.resize(half);
+    const double twoPiOverN = 2.0 * FL_M_PI / static_cast<double>(n);
+    for (int k = 0; k < half; ++k) {
+        const double th = twoPiOverN * static_cast<double>(k);
+        mCos[k] = static_cast<float>(fl::cos(th));
+        mSin[k] = static_cast<float>(fl::sin(th));
+    }
+
+    int bits = 0;
+    while ((1 << bits) < half) {
+        ++bits;
+    }
+    mBitRev.resize(half);
+    for (int k = 0; k < half; ++k) {
+        int r = 0;
+        for (int b = 0; b < bits; ++b) {
+            r |= ((k >> b) & 1) << (bits - 1 - b);
+        }
+        mBitRev[k] = static_cast<u16>(r);
+    }
+}
+
+void BatchRealFFT::forward(const kiss_fft_scalar *const *in,
+                           kiss_fft_cpx *const *out,
+                           int lanes) const FL_NOEXCEPT {
+    if (lanes <= 0) {
+        return;
+    }
+    if (lanes > kLanes) {
+        lanes = kLanes;
+    }
+    BatchFftWork &work = SingletonThreadLocal<BatchFftWork>::instance();
+    work.re.resize(mHalf * kLanes);
+    work.im.resize(mHalf * kLanes);
+    load(in, lanes, work.re.data(), work.im.data());
+    transform(work.re.data(), work.im.data());
+    unpack(work.re.data(), work.im.data(), out, lanes);
+}
+
+// Pack x[2k] + i*x[2k+1] into bit-reversed slot of each lane. Unused lanes
+// are zeroed so they cannot produce NaN/Inf that would slow the vector ops.
+void BatchRealFFT::load(const kiss_fft_scalar *const *in, int lanes,
+                        float *re, float *im) const FL_NOEXCEPT {
+    for (int k = 0; k < mHalf; ++k) {
+        const int dst = mBitRev[k] * kLanes;
+        int l = 0;
+        for (; l < lanes; ++l) {
+            re[dst + l] = static_cast<float>(in[l][2 * k]);
+            im[dst + l] = static_cast<float>(in[l][2 * k + 1]);
+        }
+        for (; l < kLanes; ++l) {
+            re[dst + l] = 0.0f;
+            im[dst + l] = 0.0f;
+        }
+    }
+}
+
+// In-place DIT complex FFT of size mHalf on bit-reversed input.
+//
+// Each radix-4 pass fuses two radix-2 stages (spans h and 2h) so the data
+// is swept once per two stages:
+//   t1 = a1*W(2h,j)   t3 = a3*W(2h,j)
+//   b0 = a0+t1  b1 = a0-t1  b2 = a2+t3  b3 = a2-t3
+//   u2 = b2*W(4h,j)   u3 = b3*W(4h,j)*(-i)
+//   a0 = b0+u2  a2 = b0-u2  a1 = b1+u3  a3 = b1-u3
+void BatchRealFFT::transform(float *re, float *im) const FL_NOEXCEPT {
+    const int half = mHalf;
+    int h = 1;
+
+    int log2Half = 0;
+    while ((1 << log2Half) < half) {
+        ++log2Half;
+    }
+    if (log2Half & 1) {
+        // Odd number of stages: one twiddle-free radix-2 pass first.
+        for (int i = 0; i < half; i += 2) {
+            float *r0 = re + i * kLanes;
+            float *i0 = im + i * kLanes;
+            simd_f32x4 ar = load_f32_4(r0);
+            simd_f32x4 ai = load_f32_4(i0);
+            simd_f32x4 br = load_f32_4(r0 + kLanes);
+            simd_f32x4 bi = load_f32_4(i0 + kLanes);
+            store_f32_4(r0, add_f32_4(ar, br));
+            store_f32_4(i0, add_f32_4(ai, bi));
+            store_f32_4(r0 + kLanes, sub_f32_4(ar, br));
+            store_f32_4(i0 + kLanes, sub_f32_4(ai, bi));
+        }
+        h = 2;
+    }
+
+    for (; h < half; h *= 4) {
+        // Table index stride for W(2h,j) and W(4h,j) on the W_N table.
+        const int stride1 = mN / (2 * h);
+        const int stride2 = mN / (4 * h);
+        for (int j = 0; j < h; ++j) {
+            const simd_f32x4 c1 = set1_f32_4(mCos[j * stride1]);
+            const simd_f32x4 s1 = set1_f32_4(mSin[j * stride1]);
+            const simd_f32x4 c2 = set1_f32_4(mCos[j * stride2]);
+            const simd_f32x4 s2 = set1_f32_4(mSin[j * stride2]);
+            for (int base = 0; base < half; base += 4 * h) {
+                const int i0 = (base + j) * kLanes;
+                const int i1 = i0 + h * kLanes;
+                const int i2 = i1 + h * kLanes;
+                const int i3 = i2 + h * kLanes;
+
+                simd_f32x4 a0r = load_f32_4(re + i0);
+                simd_f32x4 a0i = load_f32_4(im + i0);
+                simd_f32x4 t1r, t1i, t3r, t3i;
+                batchTwiddleMul(load_f32_4(re + i1), load_f32_4(im + i1),
+                                c1, s1, t1r, t1i);
+                simd_f32x4 a2r = load_f32_4(re + i2);
+                simd_f32x4 a2i = load_f32_4(im + i2);
+                batchTwiddleMul(load_f32_4(re + i3), load_f32_4(im + i3),
+                                c1, s1, t3r, t3i);
+
+                simd_f32x4 b0r = add_f32_4(a0r, t1r);
+                simd_f32x4 b0i = add_f32_4(a0i, t1i);
+                simd_f32x4 b1r = sub_f32_4(a0r, t1r);
+                simd_f32x4 b1i = sub_f32_4(a0i, t1i);
+                simd_f32x4 b2r = add_f32_4(a2r, t3r);
+                simd_f32x4 b2i = add_f32_4(a2i, t3i);
+                simd_f32x4 b3r = sub_f32_4(a2r, t3r);
+                simd_f32x4 b3i = sub_f32_4(a2i, t3i);
+
+                simd_f32x4 u2r, u2i, v3r, v3i;
+                batchTwiddleMul(b2r, b2i, c2, s2, u2r, u2i);
+                batchTwiddleMul(b3r, b3i, c2, s2, v3r, v3i);
+                // u3 = v3 * (-i) = (v3i, -v3r)
+
+                store_f32_4(re + i0, add_f32_4(b0r, u2r));
+                store_f32_4(im + i0, add_f32_4(b0i, u2i));
+                store_f32_4(re + i2, sub_f32_4(b0r, u2r));
+                store_f32_4(im + i2, sub_f32_4(b0i, u2i));
+                store_f32_4(re + i1, add_f32_4(b1r, v3i));
+                store_f32_4(im + i1, sub_f32_4(b1i, v3r));
+                store_f32_4(re + i3, sub_f32_4(b1r, v3i));
+                store_f32_4(im + i3, add_f32_4(b1i, v3r));
+            }
+        }
+    }
+}
+
+// Half-spectrum reconstruction, see espDspRealForward() in fft_backend.h
+// for the derivation:
+//   X[k].r = 1/2 * ((Y[k].r + Y[M-k].r) + c*b - s*a)
+//   X[k].i = 1/2 * ((Y[k].i - Y[M-k].i) - c*a - s*b)
+// with a = Y[k].r - Y[M-k].r, b = Y[k].i + Y[M-k].i.
+void BatchRealFFT::unpack(const float *re, const float *im,
+                          kiss_fft_cpx *const *out,
+                          int lanes) const FL_NOEXCEPT {
+    const int half = mHalf;
+#ifdef FIXED_POINT
+    // kiss' fixed-point core divides by the radix at every stage, so its
+    // real FFT comes out scaled by 1/N.
+    const float scale = 1.0f / static_cast<float>(mN);
+#else
+    const float scale = 1.0f;
+#endif
+    const simd_f32x4 halfScale = set1_f32_4(0.5f * scale);
+    float r4[kLanes];
+    float i4[kLanes];
+
+    for (int l = 0; l < lanes; ++l) {
+        const float y0r = re[l];
+        const float y0i = im[l];
+        out[l][0].r = batchToScalar((y0r + y0i) * scale);
+        out[l][0].i = 0;
+        out[l][half].r = batchToScalar((y0r - y0i) * scale);
+        out[l][half].i = 0;
+    }
+
+    for (int k = 1; k < half; ++k) {
+        const int kp = half - k;
+        simd_f32x4 ykr = load_f32_4(re + k * kLanes);
+        simd_f32x4 yki = load_f32_4(im + k * kLanes);
+        simd_f32x4 ykpr = load_f32_4(re + kp * kLanes);
+        simd_f32x4 ykpi = load_f32_4(im + kp * kLanes);
+        simd_f32x4 a = sub_f32_4(ykr, ykpr);
+        simd_f32x4 b = add_f32_4(yki, ykpi);
+        simd_f32x4 c = set1_f32_4(mCos[k]);
+        simd_f32x4 s = set1_f32_4(mSin[k]);
+        simd_f32x4 xr = add_f32_4(add_f32_4(ykr, ykpr),
+                                  sub_f32_4(mul_f32_4(c, b), mul_f32_4(s, a)));
+        simd_f32x4 xi = sub_f32_4(sub_f32_4(yki, ykpi),
+                                  add_f32_4(mul_f32_4(c, a), mul_f32_4(s, b)));
+        store_f32_4(r4, mul_f32_4(xr, halfScale));
+        store_f32_4(i4, mul_f32_4(xi, halfScale));
+        for (int l = 0; l < lanes; ++l) {
+            out[l][k].r = batchToScalar(r4[l]);
+            out[l][k].i = batchToScalar(i4[l]);
+        }
+    }
+}
+
+} // namespace fft
+} // namespace audio
+} // namespace fl
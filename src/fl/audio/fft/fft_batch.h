@@ -0,0 +1,70 @@
+#pragma once
+
+// fft_batch.h — four-lane real FFT for batched spectrum analysis
+//
+// Transforms up to four equally-sized real buffers (stereo channels,
+// overlapping hops, parallel analyzers) in one pass. Each fl::simd f32x4
+// lane carries one buffer, so every butterfly, twiddle multiply and unpack
+// step is issued once for all four inputs, and a single twiddle table is
+// shared by all of them.
+//
+// Algorithm: the N real samples of each lane are packed as N/2 complex
+// values (same trick as the ESP-DSP backend in fft_backend.h), transformed
+// with an in-place decimation-in-time FFT built from radix-4 butterflies
+// (a leading radix-2 pass when log2(N/2) is odd), then unpacked to the
+// N/2+1-bin half spectrum.
+//
+// Output layout and scaling match kiss_fftr for the active
+// FASTLED_FFT_PRECISION: FIXED16 results are scaled by 1/N like the
+// fixed-point kiss core and agree with it to within rounding (kiss rounds
+// after every stage, this path rounds once at the end).
+
+#include "fl/stl/int.h"
+#include "fl/stl/noexcept.h"
+#include "fl/stl/vector.h"
+// IWYU pragma: begin_keep
+#include "third_party/cq_kernel/kiss_fftr.h"
+// IWYU pragma: end_keep
+
+namespace fl {
+namespace audio {
+namespace fft {
+
+class BatchRealFFT {
+  public:
+    static const int kLanes = 4;
+
+    // True if n is a power of two the batch plan can handle (8..32768).
+    static bool supports(int n) FL_NOEXCEPT;
+
+    // n: real FFT size. Must satisfy supports(n).
+    explicit BatchRealFFT(int n) FL_NOEXCEPT;
+
+    int size() const FL_NOEXCEPT { return mN; }
+
+    // Forward real FFT of `lanes` (1..kLanes) buffers of size() samples.
+    // out[i] receives size()/2 + 1 bins in kiss_fftr layout. The plan itself
+    // is immutable after construction; work buffers are thread-local, so one
+    // plan may be shared by several threads.
+    void forward(const kiss_fft_scalar *const *in, kiss_fft_cpx *const *out,
+                 int lanes) const FL_NOEXCEPT;
+
+  private:
+    void load(const kiss_fft_scalar *const *in, int lanes, float *re,
+              float *im) const FL_NOEXCEPT;
+    void transform(float *re, float *im) const FL_NOEXCEPT;
+    void unpack(const float *re, const float *im, kiss_fft_cpx *const *out,
+                int lanes) const FL_NOEXCEPT;
+
+    int mN;      // real FFT size
+    int mHalf;   // complex FFT size (mN / 2)
+    // cos/sin(2*pi*k/N) for k in [0, N/2). The complex stages index it with
+    // a stride (W_{N/2}^k == W_N^{2k}), the unpack step uses it directly.
+    fl::vector<float> mCos;
+    fl::vector<float> mSin;
+    fl::vector<u16> mBitRev;  // bit-reversal permutation of [0, N/2)
+};
+
+} // namespace fft
+} // namespace audio
+} // namespace fl
@@ -8,6 +8,7 @@
 #include "third_party/cq_kernel/cq_kernel.h"
 #include "third_party/cq_kernel/kiss_fftr.h"
 #include "fl/audio/fft/fft_backend.h"
+#include "fl/audio/fft/fft_batch.h"
 
 // IWYU pragma: end_keep
 #include "fl/stl/alloca.h"
@@ -24,6 +25,7 @@
 
 #include "fl/stl/cstring.h"
 #include "fl/stl/singleton.h"
+#include "fl/stl/mutex.h"
 #include "fl/stl/noexcept.h"
 
 #ifndef FL_AUDIO_SAMPLE_RATE
@@ -115,22 +117,21 @@ class Context {
     fl::size sampleSize() const { return mInputSamples; }
 
     void run(span<const i16> buffer, Bins *out) {
-        switch (mMode) {
-        case Mode::LOG_REBIN:
-            runLogRebin(buffer, out);
-            break;
-        case Mode::CQ_NAIVE:
-            runNaive(buffer, out);
-            break;
-        case Mode::CQ_OCTAVE:
-            runOctaveWise(buffer, out);
-            break;
-        case Mode::CQ_HYBRID:
-            runHybrid(buffer, out);
-            break;
-        case Mode::AUTO:
-            FL_WARN("Mode::AUTO should have been resolved");
-            break;
+        runLanes(&buffer, &out, 1);
+    }
+
+    // Buffers are processed kLanes at a time. Every stage of the selected
+    // mode (window, FFT, decimation, kernels) runs for the whole group before
+    // the next stage, so tables and CQ kernels are fetched once per group and
+    // the FFTs go through the four-lane SIMD plan.
+    void runBatch(span<const span<const i16>> buffers, span<Bins *> outs) {
+        const int n = static_cast<int>(buffers.size());
+        for (int i = 0; i < n; i += BatchRealFFT::kLanes) {
+            int lanes = n - i;
+            if (lanes > BatchRealFFT::kLanes) {
+                lanes = BatchRealFFT::kLanes;
+            }
+            runLanes(buffers.data() + i, outs.data() + i, lanes);
         }
     }
 
@@ -153,6 +154,35 @@ class Context {
     }
 
   private:
+    void runLanes(const span<const i16> *buffers, Bins *const *outs,
+                  int lanes) {
+        switch (mMode) {
+        case Mode::LOG_REBIN:
+            runLogRebin(buffers, outs, lanes);
+            break;
+        case Mode::CQ_NAIVE:
+            runNaive(buffers, outs, lanes);
+            break;
+        case Mode::CQ_OCTAVE:
+            runOctaveWise(buffers, outs, lanes);
+            break;
+        case Mode::CQ_HYBRID:
+            runHybrid(buffers, outs, lanes);
+            break;
+        case Mode::AUTO:
+            FL_WARN("Mode::AUTO should have been resolved");
+            break;
+        }
+    }
+
+    // Per-buffer state that has to survive across the stages of a batch.
+    struct LaneScratch {
+        fl::vector<kiss_fft_scalar> work;      // decimation state
+        fl::vector<kiss_fft_scalar> windowed;  // FFT input
+        fl::vector<kiss_fft_cpx> fftOut;
+        fl::vector<u32> rawBinsI;
+    };
+
     // Thread-local scratch buffers to avoid stack overflow on ESP32 tasks
     // with limited stack (~4-8 KB). Buffers persist across calls and are
     // resized on demand.
@@ -160,15 +190,36 @@ class Context {
         fl::vector<kiss_fft_scalar> re;
         fl::vector<kiss_fft_scalar> im;
         fl::vector<u16> mag;
-        fl::vector<kiss_fft_scalar> windowed;
-        fl::vector<kiss_fft_cpx> fftOut;
-        fl::vector<u32> rawBinsI;
+        LaneScratch lanes[BatchRealFFT::kLanes];
     };
 
     static FftScratch &scratch() {
         return SingletonThreadLocal<FftScratch>::instance();
     }
 
+    // Forward real FFT of one input per lane. A single lane stays on the
+    // scalar backend, so run() is bit-identical to before batching existed;
+    // groups share the SIMD plan for size n, built on first use.
+    void forwardLanes(kiss_fftr_cfg cfg, fl::unique_ptr<BatchRealFFT> &plan,
+                      int n, const kiss_fft_scalar *const *in,
+                      kiss_fft_cpx *const *out, int lanes) {
+        if (lanes > 1 && BatchRealFFT::supports(n)) {
+            const BatchRealFFT *p = nullptr;
+            {
+                fl::lock_guard<fl::mutex> lock(mBatchMutex);
+                if (!plan) {
+                    plan = fl::make_unique<BatchRealFFT>(n);
+                }
+                p = plan.get();
+            }
+            p->forward(in, out, lanes);
+            return;
+        }
+        for (int l = 0; l < lanes; ++l) {
+            fl_fft_real_forward(cfg, n, in[l], out[l]);
+        }
+    }
+
     // ---- Log-rebin path (fast, no CQ kernels) ----
     //
     // Single 512-point FFT, then group the linear FFT bins into
@@ -234,8 +285,8 @@ class Context {
                                    0, mTotalBands);
     }
 
-    void runLogRebin(span<const i16> buffer, Bins *out) {
-        out->setParams(mFmin, mFmax, mSampleRate);
+    void runLogRebin(const span<const i16> *buffers, Bins *const *outs,
+                     int lanes) {
         const int N = mInputSamples;
         const int bands = mTotalBands;
         const int numRawBins = N / 2 + 1;
@@ -243,38 +294,53 @@ class Context {
         // Use thread-local scratch buffers to avoid stack overflow on
         // ESP32 tasks with limited stack (~4-8 KB).
         FftScratch &s = scratch();
-        s.windowed.resize(N);
-        s.fftOut.resize(N);
         s.re.resize(numRawBins);
         s.im.resize(numRawBins);
         s.mag.resize(numRawBins);
-        s.rawBinsI.resize(bands);
-
-        applyWindow(buffer.data(), mWindowBuf.data(), s.windowed.data(), N);
-        fl_fft_real_forward(mFftrCfg, mInputSamples, s.windowed.data(), s.fftOut.data());
-
-        // Deinterleave AoS → SoA and batch-compute magnitudes
-        deinterleave(s.fftOut.data(), s.re.data(), s.im.data(), numRawBins);
-        batchMag(s.re.data(), s.im.data(), s.mag.data(), numRawBins);
 
-        // Linear bins (same as other paths)
-        computeLinearBins(s.mag.data(), N, out);
-
-        // Group FFT bins into log-spaced output bins (integer accumulation)
-        fl::memset(s.rawBinsI.data(), 0, sizeof(u32) * bands);
-        logRebinRange(s.mag.data(), N, static_cast<float>(mSampleRate),
-                      0, bands, s.rawBinsI.data(), mLogBinLut);
-
-        // Store raw magnitudes (dB computed lazily by Bins::db())
-        fl::vector<float> &rawBins = out->raw_mut();
-        rawBins.resize(bands);
-        for (int i = 0; i < bands; ++i) {
-            rawBins[i] = static_cast<float>(s.rawBinsI[i]);
+        const kiss_fft_scalar *in[BatchRealFFT::kLanes];
+        kiss_fft_cpx *fft[BatchRealFFT::kLanes];
+        for (int l = 0; l < lanes; ++l) {
+            LaneScratch &ls = s.lanes[l];
+            ls.windowed.resize(N);
+            ls.fftOut.resize(N);
+            applyWindow(buffers[l].data(), mWindowBuf.data(),
+                        ls.windowed.data(), N);
+            in[l] = ls.windowed.data();
+            fft[l] = ls.fftOut.data();
         }
+        forwardLanes(mFftrCfg, mBatchFft, N, in, fft, lanes);
+
+        for (int l = 0; l < lanes; ++l) {
+            Bins *out = outs[l];
+            fl::vector<u32> &rawBinsI = s.lanes[l].rawBinsI;
+            rawBinsI.resize(bands);
+            out->setParams(mFmin, mFmax, mSampleRate);
+
+            // Deinterleave AoS → SoA and batch-compute magnitudes
+            deinterleave(fft[l], s.re.data(), s.im.data(), numRawBins);
+            batchMag(s.re.data(), s.im.data(), s.mag.data(), numRawBins);
+
+            // Linear bins (same as other paths)
+            computeLinearBins(s.mag.data(), N, out);
+
+            // Group FFT bins into log-spaced output bins (integer accumulation)
+            fl::memset(rawBinsI.data(), 0, sizeof(u32) * bands);
+            logRebinRange(s.mag.data(), N, static_cast<float>(mSampleRate),
+                          0, bands, rawBinsI.data(), mLogBinLut);
+
+            // Store raw magnitudes (dB computed lazily by Bins::db())
+            fl::vector<float> &rawBins = out->raw_mut();
+            rawBins.resize(bands);
+            for (int i = 0; i < bands; ++i) {
+                rawBins[i] = static_cast<float>(rawBinsI[i]);
+            }
 
-        // Store bin-width normalization factors so consumers can optionally
-        // normalize (e.g. for equalization display). Raw output is unchanged.
-        out->setNormFactors(mLogBinNormFactors);
+            // Store bin-width normalization factors so consumers can
+            // optionally normalize (e.g. for equalization display). Raw
+            // output is unchanged.
+            out->setNormFactors(mLogBinNormFactors);
+        }
     }
 
     // ---- Naive single-FFT path (narrow frequency ranges) ----
@@ -292,41 +358,55 @@ class Context {
         // Adding time-domain Hanning would double-window and over-attenuate.
     }
 
-    void runNaive(span<const i16> buffer, Bins *out) {
-        out->setParams(mFmin, mFmax, mSampleRate);
+    void runNaive(const span<const i16> *buffers, Bins *const *outs,
+                  int lanes) {
         const int fftSize = mInputSamples;
         const int numRawBins = fftSize / 2 + 1;
 
         FftScratch &s = scratch();
-        s.fftOut.resize(fftSize);
         s.re.resize(numRawBins);
         s.im.resize(numRawBins);
         s.mag.resize(numRawBins);
 
-        fl_fft_real_forward(mFftrCfg, mInputSamples, buffer.data(), s.fftOut.data());
+        const kiss_fft_scalar *in[BatchRealFFT::kLanes];
+        kiss_fft_cpx *fft[BatchRealFFT::kLanes];
+        for (int l = 0; l < lanes; ++l) {
+            LaneScratch &ls = s.lanes[l];
+            ls.fftOut.resize(fftSize);
+            in[l] = buffers[l].data();
+            fft[l] = ls.fftOut.data();
+        }
+        forwardLanes(mFftrCfg, mBatchFft, fftSize, in, fft, lanes);
 
-        // Deinterleave AoS → SoA and batch-compute magnitudes
-        deinterleave(s.fftOut.data(), s.re.data(), s.im.data(), numRawBins);
-        batchMag(s.re.data(), s.im.data(), s.mag.data(), numRawBins);
+        FASTLED_STACK_ARRAY(kiss_fft_cpx, cq, mCqCfg.bands);
+        const int bands = mCqCfg.bands;
+        for (int l = 0; l < lanes; ++l) {
+            Bins *out = outs[l];
+            out->setParams(mFmin, mFmax, mSampleRate);
 
-        computeLinearBins(s.mag.data(), fftSize, out);
+            // Deinterleave AoS → SoA and batch-compute magnitudes
+            deinterleave(fft[l], s.re.data(), s.im.data(), numRawBins);
+            batchMag(s.re.data(), s.im.data(), s.mag.data(), numRawBins);
 
-        FASTLED_STACK_ARRAY(kiss_fft_cpx, cq, mCqCfg.bands);
-        apply_kernels(s.fftOut.data(), cq, mKernels, mCqCfg);
+            computeLinearBins(s.mag.data(), fftSize, out);
 
-        const int bands = mCqCfg.bands;
-        fl::vector<float> &rawBins = out->raw_mut();
-        rawBins.resize(bands);
-        for (int i = 0; i < bands; ++i) {
-            i32 real = cq[i].r;
-            i32 imag = cq[i].i;
+            // apply_kernels accumulates, so each lane starts from zero.
+            fl::memset(cq, 0, sizeof(kiss_fft_cpx) * bands);
+            apply_kernels(fft[l], cq, mKernels, mCqCfg);
+
+            fl::vector<float> &rawBins = out->raw_mut();
+            rawBins.resize(bands);
+            for (int i = 0; i < bands; ++i) {
+                i32 real = cq[i].r;
+                i32 imag = cq[i].i;
 #ifdef FIXED_POINT
-            rawBins[i] = static_cast<float>(fastMag(real, imag));
+                rawBins[i] = static_cast<float>(fastMag(real, imag));
 #else
-            float r2 = float(real * real);
-            float i2 = float(imag * imag);
-            rawBins[i] = sqrt(r2 + i2);
+                float r2 = float(real * real);
+                float i2 = float(imag * imag);
+                rawBins[i] = sqrt(r2 + i2);
 #endif
+            }
         }
     }
 
@@ -648,47 +728,58 @@ class Context {
             oi.kernels = generate_kernels(oi.cfg);
         }
 
-        // Pre-allocate reusable buffers
-        mWorkBuf.resize(samples);
-        mFftOut.resize(samples);
-
         buildLinearBinLut(mLinearBinLut, samples);
         // Note: CQ kernels already apply Hamming windowing in frequency domain.
         // Adding time-domain Hanning would double-window and over-attenuate.
     }
 
-    void runOctaveWise(span<const i16> buffer, Bins *out) {
+    void runOctaveWise(const span<const i16> *buffers, Bins *const *outs,
+                       int lanes) {
         const int N = mInputSamples;
         const int numOctaves = static_cast<int>(mOctaves.size());
         const int numRawBins = N / 2 + 1;
 
-        out->setParams(mFmin, mFmax, mSampleRate);
+        FftScratch &s = scratch();
+        s.re.resize(numRawBins);
+        s.im.resize(numRawBins);
+        s.mag.resize(numRawBins);
 
         // Copy input to working buffer
         int workLen = N;
-        for (int i = 0; i < N; i++) {
-            mWorkBuf[i] =
-                (i < static_cast<int>(buffer.size())) ? buffer[i] : 0;
+        const kiss_fft_scalar *in[BatchRealFFT::kLanes];
+        kiss_fft_cpx *fft[BatchRealFFT::kLanes];
+        for (int l = 0; l < lanes; ++l) {
+            LaneScratch &ls = s.lanes[l];
+            ls.work.resize(N);
+            ls.fftOut.resize(N);
+            const span<const i16> &buffer = buffers[l];
+            for (int i = 0; i < N; i++) {
+                ls.work[i] =
+                    (i < static_cast<int>(buffer.size())) ? buffer[i] : 0;
+            }
+            in[l] = ls.work.data();
+            fft[l] = ls.fftOut.data();
         }
 
         // FFT at full sample rate (for linear bins + top octave CQ)
-        fl_fft_real_forward(mFftrCfg, mInputSamples, mWorkBuf.data(), mFftOut.data());
+        forwardLanes(mFftrCfg, mBatchFft, N, in, fft, lanes);
 
-        // Deinterleave AoS → SoA and batch-compute magnitudes
-        FftScratch &s = scratch();
-        s.re.resize(numRawBins);
-        s.im.resize(numRawBins);
-        s.mag.resize(numRawBins);
-        deinterleave(mFftOut.data(), s.re.data(), s.im.data(), numRawBins);
-        batchMag(s.re.data(), s.im.data(), s.mag.data(), numRawBins);
+        for (int l = 0; l < lanes; ++l) {
+            Bins *out = outs[l];
+            out->setParams(mFmin, mFmax, mSampleRate);
 
-        computeLinearBins(s.mag.data(), N, out);
+            // Deinterleave AoS → SoA and batch-compute magnitudes
+            deinterleave(fft[l], s.re.data(), s.im.data(), numRawBins);
+            batchMag(s.re.data(), s.im.data(), s.mag.data(), numRawBins);
 
-        // Prepare CQ output bins
-        fl::vector<float> &rawBins = out->raw_mut();
-        rawBins.resize(mTotalBands);
-        for (int i = 0; i < mTotalBands; i++) {
-            rawBins[i] = 0.0f;
+            computeLinearBins(s.mag.data(), N, out);
+
+            // Prepare CQ output bins
+            fl::vector<float> &rawBins = out->raw_mut();
+            rawBins.resize(mTotalBands);
+            for (int i = 0; i < mTotalBands; i++) {
+                rawBins[i] = 0.0f;
+            }
         }
 
         // Pre-allocate CQ accumulator once (avoids alloca in loop)
@@ -696,36 +787,44 @@ class Context {
 
         // Process octaves from top (highest freq) to bottom (lowest freq).
         // Top octave uses the FFT already computed above.
-        // Each lower octave: decimate signal by 2x, then FFT + CQ.
+        // Each lower octave: decimate signal by 2x, then FFT + CQ. With
+        // several lanes, each octave's kernels are applied to every lane
+        // while they are still hot in cache.
         for (int oct = numOctaves - 1; oct >= 0; oct--) {
             const OctaveInfo &oi = mOctaves[oct];
             if (oi.numBins <= 0 || !oi.kernels)
                 continue;
 
             if (oct != numOctaves - 1) {
-                decimateBy2(mWorkBuf.data(), workLen);
+                for (int l = 0; l < lanes; ++l) {
+                    kiss_fft_scalar *work = s.lanes[l].work.data();
+                    decimateBy2(work, workLen);
+                    // Zero-pad remainder so FFT sees clean input
+                    for (int i = workLen / 2; i < N; i++)
+                        work[i] = 0;
+                }
                 workLen = workLen / 2;
-                // Zero-pad remainder so FFT sees clean input
-                for (int i = workLen; i < N; i++)
-                    mWorkBuf[i] = 0;
-                fl_fft_real_forward(mFftrCfg, mInputSamples, mWorkBuf.data(), mFftOut.data());
+                forwardLanes(mFftrCfg, mBatchFft, N, in, fft, lanes);
             }
 
-            // Zero the CQ accumulator and apply kernels
-            fl::memset(cq, 0, sizeof(kiss_fft_cpx) * oi.numBins);
-            apply_kernels(mFftOut.data(), cq, oi.kernels, oi.cfg);
+            for (int l = 0; l < lanes; ++l) {
+                // Zero the CQ accumulator and apply kernels
+                fl::memset(cq, 0, sizeof(kiss_fft_cpx) * oi.numBins);
+                apply_kernels(fft[l], cq, oi.kernels, oi.cfg);
 
-            for (int i = 0; i < oi.numBins; i++) {
-                int binIdx = oi.firstBin + i;
-                i32 real = cq[i].r;
-                i32 imag = cq[i].i;
+                fl::vector<float> &rawBins = outs[l]->raw_mut();
+                for (int i = 0; i < oi.numBins; i++) {
+                    int binIdx = oi.firstBin + i;
+                    i32 real = cq[i].r;
+                    i32 imag = cq[i].i;
 #ifdef FIXED_POINT
-                rawBins[binIdx] = static_cast<float>(fastMag(real, imag));
+                    rawBins[binIdx] = static_cast<float>(fastMag(real, imag));
 #else
-                float r2 = float(real * real);
-                float i2 = float(imag * imag);
-                rawBins[binIdx] = sqrt(r2 + i2);
+                    float r2 = float(real * real);
+                    float i2 = float(imag * imag);
+                    rawBins[binIdx] = sqrt(r2 + i2);
 #endif
+                }
             }
         }
     }
@@ -811,7 +910,6 @@ class Context {
         mHybridMidN = samples / 4;
         mHybridMidFs = static_cast<float>(sr) / 4.0f;
         mHybridMidFft = kiss_fftr_alloc(mHybridMidN * 2, 0, nullptr, nullptr);
-        mHybridMidFftOut.resize(mHybridMidN * 2);
         computeWindow(mHybridMidWindow, mHybridMidN, mWindow);
 
         // Bass-tier: 3 decimation steps → samples/8 at sr/8
@@ -819,13 +917,8 @@ class Context {
         mHybridSmallFs = static_cast<float>(sr) / 8.0f;
         mHybridSmallFft =
             kiss_fftr_alloc(mHybridSmallN, 0, nullptr, nullptr);
-        mHybridSmallFftOut.resize(mHybridSmallN);
         computeWindow(mHybridBassWindow, mHybridSmallN, mWindow);
 
-        // Work buffer for decimation (reused across phases)
-        mWorkBuf.resize(samples);
-        mFftOut.resize(samples);
-
         // Pre-computed bin mapping LUTs for each tier
         buildLogBinLut(mLogBinLut, samples,
                        static_cast<float>(sr),
@@ -864,102 +957,137 @@ class Context {
         }
     }
 
-    void runHybrid(span<const i16> buffer, Bins *out) {
+    void runHybrid(const span<const i16> *buffers, Bins *const *outs,
+                   int lanes) {
         const int N = mInputSamples;
         const int numRawBins = N / 2 + 1;
 
-        out->setParams(mFmin, mFmax, mSampleRate);
-
         // Use thread-local scratch buffers
         FftScratch &s = scratch();
         s.re.resize(numRawBins);
         s.im.resize(numRawBins);
         s.mag.resize(numRawBins);
-        s.windowed.resize(N);
-        s.rawBinsI.resize(mTotalBands);
 
         // Phase 1: Windowed 512pt FFT → LOG_REBIN for upper bins
-        applyWindow(buffer.data(), mWindowBuf.data(), s.windowed.data(), N);
+        const kiss_fft_scalar *in[BatchRealFFT::kLanes];
+        kiss_fft_cpx *fft[BatchRealFFT::kLanes];
+        for (int l = 0; l < lanes; ++l) {
+            LaneScratch &ls = s.lanes[l];
+            ls.windowed.resize(N);
+            ls.fftOut.resize(N);
+            ls.rawBinsI.resize(mTotalBands);
+            applyWindow(buffers[l].data(), mWindowBuf.data(),
+                        ls.windowed.data(), N);
+            in[l] = ls.windowed.data();
+            fft[l] = ls.fftOut.data();
+        }
 
-        fl_fft_real_forward(mFftrCfg, mInputSamples, s.windowed.data(), mFftOut.data());
+        forwardLanes(mFftrCfg, mBatchFft, N, in, fft, lanes);
 
-        deinterleave(mFftOut.data(), s.re.data(), s.im.data(), numRawBins);
-        batchMag(s.re.data(), s.im.data(), s.mag.data(), numRawBins);
+        for (int l = 0; l < lanes; ++l) {
+            LaneScratch &ls = s.lanes[l];
+            Bins *out = outs[l];
+            out->setParams(mFmin, mFmax, mSampleRate);
 
-        computeLinearBins(s.mag.data(), N, out);
+            deinterleave(fft[l], s.re.data(), s.im.data(), numRawBins);
+            batchMag(s.re.data(), s.im.data(), s.mag.data(), numRawBins);
 
-        // Integer accumulation for log-rebin
-        fl::memset(s.rawBinsI.data(), 0, sizeof(u32) * mTotalBands);
+            computeLinearBins(s.mag.data(), N, out);
 
-        // Upper tier: LOG_REBIN for bins [mHybridMidSplitBin, mTotalBands)
-        logRebinRange(s.mag.data(), N,
-                      static_cast<float>(mSampleRate),
-                      mHybridMidSplitBin, mTotalBands, s.rawBinsI.data(),
-                      mLogBinLut);
+            // Integer accumulation for log-rebin
+            fl::memset(ls.rawBinsI.data(), 0, sizeof(u32) * mTotalBands);
+
+            // Upper tier: LOG_REBIN for bins [mHybridMidSplitBin, mTotalBands)
+            logRebinRange(s.mag.data(), N,
+                          static_cast<float>(mSampleRate),
+                          mHybridMidSplitBin, mTotalBands,
+                          ls.rawBinsI.data(), mLogBinLut);
+        }
 
         // Decimate signal: 512 → 256 → 128 (2 steps for mid tier)
         int workLen = N;
-        for (int i = 0; i < N; i++) {
-            mWorkBuf[i] =
-                (i < static_cast<int>(buffer.size())) ? buffer[i] : 0;
+        for (int l = 0; l < lanes; ++l) {
+            LaneScratch &ls = s.lanes[l];
+            const span<const i16> &buffer = buffers[l];
+            ls.work.resize(N);
+            for (int i = 0; i < N; i++) {
+                ls.work[i] =
+                    (i < static_cast<int>(buffer.size())) ? buffer[i] : 0;
+            }
+            decimateBy2(ls.work.data(), workLen);
+            decimateBy2(ls.work.data(), workLen / 2);
         }
-        decimateBy2(mWorkBuf.data(), workLen);
-        workLen /= 2;
-        decimateBy2(mWorkBuf.data(), workLen);
-        workLen /= 2;
+        workLen /= 4;
 
         // Phase 2: Zero-padded 256pt FFT (128 windowed + 128 zeros) → LOG_REBIN for mid bins
         if (mHybridMidSplitBin > mHybridSplitBin && mHybridMidFft) {
             int midFftN = mHybridMidN * 2;
             int midRawBins = midFftN / 2 + 1;
-            s.windowed.resize(midFftN);
-            applyWindow(mWorkBuf.data(), mHybridMidWindow.data(),
-                           s.windowed.data(), mHybridMidN);
-            for (int i = mHybridMidN; i < midFftN; ++i) {
-                s.windowed[i] = 0;
+            for (int l = 0; l < lanes; ++l) {
+                LaneScratch &ls = s.lanes[l];
+                ls.windowed.resize(midFftN);
+                applyWindow(ls.work.data(), mHybridMidWindow.data(),
+                            ls.windowed.data(), mHybridMidN);
+                for (int i = mHybridMidN; i < midFftN; ++i) {
+                    ls.windowed[i] = 0;
+                }
+                in[l] = ls.windowed.data();
+            }
+            forwardLanes(mHybridMidFft, mBatchMidFft, midFftN, in, fft,
+                         lanes);
+            for (int l = 0; l < lanes; ++l) {
+                deinterleave(fft[l], s.re.data(), s.im.data(), midRawBins);
+                batchMag(s.re.data(), s.im.data(), s.mag.data(), midRawBins);
+
+                logRebinRange(s.mag.data(), midFftN,
+                              mHybridMidFs,
+                              mHybridSplitBin, mHybridMidSplitBin,
+                              s.lanes[l].rawBinsI.data(), mLogBinLutMid);
             }
-            fl_fft_real_forward(mHybridMidFft, mHybridMidN * 2,
-                                s.windowed.data(),
-                                mHybridMidFftOut.data());
-            deinterleave(mHybridMidFftOut.data(), s.re.data(), s.im.data(), midRawBins);
-            batchMag(s.re.data(), s.im.data(), s.mag.data(), midRawBins);
-
-            logRebinRange(s.mag.data(), midFftN,
-                          mHybridMidFs,
-                          mHybridSplitBin, mHybridMidSplitBin, s.rawBinsI.data(),
-                          mLogBinLutMid);
         }
 
         // Decimate 1 more step: 128 → 64 (reuse unwindowed workBuf)
-        decimateBy2(mWorkBuf.data(), workLen);
+        for (int l = 0; l < lanes; ++l) {
+            decimateBy2(s.lanes[l].work.data(), workLen);
+        }
         workLen /= 2;
 
         // Phase 3: Windowed 64pt FFT → LOG_REBIN for bass bins
         if (mHybridSplitBin > 0 && mHybridSmallFft) {
             int bassRawBins = mHybridSmallN / 2 + 1;
-            s.windowed.resize(mHybridSmallN);
-            applyWindow(mWorkBuf.data(), mHybridBassWindow.data(),
-                           s.windowed.data(), mHybridSmallN);
-            fl_fft_real_forward(mHybridSmallFft, mHybridSmallN,
-                                s.windowed.data(),
-                                mHybridSmallFftOut.data());
-            deinterleave(mHybridSmallFftOut.data(), s.re.data(), s.im.data(), bassRawBins);
-            batchMag(s.re.data(), s.im.data(), s.mag.data(), bassRawBins);
-            logRebinRange(s.mag.data(), mHybridSmallN,
-                          mHybridSmallFs,
-                          0, mHybridSplitBin, s.rawBinsI.data(),
-                          mLogBinLutBass);
+            for (int l = 0; l < lanes; ++l) {
+                LaneScratch &ls = s.lanes[l];
+                ls.windowed.resize(mHybridSmallN);
+                applyWindow(ls.work.data(), mHybridBassWindow.data(),
+                            ls.windowed.data(), mHybridSmallN);
+                in[l] = ls.windowed.data();
+            }
+            forwardLanes(mHybridSmallFft, mBatchSmallFft, mHybridSmallN, in,
+                         fft, lanes);
+            for (int l = 0; l < lanes; ++l) {
+                deinterleave(fft[l], s.re.data(), s.im.data(), bassRawBins);
+                batchMag(s.re.data(), s.im.data(), s.mag.data(), bassRawBins);
+                logRebinRange(s.mag.data(), mHybridSmallN,
+                              mHybridSmallFs,
+                              0, mHybridSplitBin,
+                              s.lanes[l].rawBinsI.data(), mLogBinLutBass);
+            }
         }
 
-        // Store raw magnitudes (dB computed lazily by Bins::db())
-        fl::vector<float> &rawBins = out->raw_mut();
-        rawBins.resize(mTotalBands);
-        for (int i = 0; i < mTotalBands; ++i) {
-            rawBins[i] = static_cast<float>(s.rawBinsI[i]);
-        }
+        for (int l = 0; l < lanes; ++l) {
+            Bins *out = outs[l];
+            const fl::vector<u32> &rawBinsI = s.lanes[l].rawBinsI;
 
-        // Use pre-computed merged norm factors (no per-frame allocation)
-        out->setNormFactors(mHybridMergedNorm);
+            // Store raw magnitudes (dB computed lazily by Bins::db())
+            fl::vector<float> &rawBins = out->raw_mut();
+            rawBins.resize(mTotalBands);
+            for (int i = 0; i < mTotalBands; ++i) {
+                rawBins[i] = static_cast<float>(rawBinsI[i]);
+            }
+
+            // Use pre-computed merged norm factors (no per-frame allocation)
+            out->setNormFactors(mHybridMergedNorm);
+        }
     }
 
     // ---- Shared utilities ----
@@ -1092,8 +1220,6 @@ class Context {
     // Octave-wise CQ path (also used by Hybrid)
     Mode mMode;
     fl::vector<OctaveInfo> mOctaves;
-    fl::vector<kiss_fft_scalar> mWorkBuf; // reusable decimation buffer
-    fl::vector<kiss_fft_cpx> mFftOut;     // reusable FFT output buffer
     int mMaxBinsPerOctave = 0;
 
     // Hybrid 3-tier path
@@ -1101,12 +1227,10 @@ class Context {
     int mHybridSmallN = 0;        // bass FFT size (samples/8)
     float mHybridSmallFs = 0.0f;  // bass sample rate (sr/8)
     kiss_fftr_cfg mHybridSmallFft = nullptr;
-    fl::vector<kiss_fft_cpx> mHybridSmallFftOut;
     // Mid-tier (3-tier hybrid)
     int mHybridMidN = 0;          // mid FFT size (samples/4)
     float mHybridMidFs = 0.0f;    // mid sample rate (sr/4)
     kiss_fftr_cfg mHybridMidFft = nullptr;
-    fl::vector<kiss_fft_cpx> mHybridMidFftOut;
     int mHybridMidSplitBin = 0;   // bins >= this use upper fft::FFT
     fl::vector<alpha16> mHybridBassWindow;  // UNORM16 window for bass
     fl::vector<alpha16> mHybridMidWindow;   // UNORM16 window for mid
@@ -1123,6 +1247,13 @@ class Context {
     int mLinearKStart = 0;           // Pre-computed linear bin loop bounds
     int mLinearKEnd = 0;
 
+    // Four-lane SIMD plans for runBatch(), one per FFT size in use. Built
+    // on first batched run so single-buffer users never pay for them.
+    fl::mutex mBatchMutex;
+    fl::unique_ptr<BatchRealFFT> mBatchFft;       // mInputSamples
+    fl::unique_ptr<BatchRealFFT> mBatchMidFft;    // HYBRID mid tier
+    fl::unique_ptr<BatchRealFFT> mBatchSmallFft;  // HYBRID bass tier
+
     // Used by both paths
     int mTotalBands;
     float mFmin, mFmax;
@@ -1172,6 +1303,25 @@ Impl::Result Impl::run(span<const i16> sample, Bins *out) {
     return Impl::Result(true, "");
 }
 
+Impl::Result Impl::runBatch(span<const span<const i16>> samples,
+                            span<Bins *> outs) {
+    if (!mContext) {
+        return Impl::Result(false, "Impl context is not initialized");
+    }
+    if (samples.size() != outs.size()) {
+        FL_WARN("Impl batch size mismatch");
+        return Impl::Result(false, "Impl batch size mismatch");
+    }
+    for (fl::size i = 0; i < samples.size(); ++i) {
+        if (samples[i].size() != mContext->sampleSize()) {
+            FL_WARN("Impl sample size mismatch");
+            return Impl::Result(false, "Impl sample size mismatch");
+        }
+    }
+    mContext->runBatch(samples, outs);
+    return Impl::Result(true, "");
+}
+
 } // namespace fft
 } // namespace audio
 } // namespace fl
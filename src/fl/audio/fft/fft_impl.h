@@ -38,6 +38,10 @@ class Impl {
     // constructor.
     Result run(const Sample &sample, Bins *out);
     Result run(span<const i16> sample, Bins *out);
+    // Runs several same-sized buffers (e.g. stereo channels or overlapping
+    // hops) through this configuration, four at a time on SIMD lanes.
+    // samples[i] is written to outs[i]. A batch of one matches run().
+    Result runBatch(span<const span<const i16>> samples, span<Bins *> outs);
     // Info on what the frequency the bins represent
     fl::string info() const;
 
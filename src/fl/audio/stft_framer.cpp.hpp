@@ -0,0 +1,90 @@
+#include "fl/audio/stft_framer.h"
+#include "fl/stl/cstring.h"
+#include "fl/stl/noexcept.h"
+
+namespace fl {
+namespace audio {
+
+StftFramer::StftFramer() {
+    StftConfig off;
+    off.windowSize = 0;
+    configure(off);
+}
+
+StftFramer::StftFramer(const StftConfig& config) {
+    configure(config);
+}
+
+void StftFramer::configure(const StftConfig& config) {
+    mConfig = config;
+    if (mConfig.hopSize < 1) {
+        mConfig.hopSize = 1;
+    }
+    if (mConfig.hopSize > mConfig.windowSize) {
+        mConfig.hopSize = mConfig.windowSize;
+    }
+    mRing.clear();
+    mRing.resize(mConfig.windowSize);
+    mFrame.reserve(mConfig.windowSize);
+    reset();
+}
+
+void StftFramer::reset() {
+    mWrite = 0;
+    mFilled = 0;
+    mSinceFrame = 0;
+    mFirstFrameTaken = false;
+}
+
+bool StftFramer::frameReady() const {
+    if (!enabled() || mFilled < mConfig.windowSize) {
+        return false;
+    }
+    return !mFirstFrameTaken || mSinceFrame >= mConfig.hopSize;
+}
+
+fl::size StftFramer::consume(fl::span<const fl::i16> pcm) {
+    if (!enabled() || frameReady()) {
+        return 0;
+    }
+    const fl::size window = mConfig.windowSize;
+    // Stop exactly at the sample that completes the next frame.
+    fl::size due = mFirstFrameTaken ? mConfig.hopSize - mSinceFrame
+                                    : window - mFilled;
+    fl::size n = pcm.size() < due ? pcm.size() : due;
+
+    const fl::i16* src = pcm.data();
+    fl::size left = n;
+    while (left > 0) {
+        fl::size chunk = window - mWrite;
+        if (chunk > left) {
+            chunk = left;
+        }
+        fl::memcpy(mRing.data() + mWrite, src, chunk * sizeof(fl::i16));
+        src += chunk;
+        left -= chunk;
+        mWrite += chunk;
+        if (mWrite == window) {
+            mWrite = 0;
+        }
+    }
+
+    mFilled = (mFilled + n > window) ? window : mFilled + n;
+    mSinceFrame += n;
+    return n;
+}
+
+Sample StftFramer::takeFrame(fl::u32 timestamp) {
+    const fl::size window = mConfig.windowSize;
+    // Ring is full, so the oldest sample sits at the write cursor.
+    mFrame.resize(window);
+    const fl::size tail = window - mWrite;
+    fl::memcpy(mFrame.data(), mRing.data() + mWrite, tail * sizeof(fl::i16));
+    fl::memcpy(mFrame.data() + tail, mRing.data(), mWrite * sizeof(fl::i16));
+    mSinceFrame = 0;
+    mFirstFrameTaken = true;
+    return Sample(fl::span<const fl::i16>(mFrame.data(), window), timestamp);
+}
+
+} // namespace audio
+} // namespace fl
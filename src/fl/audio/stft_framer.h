@@ -0,0 +1,88 @@
+#pragma once
+
+#include "fl/audio/audio.h"
+#include "fl/stl/int.h"
+#include "fl/stl/span.h"
+#include "fl/stl/vector.h"
+#include "fl/stl/noexcept.h"
+
+namespace fl {
+namespace audio {
+
+/// Configuration for short-time (overlapping window) analysis
+struct StftConfig {
+    /// Samples per analysis window (the PCM size detectors see).
+    /// 0 disables STFT framing.
+    fl::size windowSize = 1024;
+
+    /// New samples between consecutive windows. windowSize / hopSize is the
+    /// overlap factor: 1024/256 gives 4 analysis frames per 1024 samples.
+    /// Clamped to [1, windowSize].
+    fl::size hopSize = 256;
+};
+
+/// StftFramer turns an arbitrary stream of PCM buffers into overlapping
+/// fixed-size analysis windows.
+///
+/// Incoming samples go into a ring of windowSize samples, so each hop costs
+/// hopSize writes plus one windowSize copy when the frame is taken — CPU per
+/// frame is bounded by the window, independent of the input buffer size.
+/// Window functions are still applied by fft::FFT on the frame.
+///
+/// Usage:
+/// @code
+/// StftConfig config;  // 1024 / 256
+/// StftFramer framer(config);
+/// span<const i16> pcm = sample.pcm();
+/// fl::size used = 0;
+/// while (used < pcm.size()) {
+///     used += framer.consume(pcm.subspan(used));
+///     if (framer.frameReady()) {
+///         Sample frame = framer.takeFrame(timestamp);
+///         // analyse frame; consecutive frames are hopSize() samples apart
+///     }
+/// }
+/// @endcode
+class StftFramer {
+public:
+    /// Default-constructed framers are disabled (windowSize 0).
+    StftFramer() FL_NOEXCEPT;
+    explicit StftFramer(const StftConfig& config) FL_NOEXCEPT;
+
+    /// Apply a new configuration. Drops any buffered audio.
+    void configure(const StftConfig& config) FL_NOEXCEPT;
+    const StftConfig& config() const FL_NOEXCEPT { return mConfig; }
+
+    bool enabled() const FL_NOEXCEPT { return mConfig.windowSize > 0; }
+    fl::size windowSize() const FL_NOEXCEPT { return mConfig.windowSize; }
+    fl::size hopSize() const FL_NOEXCEPT { return mConfig.hopSize; }
+
+    /// Append samples until the next frame is due or the input runs out.
+    /// Returns how many samples of pcm were consumed; call frameReady()
+    /// afterwards and feed the remainder once the frame has been taken.
+    fl::size consume(fl::span<const fl::i16> pcm) FL_NOEXCEPT;
+
+    /// True once the ring holds a full window and a hop has elapsed since
+    /// the previous frame (the first frame is emitted as soon as the ring
+    /// first fills).
+    bool frameReady() const FL_NOEXCEPT;
+
+    /// Copy the most recent windowSize samples, oldest first, into a Sample
+    /// and start the next hop. Only valid when frameReady().
+    Sample takeFrame(fl::u32 timestamp) FL_NOEXCEPT;
+
+    /// Drop all buffered audio (e.g. after a stream discontinuity).
+    void reset() FL_NOEXCEPT;
+
+private:
+    StftConfig mConfig;
+    fl::vector<fl::i16> mRing;   // windowSize samples, mWrite is the oldest
+    fl::vector<fl::i16> mFrame;  // linearized window handed to Sample
+    fl::size mWrite = 0;
+    fl::size mFilled = 0;        // valid samples in the ring (<= windowSize)
+    fl::size mSinceFrame = 0;    // samples since the last taken frame
+    bool mFirstFrameTaken = false;
+};
+
+} // namespace audio
+} // namespace fl
@@ -16,6 +16,7 @@
 #include "fl/system/trace.h"
 
 #include "fl/system/pin.h"
+#include "fl/chipsets/encoders/pixel_pipeline.h"
 #include "fl/chipsets/encoders/ucs7604.h"
 #include "fl/chipsets/ucs7604.h"
 #include "fl/math/ease.h"
@@ -23,6 +24,8 @@
 #include "fl/system/engine_events.h"
 #include "fl/math/xymap.h"
 #include "fl/stl/singleton.h"
+#include "fl/stl/cstring.h"
+#include "fl/math/math.h"
 #include "fl/stl/noexcept.h"
 
 namespace fl {
@@ -53,6 +56,7 @@ class ReorderingPixelIteratorAny {
         return SingletonThreadLocal<fl::vector<CRGB>>::instance();
     }
     fl::optional<PixelController<RGB, 1, 0xFFFFFFFF>> mAddressedController;
+    PixelController<RGB, 1, 0xFFFFFFFF>* mSource;
     PixelIteratorAny mPixelIterator;
 
   public:
@@ -69,7 +73,7 @@ class ReorderingPixelIteratorAny {
         Rgbw rgbw,
         Rgbww rgbww,
         const fl::string& channelName)
-        : mPixelIterator(pixels, rgbOrder, rgbw, rgbww) {
+        : mSource(&pixels), mPixelIterator(pixels, rgbOrder, rgbw, rgbww) {
 
         // Apply addressing transformation if configured
         if (addressing) {
@@ -106,14 +110,87 @@ class ReorderingPixelIteratorAny {
                 buffer.data(), buffer.size(),
                 pixels.mColorAdjustment, DISABLE_DITHER);
             mPixelIterator = PixelIteratorAny(mAddressedController.value(), rgbOrder, rgbw, rgbww);
+            mSource = &mAddressedController.value();
         }
     }
 
     /// @brief Get the constructed pixel iterator
     PixelIterator& get() { return mPixelIterator.get(); }
     const PixelIterator& get() const { return mPixelIterator.get(); }
+
+    /// @brief RGB pixels the iterator reads (after any XYMap reordering)
+    const PixelController<RGB, 1, 0xFFFFFFFF>& source() const { return *mSource; }
 };
 
+/// @brief 3-byte WS2812 frames through the specialized pixel pipeline.
+///
+/// Writes pixels.size() * 3 bytes to `out`, or returns false when the frame
+/// needs the PixelIterator path (white channel, showColor() input, or the
+/// pipeline compiled out with FASTLED_DISABLE_PIXEL_PIPELINE).
+bool encodeRGBPipeline(const PixelController<RGB, 1, 0xFFFFFFFF>& pixels,
+                       EOrder order, const ChannelOptions& settings,
+                       u8* out) FL_NOEXCEPT {
+#if !defined(FASTLED_DISABLE_PIXEL_PIPELINE) || !FASTLED_DISABLE_PIXEL_PIPELINE
+    PixelPipelineParams params;
+    if (settings.rgbw().active() || settings.rgbww().active() ||
+        !makePixelPipelineParams(pixels, &params)) {
+        return false;
+    }
+    runPixelPipeline(params, order, out);
+    return true;
+#else
+    (void)pixels;
+    (void)order;
+    (void)settings;
+    (void)out;
+    return false;
+#endif
+}
+
+/// @brief Thread-local scratch for re-encoding one dirty span at a time
+/// before it is spliced into the channel's encoded buffer.
+fl::vector<u8>& getEncodeScratchTLS() FL_NOEXCEPT {
+    return SingletonThreadLocal<fl::vector<u8>>::instance();
+}
+
+/// @brief True if two adjustments scale pixels identically.
+bool sameAdjustment(const ColorAdjustment& a, const ColorAdjustment& b) FL_NOEXCEPT {
+#if FASTLED_HD_COLOR_MIXING
+    if (a.color != b.color || a.brightness != b.brightness) {
+        return false;
+    }
+#endif
+    return a.premixed == b.premixed;
+}
+
+/// @brief Collect the pixel runs where `cur` differs from `prev`.
+///
+/// Clean gaps shorter than kMergeGap are bridged: each span costs an
+/// iterator setup, which outweighs re-encoding a handful of clean pixels.
+void diffPixels(const CRGB* cur, const CRGB* prev, u32 n,
+                DirtySpans* out) FL_NOEXCEPT {
+    const u32 kMergeGap = 8;
+    u32 i = 0;
+    while (i < n) {
+        if (cur[i] == prev[i]) {
+            ++i;
+            continue;
+        }
+        const u32 runStart = i;
+        u32 runEnd = ++i;
+        while (i < n) {
+            if (cur[i] != prev[i]) {
+                runEnd = ++i;
+            } else if (i - runEnd >= kMergeGap) {
+                break;
+            } else {
+                ++i;
+            }
+        }
+        out->add(runStart, runEnd - runStart);
+    }
+}
+
 /// @brief Out-of-line cold-path emitter for the #2517 silent-drop
 /// DISABLED-driver diagnostic in `Channel::showPixels`.
 ///
@@ -297,6 +374,9 @@ void Channel::applyConfig(const ChannelConfig& config) {
     setTemperature(config.options.mTemperature);
     setDither(config.options.mDitherMode);
     applyWhiteCfg(*this, config.options);
+    // Order / white-channel / LED span may have changed: the next frame must
+    // re-encode from scratch before incremental splicing resumes.
+    mShadowValid = false;
     auto& events = ChannelEvents::instance();
     events.onChannelConfigured(*this, config);
 }
@@ -446,67 +526,7 @@ fl::shared_ptr<IChannelDriver> Channel::resolveDynamicDriver() {
 #endif  // !FASTLED_DISABLE_DYNAMIC_DRIVER
 }
 
-void Channel::showPixels(PixelController<RGB, 1, 0xFFFFFFFF> &pixels) {
-    FL_SCOPED_TRACE;
-
-    // Safety check: don't modify buffer if driver is currently transmitting it
-    if (mChannelData->isInUse()) {
-        FL_WARN("Channel '" << mName << "': showPixels() called while mChannelData is in use by driver, attempting to wait");
-        auto driver = mDriver.lock();
-        if (!driver) {
-            FL_ERROR("Channel '" << mName << "': No driver bound yet the mChannelData is in use - cannot transmit");
-            return;
-        }
-        // wait until the driver is in a READY state.
-        bool ok = driver->waitForReady();
-        if (!ok) {
-            FL_ERROR("Channel '" << mName << "': Timeout occurred while waiting for driver to become READY");
-            return;
-        }
-        FL_WARN("Channel '" << mName << "': Engine became READY after waiting");
-    }
-
-    // Phase 5b of #2428: if the driver was pre-bound via setDriver() (legacy
-    // addLeds<>-style controllers naming BusTraits<Bus::X>::instancePtr() in
-    // their constructor), bypass ChannelManager entirely. Channels created via
-    // the manager-based API (Channel::create(cfg) without affinity) keep their
-    // existing per-frame re-selection so users can swap drivers at runtime.
-    //
-    // **Fast path (#2773 item 2.1):** the legacy `addLeds<NEOPIXEL>` flow is
-    // by far the hot per-frame path on stock Blink. It needs no busKey
-    // construction, no dynamic driver lookup, no busKey-miss diagnostics,
-    // and no fallback `FL_ERROR` reporting — the driver was already pre-bound
-    // in the controller's constructor. Pulling all of that boilerplate out
-    // of `showPixels` lets the compiler keep the hot path compact and lets
-    // the slow path's `fl::string` ops / `ChannelManager::selectDriverForChannel`
-    // / diagnostic literals tree-shake on the slow-path branch's coldness.
-    fl::shared_ptr<IChannelDriver> driver;
-    if (mDriverPreBound) {
-        driver = mDriver.lock();
-        if (!driver) {
-            // Pre-bound driver got destroyed (singleton shutdown, etc.). Silent
-            // bail — this is unrecoverable from showPixels.
-            return;
-        }
-    } else {
-#if !defined(FASTLED_DISABLE_DYNAMIC_DRIVER) || !FASTLED_DISABLE_DYNAMIC_DRIVER
-        driver = resolveDynamicDriver();
-        if (!driver) {
-            return;
-        }
-#else
-        // Dynamic-driver lookup gated out via FASTLED_DISABLE_DYNAMIC_DRIVER
-        // (#2926). The else branch is dead at runtime for every legacy
-        // `addLeds<>` flavor — those pre-bind their driver in the ctor. The
-        // gate lets `--gc-sections` drop the resolveDynamicDriver body plus
-        // the ChannelManager::findDriverByName / selectDriverForChannel
-        // chain (~400-900 B). Channels created via `Channel::create(cfg)`
-        // without a pre-bound driver silently emit nothing under this flag —
-        // user accepts the constraint.
-        return;
-#endif
-    }
-
+void Channel::encodeFull(PixelController<RGB, 1, 0xFFFFFFFF> &pixels) {
     // Build pixel iterator with optional addressing transformation
     // (#2558) Pass both Rgbw and Rgbww from the channel options; the iterator
     // carries both, and the encoder dispatch below picks the right path based
@@ -524,9 +544,15 @@ void Channel::showPixels(PixelController<RGB, 1, 0xFFFFFFFF> &pixels) {
         // Clockless chipsets: dispatch based on encoder type
         const ClocklessChipset* clockless = mChipset.ptr<ClocklessChipset>();
         switch (clockless->encoder) {
-            case ClocklessEncoder::CLOCKLESS_ENCODER_WS2812:
-                pixelIterator.writeWS2812(&data);
+            case ClocklessEncoder::CLOCKLESS_ENCODER_WS2812: {
+                const PixelController<RGB, 1, 0xFFFFFFFF>& source = iterator.source();
+                data.resize(static_cast<fl::size>(source.size()) * 3);
+                if (!encodeRGBPipeline(source, mRgbOrder, mSettings, data.data())) {
+                    data.clear();
+                    pixelIterator.writeWS2812(&data);
+                }
                 break;
+            }
 #if !defined(FASTLED_DISABLE_UCS7604) || !FASTLED_DISABLE_UCS7604
             // Gated by FASTLED_DISABLE_UCS7604 (#2920). For WS2812-only
             // sketches the UCS7604 case is dead at runtime, but each
@@ -618,6 +644,212 @@ void Channel::showPixels(PixelController<RGB, 1, 0xFFFFFFFF> &pixels) {
         // No default case - compiler will error if any enum value is missing
     }
 #endif  // !FASTLED_DISABLE_SPI_CHIPSETS
+}
+
+bool Channel::rotateChannelData() {
+    auto driver = mDriver.lock();
+    if (!driver) {
+        return false;
+    }
+    const u8 depth = fl::min(ChannelManager::instance().pipelineDepth(),
+                             driver->maxFramesInFlight());
+    if (depth <= 1) {
+        return false;
+    }
+    const fl::size spares = static_cast<fl::size>(depth - 1);
+    while (mSpareData.size() < spares) {
+        mSpareData.push_back(ChannelData::create(mChipset));
+    }
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        for (fl::size i = 0; i < spares; ++i) {
+            ChannelDataPtr& slot = mSpareData[i];
+            if (slot->isInUse()) {
+                continue;
+            }
+            // Incremental splicing patches the previous frame's bytes, so
+            // carry them over; a copy is far cheaper than a re-encode.
+            if (mShadowValid) {
+                slot->getData() = mChannelData->getData();
+            }
+            slot.swap(mChannelData);
+            return true;
+        }
+        // Every slot is in flight: let the driver retire finished frames once.
+        driver->poll();
+    }
+    return false;
+}
+
+void Channel::finishFullEncode(PixelController<RGB, 1, 0xFFFFFFFF> &pixels) {
+    const u32 encoded = static_cast<u32>(mChannelData->getData().size());
+    mChannelData->dirtyBytes().markAll(encoded);
+    mDirtyHints.clear();
+
+    ChannelEncodeStats frame;
+    frame.fullFrames = 1;
+    frame.bytesEncoded = encoded;
+    mEncodeStats += frame;
+    ChannelManager::instance().addEncodeStats(frame);
+
+    // Snapshot the input so the next frame can diff against it. Only CRGB
+    // arrays (advance == 3) are diffable; showColor() frames invalidate.
+    mShadowValid = mSettings.mIncrementalEncode && pixels.advanceBy() == 3;
+    if (!mShadowValid) {
+        mShadow.clear();
+        return;
+    }
+    const CRGB* src = reinterpret_cast<const CRGB*>(pixels.mData);  // ok reinterpret cast
+    mShadow.assign(src, src + pixels.size());
+    mShadowAdjustment = pixels.mColorAdjustment;
+}
+
+bool Channel::encodeIncremental(PixelController<RGB, 1, 0xFFFFFFFF> &pixels) {
+    // Eligibility: the encoded bytes of pixel i must depend only on pixel i.
+    // WS2812 is a fixed bytes-per-pixel stream; remapping, temporal dither
+    // and a changed brightness/correction all break that.
+    const ClocklessChipset* clockless = mChipset.ptr<ClocklessChipset>();
+    auto& data = mChannelData->getData();
+    const u32 n = static_cast<u32>(mShadow.size());
+    if (!mShadowValid || !clockless ||
+        clockless->encoder != ClocklessEncoder::CLOCKLESS_ENCODER_WS2812 ||
+        mScreenMap.getXYMap() != nullptr ||
+        pixels.advanceBy() != 3 ||
+        (pixels.e[0] | pixels.e[1] | pixels.e[2]) != 0 ||
+        static_cast<u32>(pixels.size()) != n || n == 0 ||
+        data.size() % n != 0 ||
+        !sameAdjustment(pixels.mColorAdjustment, mShadowAdjustment)) {
+        return false;
+    }
+    const u32 bytesPerPixel = static_cast<u32>(data.size()) / n;
+    const CRGB* src = reinterpret_cast<const CRGB*>(pixels.mData);  // ok reinterpret cast
+
+    DirtySpans spans;
+    if (!mDirtyHints.empty()) {
+        for (const DirtySpans::Span& hint : mDirtyHints) {
+            if (hint.begin < n) {
+                spans.add(hint.begin, fl::min(hint.end, n) - hint.begin);
+            }
+        }
+        mDirtyHints.clear();
+    } else {
+        diffPixels(src, mShadow.data(), n, &spans);
+    }
+
+    DirtySpans& dirtyBytes = mChannelData->dirtyBytes();
+    dirtyBytes.clear();
+    fl::vector<u8>& scratch = getEncodeScratchTLS();
+    for (const DirtySpans::Span& span : spans) {
+        PixelController<RGB, 1, 0xFFFFFFFF> sub(src + span.begin,
+                                                static_cast<int>(span.size()),
+                                                pixels.mColorAdjustment,
+                                                DISABLE_DITHER);
+        const u32 offset = span.begin * bytesPerPixel;
+        const u32 spanBytes = static_cast<u32>(span.size()) * bytesPerPixel;
+        if (bytesPerPixel != 3 ||
+            !encodeRGBPipeline(sub, mRgbOrder, mSettings, data.data() + offset)) {
+            PixelIteratorAny iterator(sub, mRgbOrder, mSettings.rgbw(), mSettings.rgbww());
+            scratch.clear();
+            iterator.get().writeWS2812(&scratch);
+            if (scratch.size() != spanBytes) {
+                // White-channel config changed under us: bytes-per-pixel no longer
+                // matches the buffer. The full encode rewrites everything.
+                return false;
+            }
+            fl::memcpy(data.data() + offset, scratch.data(), scratch.size());
+        }
+        fl::memcpy(mShadow.data() + span.begin, src + span.begin,
+                   span.size() * sizeof(CRGB));
+        dirtyBytes.add(offset, spanBytes);
+    }
+
+    ChannelEncodeStats frame;
+    frame.incrementalFrames = 1;
+    frame.bytesEncoded = dirtyBytes.coveredLength();
+    frame.bytesSkipped = static_cast<u32>(data.size()) - frame.bytesEncoded;
+    mEncodeStats += frame;
+    ChannelManager::instance().addEncodeStats(frame);
+    return true;
+}
+
+void Channel::markDirty(int start, int count) FL_NOEXCEPT {
+    if (start < 0) {
+        count += start;
+        start = 0;
+    }
+    if (count > 0) {
+        mDirtyHints.add(static_cast<u32>(start), static_cast<u32>(count));
+    }
+}
+
+void Channel::showPixels(PixelController<RGB, 1, 0xFFFFFFFF> &pixels) {
+    FL_SCOPED_TRACE;
+
+    // Safety check: don't modify buffer if driver is currently transmitting it.
+    // In pipelined mode switch to a spare buffer instead of waiting, so this
+    // frame encodes while the previous one is still being transmitted.
+    if (mChannelData->isInUse() && !rotateChannelData()) {
+        FL_WARN("Channel '" << mName << "': showPixels() called while mChannelData is in use by driver, attempting to wait");
+        auto driver = mDriver.lock();
+        if (!driver) {
+            FL_ERROR("Channel '" << mName << "': No driver bound yet the mChannelData is in use - cannot transmit");
+            return;
+        }
+        // wait until the driver is in a READY state.
+        bool ok = driver->waitForReady();
+        if (!ok) {
+            FL_ERROR("Channel '" << mName << "': Timeout occurred while waiting for driver to become READY");
+            return;
+        }
+        FL_WARN("Channel '" << mName << "': Engine became READY after waiting");
+    }
+
+    // Phase 5b of #2428: if the driver was pre-bound via setDriver() (legacy
+    // addLeds<>-style controllers naming BusTraits<Bus::X>::instancePtr() in
+    // their constructor), bypass ChannelManager entirely. Channels created via
+    // the manager-based API (Channel::create(cfg) without affinity) keep their
+    // existing per-frame re-selection so users can swap drivers at runtime.
+    //
+    // **Fast path (#2773 item 2.1):** the legacy `addLeds<NEOPIXEL>` flow is
+    // by far the hot per-frame path on stock Blink. It needs no busKey
+    // construction, no dynamic driver lookup, no busKey-miss diagnostics,
+    // and no fallback `FL_ERROR` reporting — the driver was already pre-bound
+    // in the controller's constructor. Pulling all of that boilerplate out
+    // of `showPixels` lets the compiler keep the hot path compact and lets
+    // the slow path's `fl::string` ops / `ChannelManager::selectDriverForChannel`
+    // / diagnostic literals tree-shake on the slow-path branch's coldness.
+    fl::shared_ptr<IChannelDriver> driver;
+    if (mDriverPreBound) {
+        driver = mDriver.lock();
+        if (!driver) {
+            // Pre-bound driver got destroyed (singleton shutdown, etc.). Silent
+            // bail — this is unrecoverable from showPixels.
+            return;
+        }
+    } else {
+#if !defined(FASTLED_DISABLE_DYNAMIC_DRIVER) || !FASTLED_DISABLE_DYNAMIC_DRIVER
+        driver = resolveDynamicDriver();
+        if (!driver) {
+            return;
+        }
+#else
+        // Dynamic-driver lookup gated out via FASTLED_DISABLE_DYNAMIC_DRIVER
+        // (#2926). The else branch is dead at runtime for every legacy
+        // `addLeds<>` flavor — those pre-bind their driver in the ctor. The
+        // gate lets `--gc-sections` drop the resolveDynamicDriver body plus
+        // the ChannelManager::findDriverByName / selectDriverForChannel
+        // chain (~400-900 B). Channels created via `Channel::create(cfg)`
+        // without a pre-bound driver silently emit nothing under this flag —
+        // user accepts the constraint.
+        return;
+#endif
+    }
+
+    // Incremental path first: when eligible it splices only the changed
+    // pixels into last frame's bytes; otherwise fall back to a full encode.
+    if (!(mSettings.mIncrementalEncode && encodeIncremental(pixels))) {
+        encodeFull(pixels);
+        finishFullEncode(pixels);
+    }
 
     // Fire event after encoding completes
     {
@@ -18,8 +18,10 @@
 #include "fl/channels/bus.h"
 #include "fl/channels/ichannel.h"
 #include "fl/channels/options.h"
+#include "fl/channels/dirty_spans.h"
 #include "fl/stl/shared_ptr.h"
 #include "fl/stl/string.h"
+#include "fl/stl/vector.h"
 #include "fl/stl/weak_ptr.h"
 #include "fl/stl/stdint.h"
 #include "fl/channels/config.h"
@@ -182,6 +184,21 @@ public:
     /// @return true if screen map has been set
     bool hasScreenMap() const;
 
+    /// @brief Hint that LEDs `[start, start + count)` changed since the last frame
+    ///
+    /// Only meaningful with `ChannelOptions::mIncrementalEncode`. When any
+    /// hint is pending, the next incremental frame re-encodes exactly the
+    /// hinted ranges and skips the shadow diff, so unhinted edits are not
+    /// transmitted until they are hinted or a full encode happens.
+    void markDirty(int start, int count) FL_NOEXCEPT OVERRIDE_IF_NOT_AVR;
+
+    /// @brief Encode counters for this channel (full vs incremental frames,
+    ///        bytes encoded vs bytes reused from the previous frame)
+    const ChannelEncodeStats& encodeStats() const FL_NOEXCEPT { return mEncodeStats; }
+
+    /// @brief Zero this channel's encode counters
+    void resetEncodeStats() FL_NOEXCEPT { mEncodeStats.reset(); }
+
 private:
     /// @brief Friend declaration for make_shared to access private constructor
     template<typename T, typename... Args>
@@ -209,6 +226,26 @@ private:
     /// see #2773 item 2.1. Returns `nullptr` on a hard miss (caller should
     /// silently bail).
     FL_NO_INLINE fl::shared_ptr<IChannelDriver> resolveDynamicDriver();
+
+    /// @brief Encode every pixel into mChannelData (the historic path).
+    void encodeFull(PixelController<RGB, 1, 0xFFFFFFFF>& pixels);
+
+    /// @brief Splice re-encoded dirty pixels into the previous frame's bytes.
+    /// @return false when the frame is not eligible (see
+    ///         `ChannelOptions::mIncrementalEncode`); the caller then runs
+    ///         encodeFull().
+    bool encodeIncremental(PixelController<RGB, 1, 0xFFFFFFFF>& pixels);
+
+    /// @brief Swap mChannelData for a spare ring buffer the driver is not
+    ///        transmitting (pipelined mode, see
+    ///        `ChannelManager::setPipelineDepth()`).
+    /// @return false if pipelining is off for this channel or every buffer
+    ///         is still in flight; the caller then waits for the driver.
+    bool rotateChannelData();
+
+    /// @brief Record the post-full-encode state the next incremental frame
+    ///        diffs against, and account the frame in the stats.
+    void finishFullEncode(PixelController<RGB, 1, 0xFFFFFFFF>& pixels);
 protected:
 
     /// @brief Pre-bind a driver, bypassing `ChannelManager::selectDriverForChannel()`
@@ -276,8 +313,15 @@ private:
     const i32 mId;
     fl::string mName;               // User-specified or auto-generated name
     ChannelOptions mSettings;           // Per-channel settings (gamma, rgbw, etc.)
-    ChannelDataPtr mChannelData;
+    ChannelDataPtr mChannelData;     // Buffer the next frame is encoded into
+    fl::vector<ChannelDataPtr> mSpareData;  // Pipelined ring slots, created on demand
     fl::ScreenMap mScreenMap;        // Screen map for JS canvas visualization
+    // Incremental re-encode state (only populated when mSettings.mIncrementalEncode).
+    fl::vector<CRGB> mShadow;        // Input pixels of the last encoded frame
+    ColorAdjustment mShadowAdjustment;  // Adjustment the shadow was encoded with
+    bool mShadowValid = false;       // mShadow/mChannelData describe the same frame
+    DirtySpans mDirtyHints;          // Pixel ranges from markDirty(), consumed per frame
+    ChannelEncodeStats mEncodeStats;
 };
 
 /// @brief Get stub channel driver for testing or unsupported platforms
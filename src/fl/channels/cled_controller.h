@@ -244,6 +244,18 @@ public:
         return *this;
     }
 
+    /// Hint that LEDs `[start, start + count)` changed since the last show().
+    /// Controllers that support incremental re-encoding (see
+    /// `ChannelOptions::mIncrementalEncode`) re-encode only the hinted
+    /// ranges on the next frame instead of diffing the whole strip; all
+    /// other controllers ignore the hint.
+    /// @param start index of the first changed LED
+    /// @param count number of changed LEDs
+    VIRTUAL_IF_NOT_AVR void markDirty(int start, int count) FL_NOEXCEPT {
+        (void)start;
+        (void)count;
+    }
+
     /// Zero out the LED data managed by this controller
     void clearLedDataInternal(int nLeds = -1) FL_NOEXCEPT;
 
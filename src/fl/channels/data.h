@@ -11,6 +11,7 @@
 #include "fl/stl/function.h"
 #include "fl/stl/span.h"
 #include "fl/channels/config.h"
+#include "fl/channels/dirty_spans.h"
 
 namespace fl {
 
@@ -82,6 +83,18 @@ public:
     /// @brief Get the data size in bytes
     size_t getSize() const FL_NOEXCEPT { return mEncodedData.size(); }
 
+    /// @brief Byte ranges of getData() rewritten by the most recent encode
+    ///
+    /// A full encode marks the whole buffer. When the owning channel has
+    /// `ChannelOptions::mIncrementalEncode` set and only some pixels changed,
+    /// this holds just the spliced ranges, so a driver that caches its own
+    /// expanded form of the bytes (wave8/wave3 symbols, DMA images) can
+    /// refresh only those regions instead of re-expanding the whole frame.
+    const DirtySpans& dirtyBytes() const FL_NOEXCEPT { return mDirtyBytes; }
+
+    /// @brief Mutable access for the encoder that owns this data
+    DirtySpans& dirtyBytes() FL_NOEXCEPT { return mDirtyBytes; }
+
     /// @brief Check if channel data is currently in use by the driver
     /// @return true if driver is transmitting this data, false otherwise
     bool isInUse() const FL_NOEXCEPT { return mInUse; }
@@ -146,6 +159,7 @@ private:
     ChipsetVariant mChipset;                ///< Chipset configuration (clockless or SPI)
     PaddingGenerator mPaddingGenerator;     ///< Optional padding generator for block-size alignment
     fl::vector_psram<u8> mEncodedData; ///< Encoded transmission bytes (PSRAM)
+    DirtySpans mDirtyBytes;                 ///< Ranges of mEncodedData touched by the last encode
     volatile bool mInUse = false;           ///< Engine is transmitting this data (prevents creator updates)
 };
 
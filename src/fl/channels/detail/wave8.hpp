@@ -8,6 +8,7 @@
 
 #include "fl/channels/wave8.h"
 #include "fl/channels/detail/bit_spread_lut.hpp"
+#include "fl/math/simd.h"
 #include "fl/stl/compiler_control.h"
 #include "fl/stl/isr/memcpy.h"
 #include "fl/stl/bit_cast.h"
@@ -502,6 +503,101 @@ void wave8_transpose_16x4_bf1_pipe4(const u8 lanes_a[16],
     }
 }
 
+// ============================================================================
+// Fused Multi-Lane Encoder (BF1 + u32x4 mask stage)
+// ============================================================================
+
+/// @brief Per-chipset output masks for the fused encoder, laid out so that one
+///        u32x4 AND/XOR produces a full 16-byte output block.
+struct Wave8SimdMasks {
+    simd::simd_u32x4 m0;  ///< Pulse pattern when every lane bit is 0 (W0)
+    simd::simd_u32x4 d;   ///< Pulses where W0 and W1 differ (W0 ^ W1)
+};
+
+/// @brief 0xFF if pulse p (0 = first) of the waveform is HIGH, else 0x00.
+FASTLED_FORCE_INLINE u32 wave8_pulse_mask(u8 waveform, int p) {
+    return ((waveform >> (7 - p)) & 1) ? 0xFFu : 0x00u;
+}
+
+/// @brief 16-lane masks: each pulse occupies 2 bytes (lanes 0-7, lanes 8-15),
+///        so word k covers pulses 2k and 2k+1.
+inline Wave8SimdMasks wave8_simd_masks_16(u8 W0, u8 W1) {
+    const u8 D = W0 ^ W1;
+    u32 m0[4];
+    u32 d[4];
+    for (int k = 0; k < 4; ++k) {
+        const u32 m0a = wave8_pulse_mask(W0, 2 * k);
+        const u32 m0b = wave8_pulse_mask(W0, 2 * k + 1);
+        const u32 da = wave8_pulse_mask(D, 2 * k);
+        const u32 db = wave8_pulse_mask(D, 2 * k + 1);
+        m0[k] = m0a | (m0a << 8) | (m0b << 16) | (m0b << 24);
+        d[k] = da | (da << 8) | (db << 16) | (db << 24);
+    }
+    Wave8SimdMasks masks;
+    masks.m0 = simd::set_u32_4(m0[0], m0[1], m0[2], m0[3]);
+    masks.d = simd::set_u32_4(d[0], d[1], d[2], d[3]);
+    return masks;
+}
+
+/// @brief 8-lane masks: each pulse is 1 byte, so one block spans two symbols
+///        and the 8-pulse pattern repeats in the upper half.
+inline Wave8SimdMasks wave8_simd_masks_8(u8 W0, u8 W1) {
+    const u8 D = W0 ^ W1;
+    u32 m0[2];
+    u32 d[2];
+    for (int k = 0; k < 2; ++k) {
+        m0[k] = 0;
+        d[k] = 0;
+        for (int b = 0; b < 4; ++b) {
+            m0[k] |= wave8_pulse_mask(W0, 4 * k + b) << (8 * b);
+            d[k] |= wave8_pulse_mask(D, 4 * k + b) << (8 * b);
+        }
+    }
+    Wave8SimdMasks masks;
+    masks.m0 = simd::set_u32_4(m0[0], m0[1], m0[0], m0[1]);
+    masks.d = simd::set_u32_4(d[0], d[1], d[0], d[1]);
+    return masks;
+}
+
+/// @brief Fused encode of one 16-lane byte position (128 output bytes).
+///        Bit-identical to wave8_transpose_16_bf1; the per-pulse byte loop is
+///        replaced by one broadcast + AND + XOR + 16-byte store per symbol.
+/// @note output must be 4-byte aligned.
+FASTLED_FORCE_INLINE FL_OPTIMIZE_FUNCTION
+void wave8_encode_16_simd(const u8 lanes[16],
+                          const Wave8SimdMasks &masks,
+                          u8 output[16 * sizeof(Wave8Byte)]) {
+    u8 cols[16];
+    spread_transpose16_symbol(lanes, cols);
+    u32 *out = fl::bit_cast_ptr<u32>(output);
+    for (int s = 0; s < 8; ++s) {
+        const u32 pair = static_cast<u32>(cols[2 * s]) |
+                         (static_cast<u32>(cols[2 * s + 1]) << 8);
+        const simd::simd_u32x4 col = simd::set1_u32_4(pair * 0x00010001u);
+        simd::store_u32_4(out + s * 4,
+                          simd::xor_u32_4(masks.m0, simd::and_u32_4(col, masks.d)));
+    }
+}
+
+/// @brief Fused encode of one 8-lane byte position (64 output bytes).
+///        Bit-identical to wave8_transpose_8_bf1; two symbols per store.
+/// @note output must be 4-byte aligned.
+FASTLED_FORCE_INLINE FL_OPTIMIZE_FUNCTION
+void wave8_encode_8_simd(const u8 lanes[8],
+                         const Wave8SimdMasks &masks,
+                         u8 output[8 * sizeof(Wave8Byte)]) {
+    u8 cols[8];
+    spread_transpose8_symbol(lanes, cols);
+    u32 *out = fl::bit_cast_ptr<u32>(output);
+    for (int s = 0; s < 8; s += 2) {
+        const u32 a = static_cast<u32>(cols[s]) * 0x01010101u;
+        const u32 b = static_cast<u32>(cols[s + 1]) * 0x01010101u;
+        const simd::simd_u32x4 col = simd::set_u32_4(a, a, b, b);
+        simd::store_u32_4(out + s * 2,
+                          simd::xor_u32_4(masks.m0, simd::and_u32_4(col, masks.d)));
+    }
+}
+
 } // namespace detail
 
 // ============================================================================
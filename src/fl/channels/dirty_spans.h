@@ -0,0 +1,144 @@
+/// @file dirty_spans.h
+/// @brief Fixed-capacity coalescing range set + encode counters used by the
+///        incremental (dirty-range) channel re-encode path.
+///
+/// `Channel` tracks which pixels changed since the previous frame and
+/// re-encodes only those, splicing the result into the existing
+/// `ChannelData` buffer. The changed regions are kept in a `DirtySpans`
+/// (pixel units inside the channel, byte units on `ChannelData`) so the
+/// bookkeeping never allocates on the per-frame path.
+
+#pragma once
+
+#include "fl/stl/stdint.h"
+#include "fl/stl/noexcept.h"
+
+namespace fl {
+
+/// @brief Sorted, non-overlapping set of half-open `[begin, end)` ranges
+///        with a fixed capacity.
+///
+/// `add()` merges any range it overlaps or touches. When the set is full the
+/// two neighbours separated by the smallest gap are fused, so the set always
+/// stays a conservative superset of everything that was added — callers may
+/// re-encode a few clean elements, never miss a dirty one.
+class DirtySpans {
+  public:
+    static constexpr u8 kMaxSpans = 8;
+
+    struct Span {
+        u32 begin;
+        u32 end;
+        u32 size() const FL_NOEXCEPT { return end - begin; }
+    };
+
+    /// @brief Record `[start, start + count)` as dirty. `count == 0` is a no-op.
+    void add(u32 start, u32 count) FL_NOEXCEPT {
+        if (count == 0) {
+            return;
+        }
+        u32 b = start;
+        u32 e = start + count;
+        // [first, last) = spans that overlap or touch the new range.
+        u8 first = 0;
+        while (first < mCount && mSpans[first].end < b) {
+            ++first;
+        }
+        u8 last = first;
+        while (last < mCount && mSpans[last].begin <= e) {
+            if (mSpans[last].begin < b) b = mSpans[last].begin;
+            if (mSpans[last].end > e) e = mSpans[last].end;
+            ++last;
+        }
+        if (last > first) {
+            // Collapse [first, last) into one slot.
+            mSpans[first].begin = b;
+            mSpans[first].end = e;
+            const u8 removed = static_cast<u8>(last - first - 1);
+            for (u8 i = first + 1; i + removed < mCount; ++i) {
+                mSpans[i] = mSpans[i + removed];
+            }
+            mCount = static_cast<u8>(mCount - removed);
+            return;
+        }
+        // Disjoint: insert at `first`. mSpans has one spare slot so the
+        // insert can overflow by one before fuseClosestPair() folds it back.
+        for (u8 i = mCount; i > first; --i) {
+            mSpans[i] = mSpans[i - 1];
+        }
+        mSpans[first].begin = b;
+        mSpans[first].end = e;
+        ++mCount;
+        if (mCount > kMaxSpans) {
+            fuseClosestPair();
+        }
+    }
+
+    /// @brief Replace the set with the single range `[0, total)`.
+    void markAll(u32 total) FL_NOEXCEPT {
+        clear();
+        add(0, total);
+    }
+
+    void clear() FL_NOEXCEPT { mCount = 0; }
+    bool empty() const FL_NOEXCEPT { return mCount == 0; }
+    u8 size() const FL_NOEXCEPT { return mCount; }
+    const Span& operator[](u8 i) const FL_NOEXCEPT { return mSpans[i]; }
+    const Span* begin() const FL_NOEXCEPT { return mSpans; }
+    const Span* end() const FL_NOEXCEPT { return mSpans + mCount; }
+
+    /// @brief Total number of elements covered by all spans.
+    u32 coveredLength() const FL_NOEXCEPT {
+        u32 total = 0;
+        for (u8 i = 0; i < mCount; ++i) {
+            total += mSpans[i].size();
+        }
+        return total;
+    }
+
+  private:
+    void fuseClosestPair() FL_NOEXCEPT {
+        u8 best = 0;
+        u32 bestGap = 0xFFFFFFFFu;
+        for (u8 i = 0; i + 1 < mCount; ++i) {
+            const u32 gap = mSpans[i + 1].begin - mSpans[i].end;
+            if (gap < bestGap) {
+                bestGap = gap;
+                best = i;
+            }
+        }
+        mSpans[best].end = mSpans[best + 1].end;
+        for (u8 i = best + 1; i + 1 < mCount; ++i) {
+            mSpans[i] = mSpans[i + 1];
+        }
+        --mCount;
+    }
+
+    Span mSpans[kMaxSpans + 1];
+    u8 mCount = 0;
+};
+
+/// @brief Encode-path counters for the incremental re-encode feature.
+///
+/// Reported per channel by `Channel::encodeStats()` and summed across all
+/// channels by `ChannelManager::encodeStats()`. `bytesSkipped` is the number
+/// of encoded output bytes that were carried over from the previous frame
+/// instead of being regenerated.
+struct ChannelEncodeStats {
+    u32 fullFrames = 0;         ///< Frames that re-encoded the whole buffer
+    u32 incrementalFrames = 0;  ///< Frames that re-encoded only dirty ranges
+    u32 bytesEncoded = 0;       ///< Output bytes produced by the encoder
+    u32 bytesSkipped = 0;       ///< Output bytes reused from the previous frame
+
+    void reset() FL_NOEXCEPT { *this = ChannelEncodeStats(); }
+
+    ChannelEncodeStats& operator+=(const ChannelEncodeStats& o) FL_NOEXCEPT {
+        fullFrames += o.fullFrames;
+        incrementalFrames += o.incrementalFrames;
+        bytesEncoded += o.bytesEncoded;
+        bytesSkipped += o.bytesSkipped;
+        return *this;
+    }
+};
+
+}  // namespace fl
@@ -125,6 +125,22 @@ public:
     /// @note Used by ChannelManager to route channels to compatible drivers
     virtual bool canHandle(const ChannelDataPtr& data) const FL_NOEXCEPT = 0;
 
+    /// @brief Number of encoded frames this driver can hold in flight at once
+    ///
+    /// The default of 1 is the classic encode-then-transmit contract: a
+    /// ChannelData handed to enqueue() stays `isInUse()` until it has been
+    /// clocked out, and its channel waits for that before encoding again.
+    ///
+    /// Returning N > 1 opts into the pipelined mode enabled by
+    /// `ChannelManager::setPipelineDepth()`. The driver then promises that
+    /// enqueue() + show() accept a *different* ChannelData for the same
+    /// channel while up to N - 1 earlier frames are still transmitting
+    /// (show() queues or blocks internally as needed), and that poll()
+    /// releases each frame with `setInUse(false)` once it is on the wire.
+    /// Channels use the spare buffers to encode frame N+1 while frame N is
+    /// still being transmitted.
+    virtual u8 maxFramesInFlight() const FL_NOEXCEPT { return 1; }
+
     /// @brief Wait for driver to become READY
     /// @param timeoutMs Optional timeout in milliseconds (0 = no timeout)
     /// @return true if driver became READY, false if timeout occurred
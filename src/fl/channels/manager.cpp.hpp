@@ -537,7 +537,23 @@ bool ChannelManager::waitForReadyOrDraining(u32 timeoutMs) {
 
 
 void ChannelManager::onBeginFrame() {
-    waitForReady();  // Wait for all drivers to become READY before clearing previous frame state.
+    if (mPipelineDepth <= 1) {
+        waitForReady();  // Wait for all drivers to become READY before clearing previous frame state.
+        return;
+    }
+    // Pipelined: drivers that hold frames in flight are only polled so they
+    // can retire finished buffers; the previous frame keeps transmitting
+    // while this one renders. Other drivers keep the classic wait.
+    for (auto& entry : mDrivers) {
+        if (!entry.enabled) {
+            continue;
+        }
+        if (entry.driver->maxFramesInFlight() > 1) {
+            entry.driver->poll();
+        } else {
+            entry.driver->waitForReady();
+        }
+    }
 }
 
 void ChannelManager::onEndFrame() {
@@ -549,7 +565,24 @@ void ChannelManager::onEndFrame() {
             entry.driver->show();
         }
     }
-    waitForReadyOrDraining();
+    if (mPipelineDepth <= 1) {
+        waitForReadyOrDraining();
+        return;
+    }
+    for (auto& entry : mDrivers) {
+        if (entry.enabled && entry.driver->maxFramesInFlight() <= 1) {
+            entry.driver->waitForReadyOrDraining();
+        }
+    }
+}
+
+void ChannelManager::setPipelineDepth(u8 depth) {
+    if (depth < 1) {
+        depth = 1;
+    } else if (depth > kMaxPipelineDepth) {
+        depth = kMaxPipelineDepth;
+    }
+    mPipelineDepth = depth;
 }
 
 void ChannelManager::reset() {
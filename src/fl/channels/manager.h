@@ -241,6 +241,37 @@ public:
     /// @note Called at frame boundaries to flush enqueued channels
     void onEndFrame() FL_NOEXCEPT override;
 
+    const char* listenerName() const FL_NOEXCEPT override { return "ChannelManager"; }
+
+    /// @brief Upper bound for setPipelineDepth() (triple buffering)
+    static constexpr u8 kMaxPipelineDepth = 3;
+
+    /// @brief Set how many encoded buffers each channel may cycle through
+    /// @param depth 1 = classic encode-then-transmit (default), 2 = double
+    ///        buffered, 3 = triple buffered. Clamped to [1, kMaxPipelineDepth].
+    /// @note With depth > 1, frame boundaries no longer wait for drivers whose
+    ///       `IChannelDriver::maxFramesInFlight()` is > 1: the next frame is
+    ///       rendered and encoded into a spare buffer while the previous one
+    ///       is still being transmitted. A channel's effective depth is
+    ///       `min(depth, driver->maxFramesInFlight())`, so drivers that keep
+    ///       the default of 1 behave exactly as before.
+    void setPipelineDepth(u8 depth) FL_NOEXCEPT;
+
+    /// @brief Current pipeline depth (see setPipelineDepth())
+    u8 pipelineDepth() const FL_NOEXCEPT { return mPipelineDepth; }
+
+    /// @brief Encode counters summed over every channel since the last reset
+    /// @note See `ChannelOptions::mIncrementalEncode`; `bytesSkipped` counts
+    ///       encoded bytes reused from the previous frame instead of regenerated.
+    const ChannelEncodeStats& encodeStats() const FL_NOEXCEPT { return mEncodeStats; }
+
+    /// @brief Zero the aggregate encode counters
+    void resetEncodeStats() FL_NOEXCEPT { mEncodeStats.reset(); }
+
+    /// @brief Accumulate one channel frame into the aggregate counters
+    /// @note Called by `Channel::showPixels()`
+    void addEncodeStats(const ChannelEncodeStats& frame) FL_NOEXCEPT { mEncodeStats += frame; }
+
     /// @brief Reset bus manager state, clearing all enqueued and transmitting channels
     /// @note Call this between test cases or when reinitializing the LED system
     void reset() FL_NOEXCEPT;
@@ -289,6 +320,12 @@ private:
     ///       Set by `setExclusiveDriverByName()` / cleared on empty name.
     fl::string mExclusiveDriver;
 
+    /// @brief Aggregate encode counters (see encodeStats())
+    ChannelEncodeStats mEncodeStats;
+
+    /// @brief Encoded buffers per channel (see setPipelineDepth())
+    u8 mPipelineDepth = 1;
+
     // Non-copyable, non-movable
     ChannelManager(const ChannelManager&) FL_NOEXCEPT = delete;
     ChannelManager& operator=(const ChannelManager&) FL_NOEXCEPT = delete;
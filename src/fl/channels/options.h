@@ -49,6 +49,13 @@ struct ChannelOptions {
     fl::variant<fl::Empty, Rgbw, Rgbww> mWhiteCfg;
     Bus mBus = Bus::AUTO;              // Typed driver selection
     fl::optional<float> mGamma;        // Gamma correction (nullopt = use default 2.8)
+    /// Re-encode only the pixels that changed since the previous frame and
+    /// splice them into the existing encoded buffer. Applies to WS2812-style
+    /// clockless channels without a screen-map remap and with dithering
+    /// disabled (`mDitherMode = DISABLE_DITHER`); every other configuration
+    /// silently takes the full-encode path. Costs one CRGB shadow copy of
+    /// the strip. See `Channel::markDirty()` and `Channel::encodeStats()`.
+    bool mIncrementalEncode = false;
 
     /// @return The active Rgbw if mWhiteCfg holds one, else RgbwInvalid::value().
     /// Backward-compat shim for code paths that pre-date the variant migration.
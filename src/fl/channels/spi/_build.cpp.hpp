@@ -2,6 +2,7 @@
 /// @brief Unity build header for fl/channels/spi/ directory
 /// Includes all implementation files in alphabetical order
 
+#include "fl/channels/spi/async_flush.cpp.hpp"
 #include "fl/channels/spi/device.cpp.hpp"
 #include "fl/channels/spi/lane.cpp.hpp"
 #include "fl/channels/spi/multi_lane_device.cpp.hpp"
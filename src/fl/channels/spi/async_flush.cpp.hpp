@@ -0,0 +1,146 @@
+#include "fl/channels/spi/async_flush.h"
+#include "fl/log/log.h"
+#include "fl/stl/cstring.h"
+#include "fl/stl/move.h"
+
+namespace fl {
+namespace spi {
+
+AsyncFlushQueue::~AsyncFlushQueue() FL_NOEXCEPT {
+    reset("SPI device destroyed");
+}
+
+void AsyncFlushQueue::attach(const fl::shared_ptr<SpiHwBase>& backend) {
+    if (mBackend != backend) {
+        reset("SPI backend changed");
+    }
+    mBackend = backend;
+}
+
+fl::span<u8> AsyncFlushQueue::stage(size_t bytes_per_lane) {
+    if (!mBackend) {
+        return fl::span<u8>();
+    }
+    poll();
+    if (mStaged) {
+        // Both buffers are taken: let the frame in flight finish so the
+        // staged one can move into the DMA buffer.
+        if (mInFlight) {
+            mBackend->waitComplete();
+            finish();
+        }
+        start();
+    }
+    mStagedInfo.bytes_per_lane = bytes_per_lane;
+    mBack.resize(bytes_per_lane * mBackend->getLaneCount());
+    return mBack;
+}
+
+fl::task::Promise<FlushInfo> AsyncFlushQueue::submit() {
+    fl::task::Promise<FlushInfo> promise = fl::task::Promise<FlushInfo>::create();
+    if (!mBackend) {
+        promise.complete_with_error(fl::task::Error("SPI backend not attached"));
+        return promise;
+    }
+    mStagedInfo.frame = ++mNextFrame;
+    mStagedPromise = promise;
+    mStaged = true;
+    setRegistered(true);
+    poll();
+    return promise;
+}
+
+void AsyncFlushQueue::poll() {
+    if (!mBackend) {
+        return;
+    }
+    if (mInFlight && !mBackend->isBusy()) {
+        mBackend->waitComplete(0);  // releases the DMA buffer
+        finish();
+    }
+    if (!mInFlight && mStaged) {
+        start();
+    }
+}
+
+bool AsyncFlushQueue::drain(u32 timeout_ms) {
+    while (pending()) {
+        if (mInFlight) {
+            if (!mBackend->waitComplete(timeout_ms)) {
+                return false;
+            }
+            finish();
+        }
+        if (mStaged) {
+            start();
+        }
+    }
+    return true;
+}
+
+void AsyncFlushQueue::reset(const char* reason) {
+    fl::task::Promise<FlushInfo> staged = fl::move(mStagedPromise);
+    fl::task::Promise<FlushInfo> inFlight = fl::move(mInFlightPromise);
+    mStagedPromise.clear();
+    mInFlightPromise.clear();
+    mStaged = false;
+    mInFlight = false;
+    mBackend.reset();
+    setRegistered(false);
+    inFlight.complete_with_error(fl::task::Error(reason));
+    staged.complete_with_error(fl::task::Error(reason));
+}
+
+// Moves the staged frame into the backend's DMA buffer and starts it.
+void AsyncFlushQueue::start() {
+    fl::task::Promise<FlushInfo> promise = fl::move(mStagedPromise);
+    mStagedPromise.clear();
+    mStaged = false;
+
+    DMABuffer dma = mBackend->acquireDMABuffer(mStagedInfo.bytes_per_lane);
+    if (!dma.ok()) {
+        FL_WARN("AsyncFlushQueue: Failed to acquire DMA buffer");
+        promise.complete_with_error(fl::task::Error("Failed to acquire DMA buffer"));
+        return;
+    }
+    fl::span<u8> out = dma.data();
+    if (out.size() != mBack.size()) {
+        FL_WARN("AsyncFlushQueue: DMA buffer size mismatch - expected " << mBack.size()
+                << " bytes, got " << out.size() << " bytes");
+        promise.complete_with_error(fl::task::Error("DMA buffer size mismatch"));
+        return;
+    }
+    fl::memcpy(out.data(), mBack.data(), out.size());
+    if (!mBackend->transmit(TransmitMode::ASYNC)) {
+        FL_WARN("AsyncFlushQueue: Hardware transmit failed");
+        promise.complete_with_error(fl::task::Error("Hardware transmit failed"));
+        return;
+    }
+    mInFlight = true;
+    mInFlightInfo = mStagedInfo;
+    mInFlightPromise = fl::move(promise);
+}
+
+// Resolves the frame in flight. State is updated before the promise so a
+// callback may flush the next frame straight away.
+void AsyncFlushQueue::finish() {
+    fl::task::Promise<FlushInfo> promise = fl::move(mInFlightPromise);
+    mInFlightPromise.clear();
+    mInFlight = false;
+    promise.complete_with_value(mInFlightInfo);
+}
+
+void AsyncFlushQueue::setRegistered(bool registered) {
+    if (registered == mRegistered) {
+        return;
+    }
+    mRegistered = registered;
+    if (registered) {
+        fl::task::Executor::instance().register_runner(this);
+    } else {
+        fl::task::Executor::instance().unregister_runner(this);
+    }
+}
+
+} // namespace spi
+} // namespace fl
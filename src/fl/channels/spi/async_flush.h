@@ -0,0 +1,109 @@
+#pragma once
+
+/// @file spi/async_flush.h
+/// @brief Double-buffered frame submission for SPI DMA backends
+
+#include "fl/stl/stdint.h"
+#include "fl/stl/limits.h"
+#include "fl/stl/span.h"
+#include "fl/stl/shared_ptr.h"
+#include "fl/stl/vector.h"
+#include "fl/task/executor.h"
+#include "fl/task/promise.h"
+// IWYU pragma: begin_keep
+#include "platforms/shared/spi_hw_base.h"  // ok platform headers
+#include "fl/stl/noexcept.h"
+// IWYU pragma: end_keep  // ok platform headers
+
+namespace fl {
+namespace spi {
+
+/// @brief Completion record for an asynchronously flushed frame
+struct FlushInfo {
+    u32 frame = 0;              ///< Sequence number of the frame, counting from 1
+    size_t bytes_per_lane = 0;  ///< Bytes clocked out on each lane
+};
+
+/// @brief Two-slot frame pipeline in front of a SpiHwBase backend
+/// @details The backend owns a single DMA buffer, which stays locked until its
+///          transmission completes. This queue adds a second, device-owned
+///          buffer: the caller prepares (transposes) the next frame into it
+///          while the backend is still clocking out the previous one, and the
+///          staged frame is copied into the DMA buffer and started as soon as
+///          the bus frees up.
+///
+///          Completion is detected by polling backend->isBusy(), either from
+///          the device's own calls or from fl::task::run() (the queue
+///          registers itself as a task::Runner on its first frame). Each
+///          submitted frame's promise resolves once its last byte has been
+///          sent, or rejects if the backend refused it.
+///
+/// @note Backs MultiLaneDevice::flushAsync() and is backend-generic; not intended
+///       for direct use by sketches.
+class AsyncFlushQueue : public fl::task::Runner {
+public:
+    AsyncFlushQueue() FL_NOEXCEPT = default;
+    ~AsyncFlushQueue() FL_NOEXCEPT override;
+
+    AsyncFlushQueue(const AsyncFlushQueue&) FL_NOEXCEPT = delete;
+    AsyncFlushQueue& operator=(const AsyncFlushQueue&) FL_NOEXCEPT = delete;
+
+    /// @brief Bind the queue to a backend (rejects anything still pending)
+    void attach(const fl::shared_ptr<SpiHwBase>& backend);
+
+    /// @brief Get the back buffer for the next frame
+    /// @param bytes_per_lane Bytes each lane will send
+    /// @returns Span of bytes_per_lane * backend lane count bytes
+    /// @note Blocks only if a frame is already staged behind the one in
+    ///       flight: the in-flight frame is waited for and the staged one
+    ///       started, which frees the back buffer.
+    fl::span<u8> stage(size_t bytes_per_lane);
+
+    /// @brief Queue the frame written into stage()'s buffer
+    /// @returns Promise resolved with the frame's FlushInfo once it has been
+    ///          transmitted, or rejected with the backend's error
+    /// @note Starts the transmission immediately if the bus is idle
+    fl::task::Promise<FlushInfo> submit();
+
+    /// @brief Complete a finished transmission and start the staged frame
+    void poll();
+
+    /// @brief Block until every queued frame has been transmitted
+    /// @param timeout_ms Maximum time to wait for each frame
+    /// @returns true if the queue drained, false on timeout
+    bool drain(u32 timeout_ms = (fl::numeric_limits<u32>::max)());
+
+    /// @brief Reject all queued frames and detach from the backend
+    void reset(const char* reason);
+
+    /// @brief Check whether any frame is staged or in flight
+    bool pending() const { return mInFlight || mStaged; }
+
+    // task::Runner
+    void update() override { poll(); }
+    bool has_active_tasks() const override { return pending(); }
+    size_t active_task_count() const override {
+        return (mInFlight ? 1 : 0) + (mStaged ? 1 : 0);
+    }
+
+private:
+    void start();
+    void finish();
+    void setRegistered(bool registered);
+
+    fl::shared_ptr<SpiHwBase> mBackend;
+    fl::vector<u8> mBack;  ///< Transposed frame waiting for the DMA buffer
+    u32 mNextFrame = 0;
+    bool mRegistered = false;
+
+    bool mStaged = false;
+    FlushInfo mStagedInfo;
+    fl::task::Promise<FlushInfo> mStagedPromise;
+
+    bool mInFlight = false;
+    FlushInfo mInFlightInfo;
+    fl::task::Promise<FlushInfo> mInFlightPromise;
+};
+
+} // namespace spi
+} // namespace fl
@@ -23,6 +23,7 @@ struct MultiLaneDevice::Impl : public DeviceImplBase {
     Config config;
     fl::vector<Lane> lanes;
     u8 backend_type;  // 1, 2, 4, or 8 (number of lanes supported by backend)
+    AsyncFlushQueue frames;  // Back buffer and completion tracking for flushAsync()
 
     Impl(const Config& cfg)
         : DeviceImplBase()
@@ -50,6 +51,121 @@ struct MultiLaneDevice::Impl : public DeviceImplBase {
 
         clearBackend();  // Use base class method
     }
+
+    /// @brief Validate that all non-empty lanes have the same size
+    /// @param out_size Receives the common lane size
+    Result<void> laneSize(size_t* out_size) const {
+        size_t expected_size = 0;
+        bool found_first = false;
+
+        for (size_t i = 0; i < lanes.size(); i++) {
+            size_t lane_size = lanes[i].bufferSize();
+
+            if (lane_size > 0) {
+                if (!found_first) {
+                    // First non-empty lane sets the expected size
+                    expected_size = lane_size;
+                    found_first = true;
+                } else if (lane_size != expected_size) {
+                    // Size mismatch detected
+                    FL_WARN("MultiLaneDevice: Lane size mismatch - expected " << expected_size
+                            << " bytes (lane 0), but lane " << i << " has " << lane_size << " bytes");
+                    return Result<void>::failure(SPIError::INVALID_PARAMETER,
+                        "Lane size mismatch: all lanes must have identical sizes");
+                }
+            }
+        }
+
+        if (expected_size == 0) {
+            FL_WARN("MultiLaneDevice: No data to flush (all lanes empty)");
+            return Result<void>::failure(SPIError::ALLOCATION_FAILED,
+                "No data to transmit");
+        }
+
+        *out_size = expected_size;
+        return Result<void>::success();
+    }
+
+    /// @brief Transpose lanes into a backend-format buffer (or copy for single lane)
+    /// @param out DMA buffer or back buffer sized for the backend
+    Result<void> transposeInto(fl::span<u8> out) const {
+        const char* error = nullptr;
+        bool transpose_ok = false;
+
+        if (backend_type == 1) {
+            // Single lane - no transposition needed, just copy data directly
+            if (lanes.size() > 0) {
+                fl::span<const u8> lane_data = lanes[0].data();
+
+                // Verify sizes match (DMA buffer should be exactly the size we requested)
+                if (lane_data.size() != out.size()) {
+                    FL_WARN("MultiLaneDevice: DMA buffer size mismatch - expected " << lane_data.size()
+                            << " bytes, got " << out.size() << " bytes");
+                    error = "DMA buffer size mismatch";
+                    transpose_ok = false;
+                } else {
+                    // Copy lane data to DMA buffer
+                    for (size_t i = 0; i < lane_data.size(); i++) {
+                        out[i] = lane_data[i];
+                    }
+                    transpose_ok = true;
+                }
+            } else {
+                error = "No lanes configured";
+                transpose_ok = false;
+            }
+
+        } else if (backend_type == 2) {
+            // Dual-SPI transposition
+            fl::optional<SPITransposer::LaneData> lane0, lane1;
+            if (lanes.size() > 0) {
+                lane0 = SPITransposer::LaneData{
+                    lanes[0].data(),
+                    fl::span<const u8>()  // No padding
+                };
+            }
+            if (lanes.size() > 1) {
+                lane1 = SPITransposer::LaneData{
+                    lanes[1].data(),
+                    fl::span<const u8>()  // No padding
+                };
+            }
+
+            transpose_ok = SPITransposer::transpose2(lane0, lane1, out, &error);
+
+        } else if (backend_type == 4) {
+            // Quad-SPI transposition
+            fl::optional<SPITransposer::LaneData> quad[4];
+            for (size_t i = 0; i < lanes.size() && i < 4; i++) {
+                quad[i] = SPITransposer::LaneData{
+                    lanes[i].data(),
+                    fl::span<const u8>()  // No padding
+                };
+            }
+
+            transpose_ok = SPITransposer::transpose4(quad[0], quad[1], quad[2], quad[3],
+                                                      out, &error);
+
+        } else if (backend_type == 8) {
+            // Octal-SPI transposition
+            fl::optional<SPITransposer::LaneData> octal[8];
+            for (size_t i = 0; i < lanes.size() && i < 8; i++) {
+                octal[i] = SPITransposer::LaneData{
+                    lanes[i].data(),
+                    fl::span<const u8>()  // No padding
+                };
+            }
+
+            transpose_ok = SPITransposer::transpose8(octal, out, &error);
+        }
+
+        if (!transpose_ok) {
+            FL_WARN("MultiLaneDevice: Transposition failed - " << (error ? error : "unknown error"));
+            return Result<void>::failure(SPIError::ALLOCATION_FAILED,
+                error ? error : "Transposition failed");
+        }
+        return Result<void>::success();
+    }
 };
 
 // ============================================================================
@@ -268,6 +384,7 @@ void MultiLaneDevice::end() {
 
     // Wait for pending operations
     waitComplete();
+    pImpl->frames.reset("SPI device shut down");
 
     // Release hardware backend
     pImpl->releaseBackend();
@@ -304,37 +421,17 @@ Result<void> MultiLaneDevice::flush() {
             "Device not initialized");
     }
 
-    // Find lane sizes and validate all non-empty lanes have the same size
-    size_t expected_size = 0;
-    bool found_first = false;
-
-    for (size_t i = 0; i < pImpl->lanes.size(); i++) {
-        size_t lane_size = pImpl->lanes[i].bufferSize();
-
-        if (lane_size > 0) {
-            if (!found_first) {
-                // First non-empty lane sets the expected size
-                expected_size = lane_size;
-                found_first = true;
-            } else if (lane_size != expected_size) {
-                // Size mismatch detected
-                FL_WARN("MultiLaneDevice: Lane size mismatch - expected " << expected_size
-                        << " bytes (lane 0), but lane " << i << " has " << lane_size << " bytes");
-                return Result<void>::failure(SPIError::INVALID_PARAMETER,
-                    "Lane size mismatch: all lanes must have identical sizes");
-            }
-        }
+    // Frames queued by flushAsync() go out first, in order
+    if (pImpl->frames.pending()) {
+        pImpl->frames.drain();
     }
 
-    if (expected_size == 0) {
-        FL_WARN("MultiLaneDevice: No data to flush (all lanes empty)");
-        return Result<void>::failure(SPIError::ALLOCATION_FAILED,
-            "No data to transmit");
+    size_t max_size = 0;
+    Result<void> size_result = pImpl->laneSize(&max_size);
+    if (!size_result.ok()) {
+        return size_result;
     }
 
-    // Use expected_size for DMA buffer allocation (all lanes now guaranteed same size)
-    size_t max_size = expected_size;
-
     // Acquire DMA buffer from hardware backend - use polymorphic interface
     DMABuffer dma_buffer = pImpl->backend->acquireDMABuffer(max_size);
 
@@ -344,82 +441,9 @@ Result<void> MultiLaneDevice::flush() {
             "Failed to acquire DMA buffer");
     }
 
-    // Transpose lanes into DMA buffer (or copy for single lane)
-    const char* error = nullptr;
-    bool transpose_ok = false;
-
-    if (pImpl->backend_type == 1) {
-        // Single lane - no transposition needed, just copy data directly
-        if (pImpl->lanes.size() > 0) {
-            fl::span<const u8> lane_data = pImpl->lanes[0].data();
-            fl::span<u8> dma_data = dma_buffer.data();
-
-            // Verify sizes match (DMA buffer should be exactly the size we requested)
-            if (lane_data.size() != dma_data.size()) {
-                FL_WARN("MultiLaneDevice: DMA buffer size mismatch - expected " << lane_data.size()
-                        << " bytes, got " << dma_data.size() << " bytes");
-                error = "DMA buffer size mismatch";
-                transpose_ok = false;
-            } else {
-                // Copy lane data to DMA buffer
-                for (size_t i = 0; i < lane_data.size(); i++) {
-                    dma_data[i] = lane_data[i];
-                }
-                transpose_ok = true;
-            }
-        } else {
-            error = "No lanes configured";
-            transpose_ok = false;
-        }
-
-    } else if (pImpl->backend_type == 2) {
-        // Dual-SPI transposition
-        fl::optional<SPITransposer::LaneData> lane0, lane1;
-        if (pImpl->lanes.size() > 0) {
-            lane0 = SPITransposer::LaneData{
-                pImpl->lanes[0].data(),
-                fl::span<const u8>()  // No padding
-            };
-        }
-        if (pImpl->lanes.size() > 1) {
-            lane1 = SPITransposer::LaneData{
-                pImpl->lanes[1].data(),
-                fl::span<const u8>()  // No padding
-            };
-        }
-
-        transpose_ok = SPITransposer::transpose2(lane0, lane1, dma_buffer.data(), &error);
-
-    } else if (pImpl->backend_type == 4) {
-        // Quad-SPI transposition
-        fl::optional<SPITransposer::LaneData> lanes[4];
-        for (size_t i = 0; i < pImpl->lanes.size() && i < 4; i++) {
-            lanes[i] = SPITransposer::LaneData{
-                pImpl->lanes[i].data(),
-                fl::span<const u8>()  // No padding
-            };
-        }
-
-        transpose_ok = SPITransposer::transpose4(lanes[0], lanes[1], lanes[2], lanes[3],
-                                                  dma_buffer.data(), &error);
-
-    } else if (pImpl->backend_type == 8) {
-        // Octal-SPI transposition
-        fl::optional<SPITransposer::LaneData> lanes[8];
-        for (size_t i = 0; i < pImpl->lanes.size() && i < 8; i++) {
-            lanes[i] = SPITransposer::LaneData{
-                pImpl->lanes[i].data(),
-                fl::span<const u8>()  // No padding
-            };
-        }
-
-        transpose_ok = SPITransposer::transpose8(lanes, dma_buffer.data(), &error);
-    }
-
-    if (!transpose_ok) {
-        FL_WARN("MultiLaneDevice: Transposition failed - " << (error ? error : "unknown error"));
-        return Result<void>::failure(SPIError::ALLOCATION_FAILED,
-            error ? error : "Transposition failed");
+    Result<void> transpose_result = pImpl->transposeInto(dma_buffer.data());
+    if (!transpose_result.ok()) {
+        return transpose_result;
     }
 
     // Transmit via hardware backend - use polymorphic interface
@@ -444,11 +468,48 @@ Result<void> MultiLaneDevice::flush() {
     return Result<void>::success();
 }
 
+fl::task::Promise<FlushInfo> MultiLaneDevice::flushAsync() {
+    if (!isReady()) {
+        return fl::task::Promise<FlushInfo>::reject(
+            fl::task::Error("Device not initialized"));
+    }
+
+    size_t bytes_per_lane = 0;
+    Result<void> size_result = pImpl->laneSize(&bytes_per_lane);
+    if (!size_result.ok()) {
+        return fl::task::Promise<FlushInfo>::reject(
+            fl::task::Error(size_result.message()));
+    }
+
+    // Transpose into the back buffer while the previous frame (if any) is
+    // still being clocked out of the DMA buffer
+    pImpl->frames.attach(pImpl->backend);
+    fl::span<u8> back = pImpl->frames.stage(bytes_per_lane);
+    Result<void> transpose_result = pImpl->transposeInto(back);
+    if (!transpose_result.ok()) {
+        return fl::task::Promise<FlushInfo>::reject(
+            fl::task::Error(transpose_result.message()));
+    }
+
+    // Lanes are free for the next frame as soon as they are transposed
+    for (auto& lane : pImpl->lanes) {
+        lane.clear();
+    }
+
+    FL_DBG("MultiLaneDevice: Queued " << pImpl->lanes.size() << " lanes ("
+           << bytes_per_lane << " bytes per lane)");
+    return pImpl->frames.submit();
+}
+
 bool MultiLaneDevice::waitComplete(u32 timeout_ms) {
     if (!isReady()) {
         return false;
     }
 
+    if (!pImpl->frames.drain(timeout_ms)) {
+        return false;
+    }
+
     // Use polymorphic interface - no casting needed!
     return pImpl->backend->waitComplete(timeout_ms);
 }
@@ -459,7 +520,7 @@ bool MultiLaneDevice::isBusy() const {
     }
 
     // Use polymorphic interface - no casting needed!
-    return pImpl->backend->isBusy();
+    return pImpl->frames.pending() || pImpl->backend->isBusy();
 }
 
 WriteResult MultiLaneDevice::writeImpl(fl::span<const fl::span<const u8>> lane_data) {
@@ -8,6 +8,7 @@
 #include "fl/stl/unique_ptr.h"
 #include "fl/stl/optional.h"
 #include "fl/task/promise.h"  // for fl::task::Error
+#include "fl/channels/spi/async_flush.h"
 #include "fl/channels/spi/config.h"
 #include "fl/channels/spi/transaction.h"
 #include "fl/channels/spi/write_result.h"
@@ -31,6 +32,8 @@ namespace spi {
 /// - Each lane has independent buffer (via Lane class)
 /// - User writes to each lane independently
 /// - flush() transposes all lanes and transmits via hardware
+/// - flushAsync() double-buffers: it transposes into a second buffer while
+///   the previous frame is still on the wire and returns a promise
 /// - Auto-selects SpiHw1 (1 lane), SpiHw2 (2 lanes), SpiHw4 (3-4 lanes), or SpiHw8 (5-8 lanes)
 ///
 /// **Example:**
@@ -48,6 +51,16 @@ namespace spi {
 ///     spi.wait();  // Block until transmission completes
 /// }
 /// @endcode
+///
+/// **Double-buffered example:**
+/// @code
+/// void loop() {
+///     renderFrame();                      // fills spi.lane(i) for every lane
+///     spi.flushAsync()                    // returns without waiting for DMA
+///         .catch_([](const fl::task::Error& e) { FL_WARN(e.message); });
+///     FastLED.show();                     // pumps fl::task, completing frames
+/// }
+/// @endcode
 class MultiLaneDevice {
 public:
     /// @brief Configuration for multi-lane SPI
@@ -111,9 +124,24 @@ public:
     /// @note Transaction API not yet implemented - call waitComplete() manually after flush()
     Result<void> flush();
 
+    /// @brief Flush all lanes without waiting for the previous frame
+    /// @returns Promise resolved with the frame's FlushInfo once it has been
+    ///          transmitted, or rejected with the reason it was not sent
+    /// @details Transposes the lanes into a back buffer while the previous
+    ///          frame is still being clocked out of the DMA buffer, clears the
+    ///          lanes, and returns. The frame is handed to DMA as soon as the
+    ///          bus is free; completion is picked up by the next flushAsync(),
+    ///          waitComplete(), or fl::task::run() (also pumped by
+    ///          FastLED.show()).
+    /// @note Blocks only when a frame is already waiting behind the one in
+    ///       flight, i.e. when rendering outpaces the bus.
+    /// @note Lane size rules are the same as for flush()
+    fl::task::Promise<FlushInfo> flushAsync();
+
     /// @brief Wait for pending transmission to complete
     /// @param timeout_ms Maximum time to wait (default: forever)
     /// @returns true if completed, false on timeout
+    /// @note Also drains frames queued by flushAsync(), resolving their promises
     bool waitComplete(u32 timeout_ms = (fl::numeric_limits<u32>::max)());
 
     /// @brief Convenience method - wait for transmission to complete
@@ -122,7 +150,7 @@ public:
     bool wait() { return waitComplete(); }
 
     /// @brief Check if transmission is in progress
-    /// @returns true if busy, false if idle
+    /// @returns true if busy (or a flushAsync() frame is queued), false if idle
     bool isBusy() const;
 
     // ========== High-Level Write API ==========
@@ -242,6 +242,70 @@ void wave8Transpose_16x4_pipe4(const u8 (&FL_RESTRICT_PARAM lanes_a)[16],
                                        output_a, output_b, output_c, output_d);
 }
 
+// ============================================================================
+// Fused Multi-Lane Encoder
+// ============================================================================
+
+FL_OPTIMIZE_FUNCTION
+size_t wave8EncodeLanes(fl::span<const fl::span<const u8>> lanes,
+                        u8 dataWidth,
+                        const Wave8ByteExpansionLut &lut,
+                        fl::span<u8> output) {
+    if ((dataWidth != 8 && dataWidth != 16) || lanes.size() > dataWidth) {
+        return 0;
+    }
+    // The block encoders store whole u32 words, which fault on Xtensa and
+    // RISC-V when the destination is not word aligned.
+    if ((fl::ptr_to_int(output.data()) & 3u) != 0) {
+        return 0;
+    }
+
+    // Ragged lanes: positions below minBytes read every lane unconditionally,
+    // the tail zero-pads lanes that have already run out.
+    const size_t numLanes = lanes.size();
+    size_t maxBytes = 0;
+    size_t minBytes = numLanes ? lanes[0].size() : 0;
+    for (size_t lane = 0; lane < numLanes; ++lane) {
+        const size_t n = lanes[lane].size();
+        maxBytes = n > maxBytes ? n : maxBytes;
+        minBytes = n < minBytes ? n : minBytes;
+    }
+
+    const size_t blockSize = dataWidth * sizeof(Wave8Byte);
+    const size_t total = maxBytes * blockSize;
+    if (output.size() < total) {
+        return 0;
+    }
+
+    // byte_lut[0x00].symbols[0] = W0, byte_lut[0xFF].symbols[0] = W1 (see BF1)
+    const u8 W0 = lut.lut[0x00].symbols[0].data;
+    const u8 W1 = lut.lut[0xFF].symbols[0].data;
+    const detail::Wave8SimdMasks masks = (dataWidth == 16)
+        ? detail::wave8_simd_masks_16(W0, W1)
+        : detail::wave8_simd_masks_8(W0, W1);
+
+    u8 gathered[16] = {0};  // Lanes >= numLanes stay zero
+    u8 *out = output.data();
+    for (size_t i = 0; i < maxBytes; ++i) {
+        if (i < minBytes) {
+            for (size_t lane = 0; lane < numLanes; ++lane) {
+                gathered[lane] = lanes[lane][i];
+            }
+        } else {
+            for (size_t lane = 0; lane < numLanes; ++lane) {
+                gathered[lane] = (i < lanes[lane].size()) ? lanes[lane][i] : 0;
+            }
+        }
+        if (dataWidth == 16) {
+            detail::wave8_encode_16_simd(gathered, masks, out);
+        } else {
+            detail::wave8_encode_8_simd(gathered, masks, out);
+        }
+        out += blockSize;
+    }
+    return total;
+}
+
 // ============================================================================
 // LUT Builder from Timing Data
 // Note: This is not designed to be called from ISR handlers.
@@ -6,6 +6,7 @@
 
 #include "fl/stl/align.h"
 #include "fl/stl/compiler_control.h"
+#include "fl/stl/span.h"
 #include "fl/stl/stdint.h"
 
 namespace fl {
@@ -203,6 +204,40 @@ void wave8Transpose_16x4_bf1_pipe4(
     u8 (&FL_RESTRICT_PARAM output_c)[16 * sizeof(Wave8Byte)],
     u8 (&FL_RESTRICT_PARAM output_d)[16 * sizeof(Wave8Byte)]);
 
+/// @brief Size in bytes of the fused encoder output for one frame.
+/// @param bytesPerLane Longest lane length in bytes
+/// @param dataWidth Parallel lane count (8 or 16)
+inline size_t wave8EncodedSize(size_t bytesPerLane, u8 dataWidth) {
+    return bytesPerLane * dataWidth * sizeof(Wave8Byte);
+}
+
+/// @brief Fused multi-lane encoder: expand + transpose a whole frame in one pass.
+///
+/// Reads every lane's encoded bytes (e.g. `ChannelData::getData()`) and writes
+/// the final interleaved DMA words directly, with no intermediate Wave8Byte
+/// staging buffer and no second transpose pass. Per byte position it runs the
+/// BF1 identity (one bit-transpose of the lane bytes) and then produces each
+/// 16-byte output block with u32x4 AND/XOR against per-chipset pulse masks.
+///
+/// Output layout is bit-identical to calling wave8Transpose_8 / _16 once per
+/// byte position and concatenating the blocks (for 8 lanes, also identical to
+/// wave8_expand_byte per lane followed by transpose_wave8byte_parlio).
+///
+/// Lanes shorter than the longest one are zero-padded, as are the unused lanes
+/// when `lanes.size() < dataWidth`. Not for ISR use — encode whole frames
+/// ahead of transmission.
+///
+/// @param lanes Per-lane input bytes (at most dataWidth entries)
+/// @param dataWidth Parallel lane count: 8 or 16
+/// @param lut Byte expansion LUT (only the bit-0/bit-1 patterns are used)
+/// @param output Destination, 4-byte aligned, at least wave8EncodedSize() bytes
+/// @return Bytes written, or 0 on unsupported width / short or misaligned
+///         output buffer
+size_t wave8EncodeLanes(fl::span<const fl::span<const u8>> lanes,
+                        u8 dataWidth,
+                        const Wave8ByteExpansionLut &lut,
+                        fl::span<u8> output);
+
 // Untranspose functions (for testing - reverse the transpose operation)
 void wave8Untranspose_2(
     const u8 (&FL_RESTRICT_PARAM transposed)[2 * sizeof(Wave8Byte)],
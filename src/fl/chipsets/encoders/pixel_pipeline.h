@@ -0,0 +1,257 @@
+#pragma once
+
+/// @file chipsets/encoders/pixel_pipeline.h
+/// @brief Compile-time specialized RGB output pipeline (dither, scale, gamma, reorder)
+///
+/// The generic encoder path pulls each pixel through PixelIterator: four
+/// indirect calls (has / loadAndScaleRGB / stepDithering / advanceData) plus a
+/// back_inserter push per byte, with the dither and scale work done even when
+/// they are no-ops. For 3-byte chipsets the per-frame work is fully described
+/// by (EOrder, dither on/off, scale on/off, gamma LUT on/off), so each
+/// combination gets its own straight-line kernel and the channel picks one
+/// from a table once per frame.
+///
+/// Per byte, every kernel computes exactly what PixelController does:
+///     v = src[ch]; v = v ? qadd8(v, d[ch]) : 0; v = scale8(v, premixed[ch]);
+/// (then gamma[v] when a LUT is given), with d toggling to e - d after each
+/// pixel. Disabled stages are compiled out rather than evaluated as identity.
+///
+/// Only contiguous CRGB input (advance == 3) is handled; RGBW/RGBWW and
+/// showColor() frames stay on the PixelIterator path.
+
+#include "fl/stl/stdint.h"
+#include "fl/stl/compiler_control.h"
+#include "fl/stl/noexcept.h"
+#include "fl/math/math8.h"
+#include "fl/math/scale8.h"
+#include "pixel_controller.h"
+#include "eorder.h"
+
+#if !defined(FL_IS_AVR)
+#include "fl/math/simd.h"
+#endif
+
+namespace fl {
+
+/// @brief Per-frame inputs of a pipeline kernel (channel-indexed R, G, B)
+struct PixelPipelineParams {
+    const u8* src = nullptr;  ///< CRGB bytes, 3 per pixel
+    int count = 0;            ///< Number of pixels
+    u8 scale[3] = {255, 255, 255};  ///< Premixed color correction * brightness
+    u8 d[3] = {0, 0, 0};      ///< Dither offset for the first pixel
+    u8 e[3] = {0, 0, 0};      ///< Dither range (d toggles to e - d per pixel)
+    const u8* gamma = nullptr;  ///< Optional 256-entry LUT applied last
+};
+
+/// @brief Kernel signature: writes count * 3 bytes in wire order to out
+typedef void (*PixelPipelineFn)(const PixelPipelineParams& params, u8* out);
+
+/// @brief Stage bits used to pick a kernel
+struct PixelPipelineStage {
+    static constexpr u8 kDither = 1;
+    static constexpr u8 kScale = 2;
+    static constexpr u8 kGamma = 4;
+};
+
+namespace detail {
+
+template <bool DITHER, bool SCALE, bool GAMMA>
+FASTLED_FORCE_INLINE u8 pixelPipelineByte(u8 v, u8 d, u8 s, const u8* gamma) FL_NOEXCEPT {
+    if (DITHER) {
+        // qadd8(0, 0) == 0, so masking d keeps black pixels black without a branch
+        v = fl::qadd8(v, v ? d : 0);
+    }
+    if (SCALE) {
+        v = fl::scale8(v, s);
+    }
+    if (GAMMA) {
+        v = gamma[v];
+    }
+    return v;
+}
+
+template <EOrder ORDER, bool DITHER, bool SCALE, bool GAMMA>
+FASTLED_FORCE_INLINE void pixelPipelinePixel(const u8* px, u8* out, const u8* d,
+                                             const u8* s, const u8* gamma) FL_NOEXCEPT {
+    constexpr int c0 = RGB_BYTE0(ORDER);
+    constexpr int c1 = RGB_BYTE1(ORDER);
+    constexpr int c2 = RGB_BYTE2(ORDER);
+    out[0] = pixelPipelineByte<DITHER, SCALE, GAMMA>(px[c0], d[c0], s[c0], gamma);
+    out[1] = pixelPipelineByte<DITHER, SCALE, GAMMA>(px[c1], d[c1], s[c1], gamma);
+    out[2] = pixelPipelineByte<DITHER, SCALE, GAMMA>(px[c2], d[c2], s[c2], gamma);
+}
+
+#if !defined(FL_IS_AVR)
+// Dither + scale 16 pixels (48 bytes, three vectors) at a time in source
+// (RGB) order. 48 bytes is a whole number of pixel pairs, so the per-byte
+// channel and dither-phase pattern is the same for every block and is built
+// once. Returns the number of pixels written to rgbOut.
+template <bool DITHER, bool SCALE>
+inline int pixelPipelineBlocksRGB(const PixelPipelineParams& p, u8* rgbOut,
+                                  int maxPixels) FL_NOEXCEPT {
+    namespace fsimd = fl::simd; // ok bare using
+    const int blocks = maxPixels / 16;
+    if (blocks == 0) {
+        return 0;
+    }
+    u8 scalePattern[48];
+    u8 ditherPattern[48];
+    for (int b = 0; b < 48; ++b) {
+        const int ch = b % 3;
+        const bool odd = ((b / 3) & 1) != 0;
+        scalePattern[b] = p.scale[ch];
+        ditherPattern[b] = odd ? static_cast<u8>(p.e[ch] - p.d[ch]) : p.d[ch];
+    }
+    const auto one = fsimd::set1_u16_8(255);
+    for (int blk = 0; blk < blocks; ++blk) {
+        const u8* src = p.src + blk * 48;
+        u8* dst = rgbOut + blk * 48;
+        for (int k = 0; k < 3; ++k) {
+            auto v = fsimd::load_u8_16(src + k * 16);
+            if (DITHER) {
+                // nz = (v + 255) >> 8 is 1 for v > 0, else 0
+                const auto dv = fsimd::load_u8_16(ditherPattern + k * 16);
+                const auto nzLo = fsimd::srli_u16_8(fsimd::add_u16_8(fsimd::widen_lo_u8_to_u16(v), one), 8);
+                const auto nzHi = fsimd::srli_u16_8(fsimd::add_u16_8(fsimd::widen_hi_u8_to_u16(v), one), 8);
+                const auto dLo = fsimd::mullo_u16_8(fsimd::widen_lo_u8_to_u16(dv), nzLo);
+                const auto dHi = fsimd::mullo_u16_8(fsimd::widen_hi_u8_to_u16(dv), nzHi);
+                v = fsimd::add_sat_u8_16(v, fsimd::narrow_u16_to_u8(dLo, dHi));
+            }
+            if (SCALE) {
+                const auto sv = fsimd::load_u8_16(scalePattern + k * 16);
+                const auto vLo = fsimd::widen_lo_u8_to_u16(v);
+                const auto vHi = fsimd::widen_hi_u8_to_u16(v);
+                auto lo = fsimd::mullo_u16_8(vLo, fsimd::widen_lo_u8_to_u16(sv));
+                auto hi = fsimd::mullo_u16_8(vHi, fsimd::widen_hi_u8_to_u16(sv));
+#if (FASTLED_SCALE8_FIXED == 1)
+                // v * (s + 1) == v * s + v, which stays within 16 bits
+                lo = fsimd::add_u16_8(lo, vLo);
+                hi = fsimd::add_u16_8(hi, vHi);
+#endif
+                v = fsimd::narrow_u16_to_u8(fsimd::srli_u16_8(lo, 8), fsimd::srli_u16_8(hi, 8));
+            }
+            fsimd::store_u8_16(dst + k * 16, v);
+        }
+    }
+    return blocks * 16;
+}
+#endif  // !FL_IS_AVR
+
+template <EOrder ORDER, bool DITHER, bool SCALE, bool GAMMA>
+void pixelPipelineRGB(const PixelPipelineParams& p, u8* out) FL_NOEXCEPT {
+    const u8* s = p.scale;
+    const u8 d1[3] = {static_cast<u8>(p.e[0] - p.d[0]),
+                      static_cast<u8>(p.e[1] - p.d[1]),
+                      static_cast<u8>(p.e[2] - p.d[2])};
+    int i = 0;
+#if !defined(FL_IS_AVR)
+    if ((DITHER || SCALE) && !GAMMA) {
+        if (ORDER == RGB) {
+            i = pixelPipelineBlocksRGB<DITHER, SCALE>(p, out, p.count);
+        } else {
+            // Transform a block into a stack buffer, then permute into place
+            u8 tmp[16 * 3];
+            PixelPipelineParams block = p;
+            for (; i + 16 <= p.count; i += 16) {
+                block.src = p.src + i * 3;
+                pixelPipelineBlocksRGB<DITHER, SCALE>(block, tmp, 16);
+                for (int j = 0; j < 16; ++j) {
+                    pixelPipelinePixel<ORDER, false, false, false>(
+                        tmp + j * 3, out + (i + j) * 3, nullptr, nullptr, nullptr);
+                }
+            }
+        }
+    }
+#endif
+    // Blocks cover whole pixel pairs, so the scalar tail starts on phase d
+    const u8* src = p.src + i * 3;
+    u8* dst = out + i * 3;
+    for (; i + 2 <= p.count; i += 2) {
+        pixelPipelinePixel<ORDER, DITHER, SCALE, GAMMA>(src, dst, p.d, s, p.gamma);
+        pixelPipelinePixel<ORDER, DITHER, SCALE, GAMMA>(src + 3, dst + 3, d1, s, p.gamma);
+        src += 6;
+        dst += 6;
+    }
+    if (i < p.count) {
+        pixelPipelinePixel<ORDER, DITHER, SCALE, GAMMA>(src, dst, p.d, s, p.gamma);
+    }
+}
+
+// One row per EOrder (RGB, RBG, GRB, GBR, BRG, BGR): entries indexed by the
+// dither/scale bits; gamma always runs the full kernel.
+template <EOrder ORDER>
+inline PixelPipelineFn pixelPipelineForOrder(u8 stages) FL_NOEXCEPT {
+    if (stages & PixelPipelineStage::kGamma) {
+        return &pixelPipelineRGB<ORDER, true, true, true>;
+    }
+    static const PixelPipelineFn kTable[4] = {
+        &pixelPipelineRGB<ORDER, false, false, false>,
+        &pixelPipelineRGB<ORDER, true, false, false>,
+        &pixelPipelineRGB<ORDER, false, true, false>,
+        &pixelPipelineRGB<ORDER, true, true, false>,
+    };
+    return kTable[stages & 3];
+}
+
+} // namespace detail
+
+/// @brief Extract kernel inputs from an RGB-ordered PixelController
+/// @return false if the controller is not a contiguous CRGB run (showColor)
+inline bool makePixelPipelineParams(const PixelController<RGB, 1, 0xFFFFFFFF>& pixels,
+                                    PixelPipelineParams* out,
+                                    const u8* gamma = nullptr) FL_NOEXCEPT {
+    if (pixels.mAdvance != 3) {
+        return false;
+    }
+    out->src = pixels.mData;
+    out->count = pixels.mLenRemaining;
+    for (int i = 0; i < 3; ++i) {
+        out->scale[i] = pixels.mColorAdjustment.premixed.raw[i];
+        out->d[i] = pixels.d[i];
+        out->e[i] = pixels.e[i];
+    }
+    out->gamma = gamma;
+    return true;
+}
+
+/// @brief Stages a frame actually needs; disabled ones are compiled out
+inline u8 pixelPipelineStages(const PixelPipelineParams& p) FL_NOEXCEPT {
+    u8 stages = 0;
+    if ((p.d[0] | p.d[1] | p.d[2] | p.e[0] | p.e[1] | p.e[2]) != 0) {
+        stages |= PixelPipelineStage::kDither;
+    }
+#if (FASTLED_SCALE8_FIXED == 1)
+    // scale8(v, 255) == v only with the fixed rounding
+    if ((p.scale[0] & p.scale[1] & p.scale[2]) != 255) {
+        stages |= PixelPipelineStage::kScale;
+    }
+#else
+    stages |= PixelPipelineStage::kScale;
+#endif
+    if (p.gamma) {
+        stages |= PixelPipelineStage::kGamma;
+    }
+    return stages;
+}
+
+/// @brief Pick the kernel for a wire order and stage set
+inline PixelPipelineFn selectPixelPipeline(EOrder order, u8 stages) FL_NOEXCEPT {
+    switch (order) {
+        case RBG: return detail::pixelPipelineForOrder<RBG>(stages);
+        case GRB: return detail::pixelPipelineForOrder<GRB>(stages);
+        case GBR: return detail::pixelPipelineForOrder<GBR>(stages);
+        case BRG: return detail::pixelPipelineForOrder<BRG>(stages);
+        case BGR: return detail::pixelPipelineForOrder<BGR>(stages);
+        case RGB:
+        default: return detail::pixelPipelineForOrder<RGB>(stages);
+    }
+}
+
+/// @brief Convert a frame: selects the kernel and runs it
+/// @param out Must hold params.count * 3 bytes
+inline void runPixelPipeline(const PixelPipelineParams& params, EOrder order,
+                             u8* out) FL_NOEXCEPT {
+    selectPixelPipeline(order, pixelPipelineStages(params))(params, out);
+}
+
+} // namespace fl
@@ -12,6 +12,7 @@
 #include "fl/codec/pixel.h"
 #include "fl/stl/chrono.h"
 #include "fl/stl/noexcept.h"
+#include "fl/math/xymap.h"
 
 namespace fl {
 
@@ -485,6 +486,167 @@ bool Jpeg::decodeStream(
     return false;
 }
 
+//////////////////////////////////////////////////////////////////////////
+// Jpeg::decodeToLeds - scaled decode into an XYMap
+//////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+// Box-filters decoded MCU blocks onto an XYMap. LED (lx, ly) averages the
+// scaled-image rectangle [x0, x1) x [y0, y1). tjpgd emits MCUs in raster
+// order, so the block holding a box's bottom-right pixel is the last one to
+// touch it; the LED is written right then and its accumulator reused.
+// Accumulators form a ring of LED rows, sized so that two rows sharing a
+// slot never overlap the same MCU row.
+class JpegLedSink {
+  public:
+    JpegLedSink(const XYMap& xymap, fl::span<CRGB> leds, fl::u16 src_w,
+                fl::u16 src_h, fl::u8 scale)
+        : mXYMap(xymap), mLeds(leds), mWidth(xymap.getWidth()) {
+        const fl::u16 height = xymap.getHeight();
+        buildEdges(src_w, mWidth, &mX0, &mX1);
+        buildEdges(src_h, height, &mY0, &mY1);
+        // An MCU row is at most 16 pixels tall before scaling.
+        const fl::u32 band = 16u >> scale;
+        const fl::u32 rows_per_src = (height + src_h - 1) / src_h;
+        const fl::u32 ring = band * rows_per_src + 1;
+        mRingRows = static_cast<fl::u16>(ring < height ? ring : height);
+        mSums.resize(static_cast<fl::size>(mRingRows) * mWidth * 3, 0);
+    }
+
+    static bool onBlock(void* ctx, fl::u16 x, fl::u16 y, fl::u16 w, fl::u16 h,
+                        const fl::u8* rgb) {
+        static_cast<JpegLedSink*>(ctx)->accumulate(x, y, w, h, rgb);
+        return true;
+    }
+
+  private:
+    const XYMap& mXYMap;
+    fl::span<CRGB> mLeds;
+    fl::u16 mWidth;
+    fl::u16 mRingRows = 0;
+    fl::vector<fl::u16> mX0, mX1, mY0, mY1;
+    fl::vector<fl::u32> mSums;
+
+    // Splits src pixels into dst boxes. When upscaling each box is one
+    // source pixel and neighbouring LEDs repeat it.
+    static void buildEdges(fl::u16 src, fl::u16 dst, fl::vector<fl::u16>* lo,
+                           fl::vector<fl::u16>* hi) {
+        lo->resize(dst);
+        hi->resize(dst);
+        for (fl::u32 i = 0; i < dst; ++i) {
+            const fl::u32 a = i * src / dst;
+            const fl::u32 b = (i + 1) * src / dst;
+            (*lo)[i] = static_cast<fl::u16>(a);
+            (*hi)[i] = static_cast<fl::u16>(b > a ? b : a + 1);
+        }
+    }
+
+    void accumulate(fl::u16 bx, fl::u16 by, fl::u16 bw, fl::u16 bh,
+                    const fl::u8* rgb) {
+        const fl::u32 bx_end = static_cast<fl::u32>(bx) + bw;
+        const fl::u32 by_end = static_cast<fl::u32>(by) + bh;
+        const fl::u16 height = static_cast<fl::u16>(mY0.size());
+        fl::u16 lx_first = 0;
+        while (lx_first < mWidth && mX1[lx_first] <= bx) {
+            ++lx_first;
+        }
+        for (fl::u16 ly = 0; ly < height && mY0[ly] < by_end; ++ly) {
+            if (mY1[ly] <= by) {
+                continue;
+            }
+            const fl::u32 ry0 = mY0[ly] > by ? mY0[ly] : by;
+            const fl::u32 ry1 = mY1[ly] < by_end ? mY1[ly] : by_end;
+            const bool row_done = mY1[ly] <= by_end;
+            fl::u32* sums = &mSums[static_cast<fl::size>(ly % mRingRows) * mWidth * 3];
+            for (fl::u16 lx = lx_first; lx < mWidth && mX0[lx] < bx_end; ++lx) {
+                const fl::u32 rx0 = mX0[lx] > bx ? mX0[lx] : bx;
+                const fl::u32 rx1 = mX1[lx] < bx_end ? mX1[lx] : bx_end;
+                fl::u32 r = 0, g = 0, b = 0;
+                for (fl::u32 sy = ry0; sy < ry1; ++sy) {
+                    const fl::u8* p = rgb + ((sy - by) * bw + (rx0 - bx)) * 3;
+                    for (fl::u32 sx = rx0; sx < rx1; ++sx) {
+                        r += p[0];
+                        g += p[1];
+                        b += p[2];
+                        p += 3;
+                    }
+                }
+                fl::u32* acc = sums + lx * 3;
+                acc[0] += r;
+                acc[1] += g;
+                acc[2] += b;
+                if (row_done && mX1[lx] <= bx_end) {
+                    const fl::u32 count = static_cast<fl::u32>(mX1[lx] - mX0[lx]) *
+                                          (mY1[ly] - mY0[ly]);
+                    const fl::u16 index = mXYMap(lx, ly);
+                    if (index < mLeds.size()) {
+                        mLeds[index] = CRGB(static_cast<fl::u8>(acc[0] / count),
+                                            static_cast<fl::u8>(acc[1] / count),
+                                            static_cast<fl::u8>(acc[2] / count));
+                    }
+                    acc[0] = acc[1] = acc[2] = 0;
+                }
+            }
+        }
+    }
+};
+
+// Largest downscale whose output still has at least as many pixels as the
+// map in both directions.
+fl::u8 autoJpegScale(fl::u16 src_w, fl::u16 src_h, fl::u16 dst_w, fl::u16 dst_h) {
+    fl::u8 scale = 0;
+    while (scale < 3 && (src_w >> (scale + 1)) >= dst_w &&
+           (src_h >> (scale + 1)) >= dst_h) {
+        ++scale;
+    }
+    return scale;
+}
+
+} // namespace
+
+bool Jpeg::decodeToLeds(fl::span<const fl::u8> data, const XYMap& xymap,
+                        fl::span<CRGB> leds, Scale scale,
+                        fl::string* error_message) {
+    if (xymap.getWidth() == 0 || xymap.getHeight() == 0 || leds.empty()) {
+        if (error_message) {
+            *error_message = "XYMap and LED buffer must not be empty";
+        }
+        return false;
+    }
+
+    // Heap-allocated: the tjpgd workspace is too large for small stacks.
+    auto decoder = fl::make_unique<fl::third_party::TJpgBlockDecoder>();
+    if (!decoder->prepare(data)) {
+        if (error_message) {
+            *error_message = decoder->error();
+        }
+        return false;
+    }
+
+    const fl::u8 shift = (scale == Scale::Auto)
+        ? autoJpegScale(decoder->width(), decoder->height(),
+                        xymap.getWidth(), xymap.getHeight())
+        : static_cast<fl::u8>(scale);
+    const fl::u16 src_w = decoder->width() >> shift;
+    const fl::u16 src_h = decoder->height() >> shift;
+    if (src_w == 0 || src_h == 0) {
+        if (error_message) {
+            *error_message = "Image too small for the requested scale";
+        }
+        return false;
+    }
+
+    JpegLedSink sink(xymap, leds, src_w, src_h, shift);
+    if (!decoder->decompress(shift, &JpegLedSink::onBlock, &sink)) {
+        if (error_message) {
+            *error_message = decoder->error();
+        }
+        return false;
+    }
+    return true;
+}
+
 JpegInfo Jpeg::parseInfo(fl::span<const fl::u8> data, fl::string* error_message) {
     (void)data;
     (void)error_message;
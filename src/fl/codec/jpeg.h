@@ -8,6 +8,7 @@ namespace fl {
 
 // Forward declarations
 class JpegDecoder;
+class XYMap;
 using JpegDecoderPtr = fl::shared_ptr<JpegDecoder>;
 
 // JPEG metadata information structure
@@ -102,6 +103,18 @@ private:
 // Main JPEG codec interface
 class Jpeg {
 public:
+    // Output scale for decodeToLeds(). The decoder shrinks every MCU before
+    // handing it out, so smaller scales decode faster and never need a
+    // full-resolution buffer.
+    enum class Scale : fl::u8 {
+        Full = 0,     // 1:1
+        Half = 1,     // 1/2
+        Quarter = 2,  // 1/4
+        Eighth = 3,   // 1/8: DC coefficient only, IDCT skipped
+        DcOnly = Eighth,
+        Auto = 0xFF   // Smallest of the above that still covers the XYMap
+    };
+
     // Synchronous decode interface
     static bool decode(const JpegConfig& config, fl::span<const fl::u8> data,
                       Frame* frame, fl::string* error_message = nullptr);
@@ -124,6 +137,14 @@ public:
                            Frame* frame, fl::u32 max_time_per_chunk_ms = 4,
                            fl::function<bool(float)> progress_callback = {});
 
+    // Decode straight into an LED buffer laid out by xymap. MCU blocks are
+    // box-filtered onto the map as they are decoded, with no intermediate
+    // frame; only a few rows of accumulators are kept. The image is stretched
+    // to the map's width and height.
+    static bool decodeToLeds(fl::span<const fl::u8> data, const XYMap& xymap,
+                             fl::span<CRGB> leds, Scale scale = Scale::Auto,
+                             fl::string* error_message = nullptr);
+
     // Metadata parsing
     static JpegInfo parseInfo(fl::span<const fl::u8> data, fl::string* error_message = nullptr);
 
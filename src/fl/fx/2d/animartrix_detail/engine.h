@@ -8,6 +8,7 @@
 #include "fl/fx/2d/animartrix_detail/context.h"
 #include "fl/fx/2d/animartrix_detail/core_types.h"
 #include "fl/fx/2d/animartrix_detail/engine_core.h"
+#include "fl/fx/2d/animartrix_detail/polar_geometry.h"
 #include "fl/math/math.h"
 #include "fl/stl/optional.h"
 #include "fl/stl/stdint.h"
@@ -31,8 +32,11 @@ struct Engine {
     modulators move;
     rgb pixel;
 
-    fl::vector<fl::vector<float>> polar_theta;
-    fl::vector<fl::vector<float>> distance;
+    // Shared per-pixel polar coordinates; polar_theta/distance are [x][y]
+    // views into it.
+    fl::shared_ptr<const PolarGeometry> geometry;
+    PolarGeometry::Table polar_theta;
+    PolarGeometry::Table distance;
 
     unsigned long a = 0;
     unsigned long b = 0;
@@ -66,13 +70,14 @@ struct Engine {
         this->num_x = w;
         this->num_y = h;
         this->radial_filter_radius = fl::min(w, h) * 0.65;
-        render_polar_lookup_table(
-            (num_x / 2) - 0.5,
-            (num_y / 2) - 0.5,
-            polar_theta,
-            distance,
-            num_x,
-            num_y);
+        PolarGeometryKey key;
+        key.num_x = w;
+        key.num_y = h;
+        key.center_x = (num_x / 2) - 0.5;
+        key.center_y = (num_y / 2) - 0.5;
+        geometry = PolarGeometry::acquire(key);
+        polar_theta = geometry->thetaTable();
+        distance = geometry->distanceTable();
         timings.master_speed = 0.01;
     }
 
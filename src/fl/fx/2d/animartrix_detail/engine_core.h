@@ -22,25 +22,6 @@ FL_OPTIMIZATION_LEVEL_O3_BEGIN
 
 namespace fl {
 
-// Polar coordinate pre-computation
-// Builds polar_theta[x][y] and distance[x][y] lookup tables
-inline void render_polar_lookup_table(float cx, float cy,
-                                      fl::vector<fl::vector<float>> &polar_theta,
-                                      fl::vector<fl::vector<float>> &distance,
-                                      int num_x, int num_y) {
-    polar_theta.resize(num_x, fl::vector<float>(num_y, 0.0f));
-    distance.resize(num_x, fl::vector<float>(num_y, 0.0f));
-
-    for (int xx = 0; xx < num_x; xx++) {
-        for (int yy = 0; yy < num_y; yy++) {
-            float dx = xx - cx;
-            float dy = yy - cy;
-            distance[xx][yy] = fl::hypotf(dx, dy);
-            polar_theta[xx][yy] = fl::atan2f(dy, dx);
-        }
-    }
-}
-
 // Calculate oscillators from timing ratios
 // Computes linear, radial, directional, and noise_angle modulators
 inline void calculate_oscillators(oscillators &timings, modulators &move,
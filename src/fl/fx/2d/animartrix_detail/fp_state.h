@@ -1,7 +1,7 @@
 #pragma once
 
 // Generic fixed-point state for Animartrix2 visualizers.
-// Holds SoA (Structure-of-Arrays) per-pixel geometry cache and Perlin fade LUT.
+// Holds SoA (Structure-of-Arrays) per-pixel geometry and Perlin fade LUT.
 // Each FP visualizer owns an FPVizState instance as a private member.
 
 #include "fl/stl/align.h"
@@ -15,12 +15,13 @@ namespace fl {
 
 // FL_ALIGNAS(16): aligns the struct to 16 bytes for potential SIMD loads.
 struct FL_ALIGNAS(16) FPVizState {
-    // SoA pixel geometry — built once when grid size changes, reused every frame.
-    // Padded to next multiple of 4 for SIMD safety.
-    fl::vector<fl::i32> polar_theta_raw;   // atan2(dy, dx), raw s16x16
-    fl::vector<fl::i32> distance_raw;      // hypot(dx, dy), raw s16x16
-    fl::vector<fl::i32> sqrt_distance_raw; // sqrt(distance), raw s16x16
-    fl::vector<fl::u16> pixel_idx;         // pre-mapped xyMap(x,y) LED index
+    // Per-pixel geometry in s16x16, borrowed from the Engine's shared
+    // PolarGeometry (cache-line aligned, padded to a multiple of 4).
+    fl::shared_ptr<const PolarGeometry> geometry;
+    const fl::i32 *polar_theta_raw = nullptr;   // atan2(dy, dx)
+    const fl::i32 *distance_raw = nullptr;      // hypot(dx, dy)
+    const fl::i32 *sqrt_distance_raw = nullptr; // sqrt(distance)
+    fl::vector<fl::u16> pixel_idx;              // pre-mapped xyMap(x,y) LED index
     int count = 0;
 
     // Perlin fade LUT (257 entries, Q8.24 format).
@@ -29,26 +30,23 @@ struct FL_ALIGNAS(16) FPVizState {
 
     FPVizState() : fade_lut{}, fade_lut_initialized(false) {}
 
-    // Rebuild per-pixel cache when grid changes.
-    // Called once per frame; rebuilds only if pixel count changed.
+    // Rebind to the Engine's geometry and rebuild the LED index map when the
+    // grid changes. Called once per frame.
     void ensureCache(Engine *e) {
         const int num_x = e->num_x;
         const int num_y = e->num_y;
         const int total_pixels = num_x * num_y;
 
-        if (count != total_pixels) {
-            const int padded = (total_pixels + 3) & ~3;
-            polar_theta_raw.resize(padded, 0);
-            distance_raw.resize(padded, 0);
-            sqrt_distance_raw.resize(padded, 0);
-            pixel_idx.resize(padded, 0);
+        if (geometry != e->geometry || count != total_pixels) {
+            geometry = e->geometry;
+            polar_theta_raw = fl::assume_aligned<16>(geometry->thetaRaw());
+            distance_raw = fl::assume_aligned<16>(geometry->distanceRaw());
+            sqrt_distance_raw = fl::assume_aligned<16>(geometry->sqrtDistanceRaw());
+            pixel_idx.resize(geometry->padded(), 0);
 
             int idx = 0;
             for (int x = 0; x < num_x; x++) {
                 for (int y = 0; y < num_y; y++) {
-                    polar_theta_raw[idx] = fl::s16x16(e->polar_theta[x][y]).raw();
-                    distance_raw[idx] = fl::s16x16(e->distance[x][y]).raw();
-                    sqrt_distance_raw[idx] = fl::s16x16(e->distance[x][y]).sqrt().raw();
                     pixel_idx[idx] = e->mCtx->xyMapFn(x, y, e->mCtx->xyMapUserData);
                     idx++;
                 }
@@ -0,0 +1,118 @@
+#include "fl/fx/2d/animartrix_detail/polar_geometry.h"
+#include "fl/math/fixed_point/s16x16.h"
+#include "fl/math/math.h"
+#include "fl/stl/compiler_control.h"
+#include "fl/stl/mutex.h"
+#include "fl/stl/weak_ptr.h"
+
+FL_FAST_MATH_BEGIN
+FL_OPTIMIZATION_LEVEL_O3_BEGIN
+
+namespace fl {
+
+namespace {
+
+struct PolarGeometryEntry {
+    PolarGeometryKey key;
+    fl::weak_ptr<const PolarGeometry> geometry;
+};
+
+fl::mutex &polarGeometryMutex() {
+    static fl::mutex mtx;
+    return mtx;
+}
+
+fl::vector<PolarGeometryEntry> &polarGeometryRegistry() {
+    static fl::vector<PolarGeometryEntry> entries;
+    return entries;
+}
+
+// Index of the first element of data that starts a cache line.
+template <typename T>
+int polarGeometryAlignedIndex(const T *data) {
+    const fl::uptr addr = reinterpret_cast<fl::uptr>(data);  // ok reinterpret cast
+    const fl::uptr mask = PolarGeometry::kAlignBytes - 1;
+    return static_cast<int>(((PolarGeometry::kAlignBytes - (addr & mask)) & mask) /
+                            sizeof(T));
+}
+
+} // namespace
+
+PolarGeometry::PolarGeometry(const PolarGeometryKey &key) FL_NOEXCEPT
+    : mKey(key) {
+    const int num_x = key.num_x;
+    const int num_y = key.num_y;
+    const int total = num_x * num_y;
+    mPadded = (total + 3) & ~3;
+
+    // Each array starts on its own cache line; the extra line of slack
+    // lets the first one be aligned regardless of where the heap put us.
+    const int perLine = kAlignBytes / static_cast<int>(sizeof(float));
+    const int stride = (mPadded + perLine - 1) / perLine * perLine;
+    mFloatSlab.resize(2 * stride + perLine, 0.0f);
+    mRawSlab.resize(3 * stride + perLine, 0);
+
+    float *floats = mFloatSlab.data() + polarGeometryAlignedIndex(mFloatSlab.data());
+    fl::i32 *raws = mRawSlab.data() + polarGeometryAlignedIndex(mRawSlab.data());
+    float *theta = floats;
+    float *dist = floats + stride;
+    fl::i32 *thetaRaw = raws;
+    fl::i32 *distRaw = raws + stride;
+    fl::i32 *sqrtDistRaw = raws + 2 * stride;
+
+    int idx = 0;
+    for (int xx = 0; xx < num_x; xx++) {
+        for (int yy = 0; yy < num_y; yy++) {
+            float dx = xx - key.center_x;
+            float dy = yy - key.center_y;
+            dist[idx] = fl::hypotf(dx, dy);
+            theta[idx] = fl::atan2f(dy, dx);
+            thetaRaw[idx] = fl::s16x16(theta[idx]).raw();
+            distRaw[idx] = fl::s16x16(dist[idx]).raw();
+            sqrtDistRaw[idx] = fl::s16x16(dist[idx]).sqrt().raw();
+            idx++;
+        }
+    }
+
+    mTheta = theta;
+    mDistance = dist;
+    mThetaRaw = thetaRaw;
+    mDistanceRaw = distRaw;
+    mSqrtDistanceRaw = sqrtDistRaw;
+}
+
+fl::shared_ptr<const PolarGeometry>
+PolarGeometry::acquire(const PolarGeometryKey &key) FL_NOEXCEPT {
+    fl::unique_lock<fl::mutex> lock(polarGeometryMutex());
+    fl::vector<PolarGeometryEntry> &entries = polarGeometryRegistry();
+
+    fl::shared_ptr<const PolarGeometry> found;
+    fl::size i = 0;
+    while (i < entries.size()) {
+        if (entries[i].geometry.expired()) {
+            entries[i] = entries.back();
+            entries.pop_back();
+            continue;
+        }
+        if (!found && entries[i].key == key) {
+            found = entries[i].geometry.lock();
+        }
+        ++i;
+    }
+    if (found) {
+        return found;
+    }
+
+    fl::shared_ptr<const PolarGeometry> built =
+        fl::make_shared<PolarGeometry>(key);
+    PolarGeometryEntry entry;
+    entry.key = key;
+    entry.geometry = built;
+    entries.push_back(entry);
+    return built;
+}
+
+}  // namespace fl
+
+FL_OPTIMIZATION_LEVEL_O3_END
+FL_FAST_MATH_END
@@ -0,0 +1,97 @@
+#pragma once
+
+// PolarGeometry: per-pixel polar coordinates of an Animartrix grid.
+//
+// theta = atan2(dy, dx) and distance = hypot(dx, dy) depend only on the grid
+// size and center, never on time, so they are computed once and shared by
+// every Engine that renders the same grid (e.g. several panels side by side).
+// Both float and s16x16 layouts are stored flat in x-major order
+// (index = x * num_y + y, the order every viz iterates in), each array
+// starting on a cache line and padded to a multiple of 4 entries so SIMD
+// loads never run past the end.
+
+#include "fl/stl/int.h"
+#include "fl/stl/shared_ptr.h"
+#include "fl/stl/vector.h"
+#include "fl/stl/noexcept.h"
+
+namespace fl {
+
+struct PolarGeometryKey {
+    int num_x = 0;
+    int num_y = 0;
+    float center_x = 0.0f;
+    float center_y = 0.0f;
+
+    bool operator==(const PolarGeometryKey &o) const FL_NOEXCEPT {
+        return num_x == o.num_x && num_y == o.num_y &&
+               center_x == o.center_x && center_y == o.center_y;
+    }
+    bool operator!=(const PolarGeometryKey &o) const FL_NOEXCEPT {
+        return !(*this == o);
+    }
+};
+
+class PolarGeometry {
+  public:
+    static const int kAlignBytes = 64;
+
+    // Read-only [x][y] view over a flat x-major array, so existing viz code
+    // can keep writing e->polar_theta[x][y].
+    class Table {
+      public:
+        Table() FL_NOEXCEPT = default;
+        Table(const float *data, int stride) FL_NOEXCEPT
+            : mData(data), mStride(stride) {}
+        const float *operator[](int x) const FL_NOEXCEPT {
+            return mData + x * mStride;
+        }
+        const float *data() const FL_NOEXCEPT { return mData; }
+
+      private:
+        const float *mData = nullptr;
+        int mStride = 0;
+    };
+
+    // Returns the shared geometry for key, building it if no live instance
+    // exists. Entries are held weakly: the tables are freed once the last
+    // Engine using them is destroyed or re-initialized.
+    static fl::shared_ptr<const PolarGeometry>
+    acquire(const PolarGeometryKey &key) FL_NOEXCEPT;
+
+    explicit PolarGeometry(const PolarGeometryKey &key) FL_NOEXCEPT;
+    PolarGeometry(const PolarGeometry &) FL_NOEXCEPT = delete;
+    PolarGeometry &operator=(const PolarGeometry &) FL_NOEXCEPT = delete;
+
+    const PolarGeometryKey &key() const FL_NOEXCEPT { return mKey; }
+    int count() const FL_NOEXCEPT { return mKey.num_x * mKey.num_y; }
+    int padded() const FL_NOEXCEPT { return mPadded; }
+
+    // Float layout, bit-identical to the former per-Engine tables.
+    const float *theta() const FL_NOEXCEPT { return mTheta; }
+    const float *distance() const FL_NOEXCEPT { return mDistance; }
+    Table thetaTable() const FL_NOEXCEPT { return Table(mTheta, mKey.num_y); }
+    Table distanceTable() const FL_NOEXCEPT {
+        return Table(mDistance, mKey.num_y);
+    }
+
+    // s16x16 raw layout, converted from the float tables.
+    const fl::i32 *thetaRaw() const FL_NOEXCEPT { return mThetaRaw; }
+    const fl::i32 *distanceRaw() const FL_NOEXCEPT { return mDistanceRaw; }
+    const fl::i32 *sqrtDistanceRaw() const FL_NOEXCEPT {
+        return mSqrtDistanceRaw;
+    }
+
+  private:
+    PolarGeometryKey mKey;
+    int mPadded = 0;
+    fl::vector<float> mFloatSlab;
+    fl::vector<fl::i32> mRawSlab;
+    const float *mTheta = nullptr;
+    const float *mDistance = nullptr;
+    const fl::i32 *mThetaRaw = nullptr;
+    const fl::i32 *mDistanceRaw = nullptr;
+    const fl::i32 *mSqrtDistanceRaw = nullptr;
+};
+
+}  // namespace fl
@@ -22,10 +22,13 @@ void Big_Caleido::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = 5 * e->polar_theta[x][y] +
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->animation.dist = distance[idx];
+            e->animation.angle = 5 * theta[idx] +
                                  5 * e->move.noise_angle[0] +
                                  e->animation.dist * 0.1;
             e->animation.z = 5;
@@ -36,7 +39,7 @@ void Big_Caleido::draw(Context &ctx) {
             e->animation.offset_y = 50 * e->move.noise_angle[1];
             float show1 = e->render_value(e->animation);
 
-            e->animation.angle = 6 * e->polar_theta[x][y] +
+            e->animation.angle = 6 * theta[idx] +
                                  5 * e->move.noise_angle[1] +
                                  e->animation.dist * 0.15;
             e->animation.z = 5;
@@ -106,10 +109,13 @@ void Big_Caleido_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = 5 * e->polar_theta[x][y] +
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->animation.dist = distance[idx];
+            e->animation.angle = 5 * theta[idx] +
                                  5 * e->move.noise_angle[0] +
                                  e->animation.dist * 0.1;
             e->animation.z = 5;
@@ -120,7 +126,7 @@ void Big_Caleido_FP::draw(Context &ctx) {
             e->animation.offset_y = 50 * e->move.noise_angle[1];
             float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.angle = 6 * e->polar_theta[x][y] +
+            e->animation.angle = 6 * theta[idx] +
                                  5 * e->move.noise_angle[1] +
                                  e->animation.dist * 0.15;
             e->animation.z = 5;
@@ -26,10 +26,13 @@ void Caleido1::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = e->distance[x][y] * (2 + e->move.directional[0]) / 3;
-            e->animation.angle = 3 * e->polar_theta[x][y] +
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->animation.dist = distance[idx] * (2 + e->move.directional[0]) / 3;
+            e->animation.angle = 3 * theta[idx] +
                                  3 * e->move.noise_angle[0] + e->move.radial[4];
             e->animation.scale_x = 0.1;
             e->animation.scale_y = 0.1;
@@ -40,29 +43,29 @@ void Caleido1::draw(Context &ctx) {
             e->animation.z = e->move.linear[0];
             float show1 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y] * (2 + e->move.directional[1]) / 3;
-            e->animation.angle = 4 * e->polar_theta[x][y] +
+            e->animation.dist = distance[idx] * (2 + e->move.directional[1]) / 3;
+            e->animation.angle = 4 * theta[idx] +
                                  3 * e->move.noise_angle[1] + e->move.radial[4];
             e->animation.offset_x = 2 * e->move.linear[1];
             e->animation.z = e->move.linear[1];
             float show2 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y] * (2 + e->move.directional[2]) / 3;
-            e->animation.angle = 5 * e->polar_theta[x][y] +
+            e->animation.dist = distance[idx] * (2 + e->move.directional[2]) / 3;
+            e->animation.angle = 5 * theta[idx] +
                                  3 * e->move.noise_angle[2] + e->move.radial[4];
             e->animation.offset_y = 2 * e->move.linear[2];
             e->animation.z = e->move.linear[2];
             float show3 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y] * (2 + e->move.directional[3]) / 3;
-            e->animation.angle = 4 * e->polar_theta[x][y] +
+            e->animation.dist = distance[idx] * (2 + e->move.directional[3]) / 3;
+            e->animation.angle = 4 * theta[idx] +
                                  3 * e->move.noise_angle[3] + e->move.radial[4];
             e->animation.offset_x = 2 * e->move.linear[3];
             e->animation.z = e->move.linear[3];
             float show4 = e->render_value(e->animation);
 
             e->pixel.red = show1;
-            e->pixel.green = show3 * e->distance[x][y] / 10;
+            e->pixel.green = show3 * distance[idx] / 10;
             e->pixel.blue = (show2 + show4) / 2;
 
             e->pixel = e->rgb_sanity_check(e->pixel);
@@ -97,10 +100,13 @@ void Caleido1_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = e->distance[x][y] * (2 + e->move.directional[0]) / 3;
-            e->animation.angle = 3 * e->polar_theta[x][y] +
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->animation.dist = distance[idx] * (2 + e->move.directional[0]) / 3;
+            e->animation.angle = 3 * theta[idx] +
                                  3 * e->move.noise_angle[0] + e->move.radial[4];
             e->animation.scale_x = 0.1;
             e->animation.scale_y = 0.1;
@@ -111,29 +117,29 @@ void Caleido1_FP::draw(Context &ctx) {
             e->animation.z = e->move.linear[0];
             float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y] * (2 + e->move.directional[1]) / 3;
-            e->animation.angle = 4 * e->polar_theta[x][y] +
+            e->animation.dist = distance[idx] * (2 + e->move.directional[1]) / 3;
+            e->animation.angle = 4 * theta[idx] +
                                  3 * e->move.noise_angle[1] + e->move.radial[4];
             e->animation.offset_x = 2 * e->move.linear[1];
             e->animation.z = e->move.linear[1];
             float show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y] * (2 + e->move.directional[2]) / 3;
-            e->animation.angle = 5 * e->polar_theta[x][y] +
+            e->animation.dist = distance[idx] * (2 + e->move.directional[2]) / 3;
+            e->animation.angle = 5 * theta[idx] +
                                  3 * e->move.noise_angle[2] + e->move.radial[4];
             e->animation.offset_y = 2 * e->move.linear[2];
             e->animation.z = e->move.linear[2];
             float show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y] * (2 + e->move.directional[3]) / 3;
-            e->animation.angle = 4 * e->polar_theta[x][y] +
+            e->animation.dist = distance[idx] * (2 + e->move.directional[3]) / 3;
+            e->animation.angle = 4 * theta[idx] +
                                  3 * e->move.noise_angle[3] + e->move.radial[4];
             e->animation.offset_x = 2 * e->move.linear[3];
             e->animation.z = e->move.linear[3];
             float show4 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
             e->pixel.red = show1;
-            e->pixel.green = show3 * e->distance[x][y] / 10;
+            e->pixel.green = show3 * distance[idx] / 10;
             e->pixel.blue = (show2 + show4) / 2;
 
             e->pixel = e->rgb_sanity_check(e->pixel);
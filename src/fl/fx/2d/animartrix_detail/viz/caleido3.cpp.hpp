@@ -26,10 +26,13 @@ void Caleido3::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = e->distance[x][y] * (2 + e->move.directional[0]) / 3;
-            e->animation.angle = 2 * e->polar_theta[x][y] +
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->animation.dist = distance[idx] * (2 + e->move.directional[0]) / 3;
+            e->animation.angle = 2 * theta[idx] +
                                  3 * e->move.noise_angle[0] + e->move.radial[4];
             e->animation.scale_x = 0.1;
             e->animation.scale_y = 0.1;
@@ -40,24 +43,24 @@ void Caleido3::draw(Context &ctx) {
             e->animation.z = e->move.linear[0];
             float show1 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y] * (2 + e->move.directional[1]) / 3;
-            e->animation.angle = 2 * e->polar_theta[x][y] +
+            e->animation.dist = distance[idx] * (2 + e->move.directional[1]) / 3;
+            e->animation.angle = 2 * theta[idx] +
                                  3 * e->move.noise_angle[1] + e->move.radial[4];
             e->animation.offset_x = 2 * e->move.linear[1];
             e->animation.offset_y = show1 / 20.0;
             e->animation.z = e->move.linear[1];
             float show2 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y] * (2 + e->move.directional[2]) / 3;
-            e->animation.angle = 2 * e->polar_theta[x][y] +
+            e->animation.dist = distance[idx] * (2 + e->move.directional[2]) / 3;
+            e->animation.angle = 2 * theta[idx] +
                                  3 * e->move.noise_angle[2] + e->move.radial[4];
             e->animation.offset_y = 2 * e->move.linear[2];
             e->animation.offset_x = show2 / 20.0;
             e->animation.z = e->move.linear[2];
             float show3 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y] * (2 + e->move.directional[3]) / 3;
-            e->animation.angle = 2 * e->polar_theta[x][y] +
+            e->animation.dist = distance[idx] * (2 + e->move.directional[3]) / 3;
+            e->animation.angle = 2 * theta[idx] +
                                  3 * e->move.noise_angle[3] + e->move.radial[4];
             e->animation.offset_x = 2 * e->move.linear[3];
             e->animation.offset_y = show3 / 20.0;
@@ -67,9 +70,9 @@ void Caleido3::draw(Context &ctx) {
             float radius = e->radial_filter_radius;
 
             e->pixel.red = show1 * (y + 1) / e->num_y;
-            e->pixel.green = show3 * e->distance[x][y] / 10;
+            e->pixel.green = show3 * distance[idx] / 10;
             e->pixel.blue = (show2 + show4) / 2;
-            if (e->distance[x][y] > radius) {
+            if (distance[idx] > radius) {
                 e->pixel.red = 0;
                 e->pixel.green = 0;
                 e->pixel.blue = 0;
@@ -107,10 +110,13 @@ void Caleido3_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = e->distance[x][y] * (2 + e->move.directional[0]) / 3;
-            e->animation.angle = 2 * e->polar_theta[x][y] +
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->animation.dist = distance[idx] * (2 + e->move.directional[0]) / 3;
+            e->animation.angle = 2 * theta[idx] +
                                  3 * e->move.noise_angle[0] + e->move.radial[4];
             e->animation.scale_x = 0.1;
             e->animation.scale_y = 0.1;
@@ -121,24 +127,24 @@ void Caleido3_FP::draw(Context &ctx) {
             e->animation.z = e->move.linear[0];
             float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y] * (2 + e->move.directional[1]) / 3;
-            e->animation.angle = 2 * e->polar_theta[x][y] +
+            e->animation.dist = distance[idx] * (2 + e->move.directional[1]) / 3;
+            e->animation.angle = 2 * theta[idx] +
                                  3 * e->move.noise_angle[1] + e->move.radial[4];
             e->animation.offset_x = 2 * e->move.linear[1];
             e->animation.offset_y = show1 / 20.0;
             e->animation.z = e->move.linear[1];
             float show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y] * (2 + e->move.directional[2]) / 3;
-            e->animation.angle = 2 * e->polar_theta[x][y] +
+            e->animation.dist = distance[idx] * (2 + e->move.directional[2]) / 3;
+            e->animation.angle = 2 * theta[idx] +
                                  3 * e->move.noise_angle[2] + e->move.radial[4];
             e->animation.offset_y = 2 * e->move.linear[2];
             e->animation.offset_x = show2 / 20.0;
             e->animation.z = e->move.linear[2];
             float show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y] * (2 + e->move.directional[3]) / 3;
-            e->animation.angle = 2 * e->polar_theta[x][y] +
+            e->animation.dist = distance[idx] * (2 + e->move.directional[3]) / 3;
+            e->animation.angle = 2 * theta[idx] +
                                  3 * e->move.noise_angle[3] + e->move.radial[4];
             e->animation.offset_x = 2 * e->move.linear[3];
             e->animation.offset_y = show3 / 20.0;
@@ -148,9 +154,9 @@ void Caleido3_FP::draw(Context &ctx) {
             float radius = e->radial_filter_radius;
 
             e->pixel.red = show1 * (y + 1) / e->num_y;
-            e->pixel.green = show3 * e->distance[x][y] / 10;
+            e->pixel.green = show3 * distance[idx] / 10;
             e->pixel.blue = (show2 + show4) / 2;
-            if (e->distance[x][y] > radius) {
+            if (distance[idx] > radius) {
                 e->pixel.red = 0;
                 e->pixel.green = 0;
                 e->pixel.blue = 0;
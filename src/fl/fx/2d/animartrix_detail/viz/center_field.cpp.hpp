@@ -28,23 +28,26 @@ void Center_Field::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.angle = e->polar_theta[x][y];
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->animation.angle = theta[idx];
             e->animation.scale_x = 0.07;
             e->animation.scale_y = 0.07;
             e->animation.scale_z = 0.1;
-            e->animation.dist = 5 * fl::sqrtf(e->distance[x][y]);
+            e->animation.dist = 5 * fl::sqrtf(distance[idx]);
             e->animation.offset_y = fl::fmodf(e->move.linear[0], perlin_period);
             e->animation.offset_x = 0;
             e->animation.z = 0;
             float show1 = e->render_value(e->animation);
 
-            e->animation.angle = e->polar_theta[x][y];
+            e->animation.angle = theta[idx];
             e->animation.scale_x = 0.07;
             e->animation.scale_y = 0.07;
             e->animation.scale_z = 0.1;
-            e->animation.dist = 4 * fl::sqrtf(e->distance[x][y]);
+            e->animation.dist = 4 * fl::sqrtf(distance[idx]);
             e->animation.offset_y = fl::fmodf(e->move.linear[0], perlin_period);
             e->animation.offset_x = 0;
             e->animation.z = 0;
@@ -313,37 +313,47 @@ void Chasing_Spirals_Float::draw(Context &ctx) {
     e->timings.offset[3] = 30;
     e->calculate_oscillators(e->timings);
 
-    for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.angle =
-                3 * e->polar_theta[x][y] + e->move.radial[0] -
-                e->distance[x][y] / 3;
-            e->animation.dist = e->distance[x][y];
-            e->animation.scale_z = 0.1;
-            e->animation.scale_y = 0.1;
-            e->animation.scale_x = 0.1;
-            e->animation.offset_x = fl::fmodf(e->move.linear[0], perlin_period);
-            e->animation.offset_y = 0;
-            e->animation.offset_z = 0;
-            e->animation.z = 0;
+    // Per-frame constants, hoisted by hand: the float stores into
+    // e->animation may alias e->move as far as the compiler knows, so it
+    // reloads (and re-runs fmodf on) them for every pixel otherwise.
+    const float radial0 = e->move.radial[0];
+    const float radial1 = e->move.radial[1];
+    const float radial2 = e->move.radial[2];
+    const float linear0 = fl::fmodf(e->move.linear[0], perlin_period);
+    const float linear1 = fl::fmodf(e->move.linear[1], perlin_period);
+    const float linear2 = fl::fmodf(e->move.linear[2], perlin_period);
+    const float radius = e->radial_filter_radius;
+    e->animation.scale_z = 0.1;
+    e->animation.scale_y = 0.1;
+    e->animation.scale_x = 0.1;
+    e->animation.offset_y = 0;
+    e->animation.offset_z = 0;
+    e->animation.z = 0;
+
+    const int num_x = e->num_x;
+    const int num_y = e->num_y;
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
+    for (int x = 0; x < num_x; x++) {
+        for (int y = 0; y < num_y; y++, idx++) {
+            const float th = theta[idx];
+            const float dist = distance[idx];
+            e->animation.dist = dist;
+
+            e->animation.angle = 3 * th + radial0 - dist / 3;
+            e->animation.offset_x = linear0;
             float show1 = e->render_value(e->animation);
 
-            e->animation.angle =
-                3 * e->polar_theta[x][y] + e->move.radial[1] -
-                e->distance[x][y] / 3;
-            e->animation.dist = e->distance[x][y];
-            e->animation.offset_x = fl::fmodf(e->move.linear[1], perlin_period);
+            e->animation.angle = 3 * th + radial1 - dist / 3;
+            e->animation.offset_x = linear1;
             float show2 = e->render_value(e->animation);
 
-            e->animation.angle =
-                3 * e->polar_theta[x][y] + e->move.radial[2] -
-                e->distance[x][y] / 3;
-            e->animation.dist = e->distance[x][y];
-            e->animation.offset_x = fl::fmodf(e->move.linear[2], perlin_period);
+            e->animation.angle = 3 * th + radial2 - dist / 3;
+            e->animation.offset_x = linear2;
             float show3 = e->render_value(e->animation);
 
-            float radius = e->radial_filter_radius;
-            float radial_filter = (radius - e->distance[x][y]) / radius;
+            float radial_filter = (radius - dist) / radius;
 
             e->pixel.red = 3 * show1 * radial_filter;
             e->pixel.green = show2 * radial_filter / 2;
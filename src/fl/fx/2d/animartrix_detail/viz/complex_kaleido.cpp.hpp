@@ -22,11 +22,14 @@ void Complex_Kaleido::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = 5 * e->polar_theta[x][y] + 10 * e->move.radial[0] +
+            e->animation.dist = distance[idx];
+            e->animation.angle = 5 * theta[idx] + 10 * e->move.radial[0] +
                                  e->animation.dist / 2;
             e->animation.z = 5;
             e->animation.scale_x = 0.07;
@@ -37,8 +40,8 @@ void Complex_Kaleido::draw(Context &ctx) {
             e->animation.low_limit = 0;
             e->show1 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = -5 * e->polar_theta[x][y] + 12 * e->move.radial[1] +
+            e->animation.dist = distance[idx];
+            e->animation.angle = -5 * theta[idx] + 12 * e->move.radial[1] +
                                  e->animation.dist / 2;
             e->animation.z = 500;
             e->animation.scale_x = 0.07;
@@ -49,8 +52,8 @@ void Complex_Kaleido::draw(Context &ctx) {
             e->animation.low_limit = 0;
             e->show2 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = -5 * e->polar_theta[x][y] + 12 * e->move.radial[2] +
+            e->animation.dist = distance[idx];
+            e->animation.angle = -5 * theta[idx] + 12 * e->move.radial[2] +
                                  e->animation.dist / 2;
             e->animation.z = 500;
             e->animation.scale_x = 0.05;
@@ -61,8 +64,8 @@ void Complex_Kaleido::draw(Context &ctx) {
             e->animation.low_limit = 0;
             e->show3 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = 5 * e->polar_theta[x][y] + 12 * e->move.radial[3] +
+            e->animation.dist = distance[idx];
+            e->animation.angle = 5 * theta[idx] + 12 * e->move.radial[3] +
                                  e->animation.dist / 2;
             e->animation.z = 500;
             e->animation.scale_x = 0.09;
@@ -77,7 +80,7 @@ void Complex_Kaleido::draw(Context &ctx) {
             e->show6 = e->colordodge(e->show2, e->show3);
 
             float radius = e->radial_filter_radius;
-            float radial = (radius - e->distance[x][y]) / e->distance[x][y];
+            float radial = (radius - distance[idx]) / distance[idx];
 
             e->pixel.red = radial * (e->show1 + e->show2);
             e->pixel.green = 0.3 * radial * e->show6;
@@ -112,11 +115,14 @@ void Complex_Kaleido_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = 5 * e->polar_theta[x][y] + 10 * e->move.radial[0] +
+            e->animation.dist = distance[idx];
+            e->animation.angle = 5 * theta[idx] + 10 * e->move.radial[0] +
                                  e->animation.dist / 2;
             e->animation.z = 5;
             e->animation.scale_x = 0.07;
@@ -127,8 +133,8 @@ void Complex_Kaleido_FP::draw(Context &ctx) {
             e->animation.low_limit = 0;
             e->show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = -5 * e->polar_theta[x][y] + 12 * e->move.radial[1] +
+            e->animation.dist = distance[idx];
+            e->animation.angle = -5 * theta[idx] + 12 * e->move.radial[1] +
                                  e->animation.dist / 2;
             e->animation.z = 500;
             e->animation.scale_x = 0.07;
@@ -139,8 +145,8 @@ void Complex_Kaleido_FP::draw(Context &ctx) {
             e->animation.low_limit = 0;
             e->show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = -5 * e->polar_theta[x][y] + 12 * e->move.radial[2] +
+            e->animation.dist = distance[idx];
+            e->animation.angle = -5 * theta[idx] + 12 * e->move.radial[2] +
                                  e->animation.dist / 2;
             e->animation.z = 500;
             e->animation.scale_x = 0.05;
@@ -151,8 +157,8 @@ void Complex_Kaleido_FP::draw(Context &ctx) {
             e->animation.low_limit = 0;
             e->show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = 5 * e->polar_theta[x][y] + 12 * e->move.radial[3] +
+            e->animation.dist = distance[idx];
+            e->animation.angle = 5 * theta[idx] + 12 * e->move.radial[3] +
                                  e->animation.dist / 2;
             e->animation.z = 500;
             e->animation.scale_x = 0.09;
@@ -167,7 +173,7 @@ void Complex_Kaleido_FP::draw(Context &ctx) {
             e->show6 = e->colordodge(e->show2, e->show3);
 
             float radius = e->radial_filter_radius;
-            float radial = (radius - e->distance[x][y]) / e->distance[x][y];
+            float radial = (radius - distance[idx]) / distance[idx];
 
             e->pixel.red = radial * (e->show1 + e->show2);
             e->pixel.green = 0.3 * radial * e->show6;
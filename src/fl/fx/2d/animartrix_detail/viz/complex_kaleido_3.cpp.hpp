@@ -27,12 +27,15 @@ void Complex_Kaleido_3::draw(Context &ctx) {
 
     float q = 2;
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
-            e->animation.dist = e->distance[x][y];
+            e->animation.dist = distance[idx];
             e->animation.angle =
-                5 * e->polar_theta[x][y] + 10 * e->move.radial[0] +
+                5 * theta[idx] + 10 * e->move.radial[0] +
                 e->animation.dist / (((e->move.directional[0] + 3) * 2)) +
                 e->move.noise_angle[0] * q;
             e->animation.z = 5;
@@ -44,9 +47,9 @@ void Complex_Kaleido_3::draw(Context &ctx) {
             e->animation.low_limit = 0;
             e->show1 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y];
+            e->animation.dist = distance[idx];
             e->animation.angle =
-                -5 * e->polar_theta[x][y] + 10 * e->move.radial[1] +
+                -5 * theta[idx] + 10 * e->move.radial[1] +
                 e->animation.dist / (((e->move.directional[1] + 3) * 2)) +
                 e->move.noise_angle[1] * q;
             e->animation.z = 500;
@@ -60,9 +63,9 @@ void Complex_Kaleido_3::draw(Context &ctx) {
             e->animation.low_limit = 0;
             e->show2 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y];
+            e->animation.dist = distance[idx];
             e->animation.angle =
-                -5 * e->polar_theta[x][y] + 12 * e->move.radial[2] +
+                -5 * theta[idx] + 12 * e->move.radial[2] +
                 e->animation.dist / (((e->move.directional[3] + 3) * 2)) +
                 e->move.noise_angle[2] * q;
             e->animation.z = 500;
@@ -76,9 +79,9 @@ void Complex_Kaleido_3::draw(Context &ctx) {
             e->animation.low_limit = 0;
             e->show3 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y];
+            e->animation.dist = distance[idx];
             e->animation.angle =
-                5 * e->polar_theta[x][y] + 12 * e->move.radial[3] +
+                5 * theta[idx] + 12 * e->move.radial[3] +
                 e->animation.dist / (((e->move.directional[5] + 3) * 2)) +
                 e->move.noise_angle[3] * q;
             e->animation.z = 500;
@@ -102,7 +105,7 @@ void Complex_Kaleido_3::draw(Context &ctx) {
             float linear1 = y / 32.f;
 
             float radius = e->radial_filter_radius;
-            float radial = (radius - e->distance[x][y]) / e->distance[x][y];
+            float radial = (radius - distance[idx]) / distance[idx];
 
             e->show7 = e->multiply(e->show1, e->show2) * linear1 * 2;
             e->show8 = e->subtract(e->show7, e->show5);
@@ -145,12 +148,15 @@ void Complex_Kaleido_3_FP::draw(Context &ctx) {
 
     float q = 2;
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
-            e->animation.dist = e->distance[x][y];
+            e->animation.dist = distance[idx];
             e->animation.angle =
-                5 * e->polar_theta[x][y] + 10 * e->move.radial[0] +
+                5 * theta[idx] + 10 * e->move.radial[0] +
                 e->animation.dist / (((e->move.directional[0] + 3) * 2)) +
                 e->move.noise_angle[0] * q;
             e->animation.z = 5;
@@ -162,9 +168,9 @@ void Complex_Kaleido_3_FP::draw(Context &ctx) {
             e->animation.low_limit = 0;
             e->show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y];
+            e->animation.dist = distance[idx];
             e->animation.angle =
-                -5 * e->polar_theta[x][y] + 10 * e->move.radial[1] +
+                -5 * theta[idx] + 10 * e->move.radial[1] +
                 e->animation.dist / (((e->move.directional[1] + 3) * 2)) +
                 e->move.noise_angle[1] * q;
             e->animation.z = 500;
@@ -178,9 +184,9 @@ void Complex_Kaleido_3_FP::draw(Context &ctx) {
             e->animation.low_limit = 0;
             e->show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y];
+            e->animation.dist = distance[idx];
             e->animation.angle =
-                -5 * e->polar_theta[x][y] + 12 * e->move.radial[2] +
+                -5 * theta[idx] + 12 * e->move.radial[2] +
                 e->animation.dist / (((e->move.directional[3] + 3) * 2)) +
                 e->move.noise_angle[2] * q;
             e->animation.z = 500;
@@ -194,9 +200,9 @@ void Complex_Kaleido_3_FP::draw(Context &ctx) {
             e->animation.low_limit = 0;
             e->show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y];
+            e->animation.dist = distance[idx];
             e->animation.angle =
-                5 * e->polar_theta[x][y] + 12 * e->move.radial[3] +
+                5 * theta[idx] + 12 * e->move.radial[3] +
                 e->animation.dist / (((e->move.directional[5] + 3) * 2)) +
                 e->move.noise_angle[3] * q;
             e->animation.z = 500;
@@ -220,7 +226,7 @@ void Complex_Kaleido_3_FP::draw(Context &ctx) {
             float linear1 = y / 32.f;
 
             float radius = e->radial_filter_radius;
-            float radial = (radius - e->distance[x][y]) / e->distance[x][y];
+            float radial = (radius - distance[idx]) / distance[idx];
 
             e->show7 = e->multiply(e->show1, e->show2) * linear1 * 2;
             e->show8 = e->subtract(e->show7, e->show5);
@@ -27,14 +27,17 @@ void Complex_Kaleido_4::draw(Context &ctx) {
 
     float q = 1;
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
             float s = 1 + e->move.directional[6] * 0.3;
 
-            e->animation.dist = e->distance[x][y] * s;
+            e->animation.dist = distance[idx] * s;
             e->animation.angle =
-                5 * e->polar_theta[x][y] + 1 * e->move.radial[0] -
+                5 * theta[idx] + 1 * e->move.radial[0] -
                 e->animation.dist / (3 + e->move.directional[0] * 0.5);
             e->animation.z = 5;
             e->animation.scale_x = 0.08 * size + (e->move.directional[0] * 0.01);
@@ -45,9 +48,9 @@ void Complex_Kaleido_4::draw(Context &ctx) {
             e->animation.low_limit = 0;
             e->show1 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y] * s;
+            e->animation.dist = distance[idx] * s;
             e->animation.angle =
-                5 * e->polar_theta[x][y] + 1 * e->move.radial[1] +
+                5 * theta[idx] + 1 * e->move.radial[1] +
                 e->animation.dist / (3 + e->move.directional[1] * 0.5);
             e->animation.z = 50;
             e->animation.scale_x = 0.08 * size + (e->move.directional[1] * 0.01);
@@ -58,7 +61,7 @@ void Complex_Kaleido_4::draw(Context &ctx) {
             e->animation.low_limit = 0;
             e->show2 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y];
+            e->animation.dist = distance[idx];
             e->animation.angle = 1;
             e->animation.z = 500;
             e->animation.scale_x = 0.2 * size;
@@ -69,9 +72,9 @@ void Complex_Kaleido_4::draw(Context &ctx) {
             e->animation.low_limit = 0;
             e->show3 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y];
+            e->animation.dist = distance[idx];
             e->animation.angle =
-                5 * e->polar_theta[x][y] + 12 * e->move.radial[3] +
+                5 * theta[idx] + 12 * e->move.radial[3] +
                 e->animation.dist / (((e->move.directional[5] + 3) * 2)) +
                 e->move.noise_angle[3] * q;
             e->animation.z = 500;
@@ -88,7 +91,7 @@ void Complex_Kaleido_4::draw(Context &ctx) {
             e->show4 = e->render_value(e->animation);
 
             float radius = e->radial_filter_radius;
-            float radial = (radius - e->distance[x][y]) / e->distance[x][y];
+            float radial = (radius - distance[idx]) / distance[idx];
 
             e->show5 = ((e->show1 + e->show2)) - e->show3;
             if (e->show5 > 255)
@@ -136,14 +139,17 @@ void Complex_Kaleido_4_FP::draw(Context &ctx) {
 
     float q = 1;
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
             float s = 1 + e->move.directional[6] * 0.3;
 
-            e->animation.dist = e->distance[x][y] * s;
+            e->animation.dist = distance[idx] * s;
             e->animation.angle =
-                5 * e->polar_theta[x][y] + 1 * e->move.radial[0] -
+                5 * theta[idx] + 1 * e->move.radial[0] -
                 e->animation.dist / (3 + e->move.directional[0] * 0.5);
             e->animation.z = 5;
             e->animation.scale_x = 0.08 * size + (e->move.directional[0] * 0.01);
@@ -154,9 +160,9 @@ void Complex_Kaleido_4_FP::draw(Context &ctx) {
             e->animation.low_limit = 0;
             e->show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y] * s;
+            e->animation.dist = distance[idx] * s;
             e->animation.angle =
-                5 * e->polar_theta[x][y] + 1 * e->move.radial[1] +
+                5 * theta[idx] + 1 * e->move.radial[1] +
                 e->animation.dist / (3 + e->move.directional[1] * 0.5);
             e->animation.z = 50;
             e->animation.scale_x = 0.08 * size + (e->move.directional[1] * 0.01);
@@ -167,7 +173,7 @@ void Complex_Kaleido_4_FP::draw(Context &ctx) {
             e->animation.low_limit = 0;
             e->show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y];
+            e->animation.dist = distance[idx];
             e->animation.angle = 1;
             e->animation.z = 500;
             e->animation.scale_x = 0.2 * size;
@@ -178,9 +184,9 @@ void Complex_Kaleido_4_FP::draw(Context &ctx) {
             e->animation.low_limit = 0;
             e->show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y];
+            e->animation.dist = distance[idx];
             e->animation.angle =
-                5 * e->polar_theta[x][y] + 12 * e->move.radial[3] +
+                5 * theta[idx] + 12 * e->move.radial[3] +
                 e->animation.dist / (((e->move.directional[5] + 3) * 2)) +
                 e->move.noise_angle[3] * q;
             e->animation.z = 500;
@@ -197,7 +203,7 @@ void Complex_Kaleido_4_FP::draw(Context &ctx) {
             e->show4 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
             float radius = e->radial_filter_radius;
-            float radial = (radius - e->distance[x][y]) / e->distance[x][y];
+            float radial = (radius - distance[idx]) / distance[idx];
 
             e->show5 = ((e->show1 + e->show2)) - e->show3;
             if (e->show5 > 255)
@@ -25,14 +25,17 @@ void Complex_Kaleido_5::draw(Context &ctx) {
 
     float size = 0.6;
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
             float s = 1 + e->move.directional[6] * 0.8;
 
-            e->animation.dist = e->distance[x][y] * s;
+            e->animation.dist = distance[idx] * s;
             e->animation.angle = 10 * e->move.radial[6] +
-                                 50 * e->move.directional[5] * e->polar_theta[x][y] -
+                                 50 * e->move.directional[5] * theta[idx] -
                                  e->animation.dist / 3;
             e->animation.z = 5;
             e->animation.scale_x = 0.08 * size;
@@ -44,7 +47,7 @@ void Complex_Kaleido_5::draw(Context &ctx) {
             e->show1 = e->render_value(e->animation);
 
             float radius = e->radial_filter_radius;
-            float radial = (radius - e->distance[x][y]) / e->distance[x][y];
+            float radial = (radius - distance[idx]) / distance[idx];
 
             e->pixel.red = e->show1 * radial;
             e->pixel.green = 0;
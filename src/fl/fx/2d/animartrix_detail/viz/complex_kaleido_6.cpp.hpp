@@ -23,11 +23,14 @@ void Complex_Kaleido_6::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = 16 * e->polar_theta[x][y] + 16 * e->move.radial[0];
+            e->animation.dist = distance[idx];
+            e->animation.angle = 16 * theta[idx] + 16 * e->move.radial[0];
             e->animation.z = 5;
             e->animation.scale_x = 0.06;
             e->animation.scale_y = 0.06;
@@ -37,8 +40,8 @@ void Complex_Kaleido_6::draw(Context &ctx) {
             e->animation.low_limit = 0;
             e->show1 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = 16 * e->polar_theta[x][y] + 16 * e->move.radial[1];
+            e->animation.dist = distance[idx];
+            e->animation.angle = 16 * theta[idx] + 16 * e->move.radial[1];
             e->animation.z = 500;
             e->animation.scale_x = 0.06;
             e->animation.scale_y = 0.06;
@@ -82,11 +85,14 @@ void Complex_Kaleido_6_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = 16 * e->polar_theta[x][y] + 16 * e->move.radial[0];
+            e->animation.dist = distance[idx];
+            e->animation.angle = 16 * theta[idx] + 16 * e->move.radial[0];
             e->animation.z = 5;
             e->animation.scale_x = 0.06;
             e->animation.scale_y = 0.06;
@@ -96,8 +102,8 @@ void Complex_Kaleido_6_FP::draw(Context &ctx) {
             e->animation.low_limit = 0;
             e->show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = 16 * e->polar_theta[x][y] + 16 * e->move.radial[1];
+            e->animation.dist = distance[idx];
+            e->animation.angle = 16 * theta[idx] + 16 * e->move.radial[1];
             e->animation.z = 500;
             e->animation.scale_x = 0.06;
             e->animation.scale_y = 0.06;
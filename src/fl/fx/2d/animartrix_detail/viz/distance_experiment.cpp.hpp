@@ -23,10 +23,13 @@ void Distance_Experiment::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = fl::powf(e->distance[x][y], 0.5f);
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[0];
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->animation.dist = fl::powf(distance[idx], 0.5f);
+            e->animation.angle = theta[idx] + e->move.radial[0];
             e->animation.scale_x = 0.07;
             e->animation.scale_y = 0.07;
             e->animation.scale_z = 0.1;
@@ -36,8 +39,8 @@ void Distance_Experiment::draw(Context &ctx) {
             e->animation.z = 0;
             float show1 = e->render_value(e->animation);
 
-            e->animation.dist = fl::powf(e->distance[x][y], 0.6f);
-            e->animation.angle = e->polar_theta[x][y] + e->move.noise_angle[2];
+            e->animation.dist = fl::powf(distance[idx], 0.6f);
+            e->animation.angle = theta[idx] + e->move.noise_angle[2];
             e->animation.scale_x = 0.07;
             e->animation.scale_y = 0.07;
             e->animation.scale_z = 0.1;
@@ -80,10 +83,13 @@ void Distance_Experiment_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = fl::powf(e->distance[x][y], 0.5f);
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[0];
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->animation.dist = fl::powf(distance[idx], 0.5f);
+            e->animation.angle = theta[idx] + e->move.radial[0];
             e->animation.scale_x = 0.07;
             e->animation.scale_y = 0.07;
             e->animation.scale_z = 0.1;
@@ -93,8 +99,8 @@ void Distance_Experiment_FP::draw(Context &ctx) {
             e->animation.z = 0;
             float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = fl::powf(e->distance[x][y], 0.6f);
-            e->animation.angle = e->polar_theta[x][y] + e->move.noise_angle[2];
+            e->animation.dist = fl::powf(distance[idx], 0.6f);
+            e->animation.angle = theta[idx] + e->move.noise_angle[2];
             e->animation.scale_x = 0.07;
             e->animation.scale_y = 0.07;
             e->animation.scale_z = 0.1;
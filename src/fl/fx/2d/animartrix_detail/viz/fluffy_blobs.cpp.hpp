@@ -28,11 +28,14 @@ void Fluffy_Blobs::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y] + (radial_speed * e->move.radial[0]);
+            e->animation.dist = distance[idx];
+            e->animation.angle = theta[idx] + (radial_speed * e->move.radial[0]);
             e->animation.z = 5;
             e->animation.scale_x = size;
             e->animation.scale_y = size;
@@ -43,56 +46,56 @@ void Fluffy_Blobs::draw(Context &ctx) {
             e->animation.high_limit = 1;
             e->show1 = e->render_value(e->animation);
 
-            e->animation.angle = e->polar_theta[x][y] + (radial_speed * e->move.radial[1]);
+            e->animation.angle = theta[idx] + (radial_speed * e->move.radial[1]);
             e->animation.offset_y = linear_speed * e->move.linear[1];
             e->animation.offset_z = 200;
             e->animation.scale_x = size * 1.1;
             e->animation.scale_y = size * 1.1;
             e->show2 = e->render_value(e->animation);
 
-            e->animation.angle = e->polar_theta[x][y] + (radial_speed * e->move.radial[2]);
+            e->animation.angle = theta[idx] + (radial_speed * e->move.radial[2]);
             e->animation.offset_y = linear_speed * e->move.linear[2];
             e->animation.offset_z = 400;
             e->animation.scale_x = size * 1.2;
             e->animation.scale_y = size * 1.2;
             e->show3 = e->render_value(e->animation);
 
-            e->animation.angle = e->polar_theta[x][y] + (radial_speed * e->move.radial[3]);
+            e->animation.angle = theta[idx] + (radial_speed * e->move.radial[3]);
             e->animation.offset_y = linear_speed * e->move.linear[3];
             e->animation.offset_z = 600;
             e->animation.scale_x = size;
             e->animation.scale_y = size;
             e->show4 = e->render_value(e->animation);
 
-            e->animation.angle = e->polar_theta[x][y] + (radial_speed * e->move.radial[4]);
+            e->animation.angle = theta[idx] + (radial_speed * e->move.radial[4]);
             e->animation.offset_y = linear_speed * e->move.linear[4];
             e->animation.offset_z = 800;
             e->animation.scale_x = size * 1.1;
             e->animation.scale_y = size * 1.1;
             e->show5 = e->render_value(e->animation);
 
-            e->animation.angle = e->polar_theta[x][y] + (radial_speed * e->move.radial[5]);
+            e->animation.angle = theta[idx] + (radial_speed * e->move.radial[5]);
             e->animation.offset_y = linear_speed * e->move.linear[5];
             e->animation.offset_z = 1800;
             e->animation.scale_x = size * 1.2;
             e->animation.scale_y = size * 1.2;
             e->show6 = e->render_value(e->animation);
 
-            e->animation.angle = e->polar_theta[x][y] + (radial_speed * e->move.radial[6]);
+            e->animation.angle = theta[idx] + (radial_speed * e->move.radial[6]);
             e->animation.offset_y = linear_speed * e->move.linear[6];
             e->animation.offset_z = 2800;
             e->animation.scale_x = size;
             e->animation.scale_y = size;
             e->show7 = e->render_value(e->animation);
 
-            e->animation.angle = e->polar_theta[x][y] + (radial_speed * e->move.radial[7]);
+            e->animation.angle = theta[idx] + (radial_speed * e->move.radial[7]);
             e->animation.offset_y = linear_speed * e->move.linear[7];
             e->animation.offset_z = 3800;
             e->animation.scale_x = size * 1.1;
             e->animation.scale_y = size * 1.1;
             e->show8 = e->render_value(e->animation);
 
-            e->animation.angle = e->polar_theta[x][y] + (radial_speed * e->move.radial[8]);
+            e->animation.angle = theta[idx] + (radial_speed * e->move.radial[8]);
             e->animation.offset_y = linear_speed * e->move.linear[8];
             e->animation.offset_z = 4800;
             e->animation.scale_x = size * 1.2;
@@ -138,11 +141,14 @@ void Fluffy_Blobs_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y] + (radial_speed * e->move.radial[0]);
+            e->animation.dist = distance[idx];
+            e->animation.angle = theta[idx] + (radial_speed * e->move.radial[0]);
             e->animation.z = 5;
             e->animation.scale_x = size;
             e->animation.scale_y = size;
@@ -153,56 +159,56 @@ void Fluffy_Blobs_FP::draw(Context &ctx) {
             e->animation.high_limit = 1;
             e->show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.angle = e->polar_theta[x][y] + (radial_speed * e->move.radial[1]);
+            e->animation.angle = theta[idx] + (radial_speed * e->move.radial[1]);
             e->animation.offset_y = linear_speed * e->move.linear[1];
             e->animation.offset_z = 200;
             e->animation.scale_x = size * 1.1;
             e->animation.scale_y = size * 1.1;
             e->show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.angle = e->polar_theta[x][y] + (radial_speed * e->move.radial[2]);
+            e->animation.angle = theta[idx] + (radial_speed * e->move.radial[2]);
             e->animation.offset_y = linear_speed * e->move.linear[2];
             e->animation.offset_z = 400;
             e->animation.scale_x = size * 1.2;
             e->animation.scale_y = size * 1.2;
             e->show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.angle = e->polar_theta[x][y] + (radial_speed * e->move.radial[3]);
+            e->animation.angle = theta[idx] + (radial_speed * e->move.radial[3]);
             e->animation.offset_y = linear_speed * e->move.linear[3];
             e->animation.offset_z = 600;
             e->animation.scale_x = size;
             e->animation.scale_y = size;
             e->show4 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.angle = e->polar_theta[x][y] + (radial_speed * e->move.radial[4]);
+            e->animation.angle = theta[idx] + (radial_speed * e->move.radial[4]);
             e->animation.offset_y = linear_speed * e->move.linear[4];
             e->animation.offset_z = 800;
             e->animation.scale_x = size * 1.1;
             e->animation.scale_y = size * 1.1;
             e->show5 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.angle = e->polar_theta[x][y] + (radial_speed * e->move.radial[5]);
+            e->animation.angle = theta[idx] + (radial_speed * e->move.radial[5]);
             e->animation.offset_y = linear_speed * e->move.linear[5];
             e->animation.offset_z = 1800;
             e->animation.scale_x = size * 1.2;
             e->animation.scale_y = size * 1.2;
             e->show6 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.angle = e->polar_theta[x][y] + (radial_speed * e->move.radial[6]);
+            e->animation.angle = theta[idx] + (radial_speed * e->move.radial[6]);
             e->animation.offset_y = linear_speed * e->move.linear[6];
             e->animation.offset_z = 2800;
             e->animation.scale_x = size;
             e->animation.scale_y = size;
             e->show7 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.angle = e->polar_theta[x][y] + (radial_speed * e->move.radial[7]);
+            e->animation.angle = theta[idx] + (radial_speed * e->move.radial[7]);
             e->animation.offset_y = linear_speed * e->move.linear[7];
             e->animation.offset_z = 3800;
             e->animation.scale_x = size * 1.1;
             e->animation.scale_y = size * 1.1;
             e->show8 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.angle = e->polar_theta[x][y] + (radial_speed * e->move.radial[8]);
+            e->animation.angle = theta[idx] + (radial_speed * e->move.radial[8]);
             e->animation.offset_y = linear_speed * e->move.linear[8];
             e->animation.offset_z = 4800;
             e->animation.scale_x = size * 1.2;
@@ -13,10 +13,13 @@ void Hot_Blob::draw(Context &ctx) {
     e->get_ready();
     e->run_default_oscillators(0.001);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y];
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->animation.dist = distance[idx];
+            e->animation.angle = theta[idx];
 
             e->animation.scale_x = 0.07 + e->move.directional[0] * 0.002;
             e->animation.scale_y = 0.07;
@@ -70,10 +73,13 @@ void Hot_Blob_FP::draw(Context &ctx) {
     const fl::u8 *perm = PERLIN_NOISE;
     e->run_default_oscillators(0.001);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y];
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->animation.dist = distance[idx];
+            e->animation.angle = theta[idx];
 
             e->animation.scale_x = 0.07 + e->move.directional[0] * 0.002;
             e->animation.scale_y = 0.07;
@@ -26,10 +26,13 @@ void Lava1::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = e->distance[x][y] * 0.8;
-            e->animation.angle = e->polar_theta[x][y];
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->animation.dist = distance[idx] * 0.8;
+            e->animation.angle = theta[idx];
             e->animation.scale_x = 0.15;
             e->animation.scale_y = 0.12;
             e->animation.scale_z = 0.01;
@@ -91,10 +94,13 @@ void Lava1_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = e->distance[x][y] * 0.8;
-            e->animation.angle = e->polar_theta[x][y];
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->animation.dist = distance[idx] * 0.8;
+            e->animation.angle = theta[idx];
             e->animation.scale_x = 0.15;
             e->animation.scale_y = 0.12;
             e->animation.scale_z = 0.01;
@@ -20,13 +20,16 @@ void Module_Experiment3::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
             e->animation.dist =
-                e->distance[x][y] - (12 + e->move.directional[3] * 4);
+                distance[idx] - (12 + e->move.directional[3] * 4);
             e->animation.angle = e->move.noise_angle[0] + e->move.noise_angle[1] +
-                                 e->polar_theta[x][y];
+                                 theta[idx];
             e->animation.z = 5;
             e->animation.scale_x = 0.1;
             e->animation.scale_y = 0.1;
@@ -21,13 +21,16 @@ void Module_Experiment4::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
             float s = 0.8;
 
-            e->animation.dist = (e->distance[x][y] * e->distance[x][y]) * 0.7;
-            e->animation.angle = e->polar_theta[x][y];
+            e->animation.dist = (distance[idx] * distance[idx]) * 0.7;
+            e->animation.angle = theta[idx];
             e->animation.z = 5;
             e->animation.scale_x = 0.004 * s;
             e->animation.scale_y = 0.003 * s;
@@ -37,8 +40,8 @@ void Module_Experiment4::draw(Context &ctx) {
             e->animation.low_limit = 0;
             e->show1 = e->render_value(e->animation);
 
-            e->animation.dist = (e->distance[x][y] * e->distance[x][y]) * 0.8;
-            e->animation.angle = e->polar_theta[x][y];
+            e->animation.dist = (distance[idx] * distance[idx]) * 0.8;
+            e->animation.angle = theta[idx];
             e->animation.z = 50;
             e->animation.scale_x = 0.004 * s;
             e->animation.scale_y = 0.003 * s;
@@ -48,8 +51,8 @@ void Module_Experiment4::draw(Context &ctx) {
             e->animation.low_limit = 0;
             e->show2 = e->render_value(e->animation);
 
-            e->animation.dist = (e->distance[x][y] * e->distance[x][y]) * 0.9;
-            e->animation.angle = e->polar_theta[x][y];
+            e->animation.dist = (distance[idx] * distance[idx]) * 0.9;
+            e->animation.angle = theta[idx];
             e->animation.z = 5000;
             e->animation.scale_x = 0.004 * s;
             e->animation.scale_y = 0.003 * s;
@@ -91,13 +94,16 @@ void Module_Experiment4_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
             float s = 0.8;
 
-            e->animation.dist = (e->distance[x][y] * e->distance[x][y]) * 0.7;
-            e->animation.angle = e->polar_theta[x][y];
+            e->animation.dist = (distance[idx] * distance[idx]) * 0.7;
+            e->animation.angle = theta[idx];
             e->animation.z = 5;
             e->animation.scale_x = 0.004 * s;
             e->animation.scale_y = 0.003 * s;
@@ -107,8 +113,8 @@ void Module_Experiment4_FP::draw(Context &ctx) {
             e->animation.low_limit = 0;
             e->show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = (e->distance[x][y] * e->distance[x][y]) * 0.8;
-            e->animation.angle = e->polar_theta[x][y];
+            e->animation.dist = (distance[idx] * distance[idx]) * 0.8;
+            e->animation.angle = theta[idx];
             e->animation.z = 50;
             e->animation.scale_x = 0.004 * s;
             e->animation.scale_y = 0.003 * s;
@@ -118,8 +124,8 @@ void Module_Experiment4_FP::draw(Context &ctx) {
             e->animation.low_limit = 0;
             e->show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = (e->distance[x][y] * e->distance[x][y]) * 0.9;
-            e->animation.angle = e->polar_theta[x][y];
+            e->animation.dist = (distance[idx] * distance[idx]) * 0.9;
+            e->animation.angle = theta[idx];
             e->animation.z = 5000;
             e->animation.scale_x = 0.004 * s;
             e->animation.scale_y = 0.003 * s;
@@ -21,14 +21,17 @@ void Module_Experiment5::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
             float s = 1.5;
 
-            e->animation.dist = e->distance[x][y] +
-                                 fl::sinf(0.5 * e->distance[x][y] - e->move.radial[3]);
-            e->animation.angle = e->polar_theta[x][y];
+            e->animation.dist = distance[idx] +
+                                 fl::sinf(0.5 * distance[idx] - e->move.radial[3]);
+            e->animation.angle = theta[idx];
             e->animation.z = 5;
             e->animation.scale_x = 0.1 * s;
             e->animation.scale_y = 0.1 * s;
@@ -70,14 +73,17 @@ void Module_Experiment5_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
             float s = 1.5;
 
-            e->animation.dist = e->distance[x][y] +
-                                 fl::sinf(0.5 * e->distance[x][y] - e->move.radial[3]);
-            e->animation.angle = e->polar_theta[x][y];
+            e->animation.dist = distance[idx] +
+                                 fl::sinf(0.5 * distance[idx] - e->move.radial[3]);
+            e->animation.angle = theta[idx];
             e->animation.z = 5;
             e->animation.scale_x = 0.1 * s;
             e->animation.scale_y = 0.1 * s;
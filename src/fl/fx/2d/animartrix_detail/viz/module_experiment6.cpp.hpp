@@ -24,14 +24,17 @@ void Module_Experiment6::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
             float s = 0.8;
 
-            e->animation.dist = e->distance[x][y] +
-                                 fl::sinf(0.25 * e->distance[x][y] - e->move.radial[3]);
-            e->animation.angle = e->polar_theta[x][y];
+            e->animation.dist = distance[idx] +
+                                 fl::sinf(0.25 * distance[idx] - e->move.radial[3]);
+            e->animation.angle = theta[idx];
             e->animation.z = 5;
             e->animation.scale_x = 0.1 * s;
             e->animation.scale_y = 0.1 * s;
@@ -41,9 +44,9 @@ void Module_Experiment6::draw(Context &ctx) {
             e->animation.low_limit = 0;
             e->show1 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y] +
-                                 fl::sinf(0.24 * e->distance[x][y] - e->move.radial[4]);
-            e->animation.angle = e->polar_theta[x][y];
+            e->animation.dist = distance[idx] +
+                                 fl::sinf(0.24 * distance[idx] - e->move.radial[4]);
+            e->animation.angle = theta[idx];
             e->animation.z = 10;
             e->animation.scale_x = 0.1 * s;
             e->animation.scale_y = 0.1 * s;
@@ -88,14 +91,17 @@ void Module_Experiment6_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
             float s = 0.8;
 
-            e->animation.dist = e->distance[x][y] +
-                                 fl::sinf(0.25 * e->distance[x][y] - e->move.radial[3]);
-            e->animation.angle = e->polar_theta[x][y];
+            e->animation.dist = distance[idx] +
+                                 fl::sinf(0.25 * distance[idx] - e->move.radial[3]);
+            e->animation.angle = theta[idx];
             e->animation.z = 5;
             e->animation.scale_x = 0.1 * s;
             e->animation.scale_y = 0.1 * s;
@@ -105,9 +111,9 @@ void Module_Experiment6_FP::draw(Context &ctx) {
             e->animation.low_limit = 0;
             e->show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y] +
-                                 fl::sinf(0.24 * e->distance[x][y] - e->move.radial[4]);
-            e->animation.angle = e->polar_theta[x][y];
+            e->animation.dist = distance[idx] +
+                                 fl::sinf(0.24 * distance[idx] - e->move.radial[4]);
+            e->animation.angle = theta[idx];
             e->animation.z = 10;
             e->animation.scale_x = 0.1 * s;
             e->animation.scale_y = 0.1 * s;
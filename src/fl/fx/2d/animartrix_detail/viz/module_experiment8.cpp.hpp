@@ -34,16 +34,19 @@ void Module_Experiment8::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
             float s = 0.4;
             float r = 1.5;
 
             e->animation.dist =
-                3 + e->distance[x][y] +
-                3 * fl::sinf(0.25 * e->distance[x][y] - e->move.radial[3]);
-            e->animation.angle = e->polar_theta[x][y] + e->move.noise_angle[0] +
+                3 + distance[idx] +
+                3 * fl::sinf(0.25 * distance[idx] - e->move.radial[3]);
+            e->animation.angle = theta[idx] + e->move.noise_angle[0] +
                                  e->move.noise_angle[6];
             e->animation.z = 5;
             e->animation.scale_x = 0.1 * s;
@@ -55,9 +58,9 @@ void Module_Experiment8::draw(Context &ctx) {
             e->show1 = e->render_value(e->animation);
 
             e->animation.dist =
-                4 + e->distance[x][y] +
-                4 * fl::sinf(0.24 * e->distance[x][y] - e->move.radial[4]);
-            e->animation.angle = e->polar_theta[x][y] + e->move.noise_angle[1] +
+                4 + distance[idx] +
+                4 * fl::sinf(0.24 * distance[idx] - e->move.radial[4]);
+            e->animation.angle = theta[idx] + e->move.noise_angle[1] +
                                  e->move.noise_angle[6];
             e->animation.z = 5;
             e->animation.scale_x = 0.1 * s;
@@ -69,9 +72,9 @@ void Module_Experiment8::draw(Context &ctx) {
             e->show2 = e->render_value(e->animation);
 
             e->animation.dist =
-                5 + e->distance[x][y] +
-                5 * fl::sinf(0.23 * e->distance[x][y] - e->move.radial[5]);
-            e->animation.angle = e->polar_theta[x][y] + e->move.noise_angle[2] +
+                5 + distance[idx] +
+                5 * fl::sinf(0.23 * distance[idx] - e->move.radial[5]);
+            e->animation.angle = theta[idx] + e->move.noise_angle[2] +
                                  e->move.noise_angle[6];
             e->animation.z = 5;
             e->animation.scale_x = 0.1 * s;
@@ -85,7 +88,7 @@ void Module_Experiment8::draw(Context &ctx) {
             e->show4 = e->colordodge(e->show1, e->show2);
 
             float rad = fl::sinf(PI / 2 +
-                             e->distance[x][y] / 14);
+                             distance[idx] / 14);
 
             e->pixel.red = rad * ((e->show1 + e->show2) + e->show3);
             e->pixel.green = (((e->show2 + e->show3) * 0.8) - 90) * rad;
@@ -132,16 +135,19 @@ void Module_Experiment8_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
             float s = 0.4;
             float r = 1.5;
 
             e->animation.dist =
-                3 + e->distance[x][y] +
-                3 * fl::sinf(0.25 * e->distance[x][y] - e->move.radial[3]);
-            e->animation.angle = e->polar_theta[x][y] + e->move.noise_angle[0] +
+                3 + distance[idx] +
+                3 * fl::sinf(0.25 * distance[idx] - e->move.radial[3]);
+            e->animation.angle = theta[idx] + e->move.noise_angle[0] +
                                  e->move.noise_angle[6];
             e->animation.z = 5;
             e->animation.scale_x = 0.1 * s;
@@ -153,9 +159,9 @@ void Module_Experiment8_FP::draw(Context &ctx) {
             e->show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
             e->animation.dist =
-                4 + e->distance[x][y] +
-                4 * fl::sinf(0.24 * e->distance[x][y] - e->move.radial[4]);
-            e->animation.angle = e->polar_theta[x][y] + e->move.noise_angle[1] +
+                4 + distance[idx] +
+                4 * fl::sinf(0.24 * distance[idx] - e->move.radial[4]);
+            e->animation.angle = theta[idx] + e->move.noise_angle[1] +
                                  e->move.noise_angle[6];
             e->animation.z = 5;
             e->animation.scale_x = 0.1 * s;
@@ -167,9 +173,9 @@ void Module_Experiment8_FP::draw(Context &ctx) {
             e->show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
             e->animation.dist =
-                5 + e->distance[x][y] +
-                5 * fl::sinf(0.23 * e->distance[x][y] - e->move.radial[5]);
-            e->animation.angle = e->polar_theta[x][y] + e->move.noise_angle[2] +
+                5 + distance[idx] +
+                5 * fl::sinf(0.23 * distance[idx] - e->move.radial[5]);
+            e->animation.angle = theta[idx] + e->move.noise_angle[2] +
                                  e->move.noise_angle[6];
             e->animation.z = 5;
             e->animation.scale_x = 0.1 * s;
@@ -183,7 +189,7 @@ void Module_Experiment8_FP::draw(Context &ctx) {
             e->show4 = e->colordodge(e->show1, e->show2);
 
             float rad = fl::sinf(PI / 2 +
-                             e->distance[x][y] / 14);
+                             distance[idx] / 14);
 
             e->pixel.red = rad * ((e->show1 + e->show2) + e->show3);
             e->pixel.green = (((e->show2 + e->show3) * 0.8) - 90) * rad;
@@ -26,11 +26,14 @@ void Module_Experiment9::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[1];
+            e->animation.dist = distance[idx];
+            e->animation.angle = theta[idx] + e->move.radial[1];
             e->animation.z = 5;
             e->animation.scale_x = 0.001;
             e->animation.scale_y = 0.1;
@@ -78,11 +81,14 @@ void Module_Experiment9_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[1];
+            e->animation.dist = distance[idx];
+            e->animation.angle = theta[idx] + e->move.radial[1];
             e->animation.z = 5;
             e->animation.scale_x = 0.001;
             e->animation.scale_y = 0.1;
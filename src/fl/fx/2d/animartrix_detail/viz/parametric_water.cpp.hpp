@@ -23,16 +23,19 @@ void Parametric_Water::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
             float s = 4;
             float f = 10 + 2 * e->move.directional[0];
 
             e->animation.dist = (f + e->move.directional[0]) *
                                  fl::sinf(-e->move.radial[5] + e->move.radial[0] +
-                                      (e->distance[x][y] / (s)));
-            e->animation.angle = 1 * e->polar_theta[x][y];
+                                      (distance[idx] / (s)));
+            e->animation.angle = 1 * theta[idx];
             e->animation.z = 5;
             e->animation.scale_x = 0.1;
             e->animation.scale_y = 0.1;
@@ -44,8 +47,8 @@ void Parametric_Water::draw(Context &ctx) {
 
             e->animation.dist = (f + e->move.directional[1]) *
                                  fl::sinf(-e->move.radial[5] + e->move.radial[1] +
-                                      (e->distance[x][y] / (s)));
-            e->animation.angle = 1 * e->polar_theta[x][y];
+                                      (distance[idx] / (s)));
+            e->animation.angle = 1 * theta[idx];
             e->animation.z = 500;
             e->animation.scale_x = 0.1;
             e->animation.scale_y = 0.1;
@@ -57,8 +60,8 @@ void Parametric_Water::draw(Context &ctx) {
 
             e->animation.dist = (f + e->move.directional[2]) *
                                  fl::sinf(-e->move.radial[5] + e->move.radial[2] +
-                                      (e->distance[x][y] / (s)));
-            e->animation.angle = 1 * e->polar_theta[x][y];
+                                      (distance[idx] / (s)));
+            e->animation.angle = 1 * theta[idx];
             e->animation.z = 5000;
             e->animation.scale_x = 0.1;
             e->animation.scale_y = 0.1;
@@ -70,8 +73,8 @@ void Parametric_Water::draw(Context &ctx) {
 
             e->animation.dist = (f + e->move.directional[3]) *
                                  fl::sinf(-e->move.radial[5] + e->move.radial[3] +
-                                      (e->distance[x][y] / (s)));
-            e->animation.angle = 1 * e->polar_theta[x][y];
+                                      (distance[idx] / (s)));
+            e->animation.angle = 1 * theta[idx];
             e->animation.z = 2000;
             e->animation.scale_x = 0.1;
             e->animation.scale_y = 0.1;
@@ -85,7 +88,7 @@ void Parametric_Water::draw(Context &ctx) {
             e->show7 = e->screen(e->show2, e->show3);
 
             float radius = 40;
-            float radial = (radius - e->distance[x][y]) / radius;
+            float radial = (radius - distance[idx]) / radius;
 
             e->pixel.red = e->pixel.blue - 40;
             e->pixel.green = 0;
@@ -121,16 +124,19 @@ void Parametric_Water_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
             float s = 4;
             float f = 10 + 2 * e->move.directional[0];
 
             e->animation.dist = (f + e->move.directional[0]) *
                                  fl::sinf(-e->move.radial[5] + e->move.radial[0] +
-                                      (e->distance[x][y] / (s)));
-            e->animation.angle = 1 * e->polar_theta[x][y];
+                                      (distance[idx] / (s)));
+            e->animation.angle = 1 * theta[idx];
             e->animation.z = 5;
             e->animation.scale_x = 0.1;
             e->animation.scale_y = 0.1;
@@ -142,8 +148,8 @@ void Parametric_Water_FP::draw(Context &ctx) {
 
             e->animation.dist = (f + e->move.directional[1]) *
                                  fl::sinf(-e->move.radial[5] + e->move.radial[1] +
-                                      (e->distance[x][y] / (s)));
-            e->animation.angle = 1 * e->polar_theta[x][y];
+                                      (distance[idx] / (s)));
+            e->animation.angle = 1 * theta[idx];
             e->animation.z = 500;
             e->animation.scale_x = 0.1;
             e->animation.scale_y = 0.1;
@@ -155,8 +161,8 @@ void Parametric_Water_FP::draw(Context &ctx) {
 
             e->animation.dist = (f + e->move.directional[2]) *
                                  fl::sinf(-e->move.radial[5] + e->move.radial[2] +
-                                      (e->distance[x][y] / (s)));
-            e->animation.angle = 1 * e->polar_theta[x][y];
+                                      (distance[idx] / (s)));
+            e->animation.angle = 1 * theta[idx];
             e->animation.z = 5000;
             e->animation.scale_x = 0.1;
             e->animation.scale_y = 0.1;
@@ -168,8 +174,8 @@ void Parametric_Water_FP::draw(Context &ctx) {
 
             e->animation.dist = (f + e->move.directional[3]) *
                                  fl::sinf(-e->move.radial[5] + e->move.radial[3] +
-                                      (e->distance[x][y] / (s)));
-            e->animation.angle = 1 * e->polar_theta[x][y];
+                                      (distance[idx] / (s)));
+            e->animation.angle = 1 * theta[idx];
             e->animation.z = 2000;
             e->animation.scale_x = 0.1;
             e->animation.scale_y = 0.1;
@@ -183,7 +189,7 @@ void Parametric_Water_FP::draw(Context &ctx) {
             e->show7 = e->screen(e->show2, e->show3);
 
             float radius = 40;
-            float radial = (radius - e->distance[x][y]) / radius;
+            float radial = (radius - distance[idx]) / radius;
 
             e->pixel.red = e->pixel.blue - 40;
             e->pixel.green = 0;
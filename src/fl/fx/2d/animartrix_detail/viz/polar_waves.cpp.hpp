@@ -8,10 +8,18 @@ FL_OPTIMIZATION_LEVEL_O3_BEGIN
 
 namespace fl {
 
-void Polar_Waves::draw(Context &ctx) {
-    auto *e = ctx.mEngine.get();
-    e->get_ready();
-
+namespace {
+
+// Per-frame constants shared by the float and FP paths, computed once
+// before the pixel loop instead of re-read through the Engine per pixel.
+struct PolarWavesFrame {
+    float radial[3];
+    float linear[3];
+    float linear10[3];  // 10 * move.linear[i]
+    float radius;
+};
+
+PolarWavesFrame polarWavesSetup(Engine *e) {
     e->timings.master_speed = 0.5;
     e->timings.ratio[0] = 0.0025;
     e->timings.ratio[1] = 0.0027;
@@ -19,39 +27,56 @@ void Polar_Waves::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    PolarWavesFrame f;
+    for (int i = 0; i < 3; i++) {
+        f.radial[i] = e->move.radial[i];
+        f.linear[i] = e->move.linear[i];
+        f.linear10[i] = 10 * e->move.linear[i];
+    }
+    f.radius = e->radial_filter_radius;
+    e->animation.scale_x = 0.15;
+    e->animation.scale_y = 0.15;
+    return f;
+}
+
+// Renders one Polar_Waves pixel; value(anim) evaluates the noise field.
+template <typename RenderValue>
+FASTLED_FORCE_INLINE void polarWavesPixel(Engine *e, const PolarWavesFrame &f,
+                                          int x, int y, float theta,
+                                          float dist, RenderValue value) {
+    float show[3];
+    e->animation.dist = dist;
+    for (int i = 0; i < 3; i++) {
+        e->animation.angle = theta - e->animation.dist * 0.1 + f.radial[i];
+        e->animation.z = (e->animation.dist * 1.5) - f.linear10[i];
+        e->animation.offset_x = f.linear[i];
+        show[i] = value(e->animation);
+    }
+
+    float radial = (f.radius - dist) / dist;
+
+    e->pixel.red = radial * show[0];
+    e->pixel.green = radial * show[1];
+    e->pixel.blue = radial * show[2];
+
+    e->pixel = e->rgb_sanity_check(e->pixel);
+    e->setPixelColorInternal(x, y, e->pixel);
+}
+
+} // namespace
+
+void Polar_Waves::draw(Context &ctx) {
+    auto *e = ctx.mEngine.get();
+    e->get_ready();
+    const PolarWavesFrame f = polarWavesSetup(e);
+
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    auto value = [e](render_parameters &anim) { return e->render_value(anim); };
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = (e->distance[x][y]);
-            e->animation.angle =
-                e->polar_theta[x][y] - e->animation.dist * 0.1 + e->move.radial[0];
-            e->animation.z = (e->animation.dist * 1.5) - 10 * e->move.linear[0];
-            e->animation.scale_x = 0.15;
-            e->animation.scale_y = 0.15;
-            e->animation.offset_x = e->move.linear[0];
-
-            float show1 = e->render_value(e->animation);
-            e->animation.angle =
-                e->polar_theta[x][y] - e->animation.dist * 0.1 + e->move.radial[1];
-            e->animation.z = (e->animation.dist * 1.5) - 10 * e->move.linear[1];
-            e->animation.offset_x = e->move.linear[1];
-
-            float show2 = e->render_value(e->animation);
-            e->animation.angle =
-                e->polar_theta[x][y] - e->animation.dist * 0.1 + e->move.radial[2];
-            e->animation.z = (e->animation.dist * 1.5) - 10 * e->move.linear[2];
-            e->animation.offset_x = e->move.linear[2];
-
-            float show3 = e->render_value(e->animation);
-
-            float radius = e->radial_filter_radius;
-            float radial = (radius - e->distance[x][y]) / e->distance[x][y];
-
-            e->pixel.red = radial * show1;
-            e->pixel.green = radial * show2;
-            e->pixel.blue = radial * show3;
-
-            e->pixel = e->rgb_sanity_check(e->pixel);
-            e->setPixelColorInternal(x, y, e->pixel);
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            polarWavesPixel(e, f, x, y, theta[idx], distance[idx], value);
         }
     }
 }
@@ -67,47 +92,17 @@ void Polar_Waves_FP::draw(Context &ctx) {
     mState.ensureCache(e);
     const fl::i32 *fade_lut = fl::assume_aligned<16>(mState.fade_lut);
     const fl::u8 *perm = PERLIN_NOISE;
-
-    e->timings.master_speed = 0.5;
-    e->timings.ratio[0] = 0.0025;
-    e->timings.ratio[1] = 0.0027;
-    e->timings.ratio[2] = 0.0031;
-
-    e->calculate_oscillators(e->timings);
-
+    const PolarWavesFrame f = polarWavesSetup(e);
+
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    auto value = [fade_lut, perm](render_parameters &anim) {
+        return render_value_fp_from_float(anim, fade_lut, perm);
+    };
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = (e->distance[x][y]);
-            e->animation.angle =
-                e->polar_theta[x][y] - e->animation.dist * 0.1 + e->move.radial[0];
-            e->animation.z = (e->animation.dist * 1.5) - 10 * e->move.linear[0];
-            e->animation.scale_x = 0.15;
-            e->animation.scale_y = 0.15;
-            e->animation.offset_x = e->move.linear[0];
-
-            float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
-            e->animation.angle =
-                e->polar_theta[x][y] - e->animation.dist * 0.1 + e->move.radial[1];
-            e->animation.z = (e->animation.dist * 1.5) - 10 * e->move.linear[1];
-            e->animation.offset_x = e->move.linear[1];
-
-            float show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
-            e->animation.angle =
-                e->polar_theta[x][y] - e->animation.dist * 0.1 + e->move.radial[2];
-            e->animation.z = (e->animation.dist * 1.5) - 10 * e->move.linear[2];
-            e->animation.offset_x = e->move.linear[2];
-
-            float show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            float radius = e->radial_filter_radius;
-            float radial = (radius - e->distance[x][y]) / e->distance[x][y];
-
-            e->pixel.red = radial * show1;
-            e->pixel.green = radial * show2;
-            e->pixel.blue = radial * show3;
-
-            e->pixel = e->rgb_sanity_check(e->pixel);
-            e->setPixelColorInternal(x, y, e->pixel);
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            polarWavesPixel(e, f, x, y, theta[idx], distance[idx], value);
         }
     }
 }
@@ -22,10 +22,13 @@ void RGB_Blobs5::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = e->distance[x][y] + e->move.noise_angle[4];
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[0] +
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->animation.dist = distance[idx] + e->move.noise_angle[4];
+            e->animation.angle = theta[idx] + e->move.radial[0] +
                                  e->move.noise_angle[0] + e->move.noise_angle[3] +
                                  e->move.noise_angle[1];
             e->animation.z = 3 + fl::sqrtf(e->animation.dist);
@@ -35,14 +38,14 @@ void RGB_Blobs5::draw(Context &ctx) {
             e->animation.offset_x = 50 * e->move.linear[0];
             float show1 = e->render_value(e->animation);
 
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[1] +
+            e->animation.angle = theta[idx] + e->move.radial[1] +
                                  e->move.noise_angle[1] + e->move.noise_angle[4] +
                                  e->move.noise_angle[2];
             e->animation.offset_x = 50 * e->move.linear[1];
             e->animation.offset_z = 100;
             float show2 = e->render_value(e->animation);
 
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[2] +
+            e->animation.angle = theta[idx] + e->move.radial[2] +
                                  e->move.noise_angle[2] + e->move.noise_angle[5] +
                                  e->move.noise_angle[3];
             e->animation.offset_x = 50 * e->move.linear[2];
@@ -50,7 +53,7 @@ void RGB_Blobs5::draw(Context &ctx) {
             float show3 = e->render_value(e->animation);
 
             float radius = 23;
-            float radial = (radius - e->distance[x][y]) / e->distance[x][y];
+            float radial = (radius - distance[idx]) / distance[idx];
 
             e->pixel.red = radial * (show1 + show3) * 0.5 * e->animation.dist / 5;
             e->pixel.green = radial * (show2 + show1) * 0.5 * y / 15;
@@ -84,10 +87,13 @@ void RGB_Blobs5_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = e->distance[x][y] + e->move.noise_angle[4];
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[0] +
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->animation.dist = distance[idx] + e->move.noise_angle[4];
+            e->animation.angle = theta[idx] + e->move.radial[0] +
                                  e->move.noise_angle[0] + e->move.noise_angle[3] +
                                  e->move.noise_angle[1];
             e->animation.z = 3 + fl::sqrtf(e->animation.dist);
@@ -97,14 +103,14 @@ void RGB_Blobs5_FP::draw(Context &ctx) {
             e->animation.offset_x = 50 * e->move.linear[0];
             float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[1] +
+            e->animation.angle = theta[idx] + e->move.radial[1] +
                                  e->move.noise_angle[1] + e->move.noise_angle[4] +
                                  e->move.noise_angle[2];
             e->animation.offset_x = 50 * e->move.linear[1];
             e->animation.offset_z = 100;
             float show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[2] +
+            e->animation.angle = theta[idx] + e->move.radial[2] +
                                  e->move.noise_angle[2] + e->move.noise_angle[5] +
                                  e->move.noise_angle[3];
             e->animation.offset_x = 50 * e->move.linear[2];
@@ -112,7 +118,7 @@ void RGB_Blobs5_FP::draw(Context &ctx) {
             float show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
             float radius = 23;
-            float radial = (radius - e->distance[x][y]) / e->distance[x][y];
+            float radial = (radius - distance[idx]) / distance[idx];
 
             e->pixel.red = radial * (show1 + show3) * 0.5 * e->animation.dist / 5;
             e->pixel.green = radial * (show2 + show1) * 0.5 * y / 15;
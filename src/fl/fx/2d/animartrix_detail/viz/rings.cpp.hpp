@@ -23,24 +23,26 @@ void Rings::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
             e->animation.angle = 5;
             e->animation.scale_x = 0.2;
             e->animation.scale_y = 0.2;
             e->animation.scale_z = 1;
-            e->animation.dist = e->distance[x][y];
+            e->animation.dist = distance[idx];
             e->animation.offset_y = -e->move.linear[0];
             e->animation.offset_x = 0;
             float show1 = e->render_value(e->animation);
 
             e->animation.angle = 10;
-            e->animation.dist = e->distance[x][y];
+            e->animation.dist = distance[idx];
             e->animation.offset_y = -e->move.linear[1];
             float show2 = e->render_value(e->animation);
 
             e->animation.angle = 12;
-            e->animation.dist = e->distance[x][y];
+            e->animation.dist = distance[idx];
             e->animation.offset_y = -e->move.linear[2];
             float show3 = e->render_value(e->animation);
 
@@ -77,24 +79,26 @@ void Rings_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
             e->animation.angle = 5;
             e->animation.scale_x = 0.2;
             e->animation.scale_y = 0.2;
             e->animation.scale_z = 1;
-            e->animation.dist = e->distance[x][y];
+            e->animation.dist = distance[idx];
             e->animation.offset_y = -e->move.linear[0];
             e->animation.offset_x = 0;
             float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
             e->animation.angle = 10;
-            e->animation.dist = e->distance[x][y];
+            e->animation.dist = distance[idx];
             e->animation.offset_y = -e->move.linear[1];
             float show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
             e->animation.angle = 12;
-            e->animation.dist = e->distance[x][y];
+            e->animation.dist = distance[idx];
             e->animation.offset_y = -e->move.linear[2];
             float show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
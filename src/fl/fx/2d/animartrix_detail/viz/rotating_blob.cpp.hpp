@@ -24,35 +24,38 @@ void Rotating_Blob::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
             e->animation.scale_x = 0.05;
             e->animation.scale_y = 0.05;
             e->animation.offset_x = 0;
             e->animation.offset_y = 0;
             e->animation.offset_z = 100;
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[0];
-            e->animation.dist = e->distance[x][y];
+            e->animation.angle = theta[idx] + e->move.radial[0];
+            e->animation.dist = distance[idx];
             e->animation.z = e->move.linear[0];
             e->animation.low_limit = -1;
             float show1 = e->render_value(e->animation);
 
             e->animation.angle =
-                e->polar_theta[x][y] - e->move.radial[1] + show1 / 512.0;
-            e->animation.dist = e->distance[x][y] * show1 / 255.0;
+                theta[idx] - e->move.radial[1] + show1 / 512.0;
+            e->animation.dist = distance[idx] * show1 / 255.0;
             e->animation.low_limit = 0;
             e->animation.z = e->move.linear[1];
             float show2 = e->render_value(e->animation);
 
             e->animation.angle =
-                e->polar_theta[x][y] - e->move.radial[2] + show1 / 512.0;
-            e->animation.dist = e->distance[x][y] * show1 / 220.0;
+                theta[idx] - e->move.radial[2] + show1 / 512.0;
+            e->animation.dist = distance[idx] * show1 / 220.0;
             e->animation.z = e->move.linear[2];
             float show3 = e->render_value(e->animation);
 
             e->animation.angle =
-                e->polar_theta[x][y] - e->move.radial[3] + show1 / 512.0;
-            e->animation.dist = e->distance[x][y] * show1 / 200.0;
+                theta[idx] - e->move.radial[3] + show1 / 512.0;
+            e->animation.dist = distance[idx] * show1 / 200.0;
             e->animation.z = e->move.linear[3];
             float show4 = e->render_value(e->animation);
 
@@ -90,35 +93,38 @@ void Rotating_Blob_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
             e->animation.scale_x = 0.05;
             e->animation.scale_y = 0.05;
             e->animation.offset_x = 0;
             e->animation.offset_y = 0;
             e->animation.offset_z = 100;
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[0];
-            e->animation.dist = e->distance[x][y];
+            e->animation.angle = theta[idx] + e->move.radial[0];
+            e->animation.dist = distance[idx];
             e->animation.z = e->move.linear[0];
             e->animation.low_limit = -1;
             float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
             e->animation.angle =
-                e->polar_theta[x][y] - e->move.radial[1] + show1 / 512.0;
-            e->animation.dist = e->distance[x][y] * show1 / 255.0;
+                theta[idx] - e->move.radial[1] + show1 / 512.0;
+            e->animation.dist = distance[idx] * show1 / 255.0;
             e->animation.low_limit = 0;
             e->animation.z = e->move.linear[1];
             float show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
             e->animation.angle =
-                e->polar_theta[x][y] - e->move.radial[2] + show1 / 512.0;
-            e->animation.dist = e->distance[x][y] * show1 / 220.0;
+                theta[idx] - e->move.radial[2] + show1 / 512.0;
+            e->animation.dist = distance[idx] * show1 / 220.0;
             e->animation.z = e->move.linear[2];
             float show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
             e->animation.angle =
-                e->polar_theta[x][y] - e->move.radial[3] + show1 / 512.0;
-            e->animation.dist = e->distance[x][y] * show1 / 200.0;
+                theta[idx] - e->move.radial[3] + show1 / 512.0;
+            e->animation.dist = distance[idx] * show1 / 200.0;
             e->animation.z = e->move.linear[3];
             float show4 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
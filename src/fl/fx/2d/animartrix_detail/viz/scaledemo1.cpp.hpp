@@ -26,10 +26,13 @@ void Scaledemo1::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = 0.3 * e->distance[x][y] * 0.8;
-            e->animation.angle = 3 * e->polar_theta[x][y] + e->move.radial[2];
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->animation.dist = 0.3 * distance[idx] * 0.8;
+            e->animation.angle = 3 * theta[idx] + e->move.radial[2];
             e->animation.scale_x = 0.1 + (e->move.noise_angle[0]) / 10;
             e->animation.scale_y = 0.1 + (e->move.noise_angle[1]) / 10;
             e->animation.scale_z = 0.01;
@@ -47,7 +50,7 @@ void Scaledemo1::draw(Context &ctx) {
             e->pixel.green = (show1 - show2) * dist * 0.3;
             e->pixel.blue = (show2 - show1) * dist;
 
-            if (e->distance[x][y] > 16) {
+            if (distance[idx] > 16) {
                 e->pixel.red = 0;
                 e->pixel.green = 0;
                 e->pixel.blue = 0;
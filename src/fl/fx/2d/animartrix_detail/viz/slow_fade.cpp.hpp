@@ -16,12 +16,15 @@ void Slow_Fade::draw(Context &ctx) {
     e->timings.master_speed = 0.00005;
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
             e->animation.dist =
-                fl::sqrtf(e->distance[x][y]) * 0.7 * (e->move.directional[0] + 1.5);
+                fl::sqrtf(distance[idx]) * 0.7 * (e->move.directional[0] + 1.5);
             e->animation.angle =
-                e->polar_theta[x][y] - e->move.radial[0] + e->distance[x][y] / 5;
+                theta[idx] - e->move.radial[0] + distance[idx] / 5;
 
             e->animation.scale_x = 0.11;
             e->animation.scale_y = 0.11;
@@ -44,7 +47,7 @@ void Slow_Fade::draw(Context &ctx) {
             float show3 = e->render_value(e->animation);
 
             float radius = e->radial_filter_radius;
-            float radial = (radius - e->distance[x][y]) / e->distance[x][y];
+            float radial = (radius - distance[idx]) / distance[idx];
 
             e->pixel.red = radial * show1;
             e->pixel.green = radial * (show1 - show2) / 6;
@@ -72,12 +75,15 @@ void Slow_Fade_FP::draw(Context &ctx) {
     e->timings.master_speed = 0.00005;
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
             e->animation.dist =
-                fl::sqrtf(e->distance[x][y]) * 0.7 * (e->move.directional[0] + 1.5);
+                fl::sqrtf(distance[idx]) * 0.7 * (e->move.directional[0] + 1.5);
             e->animation.angle =
-                e->polar_theta[x][y] - e->move.radial[0] + e->distance[x][y] / 5;
+                theta[idx] - e->move.radial[0] + distance[idx] / 5;
 
             e->animation.scale_x = 0.11;
             e->animation.scale_y = 0.11;
@@ -100,7 +106,7 @@ void Slow_Fade_FP::draw(Context &ctx) {
             float show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
             float radius = e->radial_filter_radius;
-            float radial = (radius - e->distance[x][y]) / e->distance[x][y];
+            float radial = (radius - distance[idx]) / distance[idx];
 
             e->pixel.red = radial * show1;
             e->pixel.green = radial * (show1 - show2) / 6;
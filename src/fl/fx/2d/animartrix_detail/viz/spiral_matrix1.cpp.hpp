@@ -23,10 +23,12 @@ void SpiralMatrix1::draw(Context &ctx) {
     e->calculate_oscillators(e->timings);
 
     for (int x = 0; x < e->num_x / 2; x++) {
+        const float *thetaRow = e->polar_theta[x];
+        const float *distanceRow = e->distance[x];
         for (int y = 0; y < e->num_y / 2; y++) {
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y] + 5 * e->move.noise_angle[0];
+            e->animation.dist = distanceRow[y];
+            e->animation.angle = thetaRow[y] + 5 * e->move.noise_angle[0];
             e->animation.z = 5;
             e->animation.scale_x = 0.1;
             e->animation.scale_y = 0.1;
@@ -35,8 +37,8 @@ void SpiralMatrix1::draw(Context &ctx) {
             e->animation.offset_y = 150 * e->move.directional[1];
             float show1 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y] + 4 * e->move.noise_angle[1];
+            e->animation.dist = distanceRow[y];
+            e->animation.angle = thetaRow[y] + 4 * e->move.noise_angle[1];
             e->animation.z = 15;
             e->animation.scale_x = 0.15;
             e->animation.scale_y = 0.15;
@@ -45,8 +47,8 @@ void SpiralMatrix1::draw(Context &ctx) {
             e->animation.offset_y = 150 * e->move.directional[2];
             float show2 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y] + 5 * e->move.noise_angle[2];
+            e->animation.dist = distanceRow[y];
+            e->animation.angle = thetaRow[y] + 5 * e->move.noise_angle[2];
             e->animation.z = 25;
             e->animation.scale_x = 0.1;
             e->animation.scale_y = 0.1;
@@ -55,8 +57,8 @@ void SpiralMatrix1::draw(Context &ctx) {
             e->animation.offset_y = 150 * e->move.directional[3];
             float show3 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y] + 5 * e->move.noise_angle[3];
+            e->animation.dist = distanceRow[y];
+            e->animation.angle = thetaRow[y] + 5 * e->move.noise_angle[3];
             e->animation.z = 35;
             e->animation.scale_x = 0.15;
             e->animation.scale_y = 0.15;
@@ -65,8 +67,8 @@ void SpiralMatrix1::draw(Context &ctx) {
             e->animation.offset_y = 150 * e->move.directional[4];
             float show4 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y] + 5 * e->move.noise_angle[4];
+            e->animation.dist = distanceRow[y];
+            e->animation.angle = thetaRow[y] + 5 * e->move.noise_angle[4];
             e->animation.z = 45;
             e->animation.scale_x = 0.2;
             e->animation.scale_y = 0.2;
@@ -112,10 +114,12 @@ void SpiralMatrix1_FP::draw(Context &ctx) {
     e->calculate_oscillators(e->timings);
 
     for (int x = 0; x < e->num_x / 2; x++) {
+        const float *thetaRow = e->polar_theta[x];
+        const float *distanceRow = e->distance[x];
         for (int y = 0; y < e->num_y / 2; y++) {
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y] + 5 * e->move.noise_angle[0];
+            e->animation.dist = distanceRow[y];
+            e->animation.angle = thetaRow[y] + 5 * e->move.noise_angle[0];
             e->animation.z = 5;
             e->animation.scale_x = 0.1;
             e->animation.scale_y = 0.1;
@@ -124,8 +128,8 @@ void SpiralMatrix1_FP::draw(Context &ctx) {
             e->animation.offset_y = 150 * e->move.directional[1];
             float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y] + 4 * e->move.noise_angle[1];
+            e->animation.dist = distanceRow[y];
+            e->animation.angle = thetaRow[y] + 4 * e->move.noise_angle[1];
             e->animation.z = 15;
             e->animation.scale_x = 0.15;
             e->animation.scale_y = 0.15;
@@ -134,8 +138,8 @@ void SpiralMatrix1_FP::draw(Context &ctx) {
             e->animation.offset_y = 150 * e->move.directional[2];
             float show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y] + 5 * e->move.noise_angle[2];
+            e->animation.dist = distanceRow[y];
+            e->animation.angle = thetaRow[y] + 5 * e->move.noise_angle[2];
             e->animation.z = 25;
             e->animation.scale_x = 0.1;
             e->animation.scale_y = 0.1;
@@ -144,8 +148,8 @@ void SpiralMatrix1_FP::draw(Context &ctx) {
             e->animation.offset_y = 150 * e->move.directional[3];
             float show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y] + 5 * e->move.noise_angle[3];
+            e->animation.dist = distanceRow[y];
+            e->animation.angle = thetaRow[y] + 5 * e->move.noise_angle[3];
             e->animation.z = 35;
             e->animation.scale_x = 0.15;
             e->animation.scale_y = 0.15;
@@ -154,8 +158,8 @@ void SpiralMatrix1_FP::draw(Context &ctx) {
             e->animation.offset_y = 150 * e->move.directional[4];
             float show4 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y] + 5 * e->move.noise_angle[4];
+            e->animation.dist = distanceRow[y];
+            e->animation.angle = thetaRow[y] + 5 * e->move.noise_angle[4];
             e->animation.z = 45;
             e->animation.scale_x = 0.2;
             e->animation.scale_y = 0.2;
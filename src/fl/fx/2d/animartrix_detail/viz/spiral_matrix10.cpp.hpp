@@ -22,13 +22,16 @@ void SpiralMatrix10::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
             float scale = 0.6;
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y];
+            e->animation.dist = distance[idx];
+            e->animation.angle = theta[idx];
             e->animation.z = 5;
             e->animation.scale_x = 0.09 * scale;
             e->animation.scale_y = 0.09 * scale;
@@ -38,8 +41,8 @@ void SpiralMatrix10::draw(Context &ctx) {
             e->animation.low_limit = -1;
             e->show1 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y];
+            e->animation.dist = distance[idx];
+            e->animation.angle = theta[idx];
             e->animation.z = 50;
             e->animation.scale_x = 0.09 * scale;
             e->animation.scale_y = 0.09 * scale;
@@ -49,8 +52,8 @@ void SpiralMatrix10::draw(Context &ctx) {
             e->animation.low_limit = -1;
             e->show2 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y] + 2 + (e->show1 / 255) * PI;
+            e->animation.dist = distance[idx];
+            e->animation.angle = theta[idx] + 2 + (e->show1 / 255) * PI;
             e->animation.z = 5;
             e->animation.scale_x = 0.09 * scale;
             e->animation.scale_y = 0.09 * scale;
@@ -60,8 +63,8 @@ void SpiralMatrix10::draw(Context &ctx) {
             e->animation.low_limit = 0;
             e->show3 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y] + 2 + (e->show2 / 255) * PI;
+            e->animation.dist = distance[idx];
+            e->animation.angle = theta[idx] + 2 + (e->show2 / 255) * PI;
             ;
             e->animation.z = 5;
             e->animation.scale_x = 0.09 * scale;
@@ -108,13 +111,16 @@ void SpiralMatrix10_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
             float scale = 0.6;
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y];
+            e->animation.dist = distance[idx];
+            e->animation.angle = theta[idx];
             e->animation.z = 5;
             e->animation.scale_x = 0.09 * scale;
             e->animation.scale_y = 0.09 * scale;
@@ -124,8 +130,8 @@ void SpiralMatrix10_FP::draw(Context &ctx) {
             e->animation.low_limit = -1;
             e->show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y];
+            e->animation.dist = distance[idx];
+            e->animation.angle = theta[idx];
             e->animation.z = 50;
             e->animation.scale_x = 0.09 * scale;
             e->animation.scale_y = 0.09 * scale;
@@ -135,8 +141,8 @@ void SpiralMatrix10_FP::draw(Context &ctx) {
             e->animation.low_limit = -1;
             e->show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y] + 2 + (e->show1 / 255) * PI;
+            e->animation.dist = distance[idx];
+            e->animation.angle = theta[idx] + 2 + (e->show1 / 255) * PI;
             e->animation.z = 5;
             e->animation.scale_x = 0.09 * scale;
             e->animation.scale_y = 0.09 * scale;
@@ -146,8 +152,8 @@ void SpiralMatrix10_FP::draw(Context &ctx) {
             e->animation.low_limit = 0;
             e->show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y] + 2 + (e->show2 / 255) * PI;
+            e->animation.dist = distance[idx];
+            e->animation.angle = theta[idx] + 2 + (e->show2 / 255) * PI;
             ;
             e->animation.z = 5;
             e->animation.scale_x = 0.09 * scale;
@@ -22,11 +22,14 @@ void SpiralMatrix2::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
-            e->animation.dist = e->distance[x][y] * (e->move.directional[0]);
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[0];
+            e->animation.dist = distance[idx] * (e->move.directional[0]);
+            e->animation.angle = theta[idx] + e->move.radial[0];
             e->animation.z = 5;
             e->animation.scale_x = 0.09;
             e->animation.scale_y = 0.09;
@@ -35,8 +38,8 @@ void SpiralMatrix2::draw(Context &ctx) {
             e->animation.offset_y = 0;
             float show1 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y] * e->move.directional[1];
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[1];
+            e->animation.dist = distance[idx] * e->move.directional[1];
+            e->animation.angle = theta[idx] + e->move.radial[1];
             e->animation.z = 50;
             e->animation.scale_x = 0.07;
             e->animation.scale_y = 0.07;
@@ -45,8 +48,8 @@ void SpiralMatrix2::draw(Context &ctx) {
             e->animation.offset_y = 0;
             float show2 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y] * e->move.directional[2];
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[2];
+            e->animation.dist = distance[idx] * e->move.directional[2];
+            e->animation.angle = theta[idx] + e->move.radial[2];
             e->animation.z = 500;
             e->animation.scale_x = 0.05;
             e->animation.scale_y = 0.05;
@@ -88,11 +91,14 @@ void SpiralMatrix2_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
-            e->animation.dist = e->distance[x][y] * (e->move.directional[0]);
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[0];
+            e->animation.dist = distance[idx] * (e->move.directional[0]);
+            e->animation.angle = theta[idx] + e->move.radial[0];
             e->animation.z = 5;
             e->animation.scale_x = 0.09;
             e->animation.scale_y = 0.09;
@@ -101,8 +107,8 @@ void SpiralMatrix2_FP::draw(Context &ctx) {
             e->animation.offset_y = 0;
             float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y] * e->move.directional[1];
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[1];
+            e->animation.dist = distance[idx] * e->move.directional[1];
+            e->animation.angle = theta[idx] + e->move.radial[1];
             e->animation.z = 50;
             e->animation.scale_x = 0.07;
             e->animation.scale_y = 0.07;
@@ -111,8 +117,8 @@ void SpiralMatrix2_FP::draw(Context &ctx) {
             e->animation.offset_y = 0;
             float show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y] * e->move.directional[2];
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[2];
+            e->animation.dist = distance[idx] * e->move.directional[2];
+            e->animation.angle = theta[idx] + e->move.radial[2];
             e->animation.z = 500;
             e->animation.scale_x = 0.05;
             e->animation.scale_y = 0.05;
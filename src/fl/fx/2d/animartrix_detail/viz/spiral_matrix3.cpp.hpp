@@ -22,11 +22,14 @@ void SpiralMatrix3::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y];
+            e->animation.dist = distance[idx];
+            e->animation.angle = theta[idx];
             e->animation.z = 5;
             e->animation.scale_x = 0.09;
             e->animation.scale_y = 0.09;
@@ -38,8 +41,8 @@ void SpiralMatrix3::draw(Context &ctx) {
             e->animation.high_limit = 1;
             e->show1 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y];
+            e->animation.dist = distance[idx];
+            e->animation.angle = theta[idx];
             e->animation.z = 500;
             e->animation.scale_x = 0.09;
             e->animation.scale_y = 0.09;
@@ -51,8 +54,8 @@ void SpiralMatrix3::draw(Context &ctx) {
             e->animation.high_limit = 1;
             e->show2 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y];
+            e->animation.dist = distance[idx];
+            e->animation.angle = theta[idx];
             e->animation.z = 50;
             e->animation.scale_x = 0.09;
             e->animation.scale_y = 0.09;
@@ -63,8 +66,8 @@ void SpiralMatrix3::draw(Context &ctx) {
             e->animation.high_limit = 1;
             e->show3 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y];
+            e->animation.dist = distance[idx];
+            e->animation.angle = theta[idx];
             e->animation.z = 50;
             e->animation.scale_x = 0.09;
             e->animation.scale_y = 0.09;
@@ -75,8 +78,8 @@ void SpiralMatrix3::draw(Context &ctx) {
             e->animation.high_limit = 1;
             e->show4 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y];
+            e->animation.dist = distance[idx];
+            e->animation.angle = theta[idx];
             e->animation.z = 50;
             e->animation.scale_x = 0.09;
             e->animation.scale_y = 0.09;
@@ -120,11 +123,14 @@ void SpiralMatrix3_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y];
+            e->animation.dist = distance[idx];
+            e->animation.angle = theta[idx];
             e->animation.z = 5;
             e->animation.scale_x = 0.09;
             e->animation.scale_y = 0.09;
@@ -136,8 +142,8 @@ void SpiralMatrix3_FP::draw(Context &ctx) {
             e->animation.high_limit = 1;
             e->show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y];
+            e->animation.dist = distance[idx];
+            e->animation.angle = theta[idx];
             e->animation.z = 500;
             e->animation.scale_x = 0.09;
             e->animation.scale_y = 0.09;
@@ -149,8 +155,8 @@ void SpiralMatrix3_FP::draw(Context &ctx) {
             e->animation.high_limit = 1;
             e->show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y];
+            e->animation.dist = distance[idx];
+            e->animation.angle = theta[idx];
             e->animation.z = 50;
             e->animation.scale_x = 0.09;
             e->animation.scale_y = 0.09;
@@ -161,8 +167,8 @@ void SpiralMatrix3_FP::draw(Context &ctx) {
             e->animation.high_limit = 1;
             e->show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y];
+            e->animation.dist = distance[idx];
+            e->animation.angle = theta[idx];
             e->animation.z = 50;
             e->animation.scale_x = 0.09;
             e->animation.scale_y = 0.09;
@@ -173,8 +179,8 @@ void SpiralMatrix3_FP::draw(Context &ctx) {
             e->animation.high_limit = 1;
             e->show4 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y];
+            e->animation.dist = distance[idx];
+            e->animation.angle = theta[idx];
             e->animation.z = 50;
             e->animation.scale_x = 0.09;
             e->animation.scale_y = 0.09;
@@ -22,11 +22,14 @@ void SpiralMatrix4::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y];
+            e->animation.dist = distance[idx];
+            e->animation.angle = theta[idx];
             e->animation.z = 5;
             e->animation.scale_x = 0.09;
             e->animation.scale_y = 0.09;
@@ -38,8 +41,8 @@ void SpiralMatrix4::draw(Context &ctx) {
             e->animation.high_limit = 1;
             e->show1 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y];
+            e->animation.dist = distance[idx];
+            e->animation.angle = theta[idx];
             e->animation.z = 500;
             e->animation.scale_x = 0.09;
             e->animation.scale_y = 0.09;
@@ -22,11 +22,14 @@ void SpiralMatrix5::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
-            e->animation.dist = e->distance[x][y] * (e->move.directional[0]);
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[0];
+            e->animation.dist = distance[idx] * (e->move.directional[0]);
+            e->animation.angle = theta[idx] + e->move.radial[0];
             e->animation.z = 5;
             e->animation.scale_x = 0.09;
             e->animation.scale_y = 0.09;
@@ -35,8 +38,8 @@ void SpiralMatrix5::draw(Context &ctx) {
             e->animation.offset_y = 0;
             float show1 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y] * e->move.directional[1];
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[1];
+            e->animation.dist = distance[idx] * e->move.directional[1];
+            e->animation.angle = theta[idx] + e->move.radial[1];
             e->animation.z = 50;
             e->animation.scale_x = 0.07;
             e->animation.scale_y = 0.07;
@@ -45,8 +48,8 @@ void SpiralMatrix5::draw(Context &ctx) {
             e->animation.offset_y = 0;
             float show2 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y] * e->move.directional[2];
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[2];
+            e->animation.dist = distance[idx] * e->move.directional[2];
+            e->animation.angle = theta[idx] + e->move.radial[2];
             e->animation.z = 500;
             e->animation.scale_x = 0.05;
             e->animation.scale_y = 0.05;
@@ -55,8 +58,8 @@ void SpiralMatrix5::draw(Context &ctx) {
             e->animation.offset_y = 0;
             float show3 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y] * (e->move.directional[3]);
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[3];
+            e->animation.dist = distance[idx] * (e->move.directional[3]);
+            e->animation.angle = theta[idx] + e->move.radial[3];
             e->animation.z = 5;
             e->animation.scale_x = 0.09;
             e->animation.scale_y = 0.09;
@@ -65,8 +68,8 @@ void SpiralMatrix5::draw(Context &ctx) {
             e->animation.offset_y = 0;
             float show4 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y] * e->move.directional[4];
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[4];
+            e->animation.dist = distance[idx] * e->move.directional[4];
+            e->animation.angle = theta[idx] + e->move.radial[4];
             e->animation.z = 50;
             e->animation.scale_x = 0.07;
             e->animation.scale_y = 0.07;
@@ -75,8 +78,8 @@ void SpiralMatrix5::draw(Context &ctx) {
             e->animation.offset_y = 0;
             float show5 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y] * e->move.directional[5];
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[5];
+            e->animation.dist = distance[idx] * e->move.directional[5];
+            e->animation.angle = theta[idx] + e->move.radial[5];
             e->animation.z = 500;
             e->animation.scale_x = 0.05;
             e->animation.scale_y = 0.05;
@@ -86,7 +89,7 @@ void SpiralMatrix5::draw(Context &ctx) {
             float show6 = e->render_value(e->animation);
 
             float radius = e->radial_filter_radius;
-            float radial = (radius - e->distance[x][y]) / e->distance[x][y];
+            float radial = (radius - distance[idx]) / distance[idx];
 
             e->pixel.red = radial * e->add(show1, show4);
             e->pixel.green = radial * e->colordodge(show2, show5);
@@ -121,11 +124,14 @@ void SpiralMatrix5_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
-            e->animation.dist = e->distance[x][y] * (e->move.directional[0]);
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[0];
+            e->animation.dist = distance[idx] * (e->move.directional[0]);
+            e->animation.angle = theta[idx] + e->move.radial[0];
             e->animation.z = 5;
             e->animation.scale_x = 0.09;
             e->animation.scale_y = 0.09;
@@ -134,8 +140,8 @@ void SpiralMatrix5_FP::draw(Context &ctx) {
             e->animation.offset_y = 0;
             float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y] * e->move.directional[1];
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[1];
+            e->animation.dist = distance[idx] * e->move.directional[1];
+            e->animation.angle = theta[idx] + e->move.radial[1];
             e->animation.z = 50;
             e->animation.scale_x = 0.07;
             e->animation.scale_y = 0.07;
@@ -144,8 +150,8 @@ void SpiralMatrix5_FP::draw(Context &ctx) {
             e->animation.offset_y = 0;
             float show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y] * e->move.directional[2];
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[2];
+            e->animation.dist = distance[idx] * e->move.directional[2];
+            e->animation.angle = theta[idx] + e->move.radial[2];
             e->animation.z = 500;
             e->animation.scale_x = 0.05;
             e->animation.scale_y = 0.05;
@@ -154,8 +160,8 @@ void SpiralMatrix5_FP::draw(Context &ctx) {
             e->animation.offset_y = 0;
             float show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y] * (e->move.directional[3]);
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[3];
+            e->animation.dist = distance[idx] * (e->move.directional[3]);
+            e->animation.angle = theta[idx] + e->move.radial[3];
             e->animation.z = 5;
             e->animation.scale_x = 0.09;
             e->animation.scale_y = 0.09;
@@ -164,8 +170,8 @@ void SpiralMatrix5_FP::draw(Context &ctx) {
             e->animation.offset_y = 0;
             float show4 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y] * e->move.directional[4];
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[4];
+            e->animation.dist = distance[idx] * e->move.directional[4];
+            e->animation.angle = theta[idx] + e->move.radial[4];
             e->animation.z = 50;
             e->animation.scale_x = 0.07;
             e->animation.scale_y = 0.07;
@@ -174,8 +180,8 @@ void SpiralMatrix5_FP::draw(Context &ctx) {
             e->animation.offset_y = 0;
             float show5 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y] * e->move.directional[5];
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[5];
+            e->animation.dist = distance[idx] * e->move.directional[5];
+            e->animation.angle = theta[idx] + e->move.radial[5];
             e->animation.z = 500;
             e->animation.scale_x = 0.05;
             e->animation.scale_y = 0.05;
@@ -185,7 +191,7 @@ void SpiralMatrix5_FP::draw(Context &ctx) {
             float show6 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
             float radius = e->radial_filter_radius;
-            float radial = (radius - e->distance[x][y]) / e->distance[x][y];
+            float radial = (radius - distance[idx]) / distance[idx];
 
             e->pixel.red = radial * e->add(show1, show4);
             e->pixel.green = radial * e->colordodge(show2, show5);
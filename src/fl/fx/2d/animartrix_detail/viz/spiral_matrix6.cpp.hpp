@@ -22,13 +22,16 @@ void SpiralMatrix6::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
             float s = 0.7;
 
-            e->animation.dist = e->distance[x][y] * (e->move.directional[0]) * s;
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[0];
+            e->animation.dist = distance[idx] * (e->move.directional[0]) * s;
+            e->animation.angle = theta[idx] + e->move.radial[0];
             e->animation.z = 5;
             e->animation.scale_x = 0.09;
             e->animation.scale_y = 0.09;
@@ -37,8 +40,8 @@ void SpiralMatrix6::draw(Context &ctx) {
             e->animation.offset_y = 0;
             float show1 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y] * e->move.directional[1] * s;
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[1];
+            e->animation.dist = distance[idx] * e->move.directional[1] * s;
+            e->animation.angle = theta[idx] + e->move.radial[1];
             e->animation.z = 50;
             e->animation.scale_x = 0.07;
             e->animation.scale_y = 0.07;
@@ -47,8 +50,8 @@ void SpiralMatrix6::draw(Context &ctx) {
             e->animation.offset_y = 0;
             float show2 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y] * e->move.directional[2] * s;
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[2];
+            e->animation.dist = distance[idx] * e->move.directional[2] * s;
+            e->animation.angle = theta[idx] + e->move.radial[2];
             e->animation.z = 500;
             e->animation.scale_x = 0.05;
             e->animation.scale_y = 0.05;
@@ -57,8 +60,8 @@ void SpiralMatrix6::draw(Context &ctx) {
             e->animation.offset_y = 0;
             float show3 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y] * (e->move.directional[3]) * s;
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[3];
+            e->animation.dist = distance[idx] * (e->move.directional[3]) * s;
+            e->animation.angle = theta[idx] + e->move.radial[3];
             e->animation.z = 5;
             e->animation.scale_x = 0.09;
             e->animation.scale_y = 0.09;
@@ -67,8 +70,8 @@ void SpiralMatrix6::draw(Context &ctx) {
             e->animation.offset_y = 0;
             float show4 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y] * e->move.directional[4] * s;
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[4];
+            e->animation.dist = distance[idx] * e->move.directional[4] * s;
+            e->animation.angle = theta[idx] + e->move.radial[4];
             e->animation.z = 50;
             e->animation.scale_x = 0.07;
             e->animation.scale_y = 0.07;
@@ -77,8 +80,8 @@ void SpiralMatrix6::draw(Context &ctx) {
             e->animation.offset_y = 0;
             float show5 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y] * e->move.directional[5] * s;
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[5];
+            e->animation.dist = distance[idx] * e->move.directional[5] * s;
+            e->animation.angle = theta[idx] + e->move.radial[5];
             e->animation.z = 500;
             e->animation.scale_x = 0.05;
             e->animation.scale_y = 0.05;
@@ -88,7 +91,7 @@ void SpiralMatrix6::draw(Context &ctx) {
             float show6 = e->render_value(e->animation);
 
             float radius = e->radial_filter_radius;
-            float radial = (radius - e->distance[x][y]) / e->distance[x][y];
+            float radial = (radius - distance[idx]) / distance[idx];
 
             e->show7 = e->screen(show1, show4);
             e->show8 = e->colordodge(show2, show5);
@@ -127,13 +130,16 @@ void SpiralMatrix6_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
             float s = 0.7;
 
-            e->animation.dist = e->distance[x][y] * (e->move.directional[0]) * s;
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[0];
+            e->animation.dist = distance[idx] * (e->move.directional[0]) * s;
+            e->animation.angle = theta[idx] + e->move.radial[0];
             e->animation.z = 5;
             e->animation.scale_x = 0.09;
             e->animation.scale_y = 0.09;
@@ -142,8 +148,8 @@ void SpiralMatrix6_FP::draw(Context &ctx) {
             e->animation.offset_y = 0;
             float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y] * e->move.directional[1] * s;
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[1];
+            e->animation.dist = distance[idx] * e->move.directional[1] * s;
+            e->animation.angle = theta[idx] + e->move.radial[1];
             e->animation.z = 50;
             e->animation.scale_x = 0.07;
             e->animation.scale_y = 0.07;
@@ -152,8 +158,8 @@ void SpiralMatrix6_FP::draw(Context &ctx) {
             e->animation.offset_y = 0;
             float show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y] * e->move.directional[2] * s;
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[2];
+            e->animation.dist = distance[idx] * e->move.directional[2] * s;
+            e->animation.angle = theta[idx] + e->move.radial[2];
             e->animation.z = 500;
             e->animation.scale_x = 0.05;
             e->animation.scale_y = 0.05;
@@ -162,8 +168,8 @@ void SpiralMatrix6_FP::draw(Context &ctx) {
             e->animation.offset_y = 0;
             float show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y] * (e->move.directional[3]) * s;
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[3];
+            e->animation.dist = distance[idx] * (e->move.directional[3]) * s;
+            e->animation.angle = theta[idx] + e->move.radial[3];
             e->animation.z = 5;
             e->animation.scale_x = 0.09;
             e->animation.scale_y = 0.09;
@@ -172,8 +178,8 @@ void SpiralMatrix6_FP::draw(Context &ctx) {
             e->animation.offset_y = 0;
             float show4 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y] * e->move.directional[4] * s;
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[4];
+            e->animation.dist = distance[idx] * e->move.directional[4] * s;
+            e->animation.angle = theta[idx] + e->move.radial[4];
             e->animation.z = 50;
             e->animation.scale_x = 0.07;
             e->animation.scale_y = 0.07;
@@ -182,8 +188,8 @@ void SpiralMatrix6_FP::draw(Context &ctx) {
             e->animation.offset_y = 0;
             float show5 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y] * e->move.directional[5] * s;
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[5];
+            e->animation.dist = distance[idx] * e->move.directional[5] * s;
+            e->animation.angle = theta[idx] + e->move.radial[5];
             e->animation.z = 500;
             e->animation.scale_x = 0.05;
             e->animation.scale_y = 0.05;
@@ -193,7 +199,7 @@ void SpiralMatrix6_FP::draw(Context &ctx) {
             float show6 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
             float radius = e->radial_filter_radius;
-            float radial = (radius - e->distance[x][y]) / e->distance[x][y];
+            float radial = (radius - distance[idx]) / distance[idx];
 
             e->show7 = e->screen(show1, show4);
             e->show8 = e->colordodge(show2, show5);
@@ -22,10 +22,12 @@ void SpiralMatrix8::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
-            e->animation.dist = e->distance[x][y];
+            e->animation.dist = distance[idx];
             e->animation.angle = 2;
             e->animation.z = 5;
             e->animation.scale_x = 0.15;
@@ -36,13 +38,13 @@ void SpiralMatrix8::draw(Context &ctx) {
             e->animation.low_limit = 0;
             float show1 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y];
+            e->animation.dist = distance[idx];
             e->animation.angle = 2;
             e->animation.z = 150;
             e->animation.offset_x = -50 * e->move.linear[0];
             float show2 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y];
+            e->animation.dist = distance[idx];
             e->animation.angle = 1;
             e->animation.z = 550;
             e->animation.scale_x = 0.15;
@@ -51,7 +53,7 @@ void SpiralMatrix8::draw(Context &ctx) {
             e->animation.offset_y = -50 * e->move.linear[1];
             float show4 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y];
+            e->animation.dist = distance[idx];
             e->animation.angle = 1;
             e->animation.z = 1250;
             e->animation.scale_x = 0.15;
@@ -96,10 +98,12 @@ void SpiralMatrix8_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
-            e->animation.dist = e->distance[x][y];
+            e->animation.dist = distance[idx];
             e->animation.angle = 2;
             e->animation.z = 5;
             e->animation.scale_x = 0.15;
@@ -110,13 +114,13 @@ void SpiralMatrix8_FP::draw(Context &ctx) {
             e->animation.low_limit = 0;
             float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y];
+            e->animation.dist = distance[idx];
             e->animation.angle = 2;
             e->animation.z = 150;
             e->animation.offset_x = -50 * e->move.linear[0];
             float show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y];
+            e->animation.dist = distance[idx];
             e->animation.angle = 1;
             e->animation.z = 550;
             e->animation.scale_x = 0.15;
@@ -125,7 +129,7 @@ void SpiralMatrix8_FP::draw(Context &ctx) {
             e->animation.offset_y = -50 * e->move.linear[1];
             float show4 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y];
+            e->animation.dist = distance[idx];
             e->animation.angle = 1;
             e->animation.z = 1250;
             e->animation.scale_x = 0.15;
@@ -22,11 +22,14 @@ void SpiralMatrix9::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y];
+            e->animation.dist = distance[idx];
+            e->animation.angle = theta[idx];
             e->animation.z = 5;
             e->animation.scale_x = 0.09;
             e->animation.scale_y = 0.09;
@@ -36,8 +39,8 @@ void SpiralMatrix9::draw(Context &ctx) {
             e->animation.low_limit = -1;
             e->show1 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y];
+            e->animation.dist = distance[idx];
+            e->animation.angle = theta[idx];
             e->animation.z = 50;
             e->animation.scale_x = 0.09;
             e->animation.scale_y = 0.09;
@@ -47,8 +50,8 @@ void SpiralMatrix9::draw(Context &ctx) {
             e->animation.low_limit = -1;
             e->show2 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y] + 2 + (e->show1 / 255) * PI;
+            e->animation.dist = distance[idx];
+            e->animation.angle = theta[idx] + 2 + (e->show1 / 255) * PI;
             e->animation.z = 5;
             e->animation.scale_x = 0.09;
             e->animation.scale_y = 0.09;
@@ -58,8 +61,8 @@ void SpiralMatrix9::draw(Context &ctx) {
             e->animation.low_limit = 0;
             e->show3 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y] + 2 + (e->show2 / 255) * PI;
+            e->animation.dist = distance[idx];
+            e->animation.angle = theta[idx] + 2 + (e->show2 / 255) * PI;
             ;
             e->animation.z = 5;
             e->animation.scale_x = 0.09;
@@ -109,11 +112,14 @@ void SpiralMatrix9_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y];
+            e->animation.dist = distance[idx];
+            e->animation.angle = theta[idx];
             e->animation.z = 5;
             e->animation.scale_x = 0.09;
             e->animation.scale_y = 0.09;
@@ -123,8 +129,8 @@ void SpiralMatrix9_FP::draw(Context &ctx) {
             e->animation.low_limit = -1;
             e->show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y];
+            e->animation.dist = distance[idx];
+            e->animation.angle = theta[idx];
             e->animation.z = 50;
             e->animation.scale_x = 0.09;
             e->animation.scale_y = 0.09;
@@ -134,8 +140,8 @@ void SpiralMatrix9_FP::draw(Context &ctx) {
             e->animation.low_limit = -1;
             e->show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y] + 2 + (e->show1 / 255) * PI;
+            e->animation.dist = distance[idx];
+            e->animation.angle = theta[idx] + 2 + (e->show1 / 255) * PI;
             e->animation.z = 5;
             e->animation.scale_x = 0.09;
             e->animation.scale_y = 0.09;
@@ -145,8 +151,8 @@ void SpiralMatrix9_FP::draw(Context &ctx) {
             e->animation.low_limit = 0;
             e->show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y] + 2 + (e->show2 / 255) * PI;
+            e->animation.dist = distance[idx];
+            e->animation.angle = theta[idx] + 2 + (e->show2 / 255) * PI;
             ;
             e->animation.z = 5;
             e->animation.scale_x = 0.09;
@@ -32,10 +32,13 @@ void Spiralus::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = 2 * e->polar_theta[x][y] + e->move.noise_angle[5] +
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->animation.dist = distance[idx];
+            e->animation.angle = 2 * theta[idx] + e->move.noise_angle[5] +
                                  e->move.directional[3] * e->move.noise_angle[6] *
                                      e->animation.dist / 10;
             e->animation.scale_x = 0.08;
@@ -47,14 +50,14 @@ void Spiralus::draw(Context &ctx) {
             e->animation.z = e->move.linear[1];
             float show1 = e->render_value(e->animation);
 
-            e->animation.angle = 2 * e->polar_theta[x][y] + e->move.noise_angle[7] +
+            e->animation.angle = 2 * theta[idx] + e->move.noise_angle[7] +
                                  e->move.directional[5] * e->move.noise_angle[8] *
                                      e->animation.dist / 10;
             e->animation.offset_y = -e->move.linear[1];
             e->animation.z = e->move.linear[2];
             float show2 = e->render_value(e->animation);
 
-            e->animation.angle = 2 * e->polar_theta[x][y] + e->move.noise_angle[6] +
+            e->animation.angle = 2 * theta[idx] + e->move.noise_angle[6] +
                                  e->move.directional[6] * e->move.noise_angle[7] *
                                      e->animation.dist / 10;
             e->animation.offset_y = e->move.linear[2];
@@ -105,10 +108,13 @@ void Spiralus_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = 2 * e->polar_theta[x][y] + e->move.noise_angle[5] +
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->animation.dist = distance[idx];
+            e->animation.angle = 2 * theta[idx] + e->move.noise_angle[5] +
                                  e->move.directional[3] * e->move.noise_angle[6] *
                                      e->animation.dist / 10;
             e->animation.scale_x = 0.08;
@@ -120,14 +126,14 @@ void Spiralus_FP::draw(Context &ctx) {
             e->animation.z = e->move.linear[1];
             float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.angle = 2 * e->polar_theta[x][y] + e->move.noise_angle[7] +
+            e->animation.angle = 2 * theta[idx] + e->move.noise_angle[7] +
                                  e->move.directional[5] * e->move.noise_angle[8] *
                                      e->animation.dist / 10;
             e->animation.offset_y = -e->move.linear[1];
             e->animation.z = e->move.linear[2];
             float show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.angle = 2 * e->polar_theta[x][y] + e->move.noise_angle[6] +
+            e->animation.angle = 2 * theta[idx] + e->move.noise_angle[6] +
                                  e->move.directional[6] * e->move.noise_angle[7] *
                                      e->animation.dist / 10;
             e->animation.offset_y = e->move.linear[2];
@@ -23,14 +23,17 @@ void Water::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
             e->animation.dist =
-                e->distance[x][y] +
+                distance[idx] +
                 4 * fl::sinf(e->move.directional[5] * PI + (float)x / 2) +
                 4 * fl::cosf(e->move.directional[6] * PI + float(y) / 2);
-            e->animation.angle = 1 * e->polar_theta[x][y];
+            e->animation.angle = 1 * theta[idx];
             e->animation.z = 5;
             e->animation.scale_x = 0.06;
             e->animation.scale_y = 0.06;
@@ -42,8 +45,8 @@ void Water::draw(Context &ctx) {
 
             e->animation.dist = (10 + e->move.directional[0]) *
                                  fl::sinf(-e->move.radial[5] + e->move.radial[0] +
-                                      (e->distance[x][y] / (3)));
-            e->animation.angle = 1 * e->polar_theta[x][y];
+                                      (distance[idx] / (3)));
+            e->animation.angle = 1 * theta[idx];
             e->animation.z = 5;
             e->animation.scale_x = 0.1;
             e->animation.scale_y = 0.1;
@@ -55,8 +58,8 @@ void Water::draw(Context &ctx) {
 
             e->animation.dist = (10 + e->move.directional[1]) *
                                  fl::sinf(-e->move.radial[5] + e->move.radial[1] +
-                                      (e->distance[x][y] / (3)));
-            e->animation.angle = 1 * e->polar_theta[x][y];
+                                      (distance[idx] / (3)));
+            e->animation.angle = 1 * theta[idx];
             e->animation.z = 500;
             e->animation.scale_x = 0.1;
             e->animation.scale_y = 0.1;
@@ -68,8 +71,8 @@ void Water::draw(Context &ctx) {
 
             e->animation.dist = (10 + e->move.directional[2]) *
                                  fl::sinf(-e->move.radial[5] + e->move.radial[2] +
-                                      (e->distance[x][y] / (3)));
-            e->animation.angle = 1 * e->polar_theta[x][y];
+                                      (distance[idx] / (3)));
+            e->animation.angle = 1 * theta[idx];
             e->animation.z = 500;
             e->animation.scale_x = 0.1;
             e->animation.scale_y = 0.1;
@@ -113,14 +116,17 @@ void Water_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
 
             e->animation.dist =
-                e->distance[x][y] +
+                distance[idx] +
                 4 * fl::sinf(e->move.directional[5] * PI + (float)x / 2) +
                 4 * fl::cosf(e->move.directional[6] * PI + float(y) / 2);
-            e->animation.angle = 1 * e->polar_theta[x][y];
+            e->animation.angle = 1 * theta[idx];
             e->animation.z = 5;
             e->animation.scale_x = 0.06;
             e->animation.scale_y = 0.06;
@@ -132,8 +138,8 @@ void Water_FP::draw(Context &ctx) {
 
             e->animation.dist = (10 + e->move.directional[0]) *
                                  fl::sinf(-e->move.radial[5] + e->move.radial[0] +
-                                      (e->distance[x][y] / (3)));
-            e->animation.angle = 1 * e->polar_theta[x][y];
+                                      (distance[idx] / (3)));
+            e->animation.angle = 1 * theta[idx];
             e->animation.z = 5;
             e->animation.scale_x = 0.1;
             e->animation.scale_y = 0.1;
@@ -145,8 +151,8 @@ void Water_FP::draw(Context &ctx) {
 
             e->animation.dist = (10 + e->move.directional[1]) *
                                  fl::sinf(-e->move.radial[5] + e->move.radial[1] +
-                                      (e->distance[x][y] / (3)));
-            e->animation.angle = 1 * e->polar_theta[x][y];
+                                      (distance[idx] / (3)));
+            e->animation.angle = 1 * theta[idx];
             e->animation.z = 500;
             e->animation.scale_x = 0.1;
             e->animation.scale_y = 0.1;
@@ -158,8 +164,8 @@ void Water_FP::draw(Context &ctx) {
 
             e->animation.dist = (10 + e->move.directional[2]) *
                                  fl::sinf(-e->move.radial[5] + e->move.radial[2] +
-                                      (e->distance[x][y] / (3)));
-            e->animation.angle = 1 * e->polar_theta[x][y];
+                                      (distance[idx] / (3)));
+            e->animation.angle = 1 * theta[idx];
             e->animation.z = 500;
             e->animation.scale_x = 0.1;
             e->animation.scale_y = 0.1;
@@ -23,21 +23,24 @@ void Waves::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.angle = e->polar_theta[x][y];
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->animation.angle = theta[idx];
             e->animation.scale_x = 0.1;
             e->animation.scale_y = 0.1;
             e->animation.scale_z = 0.1;
-            e->animation.dist = e->distance[x][y];
+            e->animation.dist = distance[idx];
             e->animation.offset_y = 0;
             e->animation.offset_x = 0;
-            e->animation.z = 2 * e->distance[x][y] - e->move.linear[0];
+            e->animation.z = 2 * distance[idx] - e->move.linear[0];
             float show1 = e->render_value(e->animation);
 
-            e->animation.angle = e->polar_theta[x][y];
-            e->animation.dist = e->distance[x][y];
-            e->animation.z = 2 * e->distance[x][y] - e->move.linear[1];
+            e->animation.angle = theta[idx];
+            e->animation.dist = distance[idx];
+            e->animation.z = 2 * distance[idx] - e->move.linear[1];
             float show2 = e->render_value(e->animation);
 
             e->pixel.red = show1;
@@ -73,21 +76,24 @@ void Waves_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.angle = e->polar_theta[x][y];
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->animation.angle = theta[idx];
             e->animation.scale_x = 0.1;
             e->animation.scale_y = 0.1;
             e->animation.scale_z = 0.1;
-            e->animation.dist = e->distance[x][y];
+            e->animation.dist = distance[idx];
             e->animation.offset_y = 0;
             e->animation.offset_x = 0;
-            e->animation.z = 2 * e->distance[x][y] - e->move.linear[0];
+            e->animation.z = 2 * distance[idx] - e->move.linear[0];
             float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.angle = e->polar_theta[x][y];
-            e->animation.dist = e->distance[x][y];
-            e->animation.z = 2 * e->distance[x][y] - e->move.linear[1];
+            e->animation.angle = theta[idx];
+            e->animation.dist = distance[idx];
+            e->animation.z = 2 * distance[idx] - e->move.linear[1];
             float show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
             e->pixel.red = show1;
@@ -32,11 +32,14 @@ void Yves::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = e->distance[x][y];
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->animation.dist = distance[idx];
             e->animation.angle =
-                e->polar_theta[x][y] + 2 * PI + e->move.noise_angle[5];
+                theta[idx] + 2 * PI + e->move.noise_angle[5];
             e->animation.scale_x = 0.08;
             e->animation.scale_y = 0.08;
             e->animation.scale_z = 0.08;
@@ -46,9 +49,9 @@ void Yves::draw(Context &ctx) {
             e->animation.z = 0;
             float show1 = e->render_value(e->animation);
 
-            e->animation.dist = e->distance[x][y];
+            e->animation.dist = distance[idx];
             e->animation.angle =
-                e->polar_theta[x][y] + 2 * PI + e->move.noise_angle[6];
+                theta[idx] + 2 * PI + e->move.noise_angle[6];
             ;
             e->animation.scale_x = 0.08;
             e->animation.scale_y = 0.08;
@@ -59,9 +62,9 @@ void Yves::draw(Context &ctx) {
             e->animation.z = 0;
             float show2 = e->render_value(e->animation);
 
-            e->animation.angle = e->polar_theta[x][y] + show1 / 100 +
+            e->animation.angle = theta[idx] + show1 / 100 +
                                  e->move.noise_angle[3] + e->move.noise_angle[4];
-            e->animation.dist = e->distance[x][y] + show2 / 50;
+            e->animation.dist = distance[idx] + show2 / 50;
             e->animation.offset_y = -e->move.linear[2];
 
             e->animation.offset_y += show1 / 100;
@@ -116,11 +119,14 @@ void Yves_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = e->distance[x][y];
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->animation.dist = distance[idx];
             e->animation.angle =
-                e->polar_theta[x][y] + 2 * PI + e->move.noise_angle[5];
+                theta[idx] + 2 * PI + e->move.noise_angle[5];
             e->animation.scale_x = 0.08;
             e->animation.scale_y = 0.08;
             e->animation.scale_z = 0.08;
@@ -130,9 +136,9 @@ void Yves_FP::draw(Context &ctx) {
             e->animation.z = 0;
             float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.dist = e->distance[x][y];
+            e->animation.dist = distance[idx];
             e->animation.angle =
-                e->polar_theta[x][y] + 2 * PI + e->move.noise_angle[6];
+                theta[idx] + 2 * PI + e->move.noise_angle[6];
             ;
             e->animation.scale_x = 0.08;
             e->animation.scale_y = 0.08;
@@ -143,9 +149,9 @@ void Yves_FP::draw(Context &ctx) {
             e->animation.z = 0;
             float show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
 
-            e->animation.angle = e->polar_theta[x][y] + show1 / 100 +
+            e->animation.angle = theta[idx] + show1 / 100 +
                                  e->move.noise_angle[3] + e->move.noise_angle[4];
-            e->animation.dist = e->distance[x][y] + show2 / 50;
+            e->animation.dist = distance[idx] + show2 / 50;
             e->animation.offset_y = -e->move.linear[2];
 
             e->animation.offset_y += show1 / 100;
@@ -16,10 +16,13 @@ void Zoom2::draw(Context &ctx) {
     e->timings.master_speed = 0.003;
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = (e->distance[x][y] * e->distance[x][y]) / 2;
-            e->animation.angle = e->polar_theta[x][y];
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->animation.dist = (distance[idx] * distance[idx]) / 2;
+            e->animation.angle = theta[idx];
 
             e->animation.scale_x = 0.005;
             e->animation.scale_y = 0.005;
@@ -58,10 +61,13 @@ void Zoom2_FP::draw(Context &ctx) {
     e->timings.master_speed = 0.003;
     e->calculate_oscillators(e->timings);
 
+    const float *theta = e->geometry->theta();
+    const float *distance = e->geometry->distance();
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = (e->distance[x][y] * e->distance[x][y]) / 2;
-            e->animation.angle = e->polar_theta[x][y];
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->animation.dist = (distance[idx] * distance[idx]) / 2;
+            e->animation.angle = theta[idx];
 
             e->animation.scale_x = 0.005;
             e->animation.scale_y = 0.005;
@@ -12,6 +12,7 @@ are blended by the the max luminance of the components.
 #include "fl/stl/stdint.h"
 #include "fl/math/xymap.h"
 #include "fl/log/log.h"
+#include "fl/system/frame_budget.h"
 
 namespace fl {
 
@@ -53,6 +54,12 @@ void Blend2d::add(Fx2d &layer, const Params &p) {
     this->add(fx, p);
 }
 
+u8 Blend2d::blurPasses(u8 passes) const {
+    const u8 full = fl::max(1, passes);
+    // Under budget pressure halve the passes per quality level, down to none.
+    return mAdaptiveQuality ? FrameBudget::scaleToQuality(full, 0) : full;
+}
+
 void Blend2d::draw(DrawContext context) {
     mFrame->clear();
     mFrameTransform->clear();
@@ -71,7 +78,7 @@ void Blend2d::draw(DrawContext context) {
         u8 blur_amount = it->blur_amount;
         if (blur_amount > 0) {
             const XYMap &xyMap = fx->getXYMap();
-            u8 blur_passes = fl::max(1, it->blur_passes);
+            u8 blur_passes = blurPasses(it->blur_passes);
             for (u8 i = 0; i < blur_passes; ++i) {
                 // Apply the blur effect
                 blur2d(mFrame->rgb().data(), mXyMap.getWidth(), mXyMap.getHeight(),
@@ -87,7 +94,7 @@ void Blend2d::draw(DrawContext context) {
         u16 height = mXyMap.getHeight();
         XYMap rect = XYMap::constructRectangularGrid(width, height);
         fl::span<CRGB> rgb = mFrameTransform->rgb();
-        u8 blur_passes = fl::max(1, mGlobalBlurPasses);
+        u8 blur_passes = blurPasses(mGlobalBlurPasses);
         for (u8 i = 0; i < blur_passes; ++i) {
             // Apply the blur effect
             blur2d(rgb, width, height, mGlobalBlurAmount, rect);
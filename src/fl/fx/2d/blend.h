@@ -42,6 +42,9 @@ class Blend2d : public Fx2d {
     void setGlobalBlurPasses(u8 blur_passes) {
         mGlobalBlurPasses = blur_passes;
     }
+    // Follow the FrameBudget quality level: blur passes halve per level and
+    // are skipped entirely once they reach zero.
+    void setAdaptiveQuality(bool on) { mAdaptiveQuality = on; }
     bool setParams(Fx2dPtr fx, const Params &p);
     bool setParams(Fx2d &fx, const Params &p);
 
@@ -59,6 +62,10 @@ class Blend2d : public Fx2d {
     fl::shared_ptr<Frame> mFrameTransform;
     u8 mGlobalBlurAmount = 0;
     u8 mGlobalBlurPasses = 1;
+    bool mAdaptiveQuality = false;
+
+  private:
+    u8 blurPasses(u8 passes) const;
 };
 
 } // namespace fl
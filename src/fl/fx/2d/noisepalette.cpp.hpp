@@ -106,11 +106,46 @@ void NoisePalette::setPalettePreset(int paletteIndex) {
     }
 }
 
+void NoisePalette::beginFrame(DrawContext &context) {
+    FASTLED_UNUSED(context);
+    // If we're running at a low "speed", some 8-bit artifacts become
+    // visible from frame-to-frame.  In order to reduce this, we can do some
+    // fast data-smoothing. The amount of data smoothing we're doing depends
+    // on "speed".
+    mDataSmoothing = 0;
+    if (speed < 50) {
+        mDataSmoothing = 200 - (speed * 4);
+    }
+}
+
+void NoisePalette::drawRows(DrawContext context, u8 pass, u16 yBegin,
+                            u16 yEnd) {
+    if (pass == 0) {
+        fillNoiseRows(yBegin, yEnd);
+    } else {
+        mapNoiseRows(context.leds, yBegin, yEnd);
+    }
+}
+
+void NoisePalette::endFrame(DrawContext &context) {
+    FASTLED_UNUSED(context);
+    mZ += speed;
+
+    // apply slow drift to X and Y, just for visual variation.
+    mX += speed / 8;
+    mY -= speed / 16;
+
+    mHue += 1;
+}
+
 void NoisePalette::mapNoiseToLEDsUsingPalette(fl::span<CRGB> leds) {
-    static u8 ihue = 0; // okay static in header
+    mapNoiseRows(leds, 0, height);
+    mHue += 1;
+}
 
-    for (u16 i = 0; i < width; i++) {
-        for (u16 j = 0; j < height; j++) {
+void NoisePalette::mapNoiseRows(fl::span<CRGB> leds, u16 yBegin, u16 yEnd) {
+    for (u16 j = yBegin; j < yEnd; j++) {
+        for (u16 i = 0; i < width; i++) {
             // We use the value at the (i,j) coordinate in the noise
             // array for our brightness, and the flipped value from (j,i)
             // for our pixel's index into the color palette.
@@ -120,7 +155,7 @@ void NoisePalette::mapNoiseToLEDsUsingPalette(fl::span<CRGB> leds) {
 
             // if this palette is a 'loop', add a slowly-changing base value
             if (colorLoop) {
-                index += ihue;
+                index += mHue;
             }
 
             // brighten up, as the color palette itself often contains the
@@ -135,24 +170,14 @@ void NoisePalette::mapNoiseToLEDsUsingPalette(fl::span<CRGB> leds) {
             leds[XY(i, j)] = color;
         }
     }
-
-    ihue += 1;
 }
 
-void NoisePalette::fillnoise8() {
-    // If we're running at a low "speed", some 8-bit artifacts become
-    // visible from frame-to-frame.  In order to reduce this, we can do some
-    // fast data-smoothing. The amount of data smoothing we're doing depends
-    // on "speed".
-    u8 dataSmoothing = 0;
-    if (speed < 50) {
-        dataSmoothing = 200 - (speed * 4);
-    }
-
-    for (u16 i = 0; i < width; i++) {
-        int ioffset = scale * i;
-        for (u16 j = 0; j < height; j++) {
-            int joffset = scale * j;
+void NoisePalette::fillNoiseRows(u16 yBegin, u16 yEnd) {
+    const u8 dataSmoothing = mDataSmoothing;
+    for (u16 j = yBegin; j < yEnd; j++) {
+        int joffset = scale * j;
+        for (u16 i = 0; i < width; i++) {
+            int ioffset = scale * i;
 
             u8 data = inoise8(mX + ioffset, mY + joffset, mZ);
 
@@ -173,12 +198,6 @@ void NoisePalette::fillnoise8() {
             noise[i * height + j] = data;
         }
     }
-
-    mZ += speed;
-
-    // apply slow drift to X and Y, just for visual variation.
-    mX += speed / 8;
-    mY -= speed / 16;
 }
 
 u8 NoisePalette::changeToRandomPalette() {
@@ -29,10 +29,15 @@ class NoisePalette : public Fx2d {
 
     // No need for a destructor, scoped_ptr will handle memory deallocation
 
-    void draw(DrawContext context) override {
-        fillnoise8();
-        mapNoiseToLEDsUsingPalette(context.leds);
-    }
+    void draw(DrawContext context) override { drawBanded(context); }
+
+    // Row-independent: pass 0 fills the noise field, pass 1 maps it through
+    // the palette (it reads transposed noise, hence the barrier between).
+    u8 rowPasses() const override { return 2; }
+    void beginFrame(DrawContext &context) override;
+    void drawRows(DrawContext context, u8 pass, u16 yBegin,
+                  u16 yEnd) override;
+    void endFrame(DrawContext &context) override;
 
     string fxName() const override { return "NoisePalette"; }
     void mapNoiseToLEDsUsingPalette(fl::span<CRGB> leds);
@@ -64,8 +69,11 @@ class NoisePalette : public Fx2d {
     bool colorLoop = 0;
     int currentPaletteIndex = 0;
     float mFps = 60.f;
+    u8 mHue = 0;
+    u8 mDataSmoothing = 0;
 
-    void fillnoise8();
+    void fillNoiseRows(u16 yBegin, u16 yEnd);
+    void mapNoiseRows(fl::span<CRGB> leds, u16 yBegin, u16 yEnd);
 
     u16 XY(u8 x, u8 y) const { return mXyMap.mapToIndex(x, y); }
 
@@ -5,6 +5,7 @@
 
 #include "fl/stl/pair.h"
 #include "fl/stl/vector.h"
+#include "fl/system/frame_budget.h"
 
 namespace fl {
 
@@ -83,4 +84,43 @@ void WaveCrgbGradientMap::mapWaveToLEDs(const XYMap &xymap,
     batch.flush();
 }
 
+SuperSample WaveFx::adaptiveSuperSample() const {
+    if (!mAdaptiveQuality) {
+        return mSuperSample;
+    }
+    return static_cast<SuperSample>(
+        FrameBudget::scaleToQuality(static_cast<u8>(mSuperSample)));
+}
+
+void WaveFx::applyQualityLevel() {
+    const SuperSample factor = adaptiveSuperSample();
+    if (factor == mWaveSim.getSuperSample()) {
+        return;
+    }
+    const u32 width = mWaveSim.getWidth();
+    const u32 height = mWaveSim.getHeight();
+    // setSuperSample() rebuilds the simulation; carry the downsampled field
+    // over so a quality step does not flatten the waves.
+    fl::vector<i16> field;
+    field.reserve(width * height);
+    for (u32 y = 0; y < height; ++y) {
+        for (u32 x = 0; x < width; ++x) {
+            field.push_back(mWaveSim.geti16(x, y));
+        }
+    }
+    mWaveSim.setSuperSample(factor);
+    const u32 mult = static_cast<u32>(factor);
+    WaveSimulation2D_Real &sim = mWaveSim.real();
+    for (u32 y = 0; y < height; ++y) {
+        for (u32 x = 0; x < width; ++x) {
+            const i16 v = field[y * width + x];
+            for (u32 j = 0; j < mult; ++j) {
+                for (u32 i = 0; i < mult; ++i) {
+                    sim.seti16(x * mult + i, y * mult + j, v);
+                }
+            }
+        }
+    }
+}
+
 } // namespace fl
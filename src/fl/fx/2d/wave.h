@@ -172,7 +172,8 @@ class WaveFx : public Fx2d {
     /// @param args Configuration parameters (uses defaults if not specified)
     WaveFx(const XYMap& xymap, Args args = Args())
         : Fx2d(xymap), mWaveSim(xymap.getWidth(), xymap.getHeight(),
-                                args.factor, args.speed, args.dampening) {
+                                args.factor, args.speed, args.dampening),
+          mSuperSample(args.factor) {
         // Initialize the wave simulation with the given parameters.
         if (args.crgbMap == nullptr) {
             // Use the default CRGB mapping function.
@@ -234,7 +235,20 @@ class WaveFx : public Fx2d {
     /// Recommended: SUPER_SAMPLE_2X for good balance.
     void setSuperSample(SuperSample factor) {
         // Set the supersampling factor of the wave simulation.
-        mWaveSim.setSuperSample(factor);
+        mSuperSample = factor;
+        mWaveSim.setSuperSample(adaptiveSuperSample());
+    }
+
+    /// @brief Follow the FrameBudget quality level
+    /// @param on If true, supersampling drops one step per quality level
+    ///
+    /// When fl::frame_budget() reports overruns, the simulation falls back
+    /// from the factor given to setSuperSample() (8X -> 4X -> 2X -> NONE)
+    /// and climbs back as the budget recovers. The visible wave field is
+    /// carried across each switch.
+    void setAdaptiveQuality(bool on) {
+        mAdaptiveQuality = on;
+        applyQualityLevel();
     }
 
     /// @brief Set easing function for wave amplitude calculation
@@ -319,6 +333,9 @@ class WaveFx : public Fx2d {
     /// Updates the wave simulation (if auto-update enabled) and
     /// maps wave values to LED colors using the current color mapper.
     void draw(DrawContext context) override {
+        if (mAdaptiveQuality) {
+            applyQualityLevel();
+        }
         // Update the wave simulation.
         if (mAutoUpdates) {
             mWaveSim.update();
@@ -356,6 +373,13 @@ class WaveFx : public Fx2d {
     WaveSimulation2D mWaveSim;
     WaveCrgbMapPtr mCrgbMap;
     bool mAutoUpdates = true;
+
+  private:
+    SuperSample adaptiveSuperSample() const;
+    void applyQualityLevel();
+
+    SuperSample mSuperSample;  // Requested factor, before quality scaling
+    bool mAdaptiveQuality = false;
 };
 
 } // namespace fl
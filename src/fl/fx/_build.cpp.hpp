@@ -3,6 +3,7 @@
 
 // begin current directory includes
 #include "fl/fx/frame.cpp.hpp"
+#include "fl/fx/fx2d.cpp.hpp"
 #include "fl/fx/fx2d_to_1d.cpp.hpp"
 #include "fl/fx/fx_engine.cpp.hpp"
 #include "fl/fx/pixel.cpp.hpp"
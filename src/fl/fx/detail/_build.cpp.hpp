@@ -2,4 +2,6 @@
 /// @brief Unity build header for fl/fx/detail/ directory
 /// Includes all implementation files in alphabetical order
 
+#include "fl/fx/detail/fx_blend.cpp.hpp"
+#include "fl/fx/detail/fx_compositor.cpp.hpp"
 #include "fl/fx/detail/fx_layer.cpp.hpp"
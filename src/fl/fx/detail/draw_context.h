@@ -13,6 +13,9 @@ struct DrawContext {
     u16 frame_time = 0;
     float speed = 1.0f;
     const AudioBatch *audio = nullptr; ///< Non-owning. Null when no audio.
+    /// Row bands a row-independent Fx2d may split this frame into and
+    /// render in parallel. 1 renders on the calling thread only.
+    u8 bands = 1;
     DrawContext(fl::u32 now, fl::span<CRGB> leds, u16 frame_time = 0,
                 float speed = 1.0f, const AudioBatch *audio = nullptr)
         : now(now), leds(leds), frame_time(frame_time), speed(speed),
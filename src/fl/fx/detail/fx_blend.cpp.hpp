@@ -0,0 +1,145 @@
+#include "fl/fx/detail/fx_blend.h"
+
+#include "fl/stl/compiler_control.h"
+#include "fl/stl/cstring.h"
+#include "platforms/avr/is_avr.h"
+
+#if !defined(FL_IS_AVR)
+#include "fl/math/simd.h"
+#endif
+
+namespace fl {
+
+namespace {
+
+// x / 255 for x in [0, 255 * 255], exact.
+FASTLED_FORCE_INLINE u8 fx_div255(u16 x) {
+    return static_cast<u8>((x + 1 + (x >> 8)) >> 8);
+}
+
+FASTLED_FORCE_INLINE u8 fx_blend_byte(u8 a, u8 b, BlendMode mode) {
+    switch (mode) {
+    case BlendMode::kNormal:
+        return b;
+    case BlendMode::kAdd: {
+        u16 s = static_cast<u16>(a) + b;
+        return s > 255 ? 255 : static_cast<u8>(s);
+    }
+    case BlendMode::kScreen:
+        return static_cast<u8>(
+            255 - fx_div255(static_cast<u16>((255 - a) * (255 - b))));
+    case BlendMode::kMultiply:
+        return fx_div255(static_cast<u16>(a * b));
+    case BlendMode::kMax:
+        return a > b ? a : b;
+    }
+    return b;
+}
+
+// (a * (256 - w) + b * w + 128) >> 8, the 8-bit blend8() formula.
+FASTLED_FORCE_INLINE u8 fx_lerp_byte(u8 a, u8 b, u8 w) {
+    return static_cast<u8>(
+        (static_cast<u16>(a) * (256 - w) + static_cast<u16>(b) * w + 128) >> 8);
+}
+
+#if !defined(FL_IS_AVR)
+
+// Exact x / 255 on eight u16 lanes holding values <= 255 * 255.
+FASTLED_FORCE_INLINE simd::simd_u16x8 fx_div255_u16(simd::simd_u16x8 x) {
+    const auto one = simd::set1_u16_8(1);
+    return simd::srli_u16_8(
+        simd::add_u16_8(simd::add_u16_8(x, one), simd::srli_u16_8(x, 8)), 8);
+}
+
+FASTLED_FORCE_INLINE simd::simd_u8x16 fx_mul255_u8(simd::simd_u8x16 a,
+                                                    simd::simd_u8x16 b) {
+    auto lo = simd::mullo_u16_8(simd::widen_lo_u8_to_u16(a),
+                                 simd::widen_lo_u8_to_u16(b));
+    auto hi = simd::mullo_u16_8(simd::widen_hi_u8_to_u16(a),
+                                 simd::widen_hi_u8_to_u16(b));
+    return simd::narrow_u16_to_u8(fx_div255_u16(lo), fx_div255_u16(hi));
+}
+
+FASTLED_FORCE_INLINE simd::simd_u8x16 fx_blend_u8(simd::simd_u8x16 a,
+                                                   simd::simd_u8x16 b,
+                                                   BlendMode mode) {
+    switch (mode) {
+    case BlendMode::kNormal:
+        return b;
+    case BlendMode::kAdd:
+        return simd::add_sat_u8_16(a, b);
+    case BlendMode::kScreen: {
+        const auto full = simd::narrow_u16_to_u8(simd::set1_u16_8(255),
+                                                 simd::set1_u16_8(255));
+        auto inv = fx_mul255_u8(simd::sub_sat_u8_16(full, a),
+                                simd::sub_sat_u8_16(full, b));
+        return simd::sub_sat_u8_16(full, inv);
+    }
+    case BlendMode::kMultiply:
+        return fx_mul255_u8(a, b);
+    case BlendMode::kMax:
+        return simd::max_u8_16(a, b);
+    }
+    return b;
+}
+
+FASTLED_FORCE_INLINE simd::simd_u8x16 fx_lerp_u8(simd::simd_u8x16 a,
+                                                  simd::simd_u8x16 b,
+                                                  simd::simd_u16x8 wa,
+                                                  simd::simd_u16x8 wb) {
+    const auto half = simd::set1_u16_8(128);
+    auto lo = simd::add_u16_8(
+        simd::add_u16_8(simd::mullo_u16_8(simd::widen_lo_u8_to_u16(a), wa),
+                         simd::mullo_u16_8(simd::widen_lo_u8_to_u16(b), wb)),
+        half);
+    auto hi = simd::add_u16_8(
+        simd::add_u16_8(simd::mullo_u16_8(simd::widen_hi_u8_to_u16(a), wa),
+                         simd::mullo_u16_8(simd::widen_hi_u8_to_u16(b), wb)),
+        half);
+    return simd::narrow_u16_to_u8(simd::srli_u16_8(lo, 8),
+                                   simd::srli_u16_8(hi, 8));
+}
+
+#endif // !FL_IS_AVR
+
+} // namespace
+
+void blendSpans(fl::span<CRGB> out, fl::span<const CRGB> under,
+                fl::span<const CRGB> over, BlendMode mode, u8 opacity) {
+    fl::size n = out.size();
+    if (under.size() < n) n = under.size();
+    if (over.size() < n) n = over.size();
+    u8 *dst = out.data()->raw;
+    const u8 *a = under.data()->raw;
+    const u8 *b = over.data()->raw;
+    const int nbytes = static_cast<int>(n * sizeof(CRGB));
+    if (n == 0) {
+        return;
+    }
+    if (opacity == 0 || (mode == BlendMode::kNormal && opacity == 255)) {
+        const u8 *src = opacity ? b : a;
+        if (src != dst) {
+            fl::memmove(dst, src, nbytes);
+        }
+        return;
+    }
+    int i = 0;
+#if !defined(FL_IS_AVR)
+    const auto wa = simd::set1_u16_8(static_cast<u16>(256 - opacity));
+    const auto wb = simd::set1_u16_8(opacity);
+    for (; i + 15 < nbytes; i += 16) {
+        auto va = simd::load_u8_16(a + i);
+        auto vf = fx_blend_u8(va, simd::load_u8_16(b + i), mode);
+        if (opacity != 255) {
+            vf = fx_lerp_u8(va, vf, wa, wb);
+        }
+        simd::store_u8_16(dst + i, vf);
+    }
+#endif
+    for (; i < nbytes; ++i) {
+        u8 f = fx_blend_byte(a[i], b[i], mode);
+        dst[i] = opacity == 255 ? f : fx_lerp_byte(a[i], f, opacity);
+    }
+}
+
+} // namespace fl
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "crgb.h"  // IWYU pragma: keep
+#include "fl/stl/int.h"
+#include "fl/stl/span.h"
+#include "fl/stl/noexcept.h"
+
+namespace fl {
+
+// How an upper layer combines with what is already below it.
+enum class BlendMode : u8 {
+    kNormal,   // upper replaces lower
+    kAdd,      // saturating add
+    kScreen,   // 255 - (255 - a) * (255 - b) / 255, never darkens
+    kMultiply, // a * b / 255, never brightens
+    kMax,      // per-channel maximum
+};
+
+// out = lerp(under, mode(under, over), opacity), per channel.
+// opacity 255 is fully opaque and 0 leaves `under` unchanged. `out` may
+// alias `under` to blend in place. The lerp matches blend8() with 8-bit
+// precision. Processes min(out, under, over) pixels 16 bytes at a time
+// with fl::simd.
+void blendSpans(fl::span<CRGB> out, fl::span<const CRGB> under,
+                fl::span<const CRGB> over, BlendMode mode,
+                u8 opacity) FL_NOEXCEPT;
+
+} // namespace fl
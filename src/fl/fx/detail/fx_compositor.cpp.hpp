@@ -0,0 +1,175 @@
+#include "fl/fx/detail/fx_compositor.h"
+
+#include "fl/math/math.h"
+#include "fl/stl/cstring.h"
+
+namespace fl {
+
+namespace {
+
+// blendSpans() stops at the shortest span. A layer smaller than the output
+// covers only its own pixels; the rest show the layer below.
+void blendLayer(fl::span<CRGB> out, fl::span<const CRGB> under,
+                fl::span<const CRGB> over, BlendMode mode, u8 opacity) {
+    blendSpans(out, under, over, mode, opacity);
+    const fl::size end = fl::min(out.size(), under.size());
+    if (over.size() < end && under.data() != out.data()) {
+        fl::memmove(out.data() + over.size(), under.data() + over.size(),
+                    sizeof(CRGB) * (end - over.size()));
+    }
+}
+
+} // namespace
+
+void FxCompositor::draw(fl::u32 now, fl::u32 warpedTime,
+                        fl::span<CRGB> finalBuffer, float speed,
+                        const AudioBatch *audio) {
+    FxLayer &base = *mLayers[0];
+    if (!base.getFx()) {
+        return;
+    }
+    const fl::size n =
+        mNumLeds < finalBuffer.size() ? fl::size(mNumLeds) : finalBuffer.size();
+    fl::span<CRGB> out(finalBuffer.data(), n);
+    u8 progress = mTransition.getProgress(now);
+    mLayers[0]->setRenderBands(mBands);
+    mLayers[1]->setRenderBands(mBands);
+    for (fl::size i = 0; i < mOverlays.size(); ++i) {
+        mOverlays[i].layer->setRenderBands(mBands);
+    }
+
+    if (!progress && !hasVisibleOverlay()) {
+        // Single visible layer: render straight into the output.
+        if (!mSurfaceStale && base.isRunning()) {
+            // Entering direct mode: the layer's previous frame lives in its
+            // own surface; carry it over so effects that build on the last
+            // frame stay continuous.
+            fl::span<CRGB> surface = base.getSurface();
+            fl::memcpy(out.data(), surface.data(),
+                       sizeof(CRGB) * fl::min(n, surface.size()));
+        }
+        base.drawInto(out, warpedTime, speed, audio);
+        mSurfaceStale = true;
+        return;
+    }
+    if (mSurfaceStale) {
+        // Leaving direct mode: the latest frame is whatever the caller
+        // handed back in `out`; hand it to the base layer's surface.
+        if (base.isRunning()) {
+            fl::span<CRGB> surface = base.getSurface();
+            fl::memcpy(surface.data(), out.data(),
+                       sizeof(CRGB) * fl::min(n, surface.size()));
+        }
+        mSurfaceStale = false;
+    }
+
+    base.draw(warpedTime, speed, audio);
+    fl::span<const CRGB> under = base.getSurface();
+    if (progress) {
+        mLayers[1]->draw(warpedTime, speed, audio);
+        blendLayer(out, under, mLayers[1]->getSurface(), BlendMode::kNormal,
+                   progress);
+        under = out;
+    }
+    for (fl::size i = 0; i < mOverlays.size(); ++i) {
+        Overlay &ov = mOverlays[i];
+        if (ov.opacity == 0 || !ov.layer->getFx()) {
+            continue;
+        }
+        if (!ov.isStatic || !ov.drawn) {
+            ov.layer->draw(warpedTime, speed, audio);
+            ov.drawn = true;
+        }
+        blendLayer(out, under, ov.layer->getSurface(), ov.mode, ov.opacity);
+        under = out;
+    }
+    if (under.data() != out.data()) {
+        fl::memcpy(out.data(), under.data(),
+                   sizeof(CRGB) * fl::min(n, under.size()));
+    }
+    if (progress == 255) {
+        completeTransition();
+    }
+}
+
+int FxCompositor::addOverlay(fl::shared_ptr<Fx> fx, BlendMode mode,
+                             u8 opacity) {
+    if (!fx) {
+        return -1;
+    }
+    Overlay ov;
+    ov.id = mNextOverlayId++;
+    ov.layer = fl::make_shared<FxLayer>();
+    ov.layer->setFx(fx);
+    ov.mode = mode;
+    ov.opacity = opacity;
+    mOverlays.push_back(ov);
+    return ov.id;
+}
+
+bool FxCompositor::removeOverlay(int id) {
+    for (fl::size i = 0; i < mOverlays.size(); ++i) {
+        if (mOverlays[i].id == id) {
+            mOverlays[i].layer->release();
+            mOverlays.erase(mOverlays.begin() + i);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FxCompositor::setOverlayOpacity(int id, u8 opacity) {
+    Overlay *ov = findOverlay(id);
+    if (!ov) {
+        return false;
+    }
+    ov->opacity = opacity;
+    return true;
+}
+
+bool FxCompositor::setOverlayBlendMode(int id, BlendMode mode) {
+    Overlay *ov = findOverlay(id);
+    if (!ov) {
+        return false;
+    }
+    ov->mode = mode;
+    return true;
+}
+
+bool FxCompositor::setOverlayStatic(int id, bool isStatic) {
+    Overlay *ov = findOverlay(id);
+    if (!ov) {
+        return false;
+    }
+    ov->isStatic = isStatic;
+    return true;
+}
+
+bool FxCompositor::invalidateOverlay(int id) {
+    Overlay *ov = findOverlay(id);
+    if (!ov) {
+        return false;
+    }
+    ov->drawn = false;
+    return true;
+}
+
+FxCompositor::Overlay *FxCompositor::findOverlay(int id) {
+    for (fl::size i = 0; i < mOverlays.size(); ++i) {
+        if (mOverlays[i].id == id) {
+            return &mOverlays[i];
+        }
+    }
+    return nullptr;
+}
+
+bool FxCompositor::hasVisibleOverlay() const {
+    for (fl::size i = 0; i < mOverlays.size(); ++i) {
+        if (mOverlays[i].opacity && mOverlays[i].layer->getFx()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace fl
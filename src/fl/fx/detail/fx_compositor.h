@@ -7,7 +7,9 @@
 #include "crgb.h"  // IWYU pragma: keep
 #include "fl/stl/shared_ptr.h"  // For shared_ptr
 #include "fl/stl/vector.h"  // IWYU pragma: keep
+#include "fl/fx/detail/fx_blend.h"
 #include "fl/fx/detail/fx_layer.h"
+#include "fl/fx/detail/transition.h"
 #include "fl/fx/fx.h"  // IWYU pragma: keep
 
 #ifndef FASTLED_FX_ENGINE_MAX_FX
@@ -16,7 +18,21 @@
 
 namespace fl {
 
-// Takes two fx layers and composites them together to a final output buffer.
+// Composites fx layers into a final output buffer.
+//
+// The base is a pair of layers that cross-fade during transitions. Any
+// number of overlay layers stack on top, bottom to top, each with its own
+// BlendMode and opacity. Blending writes straight into the output buffer.
+// Transparent overlays are neither drawn nor blended. Static overlays are
+// drawn once and then re-blended from their cached surface until
+// invalidated.
+//
+// When the base is the only visible layer and no transition is running, it
+// renders directly into the output buffer with no copy. Effects that read
+// their previous frame back (trails, fades) then see whatever buffer is
+// passed to draw(), so code that edits the LEDs between draws, or alternates
+// between buffers, will feed into them. State moves between the layer's
+// surface and the output buffer only when switching in or out of this mode.
 class FxCompositor {
   public:
     FxCompositor(fl::u32 numLeds) : mNumLeds(numLeds) {
@@ -45,44 +61,50 @@ class FxCompositor {
     void draw(fl::u32 now, fl::u32 warpedTime, fl::span<CRGB> finalBuffer,
               float speed = 1.0f, const AudioBatch *audio = nullptr);
 
+    // Overlay layers, blended above the base in insertion order. Ids are
+    // never reused. Setters return false for an unknown id.
+    int addOverlay(fl::shared_ptr<Fx> fx, BlendMode mode = BlendMode::kNormal,
+                   u8 opacity = 255);
+    bool removeOverlay(int id);
+    bool setOverlayOpacity(int id, u8 opacity);
+    bool setOverlayBlendMode(int id, BlendMode mode);
+    // A static overlay is drawn once and reused until invalidateOverlay().
+    bool setOverlayStatic(int id, bool isStatic);
+    bool invalidateOverlay(int id);
+    fl::size overlayCount() const { return mOverlays.size(); }
+
+    // Row bands offered to every layer's effect (see Fx2d::drawBanded).
+    void setRenderBands(u8 bands) { mBands = bands > 0 ? bands : 1; }
+    u8 renderBands() const { return mBands; }
+
   private:
+    struct Overlay {
+        int id = 0;
+        FxLayerPtr layer;
+        BlendMode mode = BlendMode::kNormal;
+        u8 opacity = 255;
+        bool isStatic = false;
+        bool drawn = false;
+    };
+
     void swapLayers() {
         FxLayerPtr tmp = mLayers[0];
         mLayers[0] = mLayers[1];
         mLayers[1] = tmp;
     }
 
+    Overlay *findOverlay(int id);
+    bool hasVisibleOverlay() const;
+
     FxLayerPtr mLayers[2];
     const fl::u32 mNumLeds;
     Transition mTransition;
+    fl::vector<Overlay> mOverlays;
+    int mNextOverlayId = 0;
+    u8 mBands = 1;
+    // Set while the base layer renders directly into the output buffer, so
+    // its own surface no longer holds its last frame.
+    bool mSurfaceStale = false;
 };
 
-inline void FxCompositor::draw(fl::u32 now, fl::u32 warpedTime,
-                               fl::span<CRGB> finalBuffer,
-                               float speed, const AudioBatch *audio) {
-    if (!mLayers[0]->getFx()) {
-        return;
-    }
-    mLayers[0]->draw(warpedTime, speed, audio);
-    u8 progress = mTransition.getProgress(now);
-    if (!progress) {
-        fl::span<CRGB> surface0 = mLayers[0]->getSurface();
-        fl::memcpy(finalBuffer.data(), surface0.data(), sizeof(CRGB) * mNumLeds);
-        return;
-    }
-    mLayers[1]->draw(warpedTime, speed, audio);
-    fl::span<CRGB> surface0 = mLayers[0]->getSurface();
-    fl::span<CRGB> surface1 = mLayers[1]->getSurface();
-
-    for (fl::u32 i = 0; i < mNumLeds; i++) {
-        const CRGB &p0 = surface0[i];
-        const CRGB &p1 = surface1[i];
-        CRGB out = CRGB::blend(p0, p1, progress);
-        finalBuffer[i] = out;
-    }
-    if (progress == 255) {
-        completeTransition();
-    }
-}
-
 } // namespace fl
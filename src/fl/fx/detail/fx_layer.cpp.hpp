@@ -6,6 +6,7 @@
 #include "fl/fx/frame.h"
 #include "fl/fx/fx.h"
 #include "fl/stl/cstring.h"
+#include "fl/system/frame_budget.h"
 
 namespace fl {
 
@@ -13,25 +14,29 @@ void FxLayer::setFx(fl::shared_ptr<Fx> newFx) {
     if (newFx != fx) {
         release();
         fx = newFx;
+        mName = fx ? fx->fxName() : fl::string();
     }
 }
 
 void FxLayer::draw(fl::u32 now, float speed, const AudioBatch *audio) {
     // assert(fx);
-    if (!frame) {
-        frame = fl::make_shared<Frame>(fx->getNumLeds());
-    }
+    drawInto(getSurface(), now, speed, audio);
+}
 
+void FxLayer::drawInto(fl::span<CRGB> target, fl::u32 now, float speed,
+                       const AudioBatch *audio) {
     if (!running) {
         // Clear the frame
-        fl::memset((u8*)frame->rgb().data(), 0, frame->size() * sizeof(CRGB));
+        fl::memset((u8*)target.data(), 0, target.size() * sizeof(CRGB));
         fx->resume(now);
         mLastNow = now;
         running = true;
     }
     u16 frame_time = static_cast<u16>(now - mLastNow);
     mLastNow = now;
-    Fx::DrawContext context(now, frame->rgb(), frame_time, speed, audio);
+    Fx::DrawContext context(now, target, frame_time, speed, audio);
+    context.bands = mBands;
+    FrameBudget::Section section(fx.get(), mName.c_str());
     fx->draw(context);
 }
 
@@ -52,7 +57,10 @@ fl::shared_ptr<Fx> FxLayer::getFx() {
 }
 
 fl::span<CRGB> FxLayer::getSurface() {
-    return frame->rgb();
+    if (!frame && fx) {
+        frame = fl::make_shared<Frame>(fx->getNumLeds());
+    }
+    return frame ? frame->rgb() : fl::span<CRGB>();
 }
 
 }
@@ -3,6 +3,8 @@
 #include "fl/stl/stdint.h"
 #include "fl/stl/shared_ptr.h"         // For FASTLED_SHARED_PTR macros
 #include "fl/stl/shared_ptr.h"  // For shared_ptr
+#include "fl/stl/span.h"
+#include "fl/stl/string.h"
 
 // Forward declarations to avoid including heavy headers
 namespace fl {
@@ -17,6 +19,12 @@ class FxLayer {
 
     void draw(fl::u32 now, float speed = 1.0f, const AudioBatch *audio = nullptr);
 
+    // Draw into a caller-owned buffer instead of the layer's own surface.
+    // Effects that read back their previous frame see whatever `target`
+    // holds, so the caller must keep it in step with the layer.
+    void drawInto(fl::span<CRGB> target, fl::u32 now, float speed = 1.0f,
+                  const AudioBatch *audio = nullptr);
+
     void pause(fl::u32 now);
 
     void release();
@@ -24,12 +32,19 @@ class FxLayer {
     fl::shared_ptr<Fx> getFx();
 
     fl::span<CRGB> getSurface();
+    bool hasSurface() const { return frame != nullptr; }
+    bool isRunning() const { return running; }
+
+    // Row bands offered to the effect through DrawContext::bands.
+    void setRenderBands(u8 bands) { mBands = bands; }
 
   private:
     fl::shared_ptr<Frame> frame;
     fl::shared_ptr<Fx> fx;
+    fl::string mName;  // fxName(), cached for FrameBudget sections
     fl::u32 mLastNow = 0;
     bool running = false;
+    u8 mBands = 1;
 };
 
 } // namespace fl
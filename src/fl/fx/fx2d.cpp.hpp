@@ -0,0 +1,30 @@
+#include "fl/fx/fx2d.h"
+#include "fl/task/worker_pool.h"
+
+namespace fl {
+
+void Fx2d::drawBanded(DrawContext context) {
+    const u8 passes = rowPasses();
+    const int height = getHeight();
+    int bands = context.bands;
+    if (bands > height) {
+        bands = height;
+    }
+
+    beginFrame(context);
+    for (u8 pass = 0; pass < passes; ++pass) {
+        if (bands <= 1) {
+            drawRows(context, pass, 0, static_cast<u16>(height));
+            continue;
+        }
+        fl::task::WorkerPool::instance().parallelFor(
+            bands, [this, &context, pass, height, bands](int band) {
+                const u16 yBegin = static_cast<u16>(height * band / bands);
+                const u16 yEnd = static_cast<u16>(height * (band + 1) / bands);
+                drawRows(context, pass, yBegin, yEnd);
+            });
+    }
+    endFrame(context);
+}
+
+} // namespace fl
@@ -26,7 +26,31 @@ class Fx2d : public Fx {
     XYMap &getXYMap() { return mXyMap; }
     const XYMap &getXYMap() const { return mXyMap; }
 
+    // Row-band rendering. An effect whose output rows can be computed
+    // independently returns the number of passes it needs from rowPasses()
+    // and implements draw() as drawBanded(context). Each frame then runs
+    // beginFrame() on the calling thread, each pass as drawRows() calls over
+    // disjoint row ranges (concurrently when context.bands > 1, with a
+    // barrier between passes), then endFrame() on the calling thread.
+    // drawRows() may only write rows [yBegin, yEnd) of its outputs and must
+    // not mutate state shared with other bands; per-frame state belongs in
+    // beginFrame()/endFrame().
+    virtual u8 rowPasses() const { return 0; }
+    virtual void beginFrame(DrawContext &context) { FASTLED_UNUSED(context); }
+    virtual void drawRows(DrawContext context, u8 pass, u16 yBegin,
+                          u16 yEnd) {
+        FASTLED_UNUSED(context);
+        FASTLED_UNUSED(pass);
+        FASTLED_UNUSED(yBegin);
+        FASTLED_UNUSED(yEnd);
+    }
+    virtual void endFrame(DrawContext &context) { FASTLED_UNUSED(context); }
+
   protected:
+    // Runs one frame through the row-band protocol above, split into up to
+    // context.bands bands on the shared fl::task::WorkerPool.
+    void drawBanded(DrawContext context);
+
     XYMap mXyMap;
 };
 
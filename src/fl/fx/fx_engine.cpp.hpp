@@ -23,7 +23,7 @@ void FxEngine::setAudio(fl::shared_ptr<fl::audio::Processor> proc) {
     mAudioProcessor = fl::move(proc);
 }
 
-int FxEngine::addFx(FxPtr effect) {
+FxPtr FxEngine::wrapForInterpolation(FxPtr effect) {
     float fps = 0;
     if (mInterpolate && effect->hasFixedFrameRate(&fps)) {
         // Wrap the effect in a VideoFxWrapper so that we can get
@@ -32,6 +32,11 @@ int FxEngine::addFx(FxPtr effect) {
         vid_fx->setFade(0, 0); // No fade for interpolated effects
         effect = vid_fx;
     }
+    return effect;
+}
+
+int FxEngine::addFx(FxPtr effect) {
+    effect = wrapForInterpolation(effect);
     bool auto_set = mEffects.empty();
     bool ok = mEffects.insert(mCounter, effect);
     if (!ok) {
@@ -44,6 +49,13 @@ int FxEngine::addFx(FxPtr effect) {
     return mCounter++;
 }
 
+int FxEngine::addLayer(FxPtr effect, BlendMode mode, u8 opacity) {
+    if (!effect) {
+        return -1;
+    }
+    return mCompositor.addOverlay(wrapForInterpolation(effect), mode, opacity);
+}
+
 bool FxEngine::nextFx(u16 duration) {
     bool ok = mEffects.next(mCurrId, &mCurrId, true);
     if (!ok) {
@@ -104,6 +104,35 @@ class FxEngine {
 
     IntFxMap &_getEffects() { return mEffects; }
 
+    /**
+     * @brief Stacks an effect above the current one. Layers are blended
+     * bottom to top in the order they were added and keep drawing across
+     * nextFx() transitions.
+     * @param effect The effect to draw as a layer.
+     * @param mode How the layer combines with what is below it.
+     * @param opacity 0 hides the layer (it is not drawn), 255 is opaque.
+     * @return The layer id, or -1 if the effect is null.
+     */
+    int addLayer(FxPtr effect, BlendMode mode = BlendMode::kNormal,
+                 u8 opacity = 255);
+    bool removeLayer(int layerId) { return mCompositor.removeOverlay(layerId); }
+    bool setLayerOpacity(int layerId, u8 opacity) {
+        return mCompositor.setOverlayOpacity(layerId, opacity);
+    }
+    bool setLayerBlendMode(int layerId, BlendMode mode) {
+        return mCompositor.setOverlayBlendMode(layerId, mode);
+    }
+    /**
+     * @brief Marks a layer as static: it is drawn once and its cached
+     * frame is reused until invalidateLayer() is called.
+     */
+    bool setLayerStatic(int layerId, bool isStatic) {
+        return mCompositor.setOverlayStatic(layerId, isStatic);
+    }
+    bool invalidateLayer(int layerId) {
+        return mCompositor.invalidateOverlay(layerId);
+    }
+
     /**
      * @brief Pushes an audio frame into the back buffer.
      *
@@ -129,7 +158,18 @@ class FxEngine {
     void setSpeed(float scale) { mTimeFunction.setSpeed(scale); }
     float getSpeed() const { return mTimeFunction.scale(); }
 
+    /**
+     * @brief Lets row-independent 2D effects split each frame into up to
+     * `bands` row bands rendered in parallel on fl::task::WorkerPool.
+     * Effects that are not row-independent ignore it. 1 (the default)
+     * renders everything on the calling thread.
+     */
+    void setRenderBands(u8 bands) { mCompositor.setRenderBands(bands); }
+    u8 getRenderBands() const { return mCompositor.renderBands(); }
+
   private:
+    FxPtr wrapForInterpolation(FxPtr effect);
+
     int mCounter = 0;
     TimeWarp mTimeFunction;   // FxEngine controls the clock, to allow
                               // "time-bending" effects.
@@ -27,6 +27,13 @@ void Video::setFade(fl::u32 fadeInTime, fl::u32 fadeOutTime) {
     mImpl->setFade(fadeInTime, fadeOutTime);
 }
 
+void Video::setPrefetchFrames(fl::u32 frames) {
+    if (!mImpl) {
+        return;
+    }
+    mImpl->setPrefetchFrames(frames);
+}
+
 void Video::pause(fl::u32 now) { mImpl->pause(now); }
 
 void Video::resume(fl::u32 now) { mImpl->resume(now); }
@@ -73,6 +73,9 @@ class Video : public Fx1d { // Fx1d because video can be irregular.
     void pause(fl::u32 now) override;
     void resume(fl::u32 now) override;
     void setFade(fl::u32 fadeInTime, fl::u32 fadeOutTime);
+    // Read this many frames per block from seekable files (e.g. SD cards) to
+    // cut per-frame I/O. Costs frames * pixelsPerFrame * 3 bytes. 0 disables.
+    void setPrefetchFrames(fl::u32 frames);
     i32 durationMicros() const; // -1 if this is a stream.
 
     // make compatible with if statements
@@ -53,6 +53,135 @@ fl::u16 xy_legacy_wrapper(fl::u16 x, fl::u16 y, fl::u16 width,
 
 namespace gfx {
 
+// ── SIMD kernels for the classic keep/seep blurs ────────────────────────
+// The scalar loop computes, per channel byte x[i] with neighbours one pixel
+// away on either side:
+//     out[i] = qadd8(qadd8(scale8(x[i], keep), scale8(x[i-1], seep)),
+//                    scale8(x[i+1], seep))
+// Saturating adds of non-negative terms are order independent, so this is
+// a pure per-byte expression of the ORIGINAL values. Rows are processed as
+// flat byte runs with a zero-padded "seep" row; columns are processed in
+// row-major order with three rolling seep rows, so both passes stream
+// memory sequentially instead of walking one pixel at a time.
+#if !defined(FL_IS_AVR)
+namespace keep_seep {
+
+struct Scratch {
+    fl::vector<u8> bytes;
+};
+
+static u8 *scratch(int nbytes) {
+    fl::vector<u8> &buf = SingletonThreadLocal<Scratch>::instance().bytes;
+    if (static_cast<int>(buf.size()) < nbytes) {
+        buf.resize(nbytes);
+    }
+    return buf.data();
+}
+
+// Multiplier that reproduces nscale8x3() for the configured scale8 flavour.
+static u16 scale_mul(u8 scale) {
+#if (FASTLED_SCALE8_FIXED == 1)
+    return static_cast<u16>(scale) + 1;
+#else
+    return scale;
+#endif
+}
+
+// dst[i] = (src[i] * mul) >> 8
+static void scale_bytes(const u8 *src, u8 *dst, int nbytes, u16 mul) {
+    namespace fsimd = fl::simd; // ok bare using
+    const auto vm = fsimd::set1_u16_8(mul);
+    int i = 0;
+    for (; i + 15 < nbytes; i += 16) {
+        auto v = fsimd::load_u8_16(src + i);
+        auto lo = fsimd::srli_u16_8(fsimd::mullo_u16_8(fsimd::widen_lo_u8_to_u16(v), vm), 8);
+        auto hi = fsimd::srli_u16_8(fsimd::mullo_u16_8(fsimd::widen_hi_u8_to_u16(v), vm), 8);
+        fsimd::store_u8_16(dst + i, fsimd::narrow_u16_to_u8(lo, hi));
+    }
+    for (; i < nbytes; ++i)
+        dst[i] = static_cast<u8>((static_cast<u16>(src[i]) * mul) >> 8);
+}
+
+// io[i] = sat(scale(io[i], keepMul) + a[i] + b[i]); io is updated in place.
+static void keep_add2(u8 *io, const u8 *a, const u8 *b, int nbytes,
+                      u16 keepMul) {
+    namespace fsimd = fl::simd; // ok bare using
+    const auto vm = fsimd::set1_u16_8(keepMul);
+    int i = 0;
+    for (; i + 15 < nbytes; i += 16) {
+        auto v = fsimd::load_u8_16(io + i);
+        auto lo = fsimd::srli_u16_8(fsimd::mullo_u16_8(fsimd::widen_lo_u8_to_u16(v), vm), 8);
+        auto hi = fsimd::srli_u16_8(fsimd::mullo_u16_8(fsimd::widen_hi_u8_to_u16(v), vm), 8);
+        auto k = fsimd::narrow_u16_to_u8(lo, hi);
+        k = fsimd::add_sat_u8_16(k, fsimd::load_u8_16(a + i));
+        k = fsimd::add_sat_u8_16(k, fsimd::load_u8_16(b + i));
+        fsimd::store_u8_16(io + i, k);
+    }
+    for (; i < nbytes; ++i) {
+        u16 v = static_cast<u16>((static_cast<u16>(io[i]) * keepMul) >> 8);
+        v = static_cast<u16>(v + a[i] + b[i]);
+        io[i] = v > 255 ? 255 : static_cast<u8>(v);
+    }
+}
+
+// Blur `count` contiguous pixels in place.
+static void row(CRGB *px, int count, fract8 blur_amount) {
+    if (count <= 0) {
+        return;
+    }
+    constexpr int S = sizeof(CRGB);
+    const int nbytes = count * S;
+    // Seep values padded with one black pixel on each side.
+    u8 *seep = scratch(nbytes + 2 * S);
+    FL_BUILTIN_MEMSET(seep, 0, S);
+    FL_BUILTIN_MEMSET(seep + S + nbytes, 0, S);
+    u8 *bytes = px[0].raw;
+    scale_bytes(bytes, seep + S, nbytes, scale_mul(blur_amount >> 1));
+    keep_add2(bytes, seep, seep + 2 * S, nbytes, scale_mul(255 - blur_amount));
+}
+
+static void rows(CRGB *px, int w, int h, fract8 blur_amount) {
+    for (int y = 0; y < h; ++y) {
+        row(px + y * w, w, blur_amount);
+    }
+}
+
+// Vertical keep/seep pass over a row-major w*h block, streaming rows.
+static void columns(CRGB *px, int w, int h, fract8 blur_amount) {
+    if (w <= 0 || h <= 0) {
+        return;
+    }
+    const int nbytes = w * static_cast<int>(sizeof(CRGB));
+    const u16 seepMul = scale_mul(blur_amount >> 1);
+    const u16 keepMul = scale_mul(255 - blur_amount);
+    // Rolling seep rows: previous, current, next, plus a black row.
+    u8 *buf = scratch(4 * nbytes);
+    u8 *zero = buf + 3 * nbytes;
+    FL_BUILTIN_MEMSET(zero, 0, nbytes);
+    u8 *prev = zero;
+    u8 *cur = buf;
+    u8 *next = buf + nbytes;
+    u8 *spare = buf + 2 * nbytes;
+    scale_bytes(px[0].raw, cur, nbytes, seepMul);
+    for (int y = 0; y < h; ++y) {
+        u8 *rowBytes = px[y * w].raw;
+        if (y + 1 < h) {
+            scale_bytes(px[(y + 1) * w].raw, next, nbytes, seepMul);
+        } else {
+            next = zero;
+        }
+        keep_add2(rowBytes, prev, next, nbytes, keepMul);
+        // Rotate: the retired prev buffer becomes the next scratch row.
+        u8 *retired = (prev == zero) ? spare : prev;
+        prev = cur;
+        cur = next;
+        next = retired;
+    }
+}
+
+} // namespace keep_seep
+#endif // !FL_IS_AVR
+
 // blur1d: one-dimensional blur filter. Spreads light to 2 line neighbors.
 // blur2d: two-dimensional blur filter. Spreads light to 8 XY neighbors.
 //
@@ -67,6 +196,9 @@ namespace gfx {
 //         eventually all the way to black; this is by design so that
 //         it can be used to (slowly) clear the LEDs to black.
 void blur1d(fl::span<CRGB> leds, fract8 blur_amount) {
+#if !defined(FL_IS_AVR)
+    keep_seep::row(leds.data(), static_cast<fl::u16>(leds.size()), blur_amount);
+#else
     const fl::u16 numLeds = static_cast<fl::u16>(leds.size());
     fl::u8 keep = 255 - blur_amount;
     fl::u8 seep = blur_amount >> 1;
@@ -82,6 +214,7 @@ void blur1d(fl::span<CRGB> leds, fract8 blur_amount) {
         leds[i] = cur;
         carryover = part;
     }
+#endif
 }
 
 void blur2d(fl::span<CRGB> leds, fl::u8 width, fl::u8 height,
@@ -136,6 +269,9 @@ void blurRows(fl::span<CRGB> leds, fl::u8 width, fl::u8 height,
     fl::u8 keep = 255 - blur_amount;
     fl::u8 seep = blur_amount >> 1;
     if (xyMap.isRectangularGrid()) {
+#if !defined(FL_IS_AVR)
+        keep_seep::rows(pixels, width, height, blur_amount);
+#else
         for (fl::u8 row = 0; row < height; ++row) {
             CRGB carryover = CRGB::Black;
             CRGB *rowBase = pixels + row * width;
@@ -151,6 +287,7 @@ void blurRows(fl::span<CRGB> leds, fl::u8 width, fl::u8 height,
                 carryover = part;
             }
         }
+#endif
         return;
     }
     for (fl::u8 row = 0; row < height; ++row) {
@@ -175,6 +312,9 @@ void blurColumns(fl::span<CRGB> leds, fl::u8 width, fl::u8 height,
     fl::u8 keep = 255 - blur_amount;
     fl::u8 seep = blur_amount >> 1;
     if (xyMap.isRectangularGrid()) {
+#if !defined(FL_IS_AVR)
+        keep_seep::columns(pixels, width, height, blur_amount);
+#else
         for (fl::u8 col = 0; col < width; ++col) {
             CRGB carryover = CRGB::Black;
             for (fl::u8 row = 0; row < height; ++row) {
@@ -189,6 +329,7 @@ void blurColumns(fl::span<CRGB> leds, fl::u8 width, fl::u8 height,
                 carryover = part;
             }
         }
+#endif
         return;
     }
     for (fl::u8 col = 0; col < width; ++col) {
@@ -211,6 +352,9 @@ void blurRows(Canvas<CRGB> &canvas, alpha8 blur_amount) {
     const int w = canvas.width;
     const int h = canvas.height;
     CRGB *pixels = canvas.pixels;
+#if !defined(FL_IS_AVR)
+    keep_seep::rows(pixels, w, h, blur_amount);
+#else
     fl::u8 keep = 255 - blur_amount;
     fl::u8 seep = blur_amount >> 1;
     for (int row = 0; row < h; ++row) {
@@ -228,12 +372,16 @@ void blurRows(Canvas<CRGB> &canvas, alpha8 blur_amount) {
             carryover = part;
         }
     }
+#endif
 }
 
 void blurColumns(Canvas<CRGB> &canvas, alpha8 blur_amount) {
     const int w = canvas.width;
     const int h = canvas.height;
     CRGB *pixels = canvas.pixels;
+#if !defined(FL_IS_AVR)
+    keep_seep::columns(pixels, w, h, blur_amount);
+#else
     fl::u8 keep = 255 - blur_amount;
     fl::u8 seep = blur_amount >> 1;
     for (int col = 0; col < w; ++col) {
@@ -250,6 +398,7 @@ void blurColumns(Canvas<CRGB> &canvas, alpha8 blur_amount) {
             carryover = part;
         }
     }
+#endif
 }
 
 void blur2d(Canvas<CRGB> &canvas, alpha8 blur_amount) {
@@ -17,6 +17,11 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/math/xymap.h"
 
+// Platform-neutral SIMD for the batch palette kernels.
+#if !defined(FL_IS_AVR)
+#include "fl/math/simd.h"
+#endif
+
 namespace fl {
 
 CRGB &nblend(CRGB &existing, const CRGB &overlay, fract8 amountOfOverlay) {
@@ -933,6 +938,58 @@ CRGB ColorFromPalette(const CRGBPalette256 &pal, fl::u8 index,
     return CRGB(red, green, blue);
 }
 
+void ColorFromPalette(const CRGBPalette256 &pal, fl::span<const fl::u8> indices,
+                      fl::span<CRGB> out, fl::u8 brightness) {
+    const fl::size n = indices.size() < out.size() ? indices.size() : out.size();
+    const CRGB *entries = &(pal[0]);
+    const fl::u8 *idx = indices.data();
+    CRGB *dst = out.data();
+    for (fl::size i = 0; i < n; ++i) {
+        dst[i] = entries[idx[i]];
+    }
+    if (brightness == 255) {
+        return;
+    }
+
+    // Same per-channel scale8_video() as the single-pixel lookup, applied to
+    // the gathered bytes as one flat stream.
+    ++brightness; // adjust for rounding
+    fl::u8 *bytes = reinterpret_cast<fl::u8 *>(dst);
+    const fl::size nbytes = n * 3;
+    fl::size i = 0;
+#if !defined(FL_IS_AVR)
+    namespace fsimd = fl::simd; // ok bare using
+    const auto mul = fsimd::set1_u16_8(brightness);
+    const auto one16 = fsimd::set1_u16_8(1);
+    const auto ones = fsimd::narrow_u16_to_u8(one16, one16);
+    for (; i + 16 <= nbytes; i += 16) {
+        auto v = fsimd::load_u8_16(bytes + i);
+        auto lo = fsimd::srli_u16_8(fsimd::mullo_u16_8(fsimd::widen_lo_u8_to_u16(v), mul), 8);
+        auto hi = fsimd::srli_u16_8(fsimd::mullo_u16_8(fsimd::widen_hi_u8_to_u16(v), mul), 8);
+        auto scaled = fsimd::narrow_u16_to_u8(lo, hi);
+        fsimd::store_u8_16(bytes + i, fsimd::add_sat_u8_16(scaled, fsimd::min_u8_16(v, ones)));
+    }
+#endif
+    for (; i < nbytes; ++i) {
+        bytes[i] = scale8_video_LEAVING_R1_DIRTY(bytes[i], brightness);
+    }
+    cleanup_R1();
+}
+
+namespace detail {
+
+void fill_palette_expanded(CRGB *L, fl::u16 N, fl::u8 startIndex,
+                           fl::u8 incIndex, const CRGBPalette256 &expanded) {
+    const CRGB *entries = &(expanded[0]);
+    fl::u8 colorIndex = startIndex;
+    for (fl::u16 i = 0; i < N; ++i) {
+        L[i] = entries[colorIndex];
+        colorIndex += incIndex;
+    }
+}
+
+} // namespace detail
+
 CRGB ColorFromPaletteExtended(const CRGBPalette256 &pal, fl::u16 index,
                               fl::u8 brightness, TBlendType blendType) {
     // Extract the eight most significant bits of the index as a palette index.
@@ -981,6 +1038,100 @@ CRGB ColorFromPaletteExtended(const CRGBPalette256 &pal, fl::u16 index,
     return CRGB(red1, green1, blue1);
 }
 
+namespace {
+
+// Batch ColorFromPaletteExtended() over a palette of 2^PaletteBits entries;
+// the 8 index bits below the entry select the blend offset. With
+// FASTLED_SCALE8_FIXED the scalar code's special cases (no blend, offset 0,
+// brightness 255) are exactly what the general scale8 formulas give, so the
+// gathered entries, offsets and brightness go through one SIMD path.
+template <fl::u8 PaletteBits, typename Palette>
+void colorFromPaletteExtendedBatch(const Palette &pal,
+                                   fl::span<const fl::u16> indices,
+                                   fl::span<CRGB> out, fl::u8 brightness,
+                                   TBlendType blendType) {
+    const fl::size n = indices.size() < out.size() ? indices.size() : out.size();
+    fl::size i = 0;
+#if !defined(FL_IS_AVR) && (FASTLED_SCALE8_FIXED == 1)
+    namespace fsimd = fl::simd; // ok bare using
+    constexpr fl::u8 kOffsetShift = 16 - PaletteBits - 8;
+    constexpr fl::u16 kLastEntry = (1u << PaletteBits) - 1;
+    const CRGB *entries = &(pal[0]);
+    const bool blend = blendType != NOBLEND;
+    const auto one16 = fsimd::set1_u16_8(1);
+    const auto all255 = fsimd::narrow_u16_to_u8(fsimd::set1_u16_8(255),
+                                                fsimd::set1_u16_8(255));
+    const auto bright = fsimd::set1_u16_8(static_cast<fl::u16>(brightness) + 1);
+    // 16 pixels per block: 48 channel bytes, three vectors.
+    fl::u8 lower[48];
+    fl::u8 upper[48];
+    fl::u8 offsets[48];
+    for (; i + 16 <= n; i += 16) {
+        for (fl::size p = 0; p < 16; ++p) {
+            const fl::u16 index = indices[i + p];
+            const fl::u16 entry = index >> (16 - PaletteBits);
+            const fl::u8 offset = blend ? static_cast<fl::u8>(index >> kOffsetShift) : 0;
+            const CRGB &a = entries[entry];
+            const CRGB &b = entries[entry == kLastEntry ? 0 : entry + 1];
+            lower[3 * p] = a.r;
+            lower[3 * p + 1] = a.g;
+            lower[3 * p + 2] = a.b;
+            upper[3 * p] = b.r;
+            upper[3 * p + 1] = b.g;
+            upper[3 * p + 2] = b.b;
+            offsets[3 * p] = offsets[3 * p + 1] = offsets[3 * p + 2] = offset;
+        }
+        fl::u8 *dst = reinterpret_cast<fl::u8 *>(out.data() + i);
+        for (int v = 0; v < 48; v += 16) {
+            // scale8(a, 255 - o) + scale8(b, o), then scale8(x, brightness)
+            const auto va = fsimd::load_u8_16(lower + v);
+            const auto vb = fsimd::load_u8_16(upper + v);
+            const auto vo = fsimd::load_u8_16(offsets + v);
+            const auto vf = fsimd::xor_u8_16(vo, all255);
+            auto lo = fsimd::add_u16_8(
+                fsimd::srli_u16_8(fsimd::mullo_u16_8(fsimd::widen_lo_u8_to_u16(va),
+                    fsimd::add_u16_8(fsimd::widen_lo_u8_to_u16(vf), one16)), 8),
+                fsimd::srli_u16_8(fsimd::mullo_u16_8(fsimd::widen_lo_u8_to_u16(vb),
+                    fsimd::add_u16_8(fsimd::widen_lo_u8_to_u16(vo), one16)), 8));
+            auto hi = fsimd::add_u16_8(
+                fsimd::srli_u16_8(fsimd::mullo_u16_8(fsimd::widen_hi_u8_to_u16(va),
+                    fsimd::add_u16_8(fsimd::widen_hi_u8_to_u16(vf), one16)), 8),
+                fsimd::srli_u16_8(fsimd::mullo_u16_8(fsimd::widen_hi_u8_to_u16(vb),
+                    fsimd::add_u16_8(fsimd::widen_hi_u8_to_u16(vo), one16)), 8));
+            lo = fsimd::srli_u16_8(fsimd::mullo_u16_8(lo, bright), 8);
+            hi = fsimd::srli_u16_8(fsimd::mullo_u16_8(hi, bright), 8);
+            fsimd::store_u8_16(dst + v, fsimd::narrow_u16_to_u8(lo, hi));
+        }
+    }
+#endif
+    for (; i < n; ++i) {
+        out[i] = ColorFromPaletteExtended(pal, indices[i], brightness, blendType);
+    }
+}
+
+} // namespace
+
+void ColorFromPaletteExtended(const CRGBPalette16 &pal,
+                              fl::span<const fl::u16> indices,
+                              fl::span<CRGB> out, fl::u8 brightness,
+                              TBlendType blendType) {
+    colorFromPaletteExtendedBatch<4>(pal, indices, out, brightness, blendType);
+}
+
+void ColorFromPaletteExtended(const CRGBPalette32 &pal,
+                              fl::span<const fl::u16> indices,
+                              fl::span<CRGB> out, fl::u8 brightness,
+                              TBlendType blendType) {
+    colorFromPaletteExtendedBatch<5>(pal, indices, out, brightness, blendType);
+}
+
+void ColorFromPaletteExtended(const CRGBPalette256 &pal,
+                              fl::span<const fl::u16> indices,
+                              fl::span<CRGB> out, fl::u8 brightness,
+                              TBlendType blendType) {
+    colorFromPaletteExtendedBatch<8>(pal, indices, out, brightness, blendType);
+}
+
 CRGB16 ColorFromPaletteHD(const CRGBPalette256 &pal, fl::u16 index,
                           fl::u8x8 brightness, TBlendType blendType) {
     return ColorFromPaletteHDImpl<8>(
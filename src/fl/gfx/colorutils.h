@@ -1511,6 +1511,84 @@ CHSV ColorFromPalette(const CHSVPalette32 &pal, fl::u8 index,
                       fl::u8 brightness = 255,
                       TBlendType blendType = LINEARBLEND) FL_NOEXCEPT;
 
+/// Expand a palette to one color per 8-bit index, with brightness and blend
+/// already applied: `expanded[i] == ColorFromPalette(pal, i, brightness,
+/// blendType)`. Mapping through the result is a plain table lookup, so build
+/// it once per palette change and reuse it every frame.
+/// @param pal the palette to expand
+/// @param expanded the destination for the 256 colors
+/// @param brightness brightness value used to scale the resulting colors
+/// @param blendType whether to take the palette entries directly (NOBLEND)
+/// or blend linearly between palette entries (LINEARBLEND)
+template <typename PALETTE>
+void ExpandPalette(const PALETTE &pal, CRGBPalette256 &expanded,
+                   fl::u8 brightness = 255,
+                   TBlendType blendType = LINEARBLEND) FL_NOEXCEPT {
+    for (fl::u16 i = 0; i < 256; ++i) {
+        expanded[static_cast<fl::u8>(i)] =
+            ColorFromPalette(pal, static_cast<fl::u8>(i), brightness, blendType);
+    }
+}
+
+/// Batch ColorFromPalette() for a 256-entry (or ExpandPalette()'d) palette:
+/// `out[i] = ColorFromPalette(pal, indices[i], brightness)` for the first
+/// min(indices.size(), out.size()) entries. Lookups are a branch-free table
+/// gather; the brightness scale runs 16 bytes at a time on fl/math/simd.
+void ColorFromPalette(const CRGBPalette256 &pal, fl::span<const fl::u8> indices,
+                      fl::span<CRGB> out, fl::u8 brightness = 255) FL_NOEXCEPT;
+
+/// Batch ColorFromPaletteExtended(): `out[i] = ColorFromPaletteExtended(pal,
+/// indices[i], brightness, blendType)` for the first min(indices.size(),
+/// out.size()) entries. A 16-bit index has too many steps for an expanded
+/// table, so both neighbouring entries are gathered per pixel; the blend and
+/// brightness scales then run 16 bytes at a time on fl/math/simd.
+void ColorFromPaletteExtended(const CRGBPalette16 &pal,
+                              fl::span<const fl::u16> indices,
+                              fl::span<CRGB> out, fl::u8 brightness = 255,
+                              TBlendType blendType = LINEARBLEND) FL_NOEXCEPT;
+
+/// @copydoc ColorFromPaletteExtended(const CRGBPalette16&, fl::span<const fl::u16>, fl::span<CRGB>, fl::u8, TBlendType)
+void ColorFromPaletteExtended(const CRGBPalette32 &pal,
+                              fl::span<const fl::u16> indices,
+                              fl::span<CRGB> out, fl::u8 brightness = 255,
+                              TBlendType blendType = LINEARBLEND) FL_NOEXCEPT;
+
+/// @copydoc ColorFromPaletteExtended(const CRGBPalette16&, fl::span<const fl::u16>, fl::span<CRGB>, fl::u8, TBlendType)
+void ColorFromPaletteExtended(const CRGBPalette256 &pal,
+                              fl::span<const fl::u16> indices,
+                              fl::span<CRGB> out, fl::u8 brightness = 255,
+                              TBlendType blendType = LINEARBLEND) FL_NOEXCEPT;
+
+namespace detail {
+/// Below this many pixels, expanding a palette costs more than it saves.
+constexpr fl::u16 kExpandPaletteMinPixels = 512;
+
+void fill_palette_expanded(CRGB *L, fl::u16 N, fl::u8 startIndex,
+                           fl::u8 incIndex, const CRGBPalette256 &expanded) FL_NOEXCEPT;
+} // namespace detail
+
+/// Batch ColorFromPalette() for any palette: `out[i] = ColorFromPalette(pal,
+/// indices[i], brightness, blendType)` for the first min(indices.size(),
+/// out.size()) entries. Long runs go through a temporary ExpandPalette()
+/// on the stack; short ones convert pixel by pixel.
+template <typename PALETTE>
+void ColorFromPalette(const PALETTE &pal, fl::span<const fl::u8> indices,
+                      fl::span<CRGB> out, fl::u8 brightness = 255,
+                      TBlendType blendType = LINEARBLEND) FL_NOEXCEPT {
+    const fl::size n = indices.size() < out.size() ? indices.size() : out.size();
+#if !defined(FL_IS_AVR)
+    if (n >= detail::kExpandPaletteMinPixels) {
+        CRGBPalette256 expanded;
+        ExpandPalette(pal, expanded, brightness, blendType);
+        ColorFromPalette(expanded, indices, out);
+        return;
+    }
+#endif
+    for (fl::size i = 0; i < n; ++i) {
+        out[i] = ColorFromPalette(pal, indices[i], brightness, blendType);
+    }
+}
+
 /// Fill a range of LEDs with a sequence of entries from a palette
 /// @tparam PALETTE the type of the palette used (auto-deduced)
 /// @param L pointer to the LED array to fill
@@ -1525,6 +1603,14 @@ template <typename PALETTE>
 void fill_palette(CRGB *L, fl::u16 N, fl::u8 startIndex, fl::u8 incIndex,
                   const PALETTE &pal, fl::u8 brightness = 255,
                   TBlendType blendType = LINEARBLEND) FL_NOEXCEPT {
+#if !defined(FL_IS_AVR)
+    if (N >= detail::kExpandPaletteMinPixels) {
+        CRGBPalette256 expanded;
+        ExpandPalette(pal, expanded, brightness, blendType);
+        detail::fill_palette_expanded(L, N, startIndex, incIndex, expanded);
+        return;
+    }
+#endif
     fl::u8 colorIndex = startIndex;
     for (fl::u16 i = 0; i < N; ++i) {
         L[i] = ColorFromPalette(pal, colorIndex, brightness, blendType);
@@ -1608,16 +1694,18 @@ void map_data_into_colors_through_palette(
     fl::u8 *dataArray, fl::u16 dataCount, CRGB *targetColorArray,
     const PALETTE &pal, fl::u8 brightness = 255, fl::u8 opacity = 255,
     TBlendType blendType = LINEARBLEND) FL_NOEXCEPT {
+    if (opacity == 255) {
+        ColorFromPalette(pal, fl::span<const fl::u8>(dataArray, dataCount),
+                         fl::span<CRGB>(targetColorArray, dataCount),
+                         brightness, blendType);
+        return;
+    }
     for (fl::u16 i = 0; i < dataCount; ++i) {
         fl::u8 d = dataArray[i];
         CRGB rgb = ColorFromPalette(pal, d, brightness, blendType);
-        if (opacity == 255) {
-            targetColorArray[i] = rgb;
-        } else {
-            targetColorArray[i].nscale8(256 - opacity);
-            rgb.nscale8_video(opacity);
-            targetColorArray[i] += rgb;
-        }
+        targetColorArray[i].nscale8(256 - opacity);
+        rgb.nscale8_video(opacity);
+        targetColorArray[i] += rgb;
     }
 }
 
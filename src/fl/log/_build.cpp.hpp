@@ -3,4 +3,5 @@
 
 #include "fl/log/async_log_queue.cpp.hpp"
 #include "fl/log/async_logger.cpp.hpp"
+#include "fl/log/binary_log_queue.cpp.hpp"
 #include "fl/log/log.cpp.hpp"
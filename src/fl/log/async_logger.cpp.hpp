@@ -9,6 +9,7 @@
 #include "fl/task/task.h"  // For fl::task
 #include "fl/task/scheduler.h"  // For fl::task::Scheduler
 #include "fl/stl/noexcept.h"
+#include "fl/stl/sstream.h"
 
 namespace fl {
 
@@ -153,6 +154,49 @@ fl::size AsyncLogger::flushN(fl::size maxMessages) {
     return flushed;
 }
 
+// ============================================================================
+// BinaryLogger implementation (formatting happens here, not in the producer)
+// ============================================================================
+
+void BinaryLogger::flush() {
+    while (flushN(mQueue.capacity()) > 0) {
+    }
+}
+
+fl::size BinaryLogger::flushN(fl::size maxMessages) {
+    fl::size flushed = 0;
+    BinaryLogRecord record;
+    while (flushed < maxMessages && mQueue.tryPop(&record)) {
+        fl::sstream line;
+        formatBinaryLogRecord(record, line);
+        fl::println(line.str().c_str());
+        flushed++;
+    }
+    return flushed;
+}
+
+fl::size BinaryLogger::size() const {
+    return mQueue.size();
+}
+
+bool BinaryLogger::empty() const {
+    return mQueue.empty();
+}
+
+void BinaryLogger::clear() {
+    BinaryLogRecord record;
+    while (mQueue.tryPop(&record)) {
+    }
+}
+
+fl::u32 BinaryLogger::droppedCount() const {
+    return mQueue.droppedCount();
+}
+
+fl::u32 BinaryLogger::droppedCount(fl::u8 producer) const {
+    return mQueue.droppedCount(producer);
+}
+
 bool AsyncLogger::enableBackgroundFlush(fl::u32 interval_ms, fl::size messages_per_tick) {
     detail::BackgroundFlushState& state = Singleton<detail::BackgroundFlushState>::instance();
 
@@ -218,6 +262,7 @@ void async_log_service() {
     detail::ActiveLoggerRegistry::instance().forEach([n](AsyncLogger& logger) {
         logger.flushN(n);
     });
+    detail::ActiveLoggerRegistry::instance().flushBinaryN(n);
 }
 
 // ============================================================================
@@ -265,6 +310,7 @@ void AsyncLoggerServiceTask::serviceLoggers() {
     detail::ActiveLoggerRegistry::instance().forEach([this](AsyncLogger& logger) {
         logger.flushN(mMessagesPerTick);
     });
+    detail::ActiveLoggerRegistry::instance().flushBinaryN(mMessagesPerTick);
 }
 
 } // namespace detail
@@ -4,6 +4,7 @@
 /// @brief ISR-safe async logger using SPSC queue backend (zero heap allocation)
 
 #include "fl/log/async_log_queue.h"
+#include "fl/log/binary_log_queue.h"
 #include "fl/stl/int.h"
 #include "fl/stl/singleton.h"
 #include "fl/task/task.h"
@@ -50,6 +51,37 @@ private:
     AsyncLogQueue<128, 4096> mQueue;  // Embedded storage (zero heap allocation)
 };
 
+/// @brief Deferred-format logger shared by all producers (MPSC)
+/// Producers only capture the format pointer and raw arguments; formatting
+/// and printing happen in flush(), normally from the async log service task.
+/// Drop counters are kept per producer id (a LogCategory for FL_LOG_*_BIN_*).
+class BinaryLogger {
+public:
+    BinaryLogger() FL_NOEXCEPT = default;
+    ~BinaryLogger() FL_NOEXCEPT = default;
+
+    /// @brief Capture a record (ISR-safe, multi-producer, no formatting)
+    template <typename... Args>
+    bool log(fl::u8 producer, const char* format, const Args&... args) {
+        return mQueue.push(producer, format, args...);
+    }
+
+    void flush();
+    fl::size flushN(fl::size maxMessages);
+    fl::size size() const;
+    bool empty() const;
+    void clear();
+
+    /// @brief Records dropped across all producers
+    fl::u32 droppedCount() const;
+
+    /// @brief Records dropped for one producer id
+    fl::u32 droppedCount(fl::u8 producer) const;
+
+private:
+    BinaryLogQueue<64, 16> mQueue;  // Embedded storage (~4.5KB, zero heap allocation)
+};
+
 /// @brief Logger category identifiers for registry-based access
 /// Each category has separate ISR and main thread loggers (SPSC requirement)
 enum class LogCategory : fl::u8 {
@@ -63,8 +95,12 @@ enum class LogCategory : fl::u8 {
     AUDIO_MAIN = 7,
     INTERRUPT_ISR = 8,
     INTERRUPT_MAIN = 9,
+    FLEXIO_ISR = 10,
+    FLEXIO_MAIN = 11,
+    OBJECTFLED_ISR = 12,
+    OBJECTFLED_MAIN = 13,
     // Add new categories here (max 16 total)
-    MAX_CATEGORIES = 10
+    MAX_CATEGORIES = 14
 };
 
 namespace detail {
@@ -177,6 +213,7 @@ namespace detail {
     /// Only tracks loggers that have been instantiated via template access
     struct ActiveLoggerRegistry {
         fl::vector_fixed<AsyncLogger*, 16> mActiveLoggers;
+        BinaryLogger* mBinaryLogger = nullptr;  // Set on first get_binary_logger()
 
         static ActiveLoggerRegistry& instance() {
             return SingletonShared<ActiveLoggerRegistry>::instance();
@@ -199,6 +236,13 @@ namespace detail {
                 func(*mActiveLoggers[i]);
             }
         }
+
+        /// @brief Flush up to N records from the binary logger (if instantiated)
+        void flushBinaryN(fl::size maxMessages) {
+            if (mBinaryLogger) {
+                mBinaryLogger->flushN(maxMessages);
+            }
+        }
     };
 
     /// @brief Auto-instantiating task for async logger servicing
@@ -326,4 +370,18 @@ inline AsyncLogger& get_objectfled_async_logger_main() {
     return get_async_logger_by_index<13, detail::ObjectFLEDLoggerInfo>();
 }
 
+/// @brief Shared deferred-format logger (see FL_LOG_BIN)
+/// @note Registers with the async log service task on first access, so
+///       records are formatted and printed in the background. Touch it once
+///       from setup() if the first record may come from an ISR.
+inline BinaryLogger& get_binary_logger() {
+    static BinaryLogger* logger_ptr = []() {
+        BinaryLogger* ptr = &SingletonShared<BinaryLogger>::instance();
+        detail::ActiveLoggerRegistry::instance().mBinaryLogger = ptr;
+        (void)detail::AsyncLoggerServiceTask::instance();
+        return ptr;
+    }();
+    return *logger_ptr;
+}
+
 } // namespace fl
@@ -0,0 +1,211 @@
+/// @file fl/log/binary_log_queue.cpp
+/// @brief MPSC deferred-format log queue implementation
+
+#include "fl/log/binary_log_queue.h"
+#include "fl/stl/isr/critical_section.h"
+#include "fl/stl/sstream.h"
+#include "fl/stl/stdio.h"
+
+namespace fl {
+
+constexpr fl::size BinaryLogRecord::MAX_ARGS;
+
+// ============================================================================
+// Consumer-side formatting
+// ============================================================================
+
+void formatBinaryLogRecord(const BinaryLogRecord& record, fl::sstream& out) {
+    const char* format = record.mFormat ? record.mFormat : "";
+    fl::u8 index = 0;
+    while (*format) {
+        if (*format != '%') {
+            // Single-character string since sstream treats char as number
+            char temp_str[2] = {*format, '\0'};
+            out << temp_str;
+            ++format;
+            continue;
+        }
+        const printf_detail::FormatSpec spec = printf_detail::parse_format_spec(format);
+        if (spec.type == '%') {
+            out << "%";
+            continue;
+        }
+        if (index >= record.mArgCount) {
+            out << "<missing_arg>";
+            continue;
+        }
+        const LogArgValue& value = record.mArgs[index];
+        switch (record.mTypes[index]) {
+            case LogArgType::Int:
+                printf_detail::format_arg(out, spec, value.i);
+                break;
+            case LogArgType::Uint:
+                printf_detail::format_arg(out, spec, value.u);
+                break;
+            case LogArgType::Float:
+                printf_detail::format_arg(out, spec, value.f);
+                break;
+            case LogArgType::Str:
+                printf_detail::format_arg(out, spec, value.s);
+                break;
+            case LogArgType::Ptr:
+                printf_detail::format_arg(out, spec, value.p);
+                break;
+            case LogArgType::None:
+                out << "<missing_arg>";
+                break;
+        }
+        ++index;
+    }
+}
+
+// ============================================================================
+// BinaryLogQueue public methods
+// ============================================================================
+
+template <fl::size SlotCount, fl::size ProducerCount>
+BinaryLogQueue<SlotCount, ProducerCount>::BinaryLogQueue() : mHead(0), mTail(0) {
+    for (fl::u32 i = 0; i < SlotCount; i++) {
+        mSlots[i].mSeq.store(i);
+    }
+    for (fl::size i = 0; i < ProducerCount; i++) {
+        mDropped[i].store(0);
+    }
+}
+
+template <fl::size SlotCount, fl::size ProducerCount>
+bool BinaryLogQueue<SlotCount, ProducerCount>::tryPop(BinaryLogRecord* out) {
+    Slot& slot = mSlots[mTail & (SlotCount - 1)];
+    if (loadSeq(slot) != mTail + 1) {
+        return false;  // Empty, or the oldest claim is still being written
+    }
+    *out = slot.mRecord;
+    // Hand the slot back to producers one lap ahead
+    storeSeq(slot, mTail + SlotCount);
+    mTail++;
+    return true;
+}
+
+template <fl::size SlotCount, fl::size ProducerCount>
+fl::u32 BinaryLogQueue<SlotCount, ProducerCount>::droppedCount(fl::u8 producer) const {
+    const fl::size idx = producer < ProducerCount ? producer : ProducerCount - 1;
+    return mDropped[idx].load();
+}
+
+template <fl::size SlotCount, fl::size ProducerCount>
+fl::u32 BinaryLogQueue<SlotCount, ProducerCount>::droppedCount() const {
+    fl::u32 total = 0;
+    for (fl::size i = 0; i < ProducerCount; i++) {
+        total += mDropped[i].load();
+    }
+    return total;
+}
+
+template <fl::size SlotCount, fl::size ProducerCount>
+fl::size BinaryLogQueue<SlotCount, ProducerCount>::size() const {
+#if FASTLED_USE_REAL_ATOMICS
+    const fl::u32 head = mHead.load();
+#else
+    fl::u32 head;
+    {
+        fl::isr::critical_section cs;
+        head = mHead.load();
+    }
+#endif
+    return static_cast<fl::size>(head - mTail);
+}
+
+template <fl::size SlotCount, fl::size ProducerCount>
+bool BinaryLogQueue<SlotCount, ProducerCount>::empty() const {
+    return size() == 0;
+}
+
+// ============================================================================
+// BinaryLogQueue private methods
+// ============================================================================
+
+template <fl::size SlotCount, fl::size ProducerCount>
+bool BinaryLogQueue<SlotCount, ProducerCount>::reserve(fl::u8 producer, fl::u32* pos) {
+#if FASTLED_USE_REAL_ATOMICS
+    fl::u32 head = mHead.load();
+    for (;;) {
+        const fl::u32 seq = mSlots[head & (SlotCount - 1)].mSeq.load();
+        const fl::i32 diff = static_cast<fl::i32>(seq - head);
+        if (diff == 0) {
+            // Slot is free at this lap: claim it (head reloaded on failure)
+            if (mHead.compare_exchange_weak(head, head + 1)) {
+                *pos = head;
+                return true;
+            }
+        } else if (diff < 0) {
+            // Slot still holds the record from the previous lap: full
+            countDrop(producer);
+            return false;
+        } else {
+            head = mHead.load();  // Another producer claimed it first
+        }
+    }
+#else
+    // No hardware atomics: a critical section makes the claim indivisible
+    // with respect to ISRs, which are the only other producers here.
+    {
+        fl::isr::critical_section cs;
+        const fl::u32 head = mHead.load();
+        if (mSlots[head & (SlotCount - 1)].mSeq.load() == head) {
+            mHead.store(head + 1);
+            *pos = head;
+            return true;
+        }
+    }
+    countDrop(producer);
+    return false;
+#endif
+}
+
+template <fl::size SlotCount, fl::size ProducerCount>
+void BinaryLogQueue<SlotCount, ProducerCount>::publish(fl::u32 pos) {
+    storeSeq(mSlots[pos & (SlotCount - 1)], pos + 1);
+}
+
+template <fl::size SlotCount, fl::size ProducerCount>
+fl::u32 BinaryLogQueue<SlotCount, ProducerCount>::loadSeq(const Slot& slot) const {
+#if FASTLED_USE_REAL_ATOMICS
+    return slot.mSeq.load();
+#else
+    fl::isr::critical_section cs;  // u32 is not a single load on 8/16-bit MCUs
+    return slot.mSeq.load();
+#endif
+}
+
+template <fl::size SlotCount, fl::size ProducerCount>
+void BinaryLogQueue<SlotCount, ProducerCount>::storeSeq(Slot& slot, fl::u32 seq) {
+#if FASTLED_USE_REAL_ATOMICS
+    slot.mSeq.store(seq);
+#else
+    fl::isr::critical_section cs;
+    slot.mSeq.store(seq);
+#endif
+}
+
+template <fl::size SlotCount, fl::size ProducerCount>
+void BinaryLogQueue<SlotCount, ProducerCount>::countDrop(fl::u8 producer) {
+    const fl::size idx = producer < ProducerCount ? producer : ProducerCount - 1;
+#if FASTLED_USE_REAL_ATOMICS
+    mDropped[idx].fetch_add(1);
+#else
+    fl::isr::critical_section cs;
+    mDropped[idx].store(mDropped[idx].load() + 1);
+#endif
+}
+
+// ============================================================================
+// Explicit template instantiations
+// ============================================================================
+
+// Default size (64 slots, one drop counter per LogCategory)
+template class BinaryLogQueue<64, 16>;
+
+// Small test size (8 slots, 4 producers)
+template class BinaryLogQueue<8, 4>;
+
+} // namespace fl
@@ -0,0 +1,204 @@
+#pragma once
+
+/// @file fl/log/binary_log_queue.h
+/// @brief MPSC deferred-format log queue (format pointer + raw arguments)
+///
+/// AsyncLogQueue stores finished text, so every producer still pays for
+/// formatting. BinaryLogQueue stores only the format string pointer and the
+/// raw argument values; the text is produced later by the consumer
+/// (BinaryLogger::flush(), driven by the async log service task).
+///
+/// Producers (any mix of ISRs, tasks and threads) reserve a slot, copy at most
+/// MAX_ARGS scalars and publish it - no heap, no formatting, no locks on
+/// platforms with real atomics. A full queue drops the record and counts it
+/// against the producer id, so a noisy ISR shows up in its own counter.
+///
+/// Arguments are captured by value, except strings: a `const char*` argument
+/// is stored as a pointer and must outlive the flush (string literals, static
+/// tables). The format string has the same requirement.
+
+#include "fl/stl/atomic.h"
+#include "fl/stl/int.h"
+#include "fl/stl/noexcept.h"
+#include "fl/stl/static_assert.h"
+#include "fl/stl/type_traits.h"
+
+namespace fl {
+
+class sstream;
+
+/// @brief Type tag for one captured log argument
+enum class LogArgType : fl::u8 {
+    None = 0,
+    Int,    ///< Signed integer, widened to i64
+    Uint,   ///< Unsigned integer or bool, widened to u64
+    Float,  ///< float/double, stored as double
+    Str,    ///< const char* (pointer only - must outlive the flush)
+    Ptr     ///< Any other pointer (formatted with %p)
+};
+
+/// @brief Raw storage for one captured log argument
+union LogArgValue {
+    fl::i64 i;
+    fl::u64 u;
+    double f;
+    const char* s;
+    const void* p;
+};
+
+/// @brief One deferred log record: format pointer plus raw arguments
+struct BinaryLogRecord {
+    static constexpr fl::size MAX_ARGS = 6;
+
+    const char* mFormat;
+    fl::u8 mProducer;                ///< Producer id (e.g. a LogCategory)
+    fl::u8 mArgCount;
+    LogArgType mTypes[MAX_ARGS];
+    LogArgValue mArgs[MAX_ARGS];
+};
+
+/// @brief Render a record with fl::printf semantics (%d %u %x %f %s %p ...)
+void formatBinaryLogRecord(const BinaryLogRecord& record, fl::sstream& out);
+
+namespace detail {
+
+// Maps an argument type to its LogArgType tag and stores the value
+template <typename T, typename Enable = void>
+struct LogArgCapture {
+    // Unsupported argument types (fl::string, structs, enum class ...) land
+    // here; cast them to a scalar or pass a static const char*.
+    FL_STATIC_ASSERT(sizeof(T) == 0, "FL_LOG_BIN: unsupported argument type");
+};
+
+template <typename T>
+struct LogArgCapture<T, typename fl::enable_if<fl::is_integral<T>::value && fl::is_signed<T>::value>::type> {
+    static void store(const T& arg, LogArgType* type, LogArgValue* value) {
+        *type = LogArgType::Int;
+        value->i = static_cast<fl::i64>(arg);
+    }
+};
+
+template <typename T>
+struct LogArgCapture<T, typename fl::enable_if<fl::is_integral<T>::value && !fl::is_signed<T>::value>::type> {
+    static void store(const T& arg, LogArgType* type, LogArgValue* value) {
+        *type = LogArgType::Uint;
+        value->u = static_cast<fl::u64>(arg);
+    }
+};
+
+template <typename T>
+struct LogArgCapture<T, typename fl::enable_if<fl::is_floating_point<T>::value>::type> {
+    static void store(const T& arg, LogArgType* type, LogArgValue* value) {
+        *type = LogArgType::Float;
+        value->f = static_cast<double>(arg);
+    }
+};
+
+template <>
+struct LogArgCapture<const char*, void> {
+    static void store(const char* arg, LogArgType* type, LogArgValue* value) {
+        *type = LogArgType::Str;
+        value->s = arg;
+    }
+};
+
+template <>
+struct LogArgCapture<char*, void> : LogArgCapture<const char*, void> {};
+
+template <fl::size N>
+struct LogArgCapture<char[N], void> : LogArgCapture<const char*, void> {};
+
+template <typename T>
+struct LogArgCapture<T*, typename fl::enable_if<!fl::is_same<typename fl::remove_cv<T>::type, char>::value>::type> {
+    static void store(const T* arg, LogArgType* type, LogArgValue* value) {
+        *type = LogArgType::Ptr;
+        value->p = static_cast<const void*>(arg);
+    }
+};
+
+inline void captureLogArgs(BinaryLogRecord*, fl::u8) {}
+
+template <typename T, typename... Rest>
+inline void captureLogArgs(BinaryLogRecord* record, fl::u8 index, const T& first, const Rest&... rest) {
+    LogArgCapture<T>::store(first, &record->mTypes[index], &record->mArgs[index]);
+    captureLogArgs(record, static_cast<fl::u8>(index + 1), rest...);
+}
+
+} // namespace detail
+
+/// @brief Bounded multi-producer / single-consumer queue of BinaryLogRecord
+/// @tparam SlotCount Number of record slots (must be power of 2)
+/// @tparam ProducerCount Number of per-producer drop counters (must be power of 2)
+///
+/// Each slot carries a sequence number (bounded MPMC ring, consumer side
+/// reduced to one thread): producers claim a position by advancing the head,
+/// fill the slot, then publish it by bumping its sequence. The consumer only
+/// takes a slot once published, so a producer interrupted between claim and
+/// publish just delays the records behind it. Without real atomics the claim
+/// and the sequence updates run under fl::isr::critical_section instead.
+template <fl::size SlotCount = 64, fl::size ProducerCount = 16>
+class BinaryLogQueue {
+    FL_STATIC_ASSERT((SlotCount & (SlotCount - 1)) == 0, "SlotCount must be power of 2");
+    FL_STATIC_ASSERT((ProducerCount & (ProducerCount - 1)) == 0, "ProducerCount must be power of 2");
+    FL_STATIC_ASSERT(SlotCount >= 2, "SlotCount must be >= 2");
+
+public:
+    BinaryLogQueue() FL_NOEXCEPT;
+
+    /// @brief Capture a record (ISR-safe, multi-producer)
+    /// @param producer Producer id for drop accounting; ids >= ProducerCount
+    ///        share the last counter
+    /// @param format printf-style format string with static lifetime
+    /// @return false if the queue was full (the record is dropped and counted)
+    template <typename... Args>
+    bool push(fl::u8 producer, const char* format, const Args&... args) {
+        FL_STATIC_ASSERT(sizeof...(Args) <= BinaryLogRecord::MAX_ARGS,
+                         "FL_LOG_BIN: too many arguments");
+        fl::u32 pos;
+        if (!reserve(producer, &pos)) {
+            return false;
+        }
+        BinaryLogRecord& record = mSlots[pos & (SlotCount - 1)].mRecord;
+        record.mFormat = format;
+        record.mProducer = producer;
+        record.mArgCount = static_cast<fl::u8>(sizeof...(Args));
+        detail::captureLogArgs(&record, 0, args...);
+        publish(pos);
+        return true;
+    }
+
+    /// @brief Consumer: copy out the oldest published record (single consumer)
+    bool tryPop(BinaryLogRecord* out);
+
+    /// @brief Records dropped for one producer id
+    fl::u32 droppedCount(fl::u8 producer) const;
+
+    /// @brief Records dropped across all producers
+    fl::u32 droppedCount() const;
+
+    /// @brief Records claimed but not yet consumed (includes in-flight pushes)
+    fl::size size() const;
+
+    bool empty() const;
+
+    constexpr fl::size capacity() const { return SlotCount; }
+
+private:
+    struct Slot {
+        fl::atomic<fl::u32> mSeq;  ///< == pos: free, pos + 1: published
+        BinaryLogRecord mRecord;
+    };
+
+    bool reserve(fl::u8 producer, fl::u32* pos);
+    void publish(fl::u32 pos);
+    fl::u32 loadSeq(const Slot& slot) const;
+    void storeSeq(Slot& slot, fl::u32 seq);
+    void countDrop(fl::u8 producer);
+
+    Slot mSlots[SlotCount];
+    fl::atomic<fl::u32> mHead;  ///< Next position to claim (producers)
+    fl::u32 mTail;              ///< Next position to consume (consumer only)
+    fl::atomic<fl::u32> mDropped[ProducerCount];
+};
+
+} // namespace fl
@@ -32,8 +32,8 @@
 #endif
 
 // Conditional include for async logger functions (only when logging features are enabled)
-#if defined(FASTLED_LOG_SPI_ENABLED) || defined(FASTLED_LOG_RMT_ENABLED) || defined(FASTLED_LOG_PARLIO_ENABLED) || defined(FASTLED_LOG_AUDIO_ENABLED) || defined(FASTLED_LOG_INTERRUPT_ENABLED)
-    #include "fl/log/async_logger.h"  // IWYU pragma: keep - Required by FL_LOG_*_ASYNC_* macros
+#if defined(FASTLED_LOG_SPI_ENABLED) || defined(FASTLED_LOG_RMT_ENABLED) || defined(FASTLED_LOG_PARLIO_ENABLED) || defined(FASTLED_LOG_AUDIO_ENABLED) || defined(FASTLED_LOG_INTERRUPT_ENABLED) || defined(FASTLED_LOG_FLEXIO_ENABLED) || defined(FASTLED_LOG_OBJECTFLED_ENABLED)
+    #include "fl/log/async_logger.h"  // IWYU pragma: keep - Required by FL_LOG_*_ASYNC_* / FL_LOG_*_BIN_* macros
 #include "fl/stl/noexcept.h"
 #endif
 
@@ -502,6 +502,16 @@ const char *fastled_file_offset(const char *file) FL_NOEXCEPT;
 /// - push() is ISR-safe (no locks, single-writer pattern)
 /// - flush() must be called from main thread only
 ///
+/// **Deferred Formatting (FL_LOG_*_BIN_*):**
+/// The ASYNC macros still build the message text on the caller. The BIN
+/// variants queue only the format pointer and raw arguments into one shared
+/// MPSC queue (any number of ISRs/threads), and the service task formats
+/// them later - the cheapest option inside timing-sensitive driver code:
+/// ```cpp
+/// FL_LOG_RMT_BIN_ISR("ch%u done, %u symbols", channel, count);
+/// fl::get_binary_logger().droppedCount(fl::LogCategory::RMT_ISR);
+/// ```
+///
 /// @{
 
 /// @brief Generic async logging macro (captures stream expression into string)
@@ -525,6 +535,21 @@ const char *fastled_file_offset(const char *file) FL_NOEXCEPT;
         (logger).push(msg); \
     } while(0)
 
+/// @brief Deferred-format logging (ISR-safe, multi-producer, no formatting on the caller)
+/// @param producer Producer id for drop accounting (e.g. fl::LogCategory::RMT_ISR)
+/// @param ... printf-style format literal followed by up to 6 scalar arguments
+/// Only the format pointer and raw argument values are queued; the text is
+/// built by the async log service task (or FL_LOG_BIN_FLUSH()). String
+/// arguments are stored as pointers and must outlive the flush.
+/// @example FL_LOG_BIN(fl::LogCategory::RMT_ISR, "ch%u underrun at %u us", ch, now)
+#define FL_LOG_BIN(producer, ...) \
+    do { \
+        fl::get_binary_logger().log(static_cast<fl::u8>(producer), __VA_ARGS__); \
+    } while(0)
+
+/// @brief Format and print every queued FL_LOG_BIN record now
+#define FL_LOG_BIN_FLUSH() do { fl::get_binary_logger().flush(); } while(0)
+
 // -----------------------------------------------------------------------------
 // SPI Async Logging
 // -----------------------------------------------------------------------------
@@ -532,6 +557,8 @@ const char *fastled_file_offset(const char *file) FL_NOEXCEPT;
 #ifdef FASTLED_LOG_SPI_ENABLED
     #define FL_LOG_SPI_ASYNC_ISR(X) FL_LOG_ASYNC_ISR(fl::get_spi_async_logger_isr(), X)
     #define FL_LOG_SPI_ASYNC_MAIN(X) FL_LOG_ASYNC(fl::get_spi_async_logger_main(), X)
+    #define FL_LOG_SPI_BIN_ISR(...) FL_LOG_BIN(fl::LogCategory::SPI_ISR, __VA_ARGS__)
+    #define FL_LOG_SPI_BIN_MAIN(...) FL_LOG_BIN(fl::LogCategory::SPI_MAIN, __VA_ARGS__)
     #define FL_LOG_SPI_ASYNC_FLUSH() do { \
         fl::get_spi_async_logger_isr().flush(); \
         fl::get_spi_async_logger_main().flush(); \
@@ -540,6 +567,8 @@ const char *fastled_file_offset(const char *file) FL_NOEXCEPT;
     #define FL_LOG_SPI_ASYNC_ISR(X) FL_DBG_NO_OP(X)
     #define FL_LOG_SPI_ASYNC_MAIN(X) FL_DBG_NO_OP(X)
     #define FL_LOG_SPI_ASYNC_FLUSH() do {} while(0)
+    #define FL_LOG_SPI_BIN_ISR(...) do {} while(0)
+    #define FL_LOG_SPI_BIN_MAIN(...) do {} while(0)
 #endif
 
 // -----------------------------------------------------------------------------
@@ -549,6 +578,8 @@ const char *fastled_file_offset(const char *file) FL_NOEXCEPT;
 #ifdef FASTLED_LOG_RMT_ENABLED
     #define FL_LOG_RMT_ASYNC_ISR(X) FL_LOG_ASYNC_ISR(fl::get_rmt_async_logger_isr(), X)
     #define FL_LOG_RMT_ASYNC_MAIN(X) FL_LOG_ASYNC(fl::get_rmt_async_logger_main(), X)
+    #define FL_LOG_RMT_BIN_ISR(...) FL_LOG_BIN(fl::LogCategory::RMT_ISR, __VA_ARGS__)
+    #define FL_LOG_RMT_BIN_MAIN(...) FL_LOG_BIN(fl::LogCategory::RMT_MAIN, __VA_ARGS__)
     #define FL_LOG_RMT_ASYNC_FLUSH() do { \
         fl::get_rmt_async_logger_isr().flush(); \
         fl::get_rmt_async_logger_main().flush(); \
@@ -557,6 +588,8 @@ const char *fastled_file_offset(const char *file) FL_NOEXCEPT;
     #define FL_LOG_RMT_ASYNC_ISR(X) FL_DBG_NO_OP(X)
     #define FL_LOG_RMT_ASYNC_MAIN(X) FL_DBG_NO_OP(X)
     #define FL_LOG_RMT_ASYNC_FLUSH() do {} while(0)
+    #define FL_LOG_RMT_BIN_ISR(...) do {} while(0)
+    #define FL_LOG_RMT_BIN_MAIN(...) do {} while(0)
 #endif
 
 // -----------------------------------------------------------------------------
@@ -566,6 +599,8 @@ const char *fastled_file_offset(const char *file) FL_NOEXCEPT;
 #ifdef FASTLED_LOG_PARLIO_ENABLED
     #define FL_LOG_PARLIO_ASYNC_ISR(X) FL_LOG_ASYNC_ISR(fl::get_parlio_async_logger_isr(), X)
     #define FL_LOG_PARLIO_ASYNC_MAIN(X) FL_LOG_ASYNC(fl::get_parlio_async_logger_main(), X)
+    #define FL_LOG_PARLIO_BIN_ISR(...) FL_LOG_BIN(fl::LogCategory::PARLIO_ISR, __VA_ARGS__)
+    #define FL_LOG_PARLIO_BIN_MAIN(...) FL_LOG_BIN(fl::LogCategory::PARLIO_MAIN, __VA_ARGS__)
     #define FL_LOG_PARLIO_ASYNC_FLUSH() do { \
         fl::get_parlio_async_logger_isr().flush(); \
         fl::get_parlio_async_logger_main().flush(); \
@@ -574,6 +609,8 @@ const char *fastled_file_offset(const char *file) FL_NOEXCEPT;
     #define FL_LOG_PARLIO_ASYNC_ISR(X) FL_DBG_NO_OP(X)
     #define FL_LOG_PARLIO_ASYNC_MAIN(X) FL_DBG_NO_OP(X)
     #define FL_LOG_PARLIO_ASYNC_FLUSH() do {} while(0)
+    #define FL_LOG_PARLIO_BIN_ISR(...) do {} while(0)
+    #define FL_LOG_PARLIO_BIN_MAIN(...) do {} while(0)
 #endif
 
 // -----------------------------------------------------------------------------
@@ -583,6 +620,8 @@ const char *fastled_file_offset(const char *file) FL_NOEXCEPT;
 #ifdef FASTLED_LOG_AUDIO_ENABLED
     #define FL_LOG_AUDIO_ASYNC_ISR(X) FL_LOG_ASYNC_ISR(fl::get_audio_async_logger_isr(), X)
     #define FL_LOG_AUDIO_ASYNC_MAIN(X) FL_LOG_ASYNC(fl::get_audio_async_logger_main(), X)
+    #define FL_LOG_AUDIO_BIN_ISR(...) FL_LOG_BIN(fl::LogCategory::AUDIO_ISR, __VA_ARGS__)
+    #define FL_LOG_AUDIO_BIN_MAIN(...) FL_LOG_BIN(fl::LogCategory::AUDIO_MAIN, __VA_ARGS__)
     #define FL_LOG_AUDIO_ASYNC_FLUSH() do { \
         fl::get_audio_async_logger_isr().flush(); \
         fl::get_audio_async_logger_main().flush(); \
@@ -591,6 +630,8 @@ const char *fastled_file_offset(const char *file) FL_NOEXCEPT;
     #define FL_LOG_AUDIO_ASYNC_ISR(X) FL_DBG_NO_OP(X)
     #define FL_LOG_AUDIO_ASYNC_MAIN(X) FL_DBG_NO_OP(X)
     #define FL_LOG_AUDIO_ASYNC_FLUSH() do {} while(0)
+    #define FL_LOG_AUDIO_BIN_ISR(...) do {} while(0)
+    #define FL_LOG_AUDIO_BIN_MAIN(...) do {} while(0)
 #endif
 
 // -----------------------------------------------------------------------------
@@ -600,6 +641,8 @@ const char *fastled_file_offset(const char *file) FL_NOEXCEPT;
 #ifdef FASTLED_LOG_INTERRUPT_ENABLED
     #define FL_LOG_INTERRUPT_ASYNC_ISR(X) FL_LOG_ASYNC_ISR(fl::get_interrupt_async_logger_isr(), X)
     #define FL_LOG_INTERRUPT_ASYNC_MAIN(X) FL_LOG_ASYNC(fl::get_interrupt_async_logger_main(), X)
+    #define FL_LOG_INTERRUPT_BIN_ISR(...) FL_LOG_BIN(fl::LogCategory::INTERRUPT_ISR, __VA_ARGS__)
+    #define FL_LOG_INTERRUPT_BIN_MAIN(...) FL_LOG_BIN(fl::LogCategory::INTERRUPT_MAIN, __VA_ARGS__)
     #define FL_LOG_INTERRUPT_ASYNC_FLUSH() do { \
         fl::get_interrupt_async_logger_isr().flush(); \
         fl::get_interrupt_async_logger_main().flush(); \
@@ -608,6 +651,8 @@ const char *fastled_file_offset(const char *file) FL_NOEXCEPT;
     #define FL_LOG_INTERRUPT_ASYNC_ISR(X) FL_DBG_NO_OP(X)
     #define FL_LOG_INTERRUPT_ASYNC_MAIN(X) FL_DBG_NO_OP(X)
     #define FL_LOG_INTERRUPT_ASYNC_FLUSH() do {} while(0)
+    #define FL_LOG_INTERRUPT_BIN_ISR(...) do {} while(0)
+    #define FL_LOG_INTERRUPT_BIN_MAIN(...) do {} while(0)
 #endif
 
 // -----------------------------------------------------------------------------
@@ -617,6 +662,8 @@ const char *fastled_file_offset(const char *file) FL_NOEXCEPT;
 #ifdef FASTLED_LOG_FLEXIO_ENABLED
     #define FL_LOG_FLEXIO_ASYNC_ISR(X) FL_LOG_ASYNC_ISR(fl::get_flexio_async_logger_isr(), X)
     #define FL_LOG_FLEXIO_ASYNC_MAIN(X) FL_LOG_ASYNC(fl::get_flexio_async_logger_main(), X)
+    #define FL_LOG_FLEXIO_BIN_ISR(...) FL_LOG_BIN(fl::LogCategory::FLEXIO_ISR, __VA_ARGS__)
+    #define FL_LOG_FLEXIO_BIN_MAIN(...) FL_LOG_BIN(fl::LogCategory::FLEXIO_MAIN, __VA_ARGS__)
     #define FL_LOG_FLEXIO_ASYNC_FLUSH() do { \
         fl::get_flexio_async_logger_isr().flush(); \
         fl::get_flexio_async_logger_main().flush(); \
@@ -625,6 +672,8 @@ const char *fastled_file_offset(const char *file) FL_NOEXCEPT;
     #define FL_LOG_FLEXIO_ASYNC_ISR(X) FL_DBG_NO_OP(X)
     #define FL_LOG_FLEXIO_ASYNC_MAIN(X) FL_DBG_NO_OP(X)
     #define FL_LOG_FLEXIO_ASYNC_FLUSH() do {} while(0)
+    #define FL_LOG_FLEXIO_BIN_ISR(...) do {} while(0)
+    #define FL_LOG_FLEXIO_BIN_MAIN(...) do {} while(0)
 #endif
 
 // -----------------------------------------------------------------------------
@@ -634,6 +683,8 @@ const char *fastled_file_offset(const char *file) FL_NOEXCEPT;
 #ifdef FASTLED_LOG_OBJECTFLED_ENABLED
     #define FL_LOG_OBJECTFLED_ASYNC_ISR(X) FL_LOG_ASYNC_ISR(fl::get_objectfled_async_logger_isr(), X)
     #define FL_LOG_OBJECTFLED_ASYNC_MAIN(X) FL_LOG_ASYNC(fl::get_objectfled_async_logger_main(), X)
+    #define FL_LOG_OBJECTFLED_BIN_ISR(...) FL_LOG_BIN(fl::LogCategory::OBJECTFLED_ISR, __VA_ARGS__)
+    #define FL_LOG_OBJECTFLED_BIN_MAIN(...) FL_LOG_BIN(fl::LogCategory::OBJECTFLED_MAIN, __VA_ARGS__)
     #define FL_LOG_OBJECTFLED_ASYNC_FLUSH() do { \
         fl::get_objectfled_async_logger_isr().flush(); \
         fl::get_objectfled_async_logger_main().flush(); \
@@ -642,6 +693,8 @@ const char *fastled_file_offset(const char *file) FL_NOEXCEPT;
     #define FL_LOG_OBJECTFLED_ASYNC_ISR(X) FL_DBG_NO_OP(X)
     #define FL_LOG_OBJECTFLED_ASYNC_MAIN(X) FL_DBG_NO_OP(X)
     #define FL_LOG_OBJECTFLED_ASYNC_FLUSH() do {} while(0)
+    #define FL_LOG_OBJECTFLED_BIN_ISR(...) do {} while(0)
+    #define FL_LOG_OBJECTFLED_BIN_MAIN(...) do {} while(0)
 #endif
 
 // -----------------------------------------------------------------------------
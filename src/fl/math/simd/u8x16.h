@@ -104,6 +104,16 @@ using platforms::xor_u8_16;  // ok bare using
 /// @return Bitwise AND-NOT result
 using platforms::andnot_u8_16;  // ok bare using
 
+//==============================================================================
+// Comparison Operations
+//==============================================================================
+
+/// Compare every lane against one byte value
+/// @param vec Input vector (16 uint8_t)
+/// @param value Byte to look for
+/// @return Bitmask with bit i set when lane i equals value
+using platforms::match_u8_16;  // ok bare using
+
 //==============================================================================
 // Blend Operations
 //==============================================================================
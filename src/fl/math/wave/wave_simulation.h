@@ -151,6 +151,10 @@ class WaveSimulation2D {
              mSim->getDampenening());
     }
 
+    SuperSample getSuperSample() const {
+        return static_cast<SuperSample>(mMultiplier);
+    }
+
     void setXCylindrical(bool on) { mSim->setXCylindrical(on); }
 
     // Downsampled getter for the floating point value at (x,y) in the outer
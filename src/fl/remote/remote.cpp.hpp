@@ -2,6 +2,7 @@
 #include "fl/stl/int.h"
 #include "fl/stl/json.h"
 #include "fl/log/log.h"
+#include "fl/remote/rpc/msgpack.h"
 #include "fl/remote/rpc/rpc.h"
 #include "fl/remote/rpc/server.h"
 #include "fl/remote/types.h"
@@ -11,6 +12,7 @@
 #include "fl/stl/function.h"
 #include "fl/stl/move.h"
 #include "fl/stl/optional.h"
+#include "fl/stl/span.h"
 #include "fl/stl/string.h"
 #include "fl/stl/strstream.h"
 #include "fl/stl/vector.h"
@@ -192,6 +194,49 @@ fl::json Remote::processRpc(const fl::json& request) {
     }
 }
 
+bool Remote::processRpcMsgPack(fl::span<const u8> request, fl::vector<u8>* response) {
+    MsgPackRequest req;
+    const char* error = nullptr;
+    bool jsonPath = parseMsgPackRequest(request, &req, &error) &&
+                    (req.timestamp != 0 || !mRpc.bindsMsgPackDirectly(req.method));
+    fl::json jsonRequest;
+    if (!jsonPath || !MsgPackReader(request).readJson(&jsonRequest)) {
+        // Direct binding (malformed frames get their error reply here too)
+        return mRpc.handleMsgPack(request, response);
+    }
+
+    fl::json jsonResponse = processRpc(jsonRequest);
+    bool isScheduledAck = jsonResponse.contains("scheduled") && jsonResponse["scheduled"].as_bool().value_or(false);
+    bool isAsyncSkip = jsonResponse.contains("__skip") && jsonResponse["__skip"].as_bool().value_or(false);
+    if (isScheduledAck || isAsyncSkip || !req.hasId()) {
+        return false;
+    }
+    MsgPackWriter out(fl::move(*response));
+    writeMsgPackResponse(out, jsonResponse);
+    *response = fl::move(out.buffer());
+    return true;
+}
+
+void Remote::setMsgPackTransport(MsgPackSource source, MsgPackSink sink) {
+    mMsgPackSource = fl::move(source);
+    mMsgPackSink = fl::move(sink);
+    mRpc.setMsgPackEnabled(static_cast<bool>(mMsgPackSource));
+}
+
+size_t Remote::pullMsgPack() {
+    if (!mMsgPackSource) {
+        return 0;
+    }
+    size_t processed = 0;
+    while (auto frame = mMsgPackSource()) {
+        if (processRpcMsgPack(*frame, &mMsgPackResponse) && mMsgPackSink) {
+            mMsgPackSink(mMsgPackResponse);
+        }
+        processed++;
+    }
+    return processed;
+}
+
 void Remote::scheduleFunction(u32 timestamp, u32 receivedAt, const fl::json& jsonRpcRequest) {
     // Make explicit copy for capture (avoid reference issues)
     fl::json requestCopy = jsonRpcRequest;
@@ -270,7 +315,9 @@ Remote::Remote(RequestSource source, ResponseSink sink)
 // Server Coordination
 
 size_t Remote::update(u32 currentTimeMs) {
-    size_t processed = Server::pull();   // Pull requests from Server
+    // Binary frames first: a shared serial link leaves them for this source
+    size_t processed = pullMsgPack();
+    processed += Server::pull();   // Pull requests from Server
     size_t executed = tick(currentTimeMs);  // Process scheduled tasks
 
     // Push scheduled results as JSON-RPC responses
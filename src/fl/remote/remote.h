@@ -4,6 +4,8 @@
 #include "fl/stl/stdint.h"
 #include "fl/stl/cstddef.h"
 #include "fl/stl/move.h"
+#include "fl/stl/optional.h"
+#include "fl/stl/span.h"
 #include "fl/stl/string.h"
 #include "fl/stl/unordered_map.h"
 #include "fl/stl/vector.h"
@@ -70,6 +72,10 @@ public:
      */
     Remote(RequestSource source, ResponseSink sink);
 
+    /// Binary (MessagePack) frame callbacks, see setMsgPackTransport()
+    using MsgPackSource = fl::function<fl::optional<fl::vector<u8>>()>;
+    using MsgPackSink = fl::function<void(fl::span<const u8>)>;
+
     // Non-copyable, non-movable (lambda captures 'this')
     Remote(const Remote&) FL_NOEXCEPT = delete;
     Remote(Remote&&) FL_NOEXCEPT = delete;
@@ -121,6 +127,17 @@ public:
     /// Returns JSON-RPC response: {"result": ...} or {"error": {...}}
     fl::json processRpc(const fl::json& request);
 
+    /// Process a MessagePack request (envelope described in fl/remote/rpc/msgpack.h)
+    /// SYNC methods are bound straight from the frame; scheduled and async
+    /// requests take the JSON path so they share its bookkeeping.
+    /// @returns false when there is no response to send
+    bool processRpcMsgPack(fl::span<const u8> request, fl::vector<u8>* response);
+
+    /// Carry MessagePack frames alongside JSON (e.g. createSerialMsgPackTransport()).
+    /// Frames are pulled before JSON requests on every update(), answered in
+    /// MessagePack, and "rpc.encodings" starts advertising "msgpack".
+    void setMsgPackTransport(MsgPackSource source, MsgPackSink sink);
+
     // =========================================================================
     // Server Coordination
     // =========================================================================
@@ -202,9 +219,16 @@ protected:
     void scheduleFunction(u32 timestamp, u32 receivedAt, const fl::json& jsonRpcRequest);
     void recordResult(const fl::string& funcName, const fl::json& result, u32 scheduledAt, u32 receivedAt, u32 executedAt, bool wasScheduled);
 
+    size_t pullMsgPack();
+
     // Method registry and execution
     fl::Rpc mRpc;
 
+    // Optional binary transport
+    MsgPackSource mMsgPackSource;
+    MsgPackSink mMsgPackSink;
+    fl::vector<u8> mMsgPackResponse;  // Reused between frames
+
     // Generic task scheduler
     fl::net::RpcScheduler<> mScheduler;
 
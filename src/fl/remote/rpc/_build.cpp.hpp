@@ -2,5 +2,6 @@
 /// @brief Unity build header for fl/remote/rpc/ directory
 
 #include "fl/remote/rpc/base64.cpp.hpp"
+#include "fl/remote/rpc/msgpack.cpp.hpp"
 #include "fl/remote/rpc/rpc.cpp.hpp"
 #include "fl/remote/rpc/server.cpp.hpp"
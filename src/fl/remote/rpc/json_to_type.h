@@ -262,5 +262,16 @@ struct JsonToType<fl::vector<fl::u8>, void> {
     }
 };
 
+// Byte spans take the same base64 string OR integer array as byte vectors, so
+// a span<const u8> handler works with both the JSON and MessagePack encodings.
+template <>
+struct JsonToType<fl::ConstSpanWrapper<fl::u8>, void> {
+    static fl::tuple<fl::ConstSpanWrapper<fl::u8>, TypeConversionResult> convert(const json& j) {
+        auto vecResult = JsonToType<fl::vector<fl::u8>>::convert(j);
+        return fl::make_tuple(fl::ConstSpanWrapper<fl::u8>(fl::move(fl::get<0>(vecResult))),
+                              fl::get<1>(vecResult));
+    }
+};
+
 } // namespace detail
 } // namespace fl
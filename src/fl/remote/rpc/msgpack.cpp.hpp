@@ -0,0 +1,613 @@
+#include "fl/remote/rpc/msgpack.h"
+#include "fl/remote/rpc/base64.h"
+#include "fl/stl/bit_cast.h"
+#include "fl/stl/cstring.h"
+#include "fl/stl/json.h"
+#include "fl/stl/limits.h"
+
+namespace fl {
+
+namespace {
+
+// Nesting limit for skip()/readJson(); frames come from the wire.
+const int kMsgPackMaxDepth = 32;
+
+} // namespace
+
+// =============================================================================
+// MsgPackWriter
+// =============================================================================
+
+void MsgPackWriter::putBE(u64 value, int bytes) {
+    for (int shift = (bytes - 1) * 8; shift >= 0; shift -= 8) {
+        put(static_cast<u8>(value >> shift));
+    }
+}
+
+void MsgPackWriter::writeNil() {
+    put(0xc0);
+}
+
+void MsgPackWriter::writeBool(bool value) {
+    put(value ? 0xc3 : 0xc2);
+}
+
+void MsgPackWriter::writeInt(i64 value) {
+    if (value >= 0) {
+        writeUInt(static_cast<u64>(value));
+    } else if (value >= -32) {
+        put(static_cast<u8>(value));  // negative fixint
+    } else if (value >= -128) {
+        put(0xd0);
+        putBE(static_cast<u64>(value), 1);
+    } else if (value >= -32768) {
+        put(0xd1);
+        putBE(static_cast<u64>(value), 2);
+    } else if (value >= -2147483647LL - 1) {
+        put(0xd2);
+        putBE(static_cast<u64>(value), 4);
+    } else {
+        put(0xd3);
+        putBE(static_cast<u64>(value), 8);
+    }
+}
+
+void MsgPackWriter::writeUInt(u64 value) {
+    if (value <= 0x7f) {
+        put(static_cast<u8>(value));  // positive fixint
+    } else if (value <= 0xff) {
+        put(0xcc);
+        putBE(value, 1);
+    } else if (value <= 0xffff) {
+        put(0xcd);
+        putBE(value, 2);
+    } else if (value <= 0xffffffffULL) {
+        put(0xce);
+        putBE(value, 4);
+    } else {
+        put(0xcf);
+        putBE(value, 8);
+    }
+}
+
+void MsgPackWriter::writeFloat(float value) {
+    put(0xca);
+    putBE(fl::bit_cast<u32>(value), 4);
+}
+
+void MsgPackWriter::writeDouble(double value) {
+    put(0xcb);
+    putBE(fl::bit_cast<u64>(value), 8);
+}
+
+void MsgPackWriter::writeString(fl::string_view value) {
+    const fl::size len = value.size();
+    if (len < 32) {
+        put(static_cast<u8>(0xa0 | len));
+    } else if (len <= 0xff) {
+        put(0xd9);
+        putBE(len, 1);
+    } else if (len <= 0xffff) {
+        put(0xda);
+        putBE(len, 2);
+    } else {
+        put(0xdb);
+        putBE(len, 4);
+    }
+    writeRaw(fl::span<const u8>(reinterpret_cast<const u8*>(value.data()), len));  // ok reinterpret cast
+}
+
+void MsgPackWriter::writeBinary(fl::span<const u8> value) {
+    const fl::size len = value.size();
+    if (len <= 0xff) {
+        put(0xc4);
+        putBE(len, 1);
+    } else if (len <= 0xffff) {
+        put(0xc5);
+        putBE(len, 2);
+    } else {
+        put(0xc6);
+        putBE(len, 4);
+    }
+    writeRaw(value);
+}
+
+void MsgPackWriter::writeArrayHeader(fl::size count) {
+    if (count < 16) {
+        put(static_cast<u8>(0x90 | count));
+    } else if (count <= 0xffff) {
+        put(0xdc);
+        putBE(count, 2);
+    } else {
+        put(0xdd);
+        putBE(count, 4);
+    }
+}
+
+void MsgPackWriter::writeMapHeader(fl::size count) {
+    if (count < 16) {
+        put(static_cast<u8>(0x80 | count));
+    } else if (count <= 0xffff) {
+        put(0xde);
+        putBE(count, 2);
+    } else {
+        put(0xdf);
+        putBE(count, 4);
+    }
+}
+
+void MsgPackWriter::writeRaw(fl::span<const u8> encoded) {
+    if (encoded.empty()) {
+        return;
+    }
+    const fl::size offset = mBuffer.size();
+    mBuffer.resize(offset + encoded.size());
+    fl::memcpy(mBuffer.data() + offset, encoded.data(), encoded.size());
+}
+
+void MsgPackWriter::writeJson(const fl::json& value) {
+    if (value.is_null()) {
+        writeNil();
+    } else if (value.is_bool()) {
+        writeBool(value.as_bool().value_or(false));
+    } else if (value.is_int()) {
+        writeInt(value.as_int().value_or(0));
+    } else if (value.is_number()) {
+        writeFloat(value.as_float().value_or(0.0f));
+    } else if (value.is_string()) {
+        fl::string str = value.as_string().value_or("");
+        writeString(str);
+    } else if (value.is_object()) {
+        fl::vector<fl::string> keys = value.keys();
+        writeMapHeader(keys.size());
+        for (fl::size i = 0; i < keys.size(); ++i) {
+            writeString(keys[i]);
+            writeJson(value[keys[i]]);
+        }
+    } else if (value.is_array()) {
+        const fl::size count = value.size();
+        writeArrayHeader(count);
+        for (fl::size i = 0; i < count; ++i) {
+            writeJson(value[i]);
+        }
+    } else {
+        writeNil();
+    }
+}
+
+// =============================================================================
+// MsgPackReader
+// =============================================================================
+
+MsgPackReader::Type MsgPackReader::peekType() const {
+    if (atEnd()) {
+        return Type::Invalid;
+    }
+    const u8 b = mData[mPos];
+    if (b <= 0x7f || b >= 0xe0) return Type::Int;
+    if (b <= 0x8f) return Type::Map;
+    if (b <= 0x9f) return Type::Array;
+    if (b <= 0xbf) return Type::String;
+    switch (b) {
+    case 0xc0: return Type::Nil;
+    case 0xc2: case 0xc3: return Type::Bool;
+    case 0xc4: case 0xc5: case 0xc6: return Type::Binary;
+    case 0xc7: case 0xc8: case 0xc9: return Type::Ext;
+    case 0xca: case 0xcb: return Type::Float;
+    case 0xd4: case 0xd5: case 0xd6: case 0xd7: case 0xd8: return Type::Ext;
+    case 0xd9: case 0xda: case 0xdb: return Type::String;
+    case 0xdc: case 0xdd: return Type::Array;
+    case 0xde: case 0xdf: return Type::Map;
+    default: break;
+    }
+    if (b >= 0xcc && b <= 0xd3) return Type::Int;
+    return Type::Invalid;  // 0xc1
+}
+
+bool MsgPackReader::take(fl::size bytes, const u8** out) {
+    if (mData.size() - mPos < bytes) {
+        return false;
+    }
+    *out = mData.data() + mPos;
+    mPos += bytes;
+    return true;
+}
+
+bool MsgPackReader::readBE(int bytes, u64* out) {
+    const u8* p = nullptr;
+    if (!take(static_cast<fl::size>(bytes), &p)) {
+        return false;
+    }
+    u64 value = 0;
+    for (int i = 0; i < bytes; ++i) {
+        value = (value << 8) | p[i];
+    }
+    *out = value;
+    return true;
+}
+
+// Reads a length for a family with a fix form (tag | len, `fix_mask` bits of
+// length) and 8/16/32-bit forms. A zero marker means the family lacks it.
+bool MsgPackReader::readLength(u8 fix_tag, u8 fix_mask, u8 marker8, u8 marker16,
+                               u8 marker32, fl::size* length) {
+    if (atEnd()) {
+        return false;
+    }
+    const fl::size start = mPos;
+    const u8 b = mData[mPos++];
+    u64 len = 0;
+    bool ok = true;
+    if (fix_mask != 0 && (b & static_cast<u8>(~fix_mask)) == fix_tag) {
+        len = b & fix_mask;
+    } else if (marker8 != 0 && b == marker8) {
+        ok = readBE(1, &len);
+    } else if (b == marker16) {
+        ok = readBE(2, &len);
+    } else if (b == marker32) {
+        ok = readBE(4, &len);
+    } else {
+        ok = false;
+    }
+    if (!ok) {
+        mPos = start;
+        return false;
+    }
+    *length = static_cast<fl::size>(len);
+    return true;
+}
+
+bool MsgPackReader::readNil() {
+    if (peekType() != Type::Nil) {
+        return false;
+    }
+    ++mPos;
+    return true;
+}
+
+bool MsgPackReader::readBool(bool* out) {
+    if (peekType() != Type::Bool) {
+        return false;
+    }
+    *out = mData[mPos++] == 0xc3;
+    return true;
+}
+
+bool MsgPackReader::readInt(i64* out) {
+    if (peekType() != Type::Int) {
+        return false;
+    }
+    const fl::size start = mPos;
+    const u8 b = mData[mPos++];
+    if (b <= 0x7f) {
+        *out = b;
+        return true;
+    }
+    if (b >= 0xe0) {
+        *out = static_cast<i8>(b);
+        return true;
+    }
+    u64 raw = 0;
+    bool ok = false;
+    switch (b) {
+    case 0xcc: ok = readBE(1, &raw); *out = static_cast<i64>(raw); break;
+    case 0xcd: ok = readBE(2, &raw); *out = static_cast<i64>(raw); break;
+    case 0xce: ok = readBE(4, &raw); *out = static_cast<i64>(raw); break;
+    case 0xcf:
+        ok = readBE(8, &raw) && raw <= static_cast<u64>(fl::numeric_limits<i64>::max());
+        *out = static_cast<i64>(raw);
+        break;
+    case 0xd0: ok = readBE(1, &raw); *out = static_cast<i8>(raw); break;
+    case 0xd1: ok = readBE(2, &raw); *out = static_cast<i16>(raw); break;
+    case 0xd2: ok = readBE(4, &raw); *out = static_cast<i32>(raw); break;
+    case 0xd3: ok = readBE(8, &raw); *out = static_cast<i64>(raw); break;
+    default: break;
+    }
+    if (!ok) {
+        mPos = start;
+    }
+    return ok;
+}
+
+bool MsgPackReader::readFloat(double* out) {
+    if (peekType() != Type::Float) {
+        return false;
+    }
+    const fl::size start = mPos;
+    const u8 b = mData[mPos++];
+    u64 raw = 0;
+    if (!readBE(b == 0xca ? 4 : 8, &raw)) {
+        mPos = start;
+        return false;
+    }
+    if (b == 0xca) {
+        *out = fl::bit_cast<float>(static_cast<u32>(raw));
+    } else {
+        *out = fl::bit_cast<double>(raw);
+    }
+    return true;
+}
+
+bool MsgPackReader::readString(fl::string_view* out) {
+    const fl::size start = mPos;
+    fl::size len = 0;
+    const u8* p = nullptr;
+    if (!readLength(0xa0, 0x1f, 0xd9, 0xda, 0xdb, &len) || !take(len, &p)) {
+        mPos = start;
+        return false;
+    }
+    *out = fl::string_view(reinterpret_cast<const char*>(p), len);  // ok reinterpret cast
+    return true;
+}
+
+bool MsgPackReader::readBinary(fl::span<const u8>* out) {
+    const fl::size start = mPos;
+    fl::size len = 0;
+    const u8* p = nullptr;
+    if (!readLength(0, 0, 0xc4, 0xc5, 0xc6, &len) || !take(len, &p)) {
+        mPos = start;
+        return false;
+    }
+    *out = fl::span<const u8>(p, len);
+    return true;
+}
+
+bool MsgPackReader::readArrayHeader(fl::size* count) {
+    return readLength(0x90, 0x0f, 0, 0xdc, 0xdd, count);
+}
+
+bool MsgPackReader::readMapHeader(fl::size* count) {
+    return readLength(0x80, 0x0f, 0, 0xde, 0xdf, count);
+}
+
+bool MsgPackReader::skip() {
+    const fl::size start = mPos;
+    if (!skipDepth(0)) {
+        mPos = start;
+        return false;
+    }
+    return true;
+}
+
+bool MsgPackReader::skipDepth(int depth) {
+    if (depth > kMsgPackMaxDepth) {
+        return false;
+    }
+    fl::size count = 0;
+    switch (peekType()) {
+    case Type::Nil:
+        return readNil();
+    case Type::Bool: {
+        bool b;
+        return readBool(&b);
+    }
+    case Type::Int: {
+        i64 i;
+        if (readInt(&i)) {
+            return true;
+        }
+        u64 raw;  // uint64 above INT64_MAX
+        ++mPos;
+        return readBE(8, &raw);
+    }
+    case Type::Float: {
+        double d;
+        return readFloat(&d);
+    }
+    case Type::String: {
+        fl::string_view s;
+        return readString(&s);
+    }
+    case Type::Binary: {
+        fl::span<const u8> bin;
+        return readBinary(&bin);
+    }
+    case Type::Array:
+        if (!readArrayHeader(&count)) {
+            return false;
+        }
+        for (fl::size i = 0; i < count; ++i) {
+            if (!skipDepth(depth + 1)) {
+                return false;
+            }
+        }
+        return true;
+    case Type::Map:
+        if (!readMapHeader(&count)) {
+            return false;
+        }
+        for (fl::size i = 0; i < count * 2; ++i) {
+            if (!skipDepth(depth + 1)) {
+                return false;
+            }
+        }
+        return true;
+    case Type::Ext: {
+        const u8 b = mData[mPos++];
+        u64 len = 0;
+        if (b >= 0xd4 && b <= 0xd8) {
+            len = static_cast<u64>(1) << (b - 0xd4);  // fixext 1/2/4/8/16
+        } else if (!readBE(b == 0xc7 ? 1 : (b == 0xc8 ? 2 : 4), &len)) {
+            return false;
+        }
+        const u8* p = nullptr;
+        return take(static_cast<fl::size>(len) + 1, &p);  // type byte + data
+    }
+    case Type::Invalid:
+        break;
+    }
+    return false;
+}
+
+bool MsgPackReader::readRaw(fl::span<const u8>* out) {
+    const fl::size start = mPos;
+    if (!skip()) {
+        return false;
+    }
+    *out = fl::span<const u8>(mData.data() + start, mPos - start);
+    return true;
+}
+
+bool MsgPackReader::readJson(fl::json* out) {
+    const fl::size start = mPos;
+    if (!readJsonDepth(out, 0)) {
+        mPos = start;
+        return false;
+    }
+    return true;
+}
+
+bool MsgPackReader::readJsonDepth(fl::json* out, int depth) {
+    if (depth > kMsgPackMaxDepth) {
+        return false;
+    }
+    fl::size count = 0;
+    switch (peekType()) {
+    case Type::Nil:
+        *out = fl::json(nullptr);
+        return readNil();
+    case Type::Bool: {
+        bool b = false;
+        if (!readBool(&b)) return false;
+        *out = fl::json(b);
+        return true;
+    }
+    case Type::Int: {
+        i64 i = 0;
+        if (!readInt(&i)) return false;
+        *out = fl::json(i);
+        return true;
+    }
+    case Type::Float: {
+        double d = 0.0;
+        if (!readFloat(&d)) return false;
+        *out = fl::json(d);
+        return true;
+    }
+    case Type::String: {
+        fl::string_view s;
+        if (!readString(&s)) return false;
+        *out = fl::json(fl::string(s));
+        return true;
+    }
+    case Type::Binary: {
+        fl::span<const u8> bin;
+        if (!readBinary(&bin)) return false;
+        *out = fl::json(fl::base64_encode(bin));
+        return true;
+    }
+    case Type::Array: {
+        if (!readArrayHeader(&count)) return false;
+        fl::json arr = fl::json::array();
+        for (fl::size i = 0; i < count; ++i) {
+            fl::json item;
+            if (!readJsonDepth(&item, depth + 1)) return false;
+            arr.push_back(item);
+        }
+        *out = arr;
+        return true;
+    }
+    case Type::Map: {
+        if (!readMapHeader(&count)) return false;
+        fl::json obj = fl::json::object();
+        for (fl::size i = 0; i < count; ++i) {
+            fl::string_view key;
+            fl::json item;
+            if (!readString(&key) || !readJsonDepth(&item, depth + 1)) return false;
+            obj.set(fl::string(key), item);
+        }
+        *out = obj;
+        return true;
+    }
+    case Type::Ext:
+    case Type::Invalid:
+        break;
+    }
+    return false;
+}
+
+// =============================================================================
+// parseMsgPackRequest
+// =============================================================================
+
+bool parseMsgPackRequest(fl::span<const u8> frame, MsgPackRequest* out,
+                         const char** error) {
+    MsgPackReader reader(frame);
+    fl::size count = 0;
+    if (!reader.readMapHeader(&count)) {
+        *error = "request must be a map";
+        return false;
+    }
+    bool hasMethod = false;
+    for (fl::size i = 0; i < count; ++i) {
+        fl::string_view key;
+        if (!reader.readString(&key)) {
+            *error = "request keys must be strings";
+            return false;
+        }
+        bool ok = true;
+        if (key == "method") {
+            ok = reader.readString(&out->method);
+            hasMethod = ok;
+            if (!ok) *error = "'method' must be a string";
+        } else if (key == "params") {
+            ok = reader.peekType() == MsgPackReader::Type::Array &&
+                 reader.readRaw(&out->params);
+            if (!ok) *error = "params must be an array";
+        } else if (key == "id") {
+            ok = reader.readRaw(&out->id);
+            if (!ok) *error = "truncated request";
+        } else if (key == "timestamp") {
+            i64 ts = 0;
+            ok = reader.readInt(&ts) && ts >= 0;
+            out->timestamp = static_cast<u32>(ts);
+            if (!ok) *error = "'timestamp' must be an unsigned integer";
+        } else {
+            ok = reader.skip();
+            if (!ok) *error = "truncated request";
+        }
+        if (!ok) {
+            return false;
+        }
+    }
+    if (!hasMethod) {
+        *error = "missing 'method'";
+        return false;
+    }
+    return true;
+}
+
+void writeMsgPackError(MsgPackWriter& out, fl::span<const u8> id, int code,
+                       fl::string_view message) {
+    out.writeMapHeader(id.empty() ? 1 : 2);
+    if (!id.empty()) {
+        out.writeString("id");
+        out.writeRaw(id);
+    }
+    out.writeString("error");
+    out.writeMapHeader(2);
+    out.writeString("code");
+    out.writeInt(code);
+    out.writeString("message");
+    out.writeString(message);
+}
+
+void writeMsgPackResponse(MsgPackWriter& out, const fl::json& response) {
+    if (!response.is_object()) {
+        out.writeJson(response);
+        return;
+    }
+    fl::vector<fl::string> keys = response.keys();
+    fl::size count = 0;
+    for (fl::size i = 0; i < keys.size(); ++i) {
+        if (keys[i] != "jsonrpc" && !keys[i].starts_with("__")) {
+            keys[count++] = keys[i];
+        }
+    }
+    out.writeMapHeader(count);
+    for (fl::size i = 0; i < count; ++i) {
+        out.writeString(keys[i]);
+        out.writeJson(response[keys[i]]);
+    }
+}
+
+} // namespace fl
@@ -0,0 +1,171 @@
+#pragma once
+
+#include "fl/stl/json.h"
+#include "fl/stl/stdint.h"
+#include "fl/stl/string.h"
+#include "fl/stl/string_view.h"
+#include "fl/stl/span.h"
+#include "fl/stl/vector.h"
+#include "fl/stl/noexcept.h"
+
+// =============================================================================
+// MessagePack codec for the binary RPC framing
+// =============================================================================
+//
+// Compact binary alternative to the JSON encoding used by fl::Rpc. Requests
+// are bound straight from the wire (see msgpack_arg_converter.h): no fl::json
+// DOM is built, strings are read as string_views and `bin` values as spans
+// into the request buffer, so a method taking fl::span<const u8> gets the
+// frame's pixel data without a copy or a base64 round-trip.
+//
+// Envelope (a MessagePack map, keys in any order):
+//   request:  {"method": str, "params": [...], "id": any, "timestamp": uint}
+//   response: {"id": any, "result": value}
+//          or {"id": any, "error": {"code": int, "message": str}}
+//   "params", "id" and "timestamp" are optional, as in the JSON protocol;
+//   responses may also carry "warnings": [str, ...].
+//
+// Only the subset of MessagePack needed for RPC is produced. The reader
+// accepts every format family (ext values can be skipped but not bound).
+
+namespace fl {
+
+// =============================================================================
+// MsgPackWriter - Appends MessagePack values to a byte vector
+// =============================================================================
+
+class MsgPackWriter {
+public:
+    MsgPackWriter() FL_NOEXCEPT = default;
+    /// Write into an existing buffer (cleared first, capacity kept)
+    explicit MsgPackWriter(fl::vector<u8>&& buffer) FL_NOEXCEPT {
+        mBuffer.swap(buffer);
+        mBuffer.clear();
+    }
+
+    void writeNil();
+    void writeBool(bool value);
+    void writeInt(i64 value);    ///< Smallest encoding that holds the value
+    void writeUInt(u64 value);
+    void writeFloat(float value);
+    void writeDouble(double value);
+    void writeString(fl::string_view value);
+    void writeBinary(fl::span<const u8> value);
+    void writeArrayHeader(fl::size count);  ///< Follow with `count` values
+    void writeMapHeader(fl::size count);    ///< Follow with `count` key/value pairs
+
+    /// Append pre-encoded MessagePack (e.g. a request id echoed back)
+    void writeRaw(fl::span<const u8> encoded);
+
+    /// Encode a json value (objects become maps, arrays become arrays)
+    void writeJson(const fl::json& value);
+
+    fl::size size() const { return mBuffer.size(); }
+    void truncate(fl::size size) { mBuffer.resize(size); }
+    void clear() { mBuffer.clear(); }
+    void reserve(fl::size bytes) { mBuffer.reserve(bytes); }
+
+    fl::span<const u8> data() const { return mBuffer; }
+    fl::vector<u8>& buffer() { return mBuffer; }
+
+private:
+    void put(u8 byte) { mBuffer.push_back(byte); }
+    void putBE(u64 value, int bytes);
+
+    fl::vector<u8> mBuffer;
+};
+
+// =============================================================================
+// MsgPackReader - Cursor over an encoded MessagePack buffer
+// =============================================================================
+//
+// All read*() calls consume one value and return false (leaving the cursor
+// where it was) if the next value has a different type or is truncated.
+
+class MsgPackReader {
+public:
+    enum class Type {
+        Nil,
+        Bool,
+        Int,
+        Float,
+        String,
+        Binary,
+        Array,
+        Map,
+        Ext,
+        Invalid  ///< End of buffer or reserved byte (0xC1)
+    };
+
+    MsgPackReader() FL_NOEXCEPT = default;
+    explicit MsgPackReader(fl::span<const u8> data) FL_NOEXCEPT : mData(data) {}
+
+    Type peekType() const;
+
+    bool readNil();
+    bool readBool(bool* out);
+    /// Any integer encoding; fails for uint64 values above INT64_MAX
+    bool readInt(i64* out);
+    /// float32 or float64 (use peekType() to accept integers as well)
+    bool readFloat(double* out);
+    /// Zero-copy: the view points into the reader's buffer
+    bool readString(fl::string_view* out);
+    /// Zero-copy: the span points into the reader's buffer
+    bool readBinary(fl::span<const u8>* out);
+    bool readArrayHeader(fl::size* count);
+    bool readMapHeader(fl::size* count);
+
+    /// Skip one complete value (containers included)
+    bool skip();
+
+    /// Skip one value and return its encoded bytes
+    bool readRaw(fl::span<const u8>* out);
+
+    /// Decode one value into a json DOM (bin values become base64 strings,
+    /// matching how the JSON protocol carries byte vectors)
+    bool readJson(fl::json* out);
+
+    bool atEnd() const { return mPos >= mData.size(); }
+    fl::size position() const { return mPos; }
+    /// Bytes left in the buffer; every value takes at least one
+    fl::size remaining() const { return atEnd() ? 0 : mData.size() - mPos; }
+
+private:
+    bool readLength(u8 fix_tag, u8 fix_mask, u8 marker8, u8 marker16,
+                    u8 marker32, fl::size* length);
+    bool take(fl::size bytes, const u8** out);
+    bool readBE(int bytes, u64* out);
+    bool skipDepth(int depth);
+    bool readJsonDepth(fl::json* out, int depth);
+
+    fl::span<const u8> mData;
+    fl::size mPos = 0;
+};
+
+// =============================================================================
+// MsgPackRequest - RPC request envelope, parsed without building a DOM
+// =============================================================================
+
+struct MsgPackRequest {
+    fl::string_view method;     ///< Points into the request buffer
+    fl::span<const u8> params;  ///< Encoded params array (empty if absent)
+    fl::span<const u8> id;      ///< Encoded id value (empty for notifications)
+    u32 timestamp = 0;          ///< 0 = run immediately
+
+    bool hasId() const { return !id.empty(); }
+};
+
+/// Parse the request envelope. On failure returns false and sets *error.
+bool parseMsgPackRequest(fl::span<const u8> frame, MsgPackRequest* out,
+                         const char** error);
+
+/// Write an error response: {"id": id, "error": {"code": code, "message": message}}
+/// @param id Encoded request id (omitted when empty)
+void writeMsgPackError(MsgPackWriter& out, fl::span<const u8> id, int code,
+                       fl::string_view message);
+
+/// Re-encode a JSON-RPC response object, dropping "jsonrpc" and internal
+/// "__" markers
+void writeMsgPackResponse(MsgPackWriter& out, const fl::json& response);
+
+} // namespace fl
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "fl/stl/stdint.h"
+#include "fl/stl/string.h"
+#include "fl/stl/tuple.h"
+#include "fl/stl/type_traits.h"
+#include "fl/remote/rpc/json_arg_converter.h"
+#include "fl/remote/rpc/msgpack.h"
+#include "fl/remote/rpc/msgpack_to_type.h"
+#include "fl/remote/rpc/type_conversion_result.h"
+#include "fl/stl/span.h"
+
+namespace fl {
+
+// Type mapper for MessagePack parameters. Same as rpc_storage_type, except
+// that span<const u8> is stored as-is: it views the request frame instead of
+// owning a copy.
+template <typename T>
+struct msgpack_storage_type {
+    using type = typename rpc_storage_type<T>::type;
+};
+
+template <>
+struct msgpack_storage_type<fl::span<const fl::u8>> {
+    using type = fl::span<const fl::u8>;
+};
+
+template <>
+struct msgpack_storage_type<const fl::span<const fl::u8>&> {
+    using type = fl::span<const fl::u8>;
+};
+
+// =============================================================================
+// MsgPackArgConverter - Bind a MessagePack params array to a typed tuple
+// =============================================================================
+
+template <typename Signature>
+class MsgPackArgConverter;
+
+template <typename R, typename... Args>
+class MsgPackArgConverter<R(Args...)> {
+public:
+    using args_tuple = fl::tuple<typename msgpack_storage_type<Args>::type...>;
+
+    /// @param params Reader positioned on the params array (or at its end
+    ///        when the request had none)
+    /// @param tuple Receives the arguments; untouched past the first error
+    static TypeConversionResult convert(MsgPackReader& params, args_tuple& tuple) {
+        TypeConversionResult result;
+        fl::size count = 0;
+        if (!params.atEnd() && !params.readArrayHeader(&count)) {
+            result.setError("arguments must be an array");
+            return result;
+        }
+        if (count != sizeof...(Args)) {
+            result.setError("argument count mismatch: expected " +
+                           fl::to_string(static_cast<i64>(sizeof...(Args))) +
+                           ", got " + fl::to_string(static_cast<i64>(count)));
+            return result;
+        }
+        convertArgs(params, tuple, result, make_index_sequence<sizeof...(Args)>{});
+        return result;
+    }
+
+private:
+    template <fl::size... Is>
+    static void convertArgs(MsgPackReader& params, args_tuple& tuple,
+                            TypeConversionResult& result, index_sequence<Is...>) {
+        // Braced init list: evaluated in order, like the wire layout
+        int dummy[] = {0, (convertArg<Is>(params, tuple, result), 0)...};
+        (void)dummy;
+    }
+
+    template <fl::size I>
+    static void convertArg(MsgPackReader& params, args_tuple& tuple, TypeConversionResult& result) {
+        if (result.hasError()) return;
+
+        using StorageType = typename fl::tuple_element<I, args_tuple>::type;
+        fl::tuple<StorageType, TypeConversionResult> convTuple =
+            detail::MsgPackToType<StorageType>::convert(params);
+        fl::get<I>(tuple) = fl::move(fl::get<0>(convTuple));
+        const TypeConversionResult& convResult = fl::get<1>(convTuple);
+
+        // Add argument index to warnings/errors
+        for (fl::size i = 0; i < convResult.warnings().size(); i++) {
+            result.addWarning("arg " + fl::to_string(static_cast<i64>(I)) + ": " + convResult.warnings()[i]);
+        }
+        if (convResult.hasError()) {
+            result.setError("arg " + fl::to_string(static_cast<i64>(I)) + ": " + convResult.errorMessage());
+        }
+    }
+};
+
+// Specialization for R() - no arguments
+template <typename R>
+class MsgPackArgConverter<R()> {
+public:
+    using args_tuple = fl::tuple<>;
+
+    static TypeConversionResult convert(MsgPackReader& params, args_tuple&) {
+        TypeConversionResult result;
+        fl::size count = 0;
+        if (!params.atEnd() && !params.readArrayHeader(&count)) {
+            result.setError("arguments must be an array");
+        } else if (count != 0) {
+            result.setError("argument count mismatch: expected 0, got " +
+                           fl::to_string(static_cast<i64>(count)));
+        }
+        return result;
+    }
+};
+
+} // namespace fl
@@ -0,0 +1,340 @@
+#pragma once
+
+#include "fl/stl/json.h"
+#include "fl/remote/rpc/msgpack.h"
+#include "fl/remote/rpc/json_to_type.h"
+#include "fl/remote/rpc/type_conversion_result.h"
+#include "fl/remote/rpc/type_to_json.h"
+#include "fl/stl/tuple.h"
+#include "fl/stl/type_traits.h"
+#include "fl/stl/string.h"
+#include "fl/stl/move.h"
+#include "fl/stl/vector.h"
+#include "fl/stl/span.h"
+
+namespace fl {
+namespace detail {
+
+// =============================================================================
+// MsgPackToType - Bind one MessagePack value to a C++ type
+// =============================================================================
+//
+// Mirrors JsonToType: numeric coercions (int <-> float <-> bool) succeed with
+// a warning, anything else is an error. Strings are never parsed as numbers;
+// the binary encoding is typed, so a string where a number belongs is a
+// client bug.
+
+inline fl::string msgPackTypeName(MsgPackReader::Type type) {
+    switch (type) {
+    case MsgPackReader::Type::Nil: return "nil";
+    case MsgPackReader::Type::Bool: return "bool";
+    case MsgPackReader::Type::Int: return "integer";
+    case MsgPackReader::Type::Float: return "float";
+    case MsgPackReader::Type::String: return "string";
+    case MsgPackReader::Type::Binary: return "binary";
+    case MsgPackReader::Type::Array: return "array";
+    case MsgPackReader::Type::Map: return "map";
+    case MsgPackReader::Type::Ext: return "ext";
+    case MsgPackReader::Type::Invalid: break;
+    }
+    return "invalid value";
+}
+
+inline TypeConversionResult msgPackTypeError(const char* expected, MsgPackReader::Type got) {
+    return TypeConversionResult::error(fl::string("expected ") + expected + ", got " +
+                                       msgPackTypeName(got));
+}
+
+// Array header claiming more elements than the frame has bytes left.
+inline TypeConversionResult msgPackCountError(fl::size count, fl::size remaining) {
+    return TypeConversionResult::error("array of " + fl::to_string(static_cast<fl::i64>(count)) +
+                                       " elements exceeds the " +
+                                       fl::to_string(static_cast<fl::i64>(remaining)) +
+                                       " bytes left in the frame");
+}
+
+// Read any number as double; `kind` reports what was on the wire.
+inline bool msgPackReadNumber(MsgPackReader& r, double* out, MsgPackReader::Type* kind) {
+    *kind = r.peekType();
+    if (*kind == MsgPackReader::Type::Int) {
+        i64 i = 0;
+        if (!r.readInt(&i)) return false;
+        *out = static_cast<double>(i);
+        return true;
+    }
+    if (*kind == MsgPackReader::Type::Float) {
+        return r.readFloat(out);
+    }
+    if (*kind == MsgPackReader::Type::Bool) {
+        bool b = false;
+        if (!r.readBool(&b)) return false;
+        *out = b ? 1.0 : 0.0;
+        return true;
+    }
+    return false;
+}
+
+// Primary template: decode to json, then reuse the JSON converter. Keeps
+// every type JsonToType knows usable over the binary encoding.
+template <typename T, typename Enable = void>
+struct MsgPackToType {
+    static fl::tuple<T, TypeConversionResult> convert(MsgPackReader& r) {
+        fl::json value;
+        if (!r.readJson(&value)) {
+            return fl::make_tuple(T(), msgPackTypeError("value", r.peekType()));
+        }
+        return JsonToType<T>::convert(value);
+    }
+};
+
+// Integers (excluding bool)
+template <typename T>
+struct MsgPackToType<T, typename fl::enable_if<fl::is_integral<T>::value && !fl::is_same<T, bool>::value>::type> {
+    static fl::tuple<T, TypeConversionResult> convert(MsgPackReader& r) {
+        TypeConversionResult result;
+        const MsgPackReader::Type kind = r.peekType();
+        if (kind == MsgPackReader::Type::Int) {
+            i64 raw = 0;
+            if (!r.readInt(&raw)) {
+                return fl::make_tuple(T(), TypeConversionResult::error("integer out of range"));
+            }
+            T value = static_cast<T>(raw);
+            if (static_cast<i64>(value) != raw) {
+                result.addWarning("integer overflow/truncation: " + fl::to_string(raw) +
+                                  " converted to " + fl::to_string(static_cast<i64>(value)));
+            }
+            return fl::make_tuple(value, result);
+        }
+        double number = 0.0;
+        MsgPackReader::Type got;
+        if (!msgPackReadNumber(r, &number, &got)) {
+            return fl::make_tuple(T(), msgPackTypeError("integer", kind));
+        }
+        T value = static_cast<T>(number);
+        if (got == MsgPackReader::Type::Bool) {
+            result.addWarning("bool converted to int " + fl::to_string(static_cast<i64>(value)));
+        } else if (static_cast<double>(value) != number) {
+            result.addWarning("float " + fl::to_string(number) + " truncated to int " +
+                              fl::to_string(static_cast<i64>(value)));
+        }
+        return fl::make_tuple(value, result);
+    }
+};
+
+template <>
+struct MsgPackToType<bool, void> {
+    static fl::tuple<bool, TypeConversionResult> convert(MsgPackReader& r) {
+        TypeConversionResult result;
+        bool value = false;
+        if (r.readBool(&value)) {
+            return fl::make_tuple(value, result);
+        }
+        double number = 0.0;
+        MsgPackReader::Type got;
+        if (!msgPackReadNumber(r, &number, &got)) {
+            return fl::make_tuple(false, msgPackTypeError("bool", r.peekType()));
+        }
+        value = number != 0.0;
+        result.addWarning(fl::string(msgPackTypeName(got)) + " converted to bool " +
+                          (value ? "true" : "false"));
+        return fl::make_tuple(value, result);
+    }
+};
+
+template <typename T>
+struct MsgPackToType<T, typename fl::enable_if<fl::is_floating_point<T>::value>::type> {
+    static fl::tuple<T, TypeConversionResult> convert(MsgPackReader& r) {
+        TypeConversionResult result;
+        const MsgPackReader::Type kind = r.peekType();
+        double number = 0.0;
+        MsgPackReader::Type got;
+        if (!msgPackReadNumber(r, &number, &got)) {
+            return fl::make_tuple(T(), msgPackTypeError("float", kind));
+        }
+        if (got == MsgPackReader::Type::Bool) {
+            result.addWarning("bool converted to float");
+        }
+        return fl::make_tuple(static_cast<T>(number), result);
+    }
+};
+
+template <>
+struct MsgPackToType<fl::string, void> {
+    static fl::tuple<fl::string, TypeConversionResult> convert(MsgPackReader& r) {
+        fl::string_view view;
+        if (!r.readString(&view)) {
+            return fl::make_tuple(fl::string(), msgPackTypeError("string", r.peekType()));
+        }
+        return fl::make_tuple(fl::string(view), TypeConversionResult());
+    }
+};
+
+template <>
+struct MsgPackToType<fl::ConstCharPtrWrapper, void> {
+    static fl::tuple<fl::ConstCharPtrWrapper, TypeConversionResult> convert(MsgPackReader& r) {
+        auto str = MsgPackToType<fl::string>::convert(r);
+        return fl::make_tuple(fl::ConstCharPtrWrapper(fl::move(fl::get<0>(str))), fl::get<1>(str));
+    }
+};
+
+template <>
+struct MsgPackToType<fl::json, void> {
+    static fl::tuple<fl::json, TypeConversionResult> convert(MsgPackReader& r) {
+        fl::json value;
+        if (!r.readJson(&value)) {
+            return fl::make_tuple(fl::json(), msgPackTypeError("value", r.peekType()));
+        }
+        return fl::make_tuple(value, TypeConversionResult());
+    }
+};
+
+// Zero-copy byte view: `bin` payloads are handed out as a span into the
+// request frame, valid for the duration of the call.
+template <>
+struct MsgPackToType<fl::span<const fl::u8>, void> {
+    static fl::tuple<fl::span<const fl::u8>, TypeConversionResult> convert(MsgPackReader& r) {
+        fl::span<const fl::u8> bytes;
+        if (!r.readBinary(&bytes)) {
+            return fl::make_tuple(bytes, msgPackTypeError("binary", r.peekType()));
+        }
+        return fl::make_tuple(bytes, TypeConversionResult());
+    }
+};
+
+// Arrays of T
+template <typename T>
+struct MsgPackToType<fl::vector<T>, void> {
+    static fl::tuple<fl::vector<T>, TypeConversionResult> convert(MsgPackReader& r) {
+        TypeConversionResult result;
+        fl::vector<T> vec;
+        fl::size count = 0;
+        if (!r.readArrayHeader(&count)) {
+            return fl::make_tuple(fl::move(vec), msgPackTypeError("array", r.peekType()));
+        }
+        if (count > r.remaining()) {
+            return fl::make_tuple(fl::move(vec), msgPackCountError(count, r.remaining()));
+        }
+        vec.reserve(count);
+        for (fl::size i = 0; i < count; i++) {
+            auto elem = MsgPackToType<T>::convert(r);
+            if (fl::get<1>(elem).hasError()) {
+                result.setError("element " + fl::to_string(static_cast<fl::i64>(i)) + ": " +
+                                fl::get<1>(elem).errorMessage());
+                return fl::make_tuple(fl::vector<T>(), result);
+            }
+            vec.push_back(fl::move(fl::get<0>(elem)));
+        }
+        return fl::make_tuple(fl::move(vec), result);
+    }
+};
+
+// Byte vectors take `bin` (one copy) or an integer array
+template <>
+struct MsgPackToType<fl::vector<fl::u8>, void> {
+    static fl::tuple<fl::vector<fl::u8>, TypeConversionResult> convert(MsgPackReader& r) {
+        fl::span<const fl::u8> bytes;
+        if (r.readBinary(&bytes)) {
+            return fl::make_tuple(fl::vector<fl::u8>(bytes.begin(), bytes.end()), TypeConversionResult());
+        }
+        if (r.peekType() != MsgPackReader::Type::Array) {
+            return fl::make_tuple(fl::vector<fl::u8>(), msgPackTypeError("binary or integer array", r.peekType()));
+        }
+        fl::size count = 0;
+        fl::vector<fl::u8> vec;
+        if (!r.readArrayHeader(&count)) {
+            return fl::make_tuple(fl::move(vec), msgPackTypeError("array", r.peekType()));
+        }
+        if (count > r.remaining()) {
+            return fl::make_tuple(fl::move(vec), msgPackCountError(count, r.remaining()));
+        }
+        vec.reserve(count);
+        for (fl::size i = 0; i < count; i++) {
+            auto elem = MsgPackToType<fl::u8>::convert(r);
+            if (fl::get<1>(elem).hasError()) {
+                TypeConversionResult result;
+                result.setError("element " + fl::to_string(static_cast<fl::i64>(i)) + ": " +
+                                fl::get<1>(elem).errorMessage());
+                return fl::make_tuple(fl::vector<fl::u8>(), result);
+            }
+            vec.push_back(fl::get<0>(elem));
+        }
+        return fl::make_tuple(fl::move(vec), TypeConversionResult());
+    }
+};
+
+template <typename T>
+struct MsgPackToType<fl::ConstSpanWrapper<T>, void> {
+    static fl::tuple<fl::ConstSpanWrapper<T>, TypeConversionResult> convert(MsgPackReader& r) {
+        auto vec = MsgPackToType<fl::vector<T>>::convert(r);
+        return fl::make_tuple(fl::ConstSpanWrapper<T>(fl::move(fl::get<0>(vec))), fl::get<1>(vec));
+    }
+};
+
+// =============================================================================
+// TypeToMsgPack - Encode a return value
+// =============================================================================
+
+// Primary template: go through the JSON conversion (covers every type that
+// TypeToJson supports).
+template <typename T, typename Enable = void>
+struct TypeToMsgPack {
+    static void write(MsgPackWriter& w, const T& value) {
+        w.writeJson(TypeToJson<T>::convert(value));
+    }
+};
+
+template <typename T>
+struct TypeToMsgPack<T, typename fl::enable_if<fl::is_integral<T>::value && !fl::is_same<T, bool>::value>::type> {
+    static void write(MsgPackWriter& w, const T& value) {
+        w.writeInt(static_cast<i64>(value));
+    }
+};
+
+template <>
+struct TypeToMsgPack<bool, void> {
+    static void write(MsgPackWriter& w, const bool& value) {
+        w.writeBool(value);
+    }
+};
+
+template <typename T>
+struct TypeToMsgPack<T, typename fl::enable_if<fl::is_floating_point<T>::value>::type> {
+    static void write(MsgPackWriter& w, const T& value) {
+        w.writeFloat(static_cast<float>(value));
+    }
+};
+
+template <>
+struct TypeToMsgPack<fl::string, void> {
+    static void write(MsgPackWriter& w, const fl::string& value) {
+        w.writeString(value);
+    }
+};
+
+template <>
+struct TypeToMsgPack<fl::json, void> {
+    static void write(MsgPackWriter& w, const fl::json& value) {
+        w.writeJson(value);
+    }
+};
+
+// Byte vectors go out as `bin` instead of base64
+template <>
+struct TypeToMsgPack<fl::vector<fl::u8>, void> {
+    static void write(MsgPackWriter& w, const fl::vector<fl::u8>& value) {
+        w.writeBinary(value);
+    }
+};
+
+template <typename T>
+struct TypeToMsgPack<fl::vector<T>, void> {
+    static void write(MsgPackWriter& w, const fl::vector<T>& value) {
+        w.writeArrayHeader(value.size());
+        for (fl::size i = 0; i < value.size(); i++) {
+            TypeToMsgPack<T>::write(w, value[i]);
+        }
+    }
+};
+
+} // namespace detail
+} // namespace fl
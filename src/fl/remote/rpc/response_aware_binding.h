@@ -55,6 +55,14 @@ public:
         return binding.invokeWithReturn(args);
     }
 
+    TypeConversionResult invokeMsgPack(MsgPackReader& params, MsgPackWriter& out) override {
+        ResponseSend responseSend(mRequestId, mResponseSink);
+        TypedRpcBinding<R(Args...)> binding([this, &responseSend](Args... cppArgs) -> R {
+            return mFn(responseSend, fl::forward<Args>(cppArgs)...);
+        });
+        return binding.invokeMsgPack(params, out);
+    }
+
 private:
     fl::function<R(ResponseSend&, Args...)> mFn;
     fl::json mRequestId;
@@ -84,6 +92,14 @@ public:
         return fl::make_tuple(result, json(nullptr));
     }
 
+    TypeConversionResult invokeMsgPack(MsgPackReader& params, MsgPackWriter& out) override {
+        ResponseSend responseSend(mRequestId, mResponseSink);
+        TypedRpcBinding<void(Args...)> binding([this, &responseSend](Args... cppArgs) -> void {
+            mFn(responseSend, fl::forward<Args>(cppArgs)...);
+        });
+        return binding.invokeMsgPack(params, out);
+    }
+
 private:
     fl::function<void(ResponseSend&, Args...)> mFn;
     fl::json mRequestId;
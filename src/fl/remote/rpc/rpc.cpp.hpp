@@ -5,13 +5,14 @@
 #include "fl/remote/rpc/rpc_invokers.h"
 #include "fl/remote/rpc/rpc_registry.h"
 #include "fl/remote/rpc/response_send.h"
+#include "fl/remote/rpc/msgpack.h"
 #include "fl/remote/rpc/type_conversion_result.h"
 #include "fl/stl/optional.h"
 #include "fl/stl/shared_ptr.h"
 #include "fl/stl/string.h"
 #include "fl/stl/strstream.h"
 #include "fl/stl/tuple.h"
-#include "fl/stl/unordered_map.h"
+#include "fl/stl/swiss_map.h"
 #include "fl/stl/vector.h"
 
 namespace fl {
@@ -50,6 +51,10 @@ void Rpc::bindAsync(const char* name,
             // Should not be called - handle() will call mResponseAwareFn directly
             return fl::make_tuple(TypeConversionResult::success(), json(nullptr));
         }
+        TypeConversionResult invokeMsgPack(MsgPackReader&, MsgPackWriter&) override {
+            // Not called either - bindsMsgPackDirectly() routes these through handle()
+            return TypeConversionResult::error("response-aware methods need the JSON path");
+        }
     };
     entry.mInvoker = fl::make_shared<PlaceholderInvoker>();
 
@@ -85,6 +90,22 @@ json Rpc::handle(const json& request) {
         return response;
     }
 
+    // Handle built-in rpc.encodings method (wire encodings this peer accepts)
+    if (methodName == "rpc.encodings") {
+        json encodings = json::array();
+        encodings.push_back(json("json"));
+        if (mMsgPackEnabled) {
+            encodings.push_back(json("msgpack"));
+        }
+        json response = json::object();
+        response.set("jsonrpc", "2.0");
+        response.set("result", encodings);
+        if (request.contains("id")) {
+            response.set("id", request["id"]);
+        }
+        return response;
+    }
+
     // Look up the method
     auto it = mRegistry.find(methodName);
     if (it == mRegistry.end()) {
@@ -201,6 +222,79 @@ fl::optional<json> Rpc::handle_maybe(const json& request) {
     return handle(request);
 }
 
+// =============================================================================
+// Rpc::handleMsgPack() - Process MessagePack requests
+// =============================================================================
+
+bool Rpc::bindsMsgPackDirectly(fl::string_view method) const {
+    auto it = mRegistry.find(fl::string(method));
+    if (it == mRegistry.end()) {
+        return false;
+    }
+    return it->second.mMode == RpcMode::SYNC && !it->second.mIsResponseAware;
+}
+
+bool Rpc::handleMsgPack(fl::span<const u8> request, fl::vector<u8>* response) {
+    MsgPackWriter out(fl::move(*response));
+    bool reply = true;
+
+    MsgPackRequest req;
+    const char* error = nullptr;
+    if (!parseMsgPackRequest(request, &req, &error)) {
+        FL_ERROR("RPC: Invalid MessagePack request - " << error);
+        writeMsgPackError(out, req.id, -32600, fl::string("Invalid Request: ") + error);
+    } else if (!bindsMsgPackDirectly(req.method)) {
+        // Built-ins, unknown methods and async methods: JSON semantics
+        MsgPackReader reader(request);
+        json jsonRequest;
+        if (!reader.readJson(&jsonRequest)) {
+            writeMsgPackError(out, req.id, -32600, "Invalid Request: unsupported value");
+        } else {
+            fl::optional<json> jsonResponse = handle_maybe(jsonRequest);
+            reply = jsonResponse.has_value() && !jsonResponse->contains("__async");
+            if (reply) {
+                writeMsgPackResponse(out, *jsonResponse);
+            }
+        }
+    } else {
+        const detail::RpcEntry& entry = mRegistry.find(fl::string(req.method))->second;
+
+        // {"id": ..., "result": ...[, "warnings": [...]]}; the map header is
+        // patched once the field count is known (fixmap, one byte).
+        out.writeMapHeader(0);
+        u8 fields = 0;
+        if (req.hasId()) {
+            out.writeString("id");
+            out.writeRaw(req.id);
+            ++fields;
+        }
+        out.writeString("result");
+        ++fields;
+        MsgPackReader params(req.params);
+        TypeConversionResult convResult = entry.mInvoker->invokeMsgPack(params, out);
+        if (!convResult.ok()) {
+            FL_ERROR("RPC: Invalid params for method '" << fl::string(req.method).c_str()
+                     << "': " << convResult.errorMessage().c_str());
+            out.clear();
+            writeMsgPackError(out, req.id, -32602, "Invalid params: " + convResult.errorMessage());
+        } else {
+            if (convResult.hasWarning()) {
+                out.writeString("warnings");
+                out.writeArrayHeader(convResult.warnings().size());
+                for (fl::size i = 0; i < convResult.warnings().size(); ++i) {
+                    out.writeString(convResult.warnings()[i]);
+                }
+                ++fields;
+            }
+            out.buffer()[0] = static_cast<u8>(0x80 | fields);
+        }
+        reply = req.hasId();
+    }
+
+    *response = fl::move(out.buffer());
+    return reply;
+}
+
 // =============================================================================
 // Rpc::tags() - Returns list of unique tags
 // =============================================================================
@@ -68,6 +68,10 @@
 //   fl::json request = fl::json::parse(R"({"method":"rpc.discover","id":1})");
 //   fl::json response = rpc.handle(request);  // Returns flat schema
 //
+//   // MessagePack transport (same methods, binary envelope - see msgpack.h)
+//   fl::vector<fl::u8> reply;
+//   if (rpc.handleMsgPack(frame, &reply)) { send(reply); }
+//
 // =============================================================================
 
 #include "fl/stl/json.h"  // IWYU pragma: keep
@@ -75,6 +79,7 @@
 #include "fl/remote/rpc/rpc_handle.h"
 #include "fl/remote/rpc/rpc_registry.h"
 #include "fl/remote/rpc/rpc_mode.h"
+#include "fl/remote/rpc/msgpack.h"
 
 // STL headers required for public API
 #include "fl/stl/stdint.h"
@@ -83,7 +88,7 @@
 #include "fl/stl/optional.h"
 #include "fl/stl/expected.h"
 #include "fl/stl/function.h"
-#include "fl/stl/unordered_map.h"
+#include "fl/stl/swiss_map.h"
 #include "fl/stl/type_traits.h"
 #include "fl/stl/initializer_list.h"  // IWYU pragma: keep
 #include "fl/stl/noexcept.h"
@@ -316,6 +321,28 @@ public:
     /// For notifications (no id), returns nullopt.
     fl::optional<json> handle_maybe(const json& request);
 
+    // =========================================================================
+    // MessagePack Transport
+    // =========================================================================
+
+    /// Process a MessagePack request (envelope described in msgpack.h).
+    /// SYNC typed methods bind their arguments straight from the frame; other
+    /// methods (async, bindAsync(), built-ins) go through handle() and have
+    /// their JSON response re-encoded. Async ACKs still use the response sink.
+    /// @param response Receives the encoded response (its capacity is reused)
+    /// @returns false when there is nothing to send back (notification, or
+    ///          an async method whose ACK went out through the response sink)
+    bool handleMsgPack(fl::span<const u8> request, fl::vector<u8>* response);
+
+    /// True if handleMsgPack() binds this method's arguments from the frame
+    /// directly (registered, SYNC, not response-aware)
+    bool bindsMsgPackDirectly(fl::string_view method) const;
+
+    /// Advertise MessagePack in the built-in "rpc.encodings" method. Set by
+    /// the transport that carries binary frames (see Remote::setMsgPackTransport).
+    void setMsgPackEnabled(bool enabled) { mMsgPackEnabled = enabled; }
+    bool msgPackEnabled() const { return mMsgPackEnabled; }
+
     // =========================================================================
     // Schema and Discovery
     // =========================================================================
@@ -374,8 +401,9 @@ public:
     }
 
 private:
-    fl::unordered_map<fl::string, detail::RpcEntry> mRegistry;
+    fl::swiss_map<fl::string, detail::RpcEntry> mRegistry;
     fl::function<void(const fl::json&)> mResponseSink;  // For sending ACK responses
+    bool mMsgPackEnabled = false;
 };
 
 // RpcFactory is kept as an alias for backwards compatibility
@@ -32,6 +32,10 @@ class ErasedInvoker {
 public:
     virtual ~ErasedInvoker() FL_NOEXCEPT = default;
     virtual fl::tuple<TypeConversionResult, json> invoke(const json& args) = 0;
+
+    /// Binary transport: bind arguments from MessagePack and, on success,
+    /// write exactly one result value to `out`
+    virtual TypeConversionResult invokeMsgPack(MsgPackReader& params, MsgPackWriter& out) = 0;
 };
 
 // =============================================================================
@@ -89,6 +93,10 @@ public:
         return mBinding.invokeWithReturn(args);
     }
 
+    TypeConversionResult invokeMsgPack(MsgPackReader& params, MsgPackWriter& out) override {
+        return mBinding.invokeMsgPack(params, out);
+    }
+
 private:
     TypedRpcBinding<R(Args...)> mBinding;
 };
@@ -104,6 +112,10 @@ public:
         return fl::make_tuple(result, json(nullptr));
     }
 
+    TypeConversionResult invokeMsgPack(MsgPackReader& params, MsgPackWriter& out) override {
+        return mBinding.invokeMsgPack(params, out);
+    }
+
 private:
     TypedRpcBinding<void(Args...)> mBinding;
 };
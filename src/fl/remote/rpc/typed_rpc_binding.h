@@ -8,6 +8,8 @@
 #include "fl/remote/rpc/type_conversion_result.h"
 #include "fl/remote/rpc/type_to_json.h"
 #include "fl/remote/rpc/json_arg_converter.h"
+#include "fl/remote/rpc/msgpack_arg_converter.h"
+#include "fl/remote/rpc/msgpack_to_type.h"
 
 namespace fl {
 
@@ -25,6 +27,7 @@ public:
     using FunctionType = fl::function<void(Args...)>;
     using Converter = JsonArgConverter<void(Args...)>;
     using StorageTuple = typename Converter::args_tuple;  // Stripped types for storage
+    using MsgPackConverter = MsgPackArgConverter<void(Args...)>;
 
     TypedRpcBinding(FunctionType fn) : mFunction(fn) {}
 
@@ -40,9 +43,22 @@ public:
         return result;
     }
 
+    // Binds arguments straight from the MessagePack params; on success writes
+    // the (nil) result to `out`, on failure writes nothing.
+    TypeConversionResult invokeMsgPack(MsgPackReader& params, MsgPackWriter& out) {
+        typename MsgPackConverter::args_tuple tuple{};
+        TypeConversionResult result = MsgPackConverter::convert(params, tuple);
+        if (!result.ok()) {
+            return result;
+        }
+        invokeImpl(tuple, make_index_sequence<sizeof...(Args)>{});
+        out.writeNil();
+        return result;
+    }
+
 private:
-    template <fl::size... Is>
-    void invokeImpl(StorageTuple& args, index_sequence<Is...>) {
+    template <typename Tuple, fl::size... Is>
+    void invokeImpl(Tuple& args, index_sequence<Is...>) {
         // fl::get returns T& from tuple<T>, which converts to const T& for const ref parameters
         mFunction(fl::get<Is>(args)...);
     }
@@ -57,6 +73,7 @@ public:
     using FunctionType = fl::function<R(Args...)>;
     using Converter = JsonArgConverter<R(Args...)>;
     using StorageTuple = typename Converter::args_tuple;  // Stripped types for storage
+    using MsgPackConverter = MsgPackArgConverter<R(Args...)>;
 
     TypedRpcBinding(FunctionType fn) : mFunction(fn) {}
 
@@ -85,15 +102,28 @@ public:
         return fl::make_tuple(result, jsonResult);
     }
 
+    // Binds arguments straight from the MessagePack params; on success writes
+    // the result to `out`, on failure writes nothing.
+    TypeConversionResult invokeMsgPack(MsgPackReader& params, MsgPackWriter& out) {
+        typename MsgPackConverter::args_tuple tuple{};
+        TypeConversionResult result = MsgPackConverter::convert(params, tuple);
+        if (!result.ok()) {
+            return result;
+        }
+        R returnValue = invokeImplWithReturn(tuple, make_index_sequence<sizeof...(Args)>{});
+        detail::TypeToMsgPack<R>::write(out, returnValue);
+        return result;
+    }
+
 private:
-    template <fl::size... Is>
-    void invokeImpl(StorageTuple& args, index_sequence<Is...>) {
+    template <typename Tuple, fl::size... Is>
+    void invokeImpl(Tuple& args, index_sequence<Is...>) {
         // fl::get returns T& from tuple<T>, which converts to const T& for const ref parameters
         mFunction(fl::get<Is>(args)...);
     }
 
-    template <fl::size... Is>
-    R invokeImplWithReturn(StorageTuple& args, index_sequence<Is...>) {
+    template <typename Tuple, fl::size... Is>
+    R invokeImplWithReturn(Tuple& args, index_sequence<Is...>) {
         // fl::get returns T& from tuple<T>, which converts to const T& for const ref parameters
         return mFunction(fl::get<Is>(args)...);
     }
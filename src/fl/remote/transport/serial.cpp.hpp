@@ -30,4 +30,31 @@ fl::string formatJsonResponse(const fl::json& response, const char* prefix) {
     return ss.str();
 }
 
+fl::vector<u8> formatMsgPackFrame(fl::span<const u8> payload) {
+    const u32 length = static_cast<u32>(payload.size());
+    fl::vector<u8> frame;
+    frame.reserve(payload.size() + 5);
+    frame.push_back(kSerialMsgPackMarker);
+    frame.push_back(static_cast<u8>(length >> 24));
+    frame.push_back(static_cast<u8>(length >> 16));
+    frame.push_back(static_cast<u8>(length >> 8));
+    frame.push_back(static_cast<u8>(length));
+    frame.insert(frame.end(), payload.begin(), payload.end());
+    return frame;
+}
+
+namespace detail {
+
+namespace {
+int gSerialMsgPackSources = 0;
+} // namespace
+
+SerialMsgPackSourceToken::SerialMsgPackSourceToken() { ++gSerialMsgPackSources; }
+
+SerialMsgPackSourceToken::~SerialMsgPackSourceToken() { --gSerialMsgPackSources; }
+
+bool serialMsgPackSourceActive() { return gSerialMsgPackSources > 0; }
+
+} // namespace detail
+
 } // namespace fl
@@ -23,9 +23,12 @@
 #include "fl/stl/function.h"
 #include "fl/stl/optional.h"
 #include "fl/stl/pair.h"
+#include "fl/stl/shared_ptr.h"
+#include "fl/stl/span.h"
 #include "fl/stl/string.h"
 #include "fl/stl/strstream.h"
 #include "fl/stl/string_view.h"
+#include "fl/stl/vector.h"
 
 namespace fl {
 
@@ -41,6 +44,33 @@ namespace fl {
 /// @note Generic JSON serialization - works for any JSON, not just JSON-RPC
 fl::string formatJsonResponse(const fl::json& response, const char* prefix = "");
 
+/// @brief First byte of a binary (MessagePack) frame on a serial link
+/// @note 0xC1 is never used by MessagePack and cannot start a JSON line, so
+///       JSON lines and binary frames can share one port
+constexpr u8 kSerialMsgPackMarker = 0xC1;
+
+/// @brief Wrap a MessagePack payload for the serial link
+/// @return Marker byte, 32-bit big-endian payload length, payload
+fl::vector<u8> formatMsgPackFrame(fl::span<const u8> payload);
+
+namespace detail {
+
+/// @brief Held by every live createSerialMsgPackTransport() source
+/// @note The JSON line source only leaves marker bytes in the input while at
+///       least one of these exists; otherwise nobody would ever consume them.
+class SerialMsgPackSourceToken {
+  public:
+    SerialMsgPackSourceToken();
+    ~SerialMsgPackSourceToken();
+    SerialMsgPackSourceToken(const SerialMsgPackSourceToken&) = delete;
+    SerialMsgPackSourceToken& operator=(const SerialMsgPackSourceToken&) = delete;
+};
+
+/// @brief True while a serial MessagePack source is alive
+bool serialMsgPackSourceActive();
+
+} // namespace detail
+
 // =============================================================================
 // Generic I/O Functions (Templated for Testability)
 // =============================================================================
@@ -55,6 +85,28 @@ fl::string formatJsonResponse(const fl::json& response, const char* prefix = "")
 template<typename SerialIn>
 fl::optional<fl::string> readSerialLine(SerialIn& serial, char delimiter = '\n', fl::optional<u32> timeoutMs = fl::nullopt);
 
+/// @brief Read one binary frame written by formatMsgPackFrame()
+/// @tparam SerialIn Type providing peek() and read() methods
+/// @param serial Serial input source
+/// @param maxBytes Largest accepted payload; checked against the header
+///        before any payload byte is read
+/// @param timeoutMs Time allowed for the rest of the frame once it has started
+/// @return Payload, or nullopt if the next byte is not a frame marker, the
+///         frame timed out, or it was too large
+/// @note A rejected or truncated frame is dropped by discarding input up to
+///       and including the next '\n', or up to the next marker byte, so the
+///       JSON source does not see the rest of it. Payload bytes after an
+///       embedded '\n' still reach the JSON source, which ignores lines that
+///       do not start with '{'.
+template<typename SerialIn>
+fl::optional<fl::vector<u8>> readSerialMsgPackFrame(SerialIn& serial, u32 maxBytes, u32 timeoutMs = 1000);
+
+/// @brief Discard buffered input up to the next line or frame boundary
+/// @note Consumes through the next '\n'; stops before a marker byte or when
+///       no more data is available (never blocks)
+template<typename SerialIn>
+void skipSerialToBoundary(SerialIn& serial);
+
 /// @brief Write a string with newline to a serial-like output
 /// @tparam SerialOut Type providing println() method
 /// @param serial Serial output destination
@@ -70,6 +122,7 @@ void writeSerialLine(SerialOut& serial, const fl::string& str);
 /// @note Works across all FastLED platforms (AVR, ESP32, STM32, host, etc.)
 struct SerialReader {
     int available() const { return fl::available(); }
+    int peek() { return fl::peek(); }
     int read() { return fl::read(); }
 };
 
@@ -114,6 +167,14 @@ createSerialRequestSource(const char* prefix = "") {
             return fl::nullopt;
         }
 
+        // Binary frames belong to the MessagePack source (see
+        // createSerialMsgPackTransport()), which Remote polls first. Without
+        // one, a marker byte is just noise and is stripped below.
+        const bool msgPackActive = detail::serialMsgPackSourceActive();
+        if (msgPackActive && fl::peek() == kSerialMsgPackMarker) {
+            return fl::nullopt;
+        }
+
         // Data available - read a complete line.
         // On Arduino platforms, fl::readLine() delegates to Serial.readStringUntil()
         // which uses yield() (immediate context switch) for fast USB CDC multi-packet
@@ -133,8 +194,10 @@ createSerialRequestSource(const char* prefix = "") {
             }
         }
 
-        // Trim leading whitespace
-        while (!view.empty() && fl::isspace(view.front())) {
+        // Trim leading whitespace (and stray marker bytes in JSON-only mode)
+        while (!view.empty() &&
+               (fl::isspace(view.front()) ||
+                (!msgPackActive && static_cast<u8>(view.front()) == kSerialMsgPackMarker))) {
             view.remove_prefix(1);
         }
 
@@ -183,6 +246,39 @@ createSerialTransport(const char* responsePrefix = "REMOTE: ", const char* reque
     return {createSerialRequestSource(requestPrefix), createSerialResponseSink(responsePrefix)};
 }
 
+/// @brief Create MessagePack source/sink callbacks for fl:: serial I/O
+/// @param maxFrameBytes Largest accepted request payload
+/// @return Pair suitable for fl::Remote::setMsgPackTransport()
+/// @note Shares the port with createSerialTransport(): binary frames start
+///       with kSerialMsgPackMarker, JSON lines with '{'. The JSON source
+///       leaves marker bytes alone only while the returned source is alive.
+///       Clients can check for "msgpack" in the "rpc.encodings" result
+///       before switching.
+///
+/// Example:
+/// @code
+/// fl::Remote remote(fl::createSerialRequestSource(), fl::createSerialResponseSink());
+/// auto binary = fl::createSerialMsgPackTransport();
+/// remote.setMsgPackTransport(binary.first, binary.second);
+/// @endcode
+inline fl::pair<fl::function<fl::optional<fl::vector<u8>>()>, fl::function<void(fl::span<const u8>)>>
+createSerialMsgPackTransport(u32 maxFrameBytes = 64 * 1024) {
+    fl::shared_ptr<detail::SerialMsgPackSourceToken> token =
+        fl::make_shared<detail::SerialMsgPackSourceToken>();
+    fl::function<fl::optional<fl::vector<u8>>()> source = [maxFrameBytes, token]() -> fl::optional<fl::vector<u8>> {
+        if (fl::available() <= 0) {
+            return fl::nullopt;
+        }
+        SerialReader serial;
+        return readSerialMsgPackFrame(serial, maxFrameBytes);
+    };
+    fl::function<void(fl::span<const u8>)> sink = [](fl::span<const u8> payload) {
+        fl::vector<u8> frame = formatMsgPackFrame(payload);
+        fl::write_bytes(frame.data(), frame.size());
+    };
+    return {source, sink};
+}
+
 // =============================================================================
 // Template Implementations
 // =============================================================================
@@ -241,6 +337,66 @@ fl::optional<fl::string> readSerialStringUntil(SerialIn& serial, char delimiter,
     return result;
 }
 
+template<typename SerialIn>
+fl::optional<fl::vector<u8>> readSerialMsgPackFrame(SerialIn& serial, u32 maxBytes, u32 timeoutMs) {
+    if (serial.peek() != kSerialMsgPackMarker) {
+        return fl::nullopt;
+    }
+    serial.read();
+
+    u32 startTime = fl::millis();
+    u32 length = 0;
+    for (int received = 0; received < 4;) {
+        if (fl::millis() - startTime >= timeoutMs) {
+            skipSerialToBoundary(serial);
+            return fl::nullopt;
+        }
+        int c = serial.read();
+        if (c == -1) {
+            fl::delayMicroseconds(1);
+            continue;
+        }
+        length = (length << 8) | static_cast<u8>(c);
+        ++received;
+    }
+
+    // Reject before reading: a corrupted length must not stall the link
+    if (length > maxBytes) {
+        skipSerialToBoundary(serial);
+        return fl::nullopt;
+    }
+
+    fl::vector<u8> payload;
+    payload.reserve(length);
+    while (payload.size() < length) {
+        if (fl::millis() - startTime >= timeoutMs) {
+            skipSerialToBoundary(serial);
+            return fl::nullopt;
+        }
+        int c = serial.read();
+        if (c == -1) {
+            fl::delayMicroseconds(1);
+            continue;
+        }
+        payload.push_back(static_cast<u8>(c));
+    }
+    return payload;
+}
+
+template<typename SerialIn>
+void skipSerialToBoundary(SerialIn& serial) {
+    while (true) {
+        int c = serial.peek();
+        if (c == -1 || c == kSerialMsgPackMarker) {
+            return;
+        }
+        serial.read();
+        if (c == '\n') {
+            return;
+        }
+    }
+}
+
 template<typename SerialOut>
 void writeSerialLine(SerialOut& serial, const fl::string& str) {
     serial.println(str.c_str());
@@ -16,6 +16,8 @@
 #include "fl/stl/ios.cpp.hpp"
 #include "fl/stl/istream.cpp.hpp"
 #include "fl/stl/json.cpp.hpp"
+#include "fl/stl/json_bind.cpp.hpp"
+#include "fl/stl/json_reader.cpp.hpp"
 #include "fl/stl/malloc.cpp.hpp"
 #include "fl/stl/memory_resource.cpp.hpp"
 #include "fl/stl/not_null.cpp.hpp"
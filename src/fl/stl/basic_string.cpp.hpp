@@ -1,5 +1,6 @@
 #include "fl/stl/basic_string.h"
 #include "fl/stl/cstring.h"
+#include "fl/stl/memory_resource.h"
 #include "fl/stl/noexcept.h"
 #include "fl/stl/span.h"
 #include "fl/stl/string_view.h"
@@ -18,6 +19,87 @@ basic_string::basic_string(fl::span<char, static_cast<fl::size>(-1)> storage) FL
 
 basic_string::~basic_string() FL_NOEXCEPT {}
 
+// ======= HEAP HOLDER ALLOCATION =======
+
+namespace {
+
+// The holder (and its control block) come from `resource` when it has room.
+// An exhausted resource falls back to a heap control block; the holder then
+// still tries the resource for the character buffer before using the heap.
+template <typename... Args>
+StringHolderPtr makeResourceHolder(memory_resource* resource, Args... args) {
+    StringHolderPtr holder =
+        fl::make_shared_with_resource<StringHolder>(resource, resource, args...);
+    if (!holder) {
+        holder = fl::make_shared<StringHolder>(resource, args...);
+    }
+    return holder;
+}
+
+} // namespace
+
+StringHolderPtr basic_string::makeHolder(fl::size len) const {
+    memory_resource* resource = get_resource();
+    if (resource) {
+        return makeResourceHolder(resource, len);
+    }
+    return fl::make_shared<StringHolder>(len);
+}
+
+StringHolderPtr basic_string::makeHolder(const char* str) const {
+    return makeHolder(str, fl::strlen(str));
+}
+
+StringHolderPtr basic_string::makeHolder(const char* str, fl::size len) const {
+    memory_resource* resource = get_resource();
+    if (resource) {
+        return makeResourceHolder(resource, str, len);
+    }
+    return fl::make_shared<StringHolder>(str, len);
+}
+
+bool basic_string::canShareHeapWith(const basic_string& other) const {
+    const StringHolderPtr& holder = other.heapData().get();
+    return holder->resource() == get_resource();
+}
+
+memory_resource* basic_string::get_resource() const {
+    if (mStorage.is<NotNullStringHolderPtr>()) {
+        return mStorage.get<NotNullStringHolderPtr>()->resource();
+    }
+    if (mStorage.is<InlineResource>()) {
+        return mStorage.get<InlineResource>().resource;
+    }
+    return nullptr;
+}
+
+void basic_string::set_resource(memory_resource* resource) {
+    if (isNonOwning()) {
+        materialize();
+    }
+    if (!hasHeapData()) {
+        setInline(resource);
+        return;
+    }
+    if (heapData()->resource() == resource) {
+        return;
+    }
+    // The holder records its resource, so re-home the content.
+    const NotNullStringHolderPtr& heap = heapData();
+    StringHolderPtr moved = resource
+        ? makeResourceHolder(resource, heap->data(), mLength)
+        : fl::make_shared<StringHolder>(heap->data(), mLength);
+    mStorage = NotNullStringHolderPtr(moved);
+}
+
+void basic_string::setInline(memory_resource* resource) {
+    if (resource) {
+        mStorage = InlineResource(resource);
+    } else {
+        mStorage.reset();
+    }
+}
+
 // ======= string_view CONSTRUCTOR FROM basic_string =======
 // Defined here (in the same TU as basic_string itself) so
 // string_view.h can stay light: it forward-declares basic_string
@@ -41,7 +123,7 @@ const char* basic_string::c_str() const {
 
 char* basic_string::c_str_mutable() {
     // Inline mode — already mutable
-    if (mStorage.empty()) {
+    if (isInline()) {
         return inlineBufferPtr();
     }
     struct Visitor {
@@ -51,7 +133,7 @@ char* basic_string::c_str_mutable() {
             if (heap.get().use_count() > 1) {
                 // COW: detach from shared data before returning mutable pointer
                 self->mStorage = NotNullStringHolderPtr(
-                    fl::make_shared<StringHolder>(heap->data(), self->mLength));
+                    self->makeHolder(heap->data(), self->mLength));
                 result = self->heapData()->data();
             } else {
                 result = heap->data();
@@ -67,6 +149,7 @@ char* basic_string::c_str_mutable() {
             result = self->hasHeapData() ? self->heapData()->data()
                                          : self->inlineBufferPtr();
         }
+        void accept(InlineResource&) { result = self->inlineBufferPtr(); }
     };
     Visitor v{this, nullptr};
     mStorage.visit(v);
@@ -175,7 +258,7 @@ void basic_string::materialize() {
             inlineBufferPtr()[len] = '\0';
             mStorage.reset();
         } else {
-            mStorage = NotNullStringHolderPtr(fl::make_shared<StringHolder>(data, len));
+            mStorage = NotNullStringHolderPtr(makeHolder(data, len));
         }
     } else if (mStorage.is<ConstView>()) {
         const ConstView& view = mStorage.get<ConstView>();
@@ -192,14 +275,14 @@ void basic_string::materialize() {
             inlineBufferPtr()[len] = '\0';
             mStorage.reset();
         } else {
-            mStorage = NotNullStringHolderPtr(fl::make_shared<StringHolder>(view.data, len));
+            mStorage = NotNullStringHolderPtr(makeHolder(view.data, len));
         }
     }
 }
 
 NotNullStringHolderPtr& basic_string::heapData() {
     if (!mStorage.is<NotNullStringHolderPtr>()) {
-        mStorage = NotNullStringHolderPtr(fl::make_shared<StringHolder>(0));
+        mStorage = NotNullStringHolderPtr(makeHolder(fl::size(0)));
     }
     return mStorage.get<NotNullStringHolderPtr>();
 }
@@ -238,7 +321,7 @@ fl::size basic_string::write(const char* str, fl::size n) {
             mStorage.reset();
             mLength = newLen;
         } else {
-            NotNullStringHolderPtr newData = NotNullStringHolderPtr(fl::make_shared<StringHolder>(newLen));
+            NotNullStringHolderPtr newData = NotNullStringHolderPtr(makeHolder(newLen));
             if (existingLen > 0 && existingData) {
                 fl::memcpy(newData->data(), existingData, existingLen);
             }
@@ -257,12 +340,13 @@ fl::size basic_string::write(const char* str, fl::size n) {
             // grow() uses realloc which can relocate the buffer.
             const char* bufStart = heap->data();
             fl::size grow_length = fl::max(3, newLen * 3 / 2);
-            if (str >= bufStart && str < bufStart + mLength + 1) {
-                fl::size offset = static_cast<fl::size>(str - bufStart);
-                heap->grow(grow_length);
+            bool selfRef = str >= bufStart && str < bufStart + mLength + 1;
+            fl::size offset = selfRef ? static_cast<fl::size>(str - bufStart) : 0;
+            if (!heap->grow(grow_length)) {
+                return mLength;  // out of memory: leave the string as it was
+            }
+            if (selfRef) {
                 str = heap->data() + offset; // update to new location
-            } else {
-                heap->grow(grow_length);
             }
         }
         fl::memcpy(heap->data() + mLength, str, n);
@@ -271,7 +355,7 @@ fl::size basic_string::write(const char* str, fl::size n) {
         return mLength;
     } else if (hasHeapData()) {
         // Copy-on-write
-        NotNullStringHolderPtr newData = NotNullStringHolderPtr(fl::make_shared<StringHolder>(newLen));
+        NotNullStringHolderPtr newData = NotNullStringHolderPtr(makeHolder(newLen));
         {
             const NotNullStringHolderPtr& heap = heapData();
             fl::memcpy(newData->data(), heap->data(), mLength);
@@ -292,7 +376,7 @@ fl::size basic_string::write(const char* str, fl::size n) {
         return mLength;
     }
     // Transition from inline to heap
-    NotNullStringHolderPtr newData = NotNullStringHolderPtr(fl::make_shared<StringHolder>(newLen));
+    NotNullStringHolderPtr newData = NotNullStringHolderPtr(makeHolder(newLen));
     {
         fl::memcpy(newData->data(), inlineBufferPtr(), mLength);
         fl::memcpy(newData->data() + mLength, str, n);
@@ -346,7 +430,7 @@ void basic_string::copy(const char* str) {
     mLength = len;
     if (len + 1 <= mInlineCapacity) {
         if (!isInline()) {
-            mStorage.reset();
+            setInline(get_resource());
         }
         fl::memcpy(inlineBufferPtr(), str, len + 1);
     } else {
@@ -354,7 +438,7 @@ void basic_string::copy(const char* str) {
             heapData()->copy(str, len);
             return;
         }
-        mStorage = NotNullStringHolderPtr(fl::make_shared<StringHolder>(str));
+        mStorage = NotNullStringHolderPtr(makeHolder(str));
     }
 }
 
@@ -362,7 +446,7 @@ void basic_string::copy(const char* str, fl::size len) {
     mLength = len;
     if (len + 1 <= mInlineCapacity) {
         if (!isInline()) {
-            mStorage.reset();
+            setInline(get_resource());
         }
         fl::memcpy(inlineBufferPtr(), str, len);
         inlineBufferPtr()[len] = '\0';
@@ -371,25 +455,25 @@ void basic_string::copy(const char* str, fl::size len) {
             heapData()->copy(str, len);
             return;
         }
-        mStorage = NotNullStringHolderPtr(fl::make_shared<StringHolder>(str, len));
+        mStorage = NotNullStringHolderPtr(makeHolder(str, len));
     }
 }
 
 void basic_string::copy(const basic_string& other) {
     fl::size len = other.size();
-    if (other.hasHeapData()) {
+    if (other.hasHeapData() && canShareHeapWith(other)) {
         // Share the heap pointer
         const auto& otherHeap = other.mStorage.get<NotNullStringHolderPtr>();
         mStorage = otherHeap;
     } else if (len + 1 <= mInlineCapacity) {
         if (!isInline()) {
-            mStorage.reset();
+            setInline(get_resource());
         }
         const char* src = other.c_str();
         char* dst = inlineBufferPtr();
         fl::memcpy(dst, src, len + 1);
     } else {
-        mStorage = NotNullStringHolderPtr(fl::make_shared<StringHolder>(other.c_str()));
+        mStorage = NotNullStringHolderPtr(makeHolder(other.c_str()));
     }
     mLength = len;
 }
@@ -413,12 +497,12 @@ void basic_string::assign(const char* str, fl::size len) {
     mLength = len;
     if (len + 1 <= mInlineCapacity) {
         if (!isInline()) {
-            mStorage.reset();
+            setInline(get_resource());
         }
         fl::memcpy(inlineBufferPtr(), str, len);
         inlineBufferPtr()[len] = '\0';
     } else {
-        mStorage = NotNullStringHolderPtr(fl::make_shared<StringHolder>(str, len));
+        mStorage = NotNullStringHolderPtr(makeHolder(str, len));
     }
 }
 
@@ -448,14 +532,14 @@ basic_string& basic_string::assign(fl::size count, char c) {
     mLength = count;
     if (count + 1 <= mInlineCapacity) {
         if (!isInline()) {
-            mStorage.reset();
+            setInline(get_resource());
         }
         for (fl::size i = 0; i < count; ++i) {
             inlineBufferPtr()[i] = c;
         }
         inlineBufferPtr()[count] = '\0';
     } else {
-        mStorage = NotNullStringHolderPtr(fl::make_shared<StringHolder>(count));
+        mStorage = NotNullStringHolderPtr(makeHolder(count));
         NotNullStringHolderPtr& ptr = heapData();
         for (fl::size i = 0; i < count; ++i) {
             ptr->data()[i] = c;
@@ -481,7 +565,7 @@ void basic_string::reserve(fl::size newCapacity) {
             return;
         }
     }
-    NotNullStringHolderPtr newData = NotNullStringHolderPtr(fl::make_shared<StringHolder>(newCapacity));
+    NotNullStringHolderPtr newData = NotNullStringHolderPtr(makeHolder(newCapacity));
     fl::memcpy(newData->data(), c_str(), mLength);
     newData->data()[mLength] = '\0';
     mStorage = newData;
@@ -490,7 +574,7 @@ void basic_string::reserve(fl::size newCapacity) {
 void basic_string::clear(bool freeMemory) {
     mLength = 0;
     if (isNonOwning() || (freeMemory && hasHeapData())) {
-        mStorage.reset();
+        setInline(get_resource());
         inlineBufferPtr()[0] = '\0';
     } else {
         c_str_mutable()[0] = '\0';
@@ -504,10 +588,10 @@ void basic_string::shrink_to_fit() {
         if (heap->capacity() <= mLength + 1) return;
         if (mLength + 1 <= mInlineCapacity) {
             fl::memcpy(inlineBufferPtr(), heap->data(), mLength + 1);
-            mStorage.reset();
+            setInline(heap->resource());
             return;
         }
-        NotNullStringHolderPtr newData = NotNullStringHolderPtr(fl::make_shared<StringHolder>(mLength));
+        NotNullStringHolderPtr newData = NotNullStringHolderPtr(makeHolder(mLength));
         fl::memcpy(newData->data(), heap->data(), mLength + 1);
         mStorage = newData;
     }
@@ -766,7 +850,7 @@ basic_string& basic_string::insert(fl::size pos, fl::size count, char ch) {
     // Handle COW
     if (hasHeapData() && heapData().get().use_count() > 1) {
         const NotNullStringHolderPtr& heap = heapData();
-        NotNullStringHolderPtr newData = NotNullStringHolderPtr(fl::make_shared<StringHolder>(newLen));
+        NotNullStringHolderPtr newData = NotNullStringHolderPtr(makeHolder(newLen));
         if (pos > 0) fl::memcpy(newData->data(), heap->data(), pos);
         for (fl::size i = 0; i < count; ++i) newData->data()[pos + i] = ch;
         if (pos < mLength) fl::memcpy(newData->data() + pos + count, heap->data() + pos, mLength - pos);
@@ -801,7 +885,7 @@ basic_string& basic_string::insert(fl::size pos, fl::size count, char ch) {
         }
     }
     if (!canInsertInPlace) {
-        NotNullStringHolderPtr newData = NotNullStringHolderPtr(fl::make_shared<StringHolder>(newLen));
+        NotNullStringHolderPtr newData = NotNullStringHolderPtr(makeHolder(newLen));
         const char* src = c_str();
         if (pos > 0) fl::memcpy(newData->data(), src, pos);
         for (fl::size i = 0; i < count; ++i) newData->data()[pos + i] = ch;
@@ -845,7 +929,7 @@ basic_string& basic_string::insert(fl::size pos, const char* s, fl::size count)
     // Handle COW
     if (hasHeapData() && heapData().get().use_count() > 1) {
         const NotNullStringHolderPtr& heap = heapData();
-        NotNullStringHolderPtr newData = NotNullStringHolderPtr(fl::make_shared<StringHolder>(newLen));
+        NotNullStringHolderPtr newData = NotNullStringHolderPtr(makeHolder(newLen));
         if (pos > 0) fl::memcpy(newData->data(), heap->data(), pos);
         fl::memcpy(newData->data() + pos, s, count);
         if (pos < mLength) fl::memcpy(newData->data() + pos + count, heap->data() + pos, mLength - pos);
@@ -880,7 +964,7 @@ basic_string& basic_string::insert(fl::size pos, const char* s, fl::size count)
         }
     }
     if (!canInsertInPlace) {
-        NotNullStringHolderPtr newData = NotNullStringHolderPtr(fl::make_shared<StringHolder>(newLen));
+        NotNullStringHolderPtr newData = NotNullStringHolderPtr(makeHolder(newLen));
         const char* src = c_str();
         if (pos > 0) fl::memcpy(newData->data(), src, pos);
         fl::memcpy(newData->data() + pos, s, count);
@@ -906,7 +990,7 @@ basic_string& basic_string::erase(fl::size pos, fl::size count) {
     // Handle COW
     if (hasHeapData() && heapData().get().use_count() > 1) {
         const NotNullStringHolderPtr& heap = heapData();
-        NotNullStringHolderPtr newData = NotNullStringHolderPtr(fl::make_shared<StringHolder>(mLength - actualCount));
+        NotNullStringHolderPtr newData = NotNullStringHolderPtr(makeHolder(mLength - actualCount));
         if (pos > 0) fl::memcpy(newData->data(), heap->data(), pos);
         fl::size remainingLen = mLength - pos - actualCount;
         if (remainingLen > 0) {
@@ -962,7 +1046,7 @@ basic_string& basic_string::replace(fl::size pos, fl::size count, const char* s,
     // Handle COW
     if (hasHeapData() && heapData().get().use_count() > 1) {
         const NotNullStringHolderPtr& heap = heapData();
-        NotNullStringHolderPtr newData = NotNullStringHolderPtr(fl::make_shared<StringHolder>(newLen));
+        NotNullStringHolderPtr newData = NotNullStringHolderPtr(makeHolder(newLen));
         if (pos > 0) fl::memcpy(newData->data(), heap->data(), pos);
         fl::memcpy(newData->data() + pos, s, count2);
         fl::size remainingLen = mLength - pos - actualCount;
@@ -1008,7 +1092,7 @@ basic_string& basic_string::replace(fl::size pos, fl::size count, const char* s,
         }
     }
     if (!canReplaceInPlace) {
-        NotNullStringHolderPtr newData = NotNullStringHolderPtr(fl::make_shared<StringHolder>(newLen));
+        NotNullStringHolderPtr newData = NotNullStringHolderPtr(makeHolder(newLen));
         const char* src = c_str();
         if (pos > 0) fl::memcpy(newData->data(), src, pos);
         fl::memcpy(newData->data() + pos, s, count2);
@@ -1045,7 +1129,7 @@ basic_string& basic_string::replace(fl::size pos, fl::size count, fl::size count
     // Handle COW
     if (hasHeapData() && heapData().get().use_count() > 1) {
         const NotNullStringHolderPtr& heap = heapData();
-        NotNullStringHolderPtr newData = NotNullStringHolderPtr(fl::make_shared<StringHolder>(newLen));
+        NotNullStringHolderPtr newData = NotNullStringHolderPtr(makeHolder(newLen));
         if (pos > 0) fl::memcpy(newData->data(), heap->data(), pos);
         for (fl::size i = 0; i < count2; ++i) newData->data()[pos + i] = ch;
         fl::size remainingLen = mLength - pos - actualCount;
@@ -1091,7 +1175,7 @@ basic_string& basic_string::replace(fl::size pos, fl::size count, fl::size count
         }
     }
     if (!canReplaceInPlace) {
-        NotNullStringHolderPtr newData = NotNullStringHolderPtr(fl::make_shared<StringHolder>(newLen));
+        NotNullStringHolderPtr newData = NotNullStringHolderPtr(makeHolder(newLen));
         const char* src = c_str();
         if (pos > 0) fl::memcpy(newData->data(), src, pos);
         for (fl::size i = 0; i < count2; ++i) newData->data()[pos + i] = ch;
@@ -1202,31 +1286,40 @@ int basic_string::compare(fl::size pos1, fl::size count1, const char* s, fl::siz
 // ======= PROTECTED: MOVE / SWAP / FACTORY HELPERS =======
 
 void basic_string::moveFrom(basic_string&& other) FL_NOEXCEPT {
+    memory_resource* otherResource = other.get_resource();
     if (other.isInline()) {
         mLength = other.mLength;
         fl::memcpy(inlineBufferPtr(), other.inlineBufferPtr(), other.mLength + 1);
-        // mStorage is already empty (inline mode) from constructor
+        setInline(other.get_resource());
     } else {
         mLength = other.mLength;
         mStorage = fl::move(other.mStorage);
     }
     other.mLength = 0;
-    other.mStorage.reset();
+    other.setInline(otherResource);
     other.inlineBufferPtr()[0] = '\0';
 }
 
 void basic_string::moveAssign(basic_string&& other) FL_NOEXCEPT {
     if (this == &other) return;
-    if (other.isInline()) {
+    memory_resource* otherResource = other.get_resource();
+    if (other.hasHeapData() && !canShareHeapWith(other)) {
+        // Different resource: stealing the buffer would tie our lifetime
+        // to `other`'s resource, so copy into ours instead.
+        copy(static_cast<const char*>(other.heapData()->data()), other.mLength);
+    } else if (other.isInline()) {
         mLength = other.mLength;
-        mStorage.reset();
+        setInline(get_resource());
         fl::memcpy(inlineBufferPtr(), other.inlineBufferPtr(), other.mLength + 1);
+    } else if (other.isNonOwning() && get_resource()) {
+        // Taking a literal/view would forget our resource; own a copy.
+        copy(other.c_str(), other.mLength);
     } else {
         mLength = other.mLength;
         mStorage = fl::move(other.mStorage);
     }
     other.mLength = 0;
-    other.mStorage.reset();
+    other.setInline(otherResource);
     other.inlineBufferPtr()[0] = '\0';
 }
 
@@ -1253,23 +1346,27 @@ void basic_string::swapWith(basic_string& other) {
                 other.inlineBufferPtr()[i] = tmp;
             }
             fl::swap(mLength, other.mLength);
+            fl::swap(mStorage, other.mStorage);  // resources travel along
         } else {
-            // Capacity mismatch: promote to heap where needed
+            // Capacity mismatch: promote to heap where needed. Each side's
+            // content keeps its own resource.
+            memory_resource* thisResource = get_resource();
+            memory_resource* otherResource = other.get_resource();
             NotNullStringHolderPtr thisData(
-                fl::make_shared<StringHolder>(inlineBufferPtr(), mLength));
+                makeHolder(inlineBufferPtr(), mLength));
             NotNullStringHolderPtr otherData(
-                fl::make_shared<StringHolder>(other.inlineBufferPtr(), other.mLength));
+                other.makeHolder(other.inlineBufferPtr(), other.mLength));
             fl::size thisLen = mLength;
             fl::size otherLen = other.mLength;
             if (thisFits) {
-                mStorage.reset();
+                setInline(otherResource);
                 fl::memcpy(inlineBufferPtr(), otherData->data(), otherLen + 1);
             } else {
                 mStorage = otherData;
             }
             mLength = otherLen;
             if (otherFits) {
-                other.mStorage.reset();
+                other.setInline(thisResource);
                 fl::memcpy(other.inlineBufferPtr(), thisData->data(), thisLen + 1);
             } else {
                 other.mStorage = thisData;
@@ -1279,16 +1376,20 @@ void basic_string::swapWith(basic_string& other) {
     } else if (thisInline) {
         // this inline, other non-inline
         fl::size thisLen = mLength;
+        memory_resource* thisResource = get_resource();
+        // Put this's old inline data into other
+        StringHolderPtr thisHeap;
+        if (thisLen + 1 > other.mInlineCapacity) {
+            thisHeap = makeHolder(inlineBufferPtr(), thisLen);
+        }
         // Take other's non-inline storage
         mStorage = fl::move(other.mStorage);
         mLength = other.mLength;
-        // Put this's old inline data into other
-        other.mStorage.reset();
-        if (thisLen + 1 <= other.mInlineCapacity) {
-            fl::memcpy(other.inlineBufferPtr(), inlineBufferPtr(), thisLen + 1);
+        if (thisHeap) {
+            other.mStorage = NotNullStringHolderPtr(thisHeap);
         } else {
-            other.mStorage = NotNullStringHolderPtr(
-                fl::make_shared<StringHolder>(inlineBufferPtr(), thisLen));
+            other.setInline(thisResource);
+            fl::memcpy(other.inlineBufferPtr(), inlineBufferPtr(), thisLen + 1);
         }
         other.mLength = thisLen;
     } else {
@@ -28,6 +28,7 @@ namespace fl {
 
 // Forward declarations
 class string_view;
+class memory_resource;
 template <typename T, fl::size Extent> class span;
 
 // Define shared_ptr type for StringHolder
@@ -158,6 +159,18 @@ class basic_string {
     char* c_str_mutable() FL_NOEXCEPT;
     fl::size capacity() const FL_NOEXCEPT;
 
+    // ======= MEMORY RESOURCE =======
+    // Heap spill-over (content longer than the inline buffer) is drawn
+    // from this resource; nullptr means fl::malloc. Like std::pmr the
+    // resource belongs to the object: copies do not inherit it, and a
+    // copy only shares another string's heap buffer when both use the
+    // same resource. Moves and swaps carry it along with the contents.
+    // The resource is recorded in the heap holder (or, while inline, in
+    // the storage variant), so strings that never set one pay nothing.
+    // set_resource() moves existing heap content into the new resource.
+    void set_resource(memory_resource* resource) FL_NOEXCEPT;
+    memory_resource* get_resource() const FL_NOEXCEPT;
+
     // ======= ELEMENT ACCESS =======
     char operator[](fl::size index) const FL_NOEXCEPT;
     char& operator[](fl::size index) FL_NOEXCEPT;
@@ -246,7 +259,7 @@ class basic_string {
         mLength = len;
         if (len + 1 <= mInlineCapacity) {
             if (!isInline()) {
-                mStorage.reset();
+                setInline(get_resource());
             }
             fl::size i = 0;
             for (auto it = first; it != last; ++it, ++i) {
@@ -254,7 +267,7 @@ class basic_string {
             }
             inlineBufferPtr()[len] = '\0';
         } else {
-            mStorage = NotNullStringHolderPtr(fl::make_shared<StringHolder>(len));
+            mStorage = NotNullStringHolderPtr(makeHolder(len));
             NotNullStringHolderPtr& ptr = heapData();
             fl::size i = 0;
             for (auto it = first; it != last; ++it, ++i) {
@@ -488,7 +501,13 @@ class basic_string {
     fl::size mInlineOffset;
     fl::size mInlineCapacity;
     fl::size mLength;
-    fl::variant<NotNullStringHolderPtr, ConstLiteral, ConstView> mStorage;
+    // Inline content whose future heap spill-over comes from `resource`.
+    struct InlineResource {
+        memory_resource* resource;
+        explicit InlineResource(memory_resource* r) FL_NOEXCEPT : resource(r) {}
+    };
+
+    fl::variant<NotNullStringHolderPtr, ConstLiteral, ConstView, InlineResource> mStorage;
 
     // ======= HELPER METHODS =======
     // Compute inline buffer pointer from offset (survives trivial relocation)
@@ -499,12 +518,23 @@ class basic_string {
         return static_cast<const char*>(static_cast<const void*>(this)) + mInlineOffset;
     }
 
-    bool isInline() const FL_NOEXCEPT { return mStorage.empty(); }
+    bool isInline() const FL_NOEXCEPT {
+        return mStorage.empty() || mStorage.is<InlineResource>();
+    }
+    // Switch to inline storage, remembering `resource` for later spill-over.
+    void setInline(memory_resource* resource) FL_NOEXCEPT;
     bool hasHeapData() const FL_NOEXCEPT { return mStorage.is<NotNullStringHolderPtr>(); }
     bool hasConstLiteral() const FL_NOEXCEPT { return mStorage.is<ConstLiteral>(); }
     bool hasConstView() const FL_NOEXCEPT { return mStorage.is<ConstView>(); }
     bool isNonOwning() const FL_NOEXCEPT { return hasConstLiteral() || hasConstView(); }
 
+    // Allocate a heap holder from get_resource() (or the default heap).
+    StringHolderPtr makeHolder(fl::size len) const FL_NOEXCEPT;
+    StringHolderPtr makeHolder(const char* str) const FL_NOEXCEPT;
+    StringHolderPtr makeHolder(const char* str, fl::size len) const FL_NOEXCEPT;
+    // True when `other`'s heap holder may be shared rather than copied.
+    bool canShareHeapWith(const basic_string& other) const FL_NOEXCEPT;
+
     const char* constData() const FL_NOEXCEPT;
     void materialize() FL_NOEXCEPT;
 
@@ -19,6 +19,13 @@ fl::size_t filebuf::bytes_left() const {
     return (t <= s) ? (s - t) : 0;
 }
 
+fl::size_t filebuf::read_at(fl::size_t offset, char* buffer, fl::size_t count) {
+    if (!seek(offset, seek_dir::beg)) {
+        return 0;
+    }
+    return read(buffer, count);
+}
+
 fl::size_t filebuf::pos() const {
     return const_cast<filebuf*>(this)->tell();
 }
@@ -53,6 +53,16 @@ public:
     virtual bool available() const { return is_open() && !is_eof(); }
     virtual fl::size_t bytes_left() const;
 
+    // Block read at an absolute offset (pread-style). The default seeks and
+    // reads, so the file position moves; backends with a cheaper positional
+    // path override it.
+    virtual fl::size_t read_at(fl::size_t offset, char* buffer, fl::size_t count);
+
+    // Read-only view of the whole file when the backend can expose one
+    // (memory-mapped or RAM-resident). Empty when unsupported. The view stays
+    // valid until close().
+    virtual fl::span<const fl::u8> mapped() const { return fl::span<const fl::u8>(); }
+
     // Convenience: read into u8 buffer
     fl::size_t read(fl::u8* dst, fl::size_t n) {
         return read(reinterpret_cast<char*>(dst), n); // ok reinterpret cast
@@ -6,6 +6,7 @@
 #include "fl/stl/detail/string_holder.h"
 #include "fl/stl/cstring.h"  // For memcpy
 #include "fl/stl/malloc.h"   // For fl::malloc, fl::free, fl::realloc
+#include "fl/stl/memory_resource.h"
 #include "fl/stl/noexcept.h"
 
 namespace fl {
@@ -36,24 +37,77 @@ StringHolder::StringHolder(const char *str, size length)
     mData[mLength] = '\0';
 }
 
+StringHolder::StringHolder(memory_resource *resource, size length)
+    : mData(resource ? (char*)resource->allocate(length + 1) : nullptr)
+    , mLength(length)
+    , mCapacity(length + 1)
+    , mResource(resource)
+    , mOnHeap(mData == nullptr) {
+    if (mOnHeap) {
+        // No resource, or it ran out: the buffer comes from the heap.
+        mData = (char*)fl::malloc(length + 1);
+    }
+    mData[mLength] = '\0';
+}
+
+StringHolder::StringHolder(memory_resource *resource, const char *str, size length)
+    : StringHolder(resource, length) {
+    fl::memcpy(mData, str, mLength);
+}
+
 StringHolder::~StringHolder() FL_NOEXCEPT {
+    if (!mOnHeap) {
+        mResource->deallocate(mData, mCapacity);
+        return;
+    }
     fl::free(mData); // Release the memory
 }
 
-void StringHolder::grow(size newLength) {
+bool StringHolder::grow(size newLength) {
     if (newLength + 1 <= mCapacity) {
         // We have enough capacity for newLength + null terminator
         mLength = newLength;
         mData[mLength] = '\0';
-        return;
+        return true;
+    }
+
+    if (!mOnHeap) {
+        // Resources may only be able to grow in place; otherwise move.
+        char* grown = (char*)mResource->reallocate(mData, mCapacity, newLength + 1);
+        if (!grown) {
+            grown = (char*)mResource->allocate(newLength + 1);
+            if (!grown) {
+                // The resource is exhausted; continue on the heap.
+                grown = (char*)fl::malloc(newLength + 1);
+                if (!grown) {
+                    return false;
+                }
+                fl::memcpy(grown, mData, mLength);
+                mResource->deallocate(mData, mCapacity);
+                mOnHeap = true;
+            } else {
+                fl::memcpy(grown, mData, mLength);
+                mResource->deallocate(mData, mCapacity);
+            }
+        }
+        mData = grown;
+        mLength = newLength;
+        mCapacity = newLength + 1;
+        mData[mLength] = '\0';
+        return true;
     }
 
     // Use fl::realloc for efficient growth without memory move
     // fl::realloc may expand in place or copy to larger block as needed
-    mData = (char*)fl::realloc(mData, newLength + 1);
+    char* grown = (char*)fl::realloc(mData, newLength + 1);
+    if (!grown) {
+        return false;  // old buffer and length are untouched
+    }
+    mData = grown;
     mLength = newLength;
     mCapacity = newLength + 1;
     mData[mLength] = '\0'; // Ensure null-termination
+    return true;
 }
 
 } // namespace fl
@@ -6,23 +6,33 @@
 
 namespace fl {
 
+class memory_resource;
+
 // StringHolder: Heap-allocated string storage with reference counting
-// Used when string exceeds inline buffer size
+// Used when string exceeds inline buffer size. When constructed with a
+// memory_resource the character buffer is drawn from (and returned to) it;
+// if the resource runs out the buffer falls back to the heap, while
+// resource() still reports the resource the string is bound to.
 class StringHolder {
   public:
     StringHolder(const char *str) FL_NOEXCEPT;
     StringHolder(size length) FL_NOEXCEPT;
     StringHolder(const char *str, size length) FL_NOEXCEPT;
+    StringHolder(memory_resource *resource, size length) FL_NOEXCEPT;
+    StringHolder(memory_resource *resource, const char *str, size length) FL_NOEXCEPT;
     StringHolder(const StringHolder &other) FL_NOEXCEPT = delete;
     StringHolder &operator=(const StringHolder &other) FL_NOEXCEPT = delete;
     ~StringHolder() FL_NOEXCEPT;
 
-    void grow(size newLength) FL_NOEXCEPT;
+    /// Returns false (leaving the buffer and length untouched) when no
+    /// memory is available for the larger buffer.
+    bool grow(size newLength) FL_NOEXCEPT;
     bool hasCapacity(size newLength) const FL_NOEXCEPT { return newLength + 1 <= mCapacity; }
     const char *data() const FL_NOEXCEPT { return mData; }
     char *data() FL_NOEXCEPT { return mData; }
     size length() const FL_NOEXCEPT { return mLength; }
     size capacity() const FL_NOEXCEPT { return mCapacity; }
+    memory_resource *resource() const FL_NOEXCEPT { return mResource; }
     bool copy(const char *str, size len) FL_NOEXCEPT {
         if ((len + 1) > mCapacity) {
             return false;
@@ -37,6 +47,8 @@ class StringHolder {
     char* mData;
     size mLength = 0;
     size mCapacity = 0;
+    memory_resource* mResource = nullptr;  // null = fl::malloc / fl::free
+    bool mOnHeap = true;  // mData came from fl::malloc, not mResource
 };
 
 } // namespace fl
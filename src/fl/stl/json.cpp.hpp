@@ -723,35 +723,38 @@ ArrayType classify_array(const json_array& arr) {
     return GENERIC_ARRAY;
 }
 
-fl::shared_ptr<json_value> optimize_array(fl::shared_ptr<json_value> array_val) {
+fl::shared_ptr<json_value> optimize_array(fl::shared_ptr<json_value> array_val,
+                                          memory_resource* resource = nullptr) {
     auto arr = array_val->data.ptr<json_array>();
     if (!arr) return array_val;
 
     ArrayType type = classify_array(*arr);
+    // Containers need a concrete resource; nodes treat nullptr as "heap".
+    memory_resource* storage = resource ? resource : default_memory_resource();
 
     switch (type) {
         case ALL_UINT8: {
-            fl::vector<u8> vec;
+            fl::vector<u8> vec(storage);
             vec.reserve(arr->size());
             for (const auto& elem : *arr) {
                 auto val = elem->as_int();
                 if (val) vec.push_back(static_cast<u8>(*val));
             }
-            return fl::make_shared<json_value>(fl::move(vec));
+            return fl::make_shared_with_resource<json_value>(resource, fl::move(vec));
         }
 
         case ALL_INT16: {
-            fl::vector<i16> vec;
+            fl::vector<i16> vec(storage);
             vec.reserve(arr->size());
             for (const auto& elem : *arr) {
                 auto val = elem->as_int();
                 if (val) vec.push_back(static_cast<i16>(*val));
             }
-            return fl::make_shared<json_value>(fl::move(vec));
+            return fl::make_shared_with_resource<json_value>(resource, fl::move(vec));
         }
 
         case ALL_FLOATS: {
-            fl::vector<float> vec;
+            fl::vector<float> vec(storage);
             vec.reserve(arr->size());
             for (const auto& elem : *arr) {
                 if (elem->is_float()) {
@@ -762,7 +765,7 @@ fl::shared_ptr<json_value> optimize_array(fl::shared_ptr<json_value> array_val)
                     if (val) vec.push_back(static_cast<float>(*val));
                 }
             }
-            return fl::make_shared<json_value>(fl::move(vec));
+            return fl::make_shared_with_resource<json_value>(resource, fl::move(vec));
         }
 
         default:
@@ -784,6 +787,15 @@ private:
     int mDepth;
     // String interning enabled for large strings (> 64 bytes) that overflow SSO
     fl::StringInterner mInterner;
+    // When set, nodes, containers and string values are allocated here and
+    // the interner (which owns heap storage) is bypassed for values.
+    memory_resource* mResource;
+    memory_resource* mStorage;  // mResource, or the default heap resource
+
+    template <typename... Args>
+    fl::shared_ptr<json_value> make_node(Args&&... args) {
+        return fl::make_shared_with_resource<json_value>(mResource, fl::forward<Args>(args)...);
+    }
 
     // Parse integer array directly from span into vector (zero allocations)
     template<typename T>
@@ -887,7 +899,9 @@ private:
     }
 
 public:
-    JsonBuilder() FL_NOEXCEPT : mRoot(), mDepth(0) {}
+    explicit JsonBuilder(memory_resource* resource = nullptr) FL_NOEXCEPT
+        : mRoot(), mDepth(0), mResource(resource)
+        , mStorage(resource ? resource : default_memory_resource()) {}
 
     ParseState on_token(JsonToken token, const fl::span<const char>& value) override {
         // Recursion depth check
@@ -899,31 +913,31 @@ public:
         switch (token) {
             // Specialized array tokens - parse directly into typed vectors
             case JsonToken::ARRAY_UINT8: {
-                fl::vector<u8> vec;
+                fl::vector<u8> vec(mStorage);
                 if (!parse_int_array(value, vec)) return ParseState::ERROR;
-                auto arr_val = fl::make_shared<json_value>(fl::move(vec));
+                auto arr_val = make_node(fl::move(vec));
                 push_value(arr_val);
                 return ParseState::KEEP_GOING;
             }
 
             case JsonToken::ARRAY_INT16: {
-                fl::vector<i16> vec;
+                fl::vector<i16> vec(mStorage);
                 if (!parse_int_array(value, vec)) return ParseState::ERROR;
-                auto arr_val = fl::make_shared<json_value>(fl::move(vec));
+                auto arr_val = make_node(fl::move(vec));
                 push_value(arr_val);
                 return ParseState::KEEP_GOING;
             }
 
             case JsonToken::ARRAY_FLOAT: {
-                fl::vector<float> vec;
+                fl::vector<float> vec(mStorage);
                 if (!parse_float_array(value, vec)) return ParseState::ERROR;
-                auto arr_val = fl::make_shared<json_value>(fl::move(vec));
+                auto arr_val = make_node(fl::move(vec));
                 push_value(arr_val);
                 return ParseState::KEEP_GOING;
             }
 
             case JsonToken::LBRACE: {
-                auto obj_val = fl::make_shared<json_value>(json_object{});
+                auto obj_val = make_node(json_object(mStorage));
                 // Don't push to parent yet - will push in RBRACE
                 mStack.push_back({StackFrame::OBJECT, obj_val, ""});
                 mDepth++;
@@ -942,7 +956,7 @@ public:
             }
 
             case JsonToken::LBRACKET: {
-                auto arr_val = fl::make_shared<json_value>(json_array{});
+                auto arr_val = make_node(json_array(mStorage));
                 // Don't push to parent yet - will push in RBRACKET after optimization
                 mStack.push_back({StackFrame::ARRAY, arr_val, ""});
                 mDepth++;
@@ -952,7 +966,7 @@ public:
             case JsonToken::RBRACKET: {
                 if (!mStack.empty() && mStack.back().type == StackFrame::ARRAY) {
                     // Optimize array before pushing to parent (Milestone 9)
-                    auto arr_val = optimize_array(mStack.back().value);
+                    auto arr_val = optimize_array(mStack.back().value, mResource);
                     mStack.pop_back();
                     mDepth--;
                     // Push optimized array to parent
@@ -973,14 +987,19 @@ public:
                     }
                 } else {
                     // Value: handle escape sequences, then intern (StringInterner handles SSO internally)
-                    fl::string str;
-                    if (has_escape_sequences(value)) {
+                    fl::string str(fl::allocator_arg, mResource);
+                    if (mResource) {
+                        if (has_escape_sequences(value)) {
+                            str = unescape_string(value);
+                        } else {
+                            str.assign(value.data(), value.size());
+                        }
+                    } else if (has_escape_sequences(value)) {
                         str = mInterner.intern(unescape_string(value));
                     } else {
                         str = mInterner.intern(value);
                     }
-                    auto str_val = fl::make_shared<json_value>(str);
-                    push_value(str_val);
+                    push_value(make_node(fl::move(str)));
                 }
 
                 return ParseState::KEEP_GOING;
@@ -999,11 +1018,11 @@ public:
                 fl::shared_ptr<json_value> num_val;
                 if (is_float) {
                     float f = fl::parseFloat(value.data(), value.size());
-                    num_val = fl::make_shared<json_value>(f);
+                    num_val = make_node(f);
                 } else {
                     int i = fl::parseInt(value.data(), value.size());
                     i64 i64_val = static_cast<i64>(i);
-                    num_val = fl::make_shared<json_value>(i64_val);
+                    num_val = make_node(i64_val);
                 }
 
                 push_value(num_val);
@@ -1011,15 +1030,15 @@ public:
             }
 
             case JsonToken::TRUE:
-                push_value(fl::make_shared<json_value>(true));
+                push_value(make_node(true));
                 return ParseState::KEEP_GOING;
 
             case JsonToken::FALSE:
-                push_value(fl::make_shared<json_value>(false));
+                push_value(make_node(false));
                 return ParseState::KEEP_GOING;
 
             case JsonToken::NULL_VALUE:
-                push_value(fl::make_shared<json_value>(nullptr));
+                push_value(make_node(nullptr));
                 return ParseState::KEEP_GOING;
 
             case JsonToken::COLON:
@@ -1036,7 +1055,7 @@ public:
     }
 
     fl::shared_ptr<json_value> get_result() {
-        return mRoot ? mRoot : fl::make_shared<json_value>(nullptr);
+        return mRoot ? mRoot : make_node(nullptr);
     }
 };
 
@@ -1044,6 +1063,14 @@ public:
 
 // PARSE2 IMPLEMENTATION - Milestone 8: Two-phase parser with validation
 fl::shared_ptr<json_value> json_value::parse2(const fl::string& txt) {
+    return parse2(fl::string_view(txt.c_str(), txt.length()), nullptr);
+}
+
+fl::shared_ptr<json_value> json_value::parse2(fl::string_view txt) {
+    return parse2(txt, nullptr);
+}
+
+fl::shared_ptr<json_value> json_value::parse2(fl::string_view txt, memory_resource* resource) {
     JsonTokenizer tokenizer;
 
     // Phase 1: Validate
@@ -1053,7 +1080,7 @@ fl::shared_ptr<json_value> json_value::parse2(const fl::string& txt) {
     }
 
     // Phase 2: Build
-    JsonBuilder builder;
+    JsonBuilder builder(resource);
     if (!tokenizer.parse(txt, builder)) {
         return fl::make_shared<json_value>(nullptr);
     }
@@ -686,6 +686,15 @@ public:
         return json(nullptr);
     }
 
+    // Parse with every node, container and long string drawn from `resource`
+    // (e.g. fl::frame_memory_resource() for per-frame RPC payloads). The
+    // document must not outlive the resource's current lifetime.
+    static json parse(const fl::string &txt, memory_resource* resource) FL_NOEXCEPT {
+        json result;
+        result.mValue = json_value::parse2(fl::string_view(txt.c_str(), txt.length()), resource);
+        return result;
+    }
+
     // Convenience methods for creating arrays and objects
     static json array() FL_NOEXCEPT {
         return json(json_array{});
@@ -694,6 +703,21 @@ public:
     static json object() FL_NOEXCEPT {
         return json(json_object{});
     }
+
+    // Empty array/object whose node and element storage come from `resource`.
+    static json array(memory_resource* resource) FL_NOEXCEPT {
+        json result;
+        result.mValue = fl::make_shared_with_resource<json_value>(
+            resource, json_array(resource ? resource : default_memory_resource()));
+        return result;
+    }
+
+    static json object(memory_resource* resource) FL_NOEXCEPT {
+        json result;
+        result.mValue = fl::make_shared_with_resource<json_value>(
+            resource, json_object(resource ? resource : default_memory_resource()));
+        return result;
+    }
     
     // Compatibility with existing API for array/object access
     size_t get_size() const FL_NOEXCEPT { return size(); }
@@ -676,12 +676,16 @@ struct json_value {
     json_value(float f) FL_NOEXCEPT : data(f) {}  // Changed from double to float
     json_value(const fl::string& s) FL_NOEXCEPT : data(s) {
     }
+    // Move overloads keep the source's memory_resource (see json::parse).
+    json_value(fl::string&& s) FL_NOEXCEPT : data(fl::move(s)) {}
     json_value(const json_array& a) FL_NOEXCEPT : data(a) {
         //FL_WARN("Created json_value with array");
     }
+    json_value(json_array&& a) FL_NOEXCEPT : data(fl::move(a)) {}
     json_value(const json_object& o) FL_NOEXCEPT : data(o) {
         //FL_WARN("Created json_value with object");
     }
+    json_value(json_object&& o) FL_NOEXCEPT : data(fl::move(o)) {}
     json_value(const fl::vector<i16>& audio) FL_NOEXCEPT : data(audio) {
         //FL_WARN("Created json_value with audio data");
     }
@@ -1461,6 +1465,8 @@ struct json_value {
     //   - Identical behavior to parse() (validated with A/B tests)
     static fl::shared_ptr<json_value> parse2(const fl::string &txt) FL_NOEXCEPT;
     static fl::shared_ptr<json_value> parse2(fl::string_view txt) FL_NOEXCEPT;  // Zero-copy version
+    // Build every node, container and long string from `resource` (nullptr = heap)
+    static fl::shared_ptr<json_value> parse2(fl::string_view txt, memory_resource* resource) FL_NOEXCEPT;
     static bool parse2_validate_only(const fl::string &txt) FL_NOEXCEPT;  // Phase 1 validation only (for testing)
     static bool parse2_validate_only(fl::string_view txt) FL_NOEXCEPT;  // Zero-copy version (no allocation)
 
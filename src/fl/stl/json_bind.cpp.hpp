@@ -0,0 +1,81 @@
+#include "fl/stl/json_bind.h"
+
+namespace fl {
+
+JsonReader::Event JsonBinder::fail(const char* message) {
+    if (!mError) {
+        mError = message;
+    }
+    return JsonReader::Event::Error;
+}
+
+void JsonBinder::valueComplete() {
+    if (mDepth > 0) {
+        const JsonBindSlot& parent = mStack[mDepth - 1];
+        if (parent.ops->elementDone) {
+            parent.ops->elementDone(parent.target);
+        }
+    }
+}
+
+JsonReader::Event JsonBinder::pump(JsonReader& reader) {
+    if (mError) {
+        return JsonReader::Event::Error;
+    }
+    for (;;) {
+        const JsonReader::Event e = reader.next();
+        switch (e) {
+        case JsonReader::Event::NeedInput:
+        case JsonReader::Event::End:
+            return e;
+        case JsonReader::Event::Error:
+            return fail(reader.errorMessage());
+        case JsonReader::Event::Key: {
+            const JsonBindSlot& object = mStack[mDepth - 1];
+            mSkipNext = !object.ops->member(object.target, reader.text(), &mPending);
+            continue;
+        }
+        case JsonReader::Event::EndObject:
+        case JsonReader::Event::EndArray:
+            mDepth--;
+            valueComplete();
+            continue;
+        default:
+            break;
+        }
+
+        // Start of a value: an unknown member, an array element, or the
+        // member/root in mPending
+        if (mSkipNext) {
+            mSkipNext = false;
+            reader.skip();
+            continue;
+        }
+        JsonBindSlot slot = mPending;
+        if (mDepth > 0 && mStack[mDepth - 1].ops->element) {
+            mStack[mDepth - 1].ops->element(mStack[mDepth - 1].target, &slot);
+        }
+
+        switch (e) {
+        case JsonReader::Event::BeginObject:
+            if (!slot.ops->member) return fail("unexpected object");
+            mStack[mDepth++] = slot;
+            break;
+        case JsonReader::Event::BeginArray:
+            if (!slot.ops->element) return fail("unexpected array");
+            mStack[mDepth++] = slot;
+            break;
+        case JsonReader::Event::Null:
+            valueComplete();  // target keeps its current value
+            break;
+        default:
+            if (!slot.ops->scalar || !slot.ops->scalar(slot.target, reader, e)) {
+                return fail("type mismatch");
+            }
+            valueComplete();
+            break;
+        }
+    }
+}
+
+} // namespace fl
@@ -0,0 +1,314 @@
+#pragma once
+
+/**
+ * @file json_bind.h
+ * @brief Deserialize JSON straight into C++ types from a JsonReader
+ *
+ * JsonBinder consumes JsonReader events and writes values directly into the
+ * target object - no json DOM, and chunked input works as-is because the
+ * binder keeps its position between pump() calls.
+ *
+ * Types are described with traits, in the style of TypeSchema / JsonToType:
+ * integers, bool, floats, fl::string and fl::vector<T> are built in; structs
+ * list their members by specializing fl::JsonFields:
+ *
+ * @code
+ * struct Segment { int start = 0; int stop = 0; };
+ * struct Preset { fl::string name; int bri = 0; fl::vector<Segment> seg; };
+ *
+ * namespace fl {
+ * template <> struct JsonFields<Segment> {
+ *     template <typename V> static void visit(Segment& s, V& v) {
+ *         v("start", s.start);
+ *         v("stop", s.stop);
+ *     }
+ * };
+ * template <> struct JsonFields<Preset> {
+ *     template <typename V> static void visit(Preset& p, V& v) {
+ *         v("n", p.name);
+ *         v("bri", p.bri);
+ *         v("seg", p.seg);
+ *     }
+ * };
+ * }
+ *
+ * Preset preset;
+ * fl::JsonReader reader;
+ * fl::JsonBinder binder(preset);
+ * while (fetchChunk(&chunk)) {          // e.g. an HTTP body, piece by piece
+ *     reader.feed(chunk);
+ *     binder.pump(reader);
+ * }
+ * reader.finish();
+ * bool ok = binder.pump(reader) == fl::JsonReader::Event::End;
+ * @endcode
+ *
+ * Large arrays can be walked one element at a time with JsonEach instead of
+ * being collected into a vector. Unknown members are skipped, null leaves the
+ * target untouched, and any other type mismatch stops with an error.
+ */
+
+#include "fl/stl/function.h"
+#include "fl/stl/int.h"
+#include "fl/stl/json_reader.h"
+#include "fl/stl/limits.h"
+#include "fl/stl/move.h"
+#include "fl/stl/noexcept.h"
+#include "fl/stl/string.h"
+#include "fl/stl/string_view.h"
+#include "fl/stl/type_traits.h"
+#include "fl/stl/vector.h"
+
+namespace fl {
+
+/// Member list for a struct: specialize with
+/// `template <typename V> static void visit(T& obj, V& v)` calling
+/// `v("name", obj.member)` once per member.
+template <typename T>
+struct JsonFields;
+
+struct JsonBindOps;
+
+/// A value being bound: where it goes and how to fill it
+struct JsonBindSlot {
+    void* target = nullptr;
+    const JsonBindOps* ops = nullptr;
+};
+
+/// Per-type callbacks (one static table per bound type). Unused entries are
+/// null: scalars have no member/element, containers no scalar.
+struct JsonBindOps {
+    /// Store a String/Number/Bool event; false on type mismatch
+    bool (*scalar)(void* target, const JsonReader& reader, JsonReader::Event e);
+    /// Object member lookup; false for unknown members (which are skipped)
+    bool (*member)(void* target, fl::string_view key, JsonBindSlot* child);
+    /// Array element: provide storage for the next element
+    void (*element)(void* target, JsonBindSlot* child);
+    /// Array element complete
+    void (*elementDone)(void* target);
+};
+
+/// Visit each element of a JSON array without storing the array
+template <typename T>
+class JsonEach {
+public:
+    explicit JsonEach(fl::function<void(T&)> fn) : mFn(fl::move(fn)) {}
+
+    T& item() { return mItem; }
+    void done() { mFn(mItem); }
+
+private:
+    T mItem;
+    fl::function<void(T&)> mFn;
+};
+
+// =============================================================================
+// JsonBindType - trait that provides the JsonBindOps table for T
+// =============================================================================
+
+namespace detail {
+
+template <typename T, typename Enable = void>
+struct JsonBindType;
+
+template <typename T>
+const JsonBindOps* jsonBindOps() {
+    return JsonBindType<T>::ops();
+}
+
+inline bool jsonBindNumber(const JsonReader& r, JsonReader::Event e, double* out) {
+    if (e != JsonReader::Event::Number) return false;
+    *out = r.floatValue();
+    return true;
+}
+
+// Integers (excluding bool). A number that does not fit T, or has a
+// fractional part, is a type mismatch rather than wrapped or truncated.
+template <typename T>
+struct JsonBindType<T, typename fl::enable_if<fl::is_integral<T>::value && !fl::is_same<T, bool>::value>::type> {
+    typedef fl::numeric_limits<T> Limits;
+    typedef typename fl::conditional<Limits::is_signed, i64, u64>::type Wide;
+
+    static bool fits(i64 value) {
+        if (Limits::is_signed) {
+            return value >= static_cast<i64>((Limits::min)()) &&
+                   value <= static_cast<i64>((Limits::max)());
+        }
+        return value >= 0 && static_cast<u64>(value) <= static_cast<u64>((Limits::max)());
+    }
+
+    static bool scalar(void* target, const JsonReader& r, JsonReader::Event e) {
+        if (e != JsonReader::Event::Number) return false;
+        i64 value = 0;
+        if (r.intValue(&value)) {
+            if (!fits(value)) return false;
+            *static_cast<T*>(target) = static_cast<T>(value);
+            return true;
+        }
+        // Fraction, exponent or beyond i64: only whole numbers in range.
+        // max() + 1 is exact below 2^53 and rounds to the 2^63 / 2^64
+        // bound for 64-bit types.
+        const double d = r.floatValue();
+        const double lo = static_cast<double>((Limits::min)());
+        const double hi = static_cast<double>((Limits::max)()) + 1.0;
+        if (!(d >= lo) || !(d < hi)) return false;
+        const Wide whole = static_cast<Wide>(d);
+        if (static_cast<double>(whole) != d) return false;
+        *static_cast<T*>(target) = static_cast<T>(whole);
+        return true;
+    }
+    static const JsonBindOps* ops() {
+        static const JsonBindOps kOps = {&scalar, nullptr, nullptr, nullptr};
+        return &kOps;
+    }
+};
+
+template <>
+struct JsonBindType<bool, void> {
+    static bool scalar(void* target, const JsonReader& r, JsonReader::Event e) {
+        if (e != JsonReader::Event::Bool) return false;
+        *static_cast<bool*>(target) = r.boolValue();
+        return true;
+    }
+    static const JsonBindOps* ops() {
+        static const JsonBindOps kOps = {&scalar, nullptr, nullptr, nullptr};
+        return &kOps;
+    }
+};
+
+template <typename T>
+struct JsonBindType<T, typename fl::enable_if<fl::is_floating_point<T>::value>::type> {
+    static bool scalar(void* target, const JsonReader& r, JsonReader::Event e) {
+        double value = 0.0;
+        if (!jsonBindNumber(r, e, &value)) return false;
+        *static_cast<T*>(target) = static_cast<T>(value);
+        return true;
+    }
+    static const JsonBindOps* ops() {
+        static const JsonBindOps kOps = {&scalar, nullptr, nullptr, nullptr};
+        return &kOps;
+    }
+};
+
+template <>
+struct JsonBindType<fl::string, void> {
+    static bool scalar(void* target, const JsonReader& r, JsonReader::Event e) {
+        if (e != JsonReader::Event::String) return false;
+        const fl::string_view text = r.text();
+        static_cast<fl::string*>(target)->assign(text.data(), text.size());
+        return true;
+    }
+    static const JsonBindOps* ops() {
+        static const JsonBindOps kOps = {&scalar, nullptr, nullptr, nullptr};
+        return &kOps;
+    }
+};
+
+template <typename T>
+struct JsonBindType<fl::vector<T>, void> {
+    static void element(void* target, JsonBindSlot* child) {
+        fl::vector<T>& vec = *static_cast<fl::vector<T>*>(target);
+        vec.push_back(T());
+        child->target = &vec.back();
+        child->ops = jsonBindOps<T>();
+    }
+    static const JsonBindOps* ops() {
+        static const JsonBindOps kOps = {nullptr, nullptr, &element, nullptr};
+        return &kOps;
+    }
+};
+
+template <typename T>
+struct JsonBindType<JsonEach<T>, void> {
+    static void element(void* target, JsonBindSlot* child) {
+        T& item = static_cast<JsonEach<T>*>(target)->item();
+        item = T();
+        child->target = &item;
+        child->ops = jsonBindOps<T>();
+    }
+    static void elementDone(void* target) {
+        static_cast<JsonEach<T>*>(target)->done();
+    }
+    static const JsonBindOps* ops() {
+        static const JsonBindOps kOps = {nullptr, nullptr, &element, &elementDone};
+        return &kOps;
+    }
+};
+
+// Finds the member named `key` among the ones JsonFields<T>::visit() lists
+struct JsonMemberFinder {
+    fl::string_view key;
+    JsonBindSlot* out;
+    bool found;
+
+    template <typename F>
+    void operator()(const char* name, F& field) {
+        if (!found && key == name) {
+            out->target = &field;
+            out->ops = jsonBindOps<F>();
+            found = true;
+        }
+    }
+};
+
+// Structs with a JsonFields specialization
+template <typename T, typename Enable>
+struct JsonBindType {
+    static bool member(void* target, fl::string_view key, JsonBindSlot* child) {
+        JsonMemberFinder finder{key, child, false};
+        JsonFields<T>::visit(*static_cast<T*>(target), finder);
+        return finder.found;
+    }
+    static const JsonBindOps* ops() {
+        static const JsonBindOps kOps = {nullptr, &member, nullptr, nullptr};
+        return &kOps;
+    }
+};
+
+} // namespace detail
+
+// =============================================================================
+// JsonBinder - drives a JsonReader into a typed target
+// =============================================================================
+
+class JsonBinder {
+public:
+    /// @param root Target for the top-level value; must outlive the binder
+    template <typename T>
+    explicit JsonBinder(T& root) FL_NOEXCEPT {
+        mPending.target = &root;
+        mPending.ops = detail::jsonBindOps<T>();
+    }
+
+    /// Bind events until the reader needs input, finishes or fails.
+    /// @return NeedInput, End (root complete) or Error
+    JsonReader::Event pump(JsonReader& reader);
+
+    /// Bind a complete document held in memory
+    template <typename T>
+    static bool parse(fl::string_view text, T& out, const char** error = nullptr) {
+        JsonReader reader;
+        reader.feed(text);
+        reader.finish();
+        JsonBinder binder(out);
+        const bool ok = binder.pump(reader) == JsonReader::Event::End;
+        if (error) {
+            *error = binder.errorMessage() ? binder.errorMessage() : reader.errorMessage();
+        }
+        return ok;
+    }
+
+    const char* errorMessage() const { return mError; }
+
+private:
+    JsonReader::Event fail(const char* message);
+    void valueComplete();
+
+    JsonBindSlot mStack[JsonReader::kMaxDepth];  ///< Open containers
+    int mDepth = 0;
+    JsonBindSlot mPending;   ///< Receives the next value (root or member)
+    bool mSkipNext = false;  ///< Next value belongs to an unknown member
+    const char* mError = nullptr;
+};
+
+} // namespace fl
@@ -0,0 +1,426 @@
+#include "fl/stl/json_reader.h"
+#include "fl/stl/compiler_control.h"
+#include "fl/stl/limits.h"
+
+namespace fl {
+
+namespace {
+
+bool jsonReaderIsSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+bool jsonReaderIsDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+bool jsonReaderIsNumberChar(char c) {
+    return jsonReaderIsDigit(c) || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E';
+}
+
+// -?digits(.digits)?([eE][+-]?digits)?  (leading zeros tolerated, as in json::parse)
+bool jsonReaderValidNumber(fl::string_view s) {
+    fl::size i = 0;
+    const fl::size n = s.size();
+    if (i < n && s[i] == '-') i++;
+    const fl::size intStart = i;
+    while (i < n && jsonReaderIsDigit(s[i])) i++;
+    if (i == intStart) return false;
+    if (i < n && s[i] == '.') {
+        const fl::size fracStart = ++i;
+        while (i < n && jsonReaderIsDigit(s[i])) i++;
+        if (i == fracStart) return false;
+    }
+    if (i < n && (s[i] == 'e' || s[i] == 'E')) {
+        i++;
+        if (i < n && (s[i] == '+' || s[i] == '-')) i++;
+        const fl::size expStart = i;
+        while (i < n && jsonReaderIsDigit(s[i])) i++;
+        if (i == expStart) return false;
+    }
+    return i == n;
+}
+
+int jsonReaderHex(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+bool jsonReaderHex4(fl::string_view s, fl::size at, u32* out) {
+    if (at + 4 > s.size()) return false;
+    u32 value = 0;
+    for (fl::size i = at; i < at + 4; i++) {
+        const int digit = jsonReaderHex(s[i]);
+        if (digit < 0) return false;
+        value = (value << 4) | static_cast<u32>(digit);
+    }
+    *out = value;
+    return true;
+}
+
+void jsonReaderAppendUtf8(fl::string& out, u32 cp) {
+    if (cp < 0x80) {
+        out += static_cast<char>(cp);
+    } else if (cp < 0x800) {
+        out += static_cast<char>(0xC0 | (cp >> 6));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+        out += static_cast<char>(0xE0 | (cp >> 12));
+        out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else {
+        out += static_cast<char>(0xF0 | (cp >> 18));
+        out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    }
+}
+
+} // namespace
+
+void JsonReader::feed(fl::string_view chunk) {
+    mOffset += mPos;
+    mChunk = chunk.data();
+    mLen = chunk.size();
+    mPos = 0;
+}
+
+void JsonReader::feed(fl::span<const u8> chunk) {
+    // ok reinterpret cast - bytes viewed as characters
+    feed(fl::string_view(reinterpret_cast<const char*>(chunk.data()), chunk.size()));
+}
+
+void JsonReader::finish() {
+    mFinished = true;
+}
+
+void JsonReader::reset() {
+    *this = JsonReader();
+}
+
+JsonReader::Event JsonReader::fail(const char* message) {
+    if (!mError) {
+        mError = message;
+    }
+    mPartial = Partial::None;
+    return Event::Error;
+}
+
+void JsonReader::skip() {
+    if (mSkipDepth < 0 && mDepth > 0 &&
+        (mExpect == Expect::KeyOrEnd || mExpect == Expect::ValueOrEnd)) {
+        // The last event opened a container: drop everything up to its end
+        mSkipDepth = mDepth - 1;
+    }
+}
+
+JsonReader::Event JsonReader::next() {
+    for (;;) {
+        const Event e = nextToken();
+        if (mSkipDepth < 0 || e == Event::NeedInput || e == Event::Error) {
+            return e;
+        }
+        if ((e == Event::EndObject || e == Event::EndArray) && mDepth == mSkipDepth) {
+            mSkipDepth = -1;
+        }
+    }
+}
+
+JsonReader::Event JsonReader::valueEvent(Event e) {
+    mExpect = mDepth == 0 ? Expect::Done : Expect::CommaOrEnd;
+    return e;
+}
+
+JsonReader::Event JsonReader::closeContainer(char close) {
+    const char open = close == '}' ? '{' : '[';
+    if (mDepth == 0 || mStack[mDepth - 1] != open) {
+        return fail("mismatched bracket");
+    }
+    mPos++;
+    mDepth--;
+    mExpect = mDepth == 0 ? Expect::Done : Expect::CommaOrEnd;
+    return close == '}' ? Event::EndObject : Event::EndArray;
+}
+
+JsonReader::Event JsonReader::nextToken() {
+    if (mError) {
+        return Event::Error;
+    }
+    switch (mPartial) {
+    case Partial::String: return scanString();
+    case Partial::Number: return scanNumber();
+    case Partial::Literal: return scanLiteral();
+    case Partial::None: break;
+    }
+
+    for (;;) {
+        while (mPos < mLen && jsonReaderIsSpace(mChunk[mPos])) {
+            mPos++;
+        }
+        if (mPos >= mLen) {
+            if (!mFinished) {
+                return Event::NeedInput;
+            }
+            if (mExpect == Expect::Done) {
+                return Event::End;
+            }
+            return fail("unexpected end of input");
+        }
+
+        const char c = mChunk[mPos];
+        switch (mExpect) {
+        case Expect::Done:
+            return fail("trailing characters after document");
+        case Expect::Colon:
+            if (c != ':') return fail("expected ':'");
+            mPos++;
+            mExpect = Expect::Value;
+            continue;
+        case Expect::CommaOrEnd:
+            if (c == ',') {
+                mPos++;
+                mExpect = mStack[mDepth - 1] == '{' ? Expect::Key : Expect::Value;
+                continue;
+            }
+            if (c == '}' || c == ']') return closeContainer(c);
+            return fail("expected ',' or closing bracket");
+        case Expect::KeyOrEnd:
+            if (c == '}') return closeContainer(c);
+            FL_FALLTHROUGH;
+        case Expect::Key:
+            if (c != '"') return fail("expected string key");
+            mPos++;
+            mStringIsKey = true;
+            mEscape = false;
+            mRaw.clear();
+            mPartial = Partial::String;
+            return scanString();
+        case Expect::ValueOrEnd:
+            if (c == ']') return closeContainer(c);
+            break;
+        case Expect::Value:
+            break;
+        }
+
+        // A value
+        if (c == '{' || c == '[') {
+            if (mDepth >= kMaxDepth) return fail("nesting too deep");
+            mStack[mDepth++] = static_cast<u8>(c);
+            mPos++;
+            mExpect = c == '{' ? Expect::KeyOrEnd : Expect::ValueOrEnd;
+            return c == '{' ? Event::BeginObject : Event::BeginArray;
+        }
+        mRaw.clear();
+        if (c == '"') {
+            mPos++;
+            mStringIsKey = false;
+            mEscape = false;
+            mPartial = Partial::String;
+            return scanString();
+        }
+        if (c == '-' || jsonReaderIsDigit(c)) {
+            mPartial = Partial::Number;
+            return scanNumber();
+        }
+        if (c == 't' || c == 'f' || c == 'n') {
+            mPartial = Partial::Literal;
+            return scanLiteral();
+        }
+        return fail("unexpected character");
+    }
+}
+
+JsonReader::Event JsonReader::scanString() {
+    // Tokens that started in an earlier chunk are assembled in mRaw;
+    // otherwise the string is viewed in place.
+    const bool carried = !mRaw.empty() || mPos == 0;
+    const fl::size start = mPos;
+    while (mPos < mLen) {
+        const char c = mChunk[mPos];
+        if (mEscape) {
+            mEscape = false;
+        } else if (c == '\\') {
+            mEscape = true;
+        } else if (c == '"') {
+            fl::string_view raw(mChunk + start, mPos - start);
+            if (carried) {
+                mRaw.append(raw.data(), raw.size());
+                raw = fl::string_view(mRaw.c_str(), mRaw.size());
+            }
+            mPos++;
+            mPartial = Partial::None;
+            if (!unescape(raw)) {
+                return fail("invalid escape sequence");
+            }
+            if (mStringIsKey) {
+                mExpect = Expect::Colon;
+                return Event::Key;
+            }
+            return valueEvent(Event::String);
+        } else if (static_cast<u8>(c) < 0x20) {
+            return fail("control character in string");
+        }
+        mPos++;
+    }
+    mRaw.append(mChunk + start, mPos - start);
+    if (mFinished) {
+        return fail("unterminated string");
+    }
+    return Event::NeedInput;
+}
+
+JsonReader::Event JsonReader::scanNumber() {
+    const bool carried = !mRaw.empty() || mPos == 0;
+    const fl::size start = mPos;
+    while (mPos < mLen && jsonReaderIsNumberChar(mChunk[mPos])) {
+        mPos++;
+    }
+    fl::string_view text(mChunk + start, mPos - start);
+    if (mPos >= mLen && !mFinished) {
+        mRaw.append(text.data(), text.size());
+        return Event::NeedInput;
+    }
+    if (carried) {
+        mRaw.append(text.data(), text.size());
+        text = fl::string_view(mRaw.c_str(), mRaw.size());
+    }
+    mPartial = Partial::None;
+    if (!jsonReaderValidNumber(text)) {
+        return fail("invalid number");
+    }
+    mText = text;
+    return valueEvent(Event::Number);
+}
+
+JsonReader::Event JsonReader::scanLiteral() {
+    const bool carried = !mRaw.empty() || mPos == 0;
+    const fl::size start = mPos;
+    while (mPos < mLen && mChunk[mPos] >= 'a' && mChunk[mPos] <= 'z') {
+        mPos++;
+    }
+    fl::string_view text(mChunk + start, mPos - start);
+    if (mPos >= mLen && !mFinished) {
+        mRaw.append(text.data(), text.size());
+        return Event::NeedInput;
+    }
+    if (carried) {
+        mRaw.append(text.data(), text.size());
+        text = fl::string_view(mRaw.c_str(), mRaw.size());
+    }
+    mPartial = Partial::None;
+    mText = text;
+    if (text == "true" || text == "false") {
+        mBool = text[0] == 't';
+        return valueEvent(Event::Bool);
+    }
+    if (text == "null") {
+        return valueEvent(Event::Null);
+    }
+    return fail("invalid literal");
+}
+
+bool JsonReader::unescape(fl::string_view raw) {
+    fl::size i = 0;
+    while (i < raw.size() && raw[i] != '\\') {
+        i++;
+    }
+    if (i == raw.size()) {
+        mText = raw;
+        return true;
+    }
+
+    mScratch.clear();
+    mScratch.append(raw.data(), i);
+    while (i < raw.size()) {
+        const char c = raw[i++];
+        if (c != '\\') {
+            mScratch += c;
+            continue;
+        }
+        if (i >= raw.size()) return false;
+        const char e = raw[i++];
+        switch (e) {
+        case '"': mScratch += '"'; break;
+        case '\\': mScratch += '\\'; break;
+        case '/': mScratch += '/'; break;
+        case 'b': mScratch += '\b'; break;
+        case 'f': mScratch += '\f'; break;
+        case 'n': mScratch += '\n'; break;
+        case 'r': mScratch += '\r'; break;
+        case 't': mScratch += '\t'; break;
+        case 'u': {
+            u32 cp = 0;
+            if (!jsonReaderHex4(raw, i, &cp)) return false;
+            i += 4;
+            // Surrogate pair
+            u32 low = 0;
+            if (cp >= 0xD800 && cp <= 0xDBFF && i + 1 < raw.size() &&
+                raw[i] == '\\' && raw[i + 1] == 'u' && jsonReaderHex4(raw, i + 2, &low) &&
+                low >= 0xDC00 && low <= 0xDFFF) {
+                cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                i += 6;
+            }
+            jsonReaderAppendUtf8(mScratch, cp);
+            break;
+        }
+        default:
+            return false;
+        }
+    }
+    mText = fl::string_view(mScratch.c_str(), mScratch.size());
+    return true;
+}
+
+bool JsonReader::intValue(i64* out) const {
+    fl::size i = 0;
+    const bool negative = !mText.empty() && mText[0] == '-';
+    if (negative) i++;
+    if (i >= mText.size()) return false;
+    u64 value = 0;
+    const u64 limit = negative ? static_cast<u64>(fl::numeric_limits<i64>::max()) + 1
+                               : static_cast<u64>(fl::numeric_limits<i64>::max());
+    for (; i < mText.size(); i++) {
+        const char c = mText[i];
+        if (!jsonReaderIsDigit(c)) return false;  // fraction or exponent
+        const u64 digit = static_cast<u64>(c - '0');
+        if (value > (limit - digit) / 10) return false;
+        value = value * 10 + digit;
+    }
+    *out = negative ? static_cast<i64>(0 - value) : static_cast<i64>(value);
+    return true;
+}
+
+double JsonReader::floatValue() const {
+    // Text is already validated; fl::parseFloat() has no exponent support
+    fl::size i = 0;
+    const bool negative = !mText.empty() && mText[0] == '-';
+    if (negative) i++;
+    double value = 0.0;
+    while (i < mText.size() && jsonReaderIsDigit(mText[i])) {
+        value = value * 10.0 + (mText[i++] - '0');
+    }
+    if (i < mText.size() && mText[i] == '.') {
+        double scale = 0.1;
+        for (i++; i < mText.size() && jsonReaderIsDigit(mText[i]); i++) {
+            value += (mText[i] - '0') * scale;
+            scale *= 0.1;
+        }
+    }
+    if (i < mText.size() && (mText[i] == 'e' || mText[i] == 'E')) {
+        i++;
+        const bool negativeExp = i < mText.size() && mText[i] == '-';
+        if (i < mText.size() && (mText[i] == '-' || mText[i] == '+')) i++;
+        int exp = 0;
+        for (; i < mText.size() && jsonReaderIsDigit(mText[i]); i++) {
+            if (exp < 400) exp = exp * 10 + (mText[i] - '0');
+        }
+        double factor = 1.0;
+        for (int k = 0; k < exp; k++) factor *= 10.0;
+        value = negativeExp ? value / factor : value * factor;
+    }
+    return negative ? -value : value;
+}
+
+} // namespace fl
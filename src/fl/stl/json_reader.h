@@ -0,0 +1,137 @@
+#pragma once
+
+/**
+ * @file json_reader.h
+ * @brief Streaming pull parser for JSON - no DOM, chunked input
+ *
+ * fl::json::parse() builds a complete json_value tree, which costs several
+ * times the document size in RAM. JsonReader instead hands out one event at a
+ * time and keeps only the nesting stack plus any token that straddles a chunk
+ * boundary, so documents can be consumed straight from a network stream.
+ *
+ * Pull loop:
+ * @code
+ * fl::JsonReader reader;
+ * reader.feed(chunk);           // any split: "{\"bri\":12", "8,\"on\":true}"
+ * for (;;) {
+ *     fl::JsonReader::Event e = reader.next();
+ *     if (e == fl::JsonReader::Event::NeedInput) {
+ *         // feed() the next chunk, or finish() at end of stream
+ *     } else if (e == fl::JsonReader::Event::Key && reader.text() == "seg") {
+ *         reader.next();
+ *         reader.skip();        // not interested in this value
+ *     } else if (e == fl::JsonReader::Event::End || e == fl::JsonReader::Event::Error) {
+ *         break;
+ *     }
+ * }
+ * @endcode
+ *
+ * For typed extraction into structs and arrays see fl/stl/json_bind.h.
+ */
+
+#include "fl/stl/int.h"
+#include "fl/stl/noexcept.h"
+#include "fl/stl/span.h"
+#include "fl/stl/string.h"
+#include "fl/stl/string_view.h"
+
+namespace fl {
+
+class JsonReader {
+public:
+    enum class Event : u8 {
+        BeginObject,
+        EndObject,
+        BeginArray,
+        EndArray,
+        Key,        ///< text() is the member name
+        String,     ///< text() is the unescaped value
+        Number,     ///< text() is the literal; see intValue()/floatValue()
+        Bool,       ///< boolValue()
+        Null,
+        NeedInput,  ///< Current chunk consumed: feed() more, or finish()
+        End,        ///< One complete document was read
+        Error       ///< errorMessage() says why; the reader stays in this state
+    };
+
+    /// Nesting limit, same as fl::json::parse()
+    static constexpr int kMaxDepth = 32;
+
+    JsonReader() FL_NOEXCEPT = default;
+
+    /// Supply the next chunk. The chunk must stay valid until next() returns
+    /// NeedInput: text() may point straight into it.
+    void feed(fl::string_view chunk);
+    void feed(fl::span<const u8> chunk);
+
+    /// Declare end of input (a trailing number can only be terminated here)
+    void finish();
+
+    /// Advance to the next event
+    Event next();
+
+    /// After BeginObject/BeginArray: discard events up to and including the
+    /// matching end. No-op after a scalar. Works across chunks - the skipped
+    /// events are simply never returned.
+    void skip();
+
+    /// Key/String (unescaped) or Number (literal). Valid until the next call
+    /// to next() or feed().
+    fl::string_view text() const { return mText; }
+    bool boolValue() const { return mBool; }
+    /// True for Number events without fraction or exponent that fit in i64
+    bool intValue(i64* out) const;
+    double floatValue() const;
+
+    /// Depth of the innermost open container (0 at top level)
+    int depth() const { return mDepth; }
+    /// Bytes consumed so far across all chunks
+    fl::size offset() const { return mOffset + mPos; }
+    const char* errorMessage() const { return mError; }
+
+    /// Forget all state (ready for a new document)
+    void reset();
+
+private:
+    enum class Expect : u8 {
+        Value,          ///< Any value (document start, after ':' or ',' in array)
+        ValueOrEnd,     ///< After '['
+        KeyOrEnd,       ///< After '{'
+        Key,            ///< After ',' in an object
+        Colon,
+        CommaOrEnd,
+        Done            ///< Top-level value complete
+    };
+    enum class Partial : u8 { None, String, Number, Literal };
+
+    Event fail(const char* message);
+    Event nextToken();
+    Event valueEvent(Event e);
+    Event scanString();
+    Event scanNumber();
+    Event scanLiteral();
+    bool unescape(fl::string_view raw);
+    Event closeContainer(char close);
+
+    const char* mChunk = nullptr;
+    fl::size mLen = 0;
+    fl::size mPos = 0;
+    fl::size mOffset = 0;
+    bool mFinished = false;
+
+    u8 mStack[kMaxDepth] = {};  ///< '{' or '[' per open container
+    int mDepth = 0;
+    Expect mExpect = Expect::Value;
+    bool mStringIsKey = false;
+    int mSkipDepth = -1;        ///< >= 0 while skip() is discarding events
+
+    Partial mPartial = Partial::None;
+    bool mEscape = false;       ///< Partial string ended on a backslash
+    fl::string mRaw;            ///< Token bytes carried across chunk boundaries
+    fl::string mScratch;        ///< Unescaped string storage
+    fl::string_view mText;
+    bool mBool = false;
+    const char* mError = nullptr;
+};
+
+} // namespace fl
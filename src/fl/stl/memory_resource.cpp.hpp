@@ -3,7 +3,8 @@
 #include "fl/stl/memory_resource.h"
 #include "fl/stl/allocator.h"  // fl::Malloc, fl::Free, PSRamAllocate, PSRamDeallocate
 #include "fl/stl/malloc.h"     // fl::realloc
-#include "fl/stl/cstring.h"    // fl::memset
+#include "fl/stl/cstring.h"    // fl::memset, fl::memcpy
+#include "fl/stl/cstddef.h"    // fl::max_align_t
 #include "fl/stl/noexcept.h"
 
 namespace fl {
@@ -80,4 +81,296 @@ memory_resource* psram_memory_resource() {
     return &instance;
 }
 
+// ======= Shared helpers for the bump / pool resources =======
+
+namespace {
+
+constexpr fl::size kResourceAlign = alignof(fl::max_align_t);
+
+inline fl::size alignSize(fl::size n) FL_NOEXCEPT {
+    return (n + kResourceAlign - 1) & ~(kResourceAlign - 1);
+}
+
+inline char* alignPtr(char* p) FL_NOEXCEPT {
+    const fl::uptr v = reinterpret_cast<fl::uptr>(p);  // ok reinterpret cast
+    const fl::uptr a = (v + kResourceAlign - 1) & ~static_cast<fl::uptr>(kResourceAlign - 1);
+    return p + (a - v);
+}
+
+} // anonymous namespace
+
+// ======= monotonic_buffer_resource =======
+
+struct monotonic_buffer_resource::Chunk {
+    Chunk* next;
+    fl::size bytes;  // total upstream allocation, header included
+};
+
+monotonic_buffer_resource::monotonic_buffer_resource(memory_resource* upstream) FL_NOEXCEPT
+    : monotonic_buffer_resource(nullptr, 0, upstream) {}
+
+monotonic_buffer_resource::monotonic_buffer_resource(fl::size initial_size,
+                                                     memory_resource* upstream) FL_NOEXCEPT
+    : monotonic_buffer_resource(nullptr, 0, upstream) {
+    if (initial_size > 0) {
+        mNextChunkSize = alignSize(initial_size) + alignSize(sizeof(Chunk));
+    }
+}
+
+monotonic_buffer_resource::monotonic_buffer_resource(void* buffer, fl::size buffer_size,
+                                                     memory_resource* upstream) FL_NOEXCEPT
+    : mUpstream(upstream ? upstream : default_memory_resource())
+    , mInitialBuffer(static_cast<char*>(buffer))
+    , mInitialSize(buffer ? buffer_size : 0)
+    , mNextChunkSize(256)
+    , mCursor(mInitialBuffer)
+    , mEnd(mInitialBuffer + mInitialSize) {
+    // Like std::pmr, the first upstream chunk is larger than the user buffer.
+    while (mNextChunkSize < mInitialSize) {
+        mNextChunkSize *= 2;
+    }
+}
+
+monotonic_buffer_resource::~monotonic_buffer_resource() FL_NOEXCEPT {
+    release();
+}
+
+void monotonic_buffer_resource::release() FL_NOEXCEPT {
+    while (mChunks) {
+        Chunk* next = mChunks->next;
+        mUpstream->deallocate(mChunks, mChunks->bytes);
+        mChunks = next;
+    }
+    mCursor = mInitialBuffer;
+    mEnd = mInitialBuffer + mInitialSize;
+    mLast = nullptr;
+    mUsed = 0;
+}
+
+bool monotonic_buffer_resource::addChunk(fl::size min_bytes) FL_NOEXCEPT {
+    const fl::size header = alignSize(sizeof(Chunk));
+    fl::size bytes = mNextChunkSize;
+    while (bytes < min_bytes + header) {
+        bytes *= 2;
+    }
+    void* raw = mUpstream->allocate(bytes);
+    if (!raw) {
+        return false;
+    }
+    Chunk* chunk = static_cast<Chunk*>(raw);
+    chunk->next = mChunks;
+    chunk->bytes = bytes;
+    mChunks = chunk;
+    mCursor = static_cast<char*>(raw) + header;
+    mEnd = static_cast<char*>(raw) + bytes;
+    mNextChunkSize = bytes * 2;
+    return true;
+}
+
+void* monotonic_buffer_resource::do_allocate(fl::size bytes) FL_NOEXCEPT {
+    char* p = mCursor ? alignPtr(mCursor) : nullptr;
+    if (!p || static_cast<fl::size>(mEnd - p) < bytes) {
+        if (!addChunk(bytes)) {
+            return nullptr;
+        }
+        p = mCursor;  // chunk payload is already aligned
+    }
+    mCursor = p + bytes;
+    mLast = p;
+    mUsed += bytes;
+    return p;
+}
+
+void monotonic_buffer_resource::do_deallocate(void* p, fl::size bytes) FL_NOEXCEPT {
+    // Only the most recent allocation can be given back (LIFO rollback).
+    char* c = static_cast<char*>(p);
+    if (c == mLast && c + bytes == mCursor) {
+        mCursor = c;
+        mLast = nullptr;
+        mUsed -= bytes;
+    }
+}
+
+void* monotonic_buffer_resource::do_reallocate(void* p, fl::size old_bytes,
+                                               fl::size new_bytes) FL_NOEXCEPT {
+    // Grow/shrink in place when `p` is the tail of the current buffer —
+    // the common pattern for a vector or string being appended to.
+    char* c = static_cast<char*>(p);
+    if (c == mLast && c + old_bytes == mCursor &&
+        static_cast<fl::size>(mEnd - c) >= new_bytes) {
+        mCursor = c + new_bytes;
+        mUsed = mUsed - old_bytes + new_bytes;
+        return p;
+    }
+    return nullptr;
+}
+
+// ======= unsynchronized_pool_resource =======
+
+struct unsynchronized_pool_resource::Chunk {
+    Chunk* next;
+    fl::size bytes;
+};
+
+struct unsynchronized_pool_resource::LargeBlock {
+    LargeBlock* prev;
+    LargeBlock* next;
+};
+
+unsynchronized_pool_resource::unsynchronized_pool_resource(memory_resource* upstream) FL_NOEXCEPT
+    : unsynchronized_pool_resource(pool_options(), upstream) {}
+
+unsynchronized_pool_resource::unsynchronized_pool_resource(const pool_options& opts,
+                                                           memory_resource* upstream) FL_NOEXCEPT
+    : mUpstream(upstream ? upstream : default_memory_resource())
+    , mOptions(opts)
+    , mPoolCount(0) {
+    if (mOptions.max_blocks_per_chunk == 0) {
+        mOptions.max_blocks_per_chunk = 128;
+    }
+    if (mOptions.largest_required_pool_block == 0) {
+        mOptions.largest_required_pool_block = 512;
+    }
+    // Round the largest block up to a size class, capped at the last pool.
+    fl::size largest = fl::size(1) << kMinShift;
+    mPoolCount = 1;
+    while (largest < mOptions.largest_required_pool_block && mPoolCount < kMaxPools) {
+        largest <<= 1;
+        ++mPoolCount;
+    }
+    mOptions.largest_required_pool_block = largest;
+}
+
+unsynchronized_pool_resource::~unsynchronized_pool_resource() FL_NOEXCEPT {
+    release();
+}
+
+void unsynchronized_pool_resource::release() FL_NOEXCEPT {
+    for (u8 i = 0; i < mPoolCount; ++i) {
+        Pool& pool = mPools[i];
+        while (pool.chunks) {
+            Chunk* next = pool.chunks->next;
+            mUpstream->deallocate(pool.chunks, pool.chunks->bytes);
+            pool.chunks = next;
+        }
+        pool.free = nullptr;
+        pool.nextBlocks = 0;
+    }
+    // Large blocks remember their size just before the LargeBlock header.
+    const fl::size header = alignSize(sizeof(LargeBlock) + sizeof(fl::size));
+    while (mLarge) {
+        LargeBlock* next = mLarge->next;
+        char* base = reinterpret_cast<char*>(mLarge);  // ok reinterpret cast
+        fl::size bytes;
+        fl::memcpy(&bytes, base + sizeof(LargeBlock), sizeof(bytes));
+        mUpstream->deallocate(base, header + bytes);
+        mLarge = next;
+    }
+}
+
+int unsynchronized_pool_resource::poolIndex(fl::size bytes) const FL_NOEXCEPT {
+    if (bytes > mOptions.largest_required_pool_block) {
+        return -1;
+    }
+    int index = 0;
+    fl::size blockSize = fl::size(1) << kMinShift;
+    while (blockSize < bytes) {
+        blockSize <<= 1;
+        ++index;
+    }
+    return index;
+}
+
+bool unsynchronized_pool_resource::refill(u8 index) FL_NOEXCEPT {
+    Pool& pool = mPools[index];
+    const fl::size blockSize = fl::size(1) << (kMinShift + index);
+    if (pool.nextBlocks == 0) {
+        pool.nextBlocks = 8;
+    }
+    const fl::size blocks = pool.nextBlocks;
+    const fl::size header = alignSize(sizeof(Chunk));
+    const fl::size bytes = header + blocks * blockSize;
+    void* raw = mUpstream->allocate(bytes);
+    if (!raw) {
+        return false;
+    }
+    Chunk* chunk = static_cast<Chunk*>(raw);
+    chunk->next = pool.chunks;
+    chunk->bytes = bytes;
+    pool.chunks = chunk;
+    // Thread the new blocks onto the free list, lowest address first.
+    char* payload = static_cast<char*>(raw) + header;
+    for (fl::size i = blocks; i > 0; --i) {
+        FreeBlock* b = reinterpret_cast<FreeBlock*>(payload + (i - 1) * blockSize);  // ok reinterpret cast
+        b->next = pool.free;
+        pool.free = b;
+    }
+    if (pool.nextBlocks < mOptions.max_blocks_per_chunk) {
+        pool.nextBlocks *= 2;
+        if (pool.nextBlocks > mOptions.max_blocks_per_chunk) {
+            pool.nextBlocks = mOptions.max_blocks_per_chunk;
+        }
+    }
+    return true;
+}
+
+void* unsynchronized_pool_resource::do_allocate(fl::size bytes) FL_NOEXCEPT {
+    const int index = poolIndex(bytes);
+    if (index < 0) {
+        const fl::size header = alignSize(sizeof(LargeBlock) + sizeof(fl::size));
+        char* base = static_cast<char*>(mUpstream->allocate(header + bytes));
+        if (!base) {
+            return nullptr;
+        }
+        LargeBlock* block = reinterpret_cast<LargeBlock*>(base);  // ok reinterpret cast
+        block->prev = nullptr;
+        block->next = mLarge;
+        if (mLarge) {
+            mLarge->prev = block;
+        }
+        mLarge = block;
+        fl::memcpy(base + sizeof(LargeBlock), &bytes, sizeof(bytes));
+        return base + header;
+    }
+    Pool& pool = mPools[index];
+    if (!pool.free && !refill(static_cast<u8>(index))) {
+        return nullptr;
+    }
+    FreeBlock* b = pool.free;
+    pool.free = b->next;
+    return b;
+}
+
+void unsynchronized_pool_resource::do_deallocate(void* p, fl::size bytes) FL_NOEXCEPT {
+    const int index = poolIndex(bytes);
+    if (index < 0) {
+        const fl::size header = alignSize(sizeof(LargeBlock) + sizeof(fl::size));
+        char* base = static_cast<char*>(p) - header;
+        LargeBlock* block = reinterpret_cast<LargeBlock*>(base);  // ok reinterpret cast
+        if (block->prev) {
+            block->prev->next = block->next;
+        } else {
+            mLarge = block->next;
+        }
+        if (block->next) {
+            block->next->prev = block->prev;
+        }
+        mUpstream->deallocate(base, header + bytes);
+        return;
+    }
+    FreeBlock* b = static_cast<FreeBlock*>(p);
+    b->next = mPools[index].free;
+    mPools[index].free = b;
+}
+
+void* unsynchronized_pool_resource::do_reallocate(void* p, fl::size old_bytes,
+                                                  fl::size new_bytes) FL_NOEXCEPT {
+    // Same size class: the block already has room.
+    const int oldIndex = poolIndex(old_bytes);
+    if (oldIndex >= 0 && oldIndex == poolIndex(new_bytes)) {
+        return p;
+    }
+    return nullptr;
+}
+
 } // namespace fl
@@ -4,12 +4,18 @@
 /// @brief PMR-style polymorphic memory resource for type-erased allocation.
 /// Replaces template-based allocators with runtime polymorphism.
 /// Used by vector_basic to decouple allocation strategy from container type.
+/// Concrete resources: default (heap), PSRAM, monotonic (bump) and pool.
 
 #include "fl/stl/int.h"
 #include "fl/stl/noexcept.h"
 
 namespace fl {
 
+/// Tag selecting the memory_resource overload of a constructor, as in
+/// `fl::string s(fl::allocator_arg, &arena);` (std::allocator_arg_t).
+struct allocator_arg_t {};
+constexpr allocator_arg_t allocator_arg{};
+
 /// Polymorphic memory resource base class (PMR-style).
 /// Concrete implementations wrap different allocation backends
 /// (default heap, PSRAM, DMA, slab, etc.)
@@ -60,4 +66,114 @@ memory_resource* default_memory_resource() FL_NOEXCEPT;
 /// Get the PSRAM memory resource (wraps PSRamAllocate / PSRamDeallocate).
 memory_resource* psram_memory_resource() FL_NOEXCEPT;
 
+/// Bump-pointer resource (std::pmr::monotonic_buffer_resource analogue).
+/// Allocation is a pointer increment; individual deallocation is a no-op
+/// except that freeing (or growing) the most recent allocation rolls the
+/// cursor back (or forward) in place. Memory is returned to `upstream` only
+/// by release() or destruction. When the current buffer is exhausted a new
+/// chunk is requested from `upstream`, each one twice the size of the last.
+/// Returned memory is aligned to alignof(fl::max_align_t) and NOT zeroed.
+class monotonic_buffer_resource : public memory_resource {
+  public:
+    explicit monotonic_buffer_resource(
+        memory_resource* upstream = default_memory_resource()) FL_NOEXCEPT;
+    monotonic_buffer_resource(
+        fl::size initial_size,
+        memory_resource* upstream = default_memory_resource()) FL_NOEXCEPT;
+    /// Serve allocations from `buffer` first; the caller owns it and it
+    /// must outlive this resource.
+    monotonic_buffer_resource(
+        void* buffer, fl::size buffer_size,
+        memory_resource* upstream = default_memory_resource()) FL_NOEXCEPT;
+    ~monotonic_buffer_resource() FL_NOEXCEPT override;
+
+    monotonic_buffer_resource(const monotonic_buffer_resource&) = delete;
+    monotonic_buffer_resource& operator=(const monotonic_buffer_resource&) = delete;
+
+    /// Return every upstream chunk and rewind to the initial buffer.
+    void release() FL_NOEXCEPT;
+
+    memory_resource* upstream_resource() const FL_NOEXCEPT { return mUpstream; }
+
+    /// Bytes handed out since construction / the last release().
+    fl::size bytes_used() const FL_NOEXCEPT { return mUsed; }
+
+  protected:
+    void* do_allocate(fl::size bytes) FL_NOEXCEPT override;
+    void do_deallocate(void* p, fl::size bytes) FL_NOEXCEPT override;
+    void* do_reallocate(void* p, fl::size old_bytes, fl::size new_bytes) FL_NOEXCEPT override;
+
+  private:
+    struct Chunk;
+    bool addChunk(fl::size min_bytes) FL_NOEXCEPT;
+
+    memory_resource* mUpstream;
+    char* mInitialBuffer;
+    fl::size mInitialSize;
+    fl::size mNextChunkSize;
+    Chunk* mChunks = nullptr;
+    char* mCursor;
+    char* mEnd;
+    char* mLast = nullptr;  // start of the most recent allocation
+    fl::size mUsed = 0;
+};
+
+/// Tuning knobs for unsynchronized_pool_resource. Zero selects the default.
+struct pool_options {
+    fl::size max_blocks_per_chunk = 0;         ///< Default 128
+    fl::size largest_required_pool_block = 0;  ///< Default 512, max 4096
+};
+
+/// Size-class pool resource (std::pmr::unsynchronized_pool_resource analogue).
+/// Requests up to `largest_required_pool_block` bytes are rounded up to a
+/// power-of-two size class (8, 16, 32, ...) and served from per-class free
+/// lists carved out of upstream chunks, so freed blocks are recycled without
+/// ever fragmenting the upstream heap. Larger requests go straight to
+/// `upstream`. Not thread-safe. Memory is NOT zeroed.
+class unsynchronized_pool_resource : public memory_resource {
+  public:
+    explicit unsynchronized_pool_resource(
+        memory_resource* upstream = default_memory_resource()) FL_NOEXCEPT;
+    unsynchronized_pool_resource(
+        const pool_options& opts,
+        memory_resource* upstream = default_memory_resource()) FL_NOEXCEPT;
+    ~unsynchronized_pool_resource() FL_NOEXCEPT override;
+
+    unsynchronized_pool_resource(const unsynchronized_pool_resource&) = delete;
+    unsynchronized_pool_resource& operator=(const unsynchronized_pool_resource&) = delete;
+
+    /// Return all chunks and outstanding large blocks to upstream.
+    void release() FL_NOEXCEPT;
+
+    memory_resource* upstream_resource() const FL_NOEXCEPT { return mUpstream; }
+    pool_options options() const FL_NOEXCEPT { return mOptions; }
+
+  protected:
+    void* do_allocate(fl::size bytes) FL_NOEXCEPT override;
+    void do_deallocate(void* p, fl::size bytes) FL_NOEXCEPT override;
+    void* do_reallocate(void* p, fl::size old_bytes, fl::size new_bytes) FL_NOEXCEPT override;
+
+  private:
+    static constexpr u8 kMinShift = 3;   // 8-byte smallest class
+    static constexpr u8 kMaxPools = 10;  // 8 .. 4096
+
+    struct FreeBlock { FreeBlock* next; };
+    struct Chunk;
+    struct LargeBlock;
+    struct Pool {
+        FreeBlock* free = nullptr;
+        Chunk* chunks = nullptr;
+        fl::size nextBlocks = 0;  // blocks in the next chunk (grows x2)
+    };
+
+    int poolIndex(fl::size bytes) const FL_NOEXCEPT;
+    bool refill(u8 index) FL_NOEXCEPT;
+
+    memory_resource* mUpstream;
+    pool_options mOptions;
+    u8 mPoolCount;
+    Pool mPools[kMaxPools];
+    LargeBlock* mLarge = nullptr;
+};
+
 } // namespace fl
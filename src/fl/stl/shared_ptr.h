@@ -7,6 +7,7 @@
 #include "fl/stl/int.h"
 #include "fl/stl/align.h"
 #include "fl/stl/cstdlib.h"
+#include "fl/stl/memory_resource.h"
 #include "fl/stl/noexcept.h"
 
 
@@ -147,6 +148,34 @@ struct FL_ALIGNAS(control_block_alignment<T>::value) InlinedControlBlock : publi
     }
 };
 
+// Control block + inline object carved from a memory_resource (single
+// allocation, returned to the same resource when the last weak ref drops).
+template<typename T>
+struct ResourceControlBlock : public ControlBlockBase {
+    FL_ALIGNAS(T) char storage[sizeof(T)];
+    bool object_constructed;
+    memory_resource* resource;
+
+    explicit ResourceControlBlock(memory_resource* r) FL_NOEXCEPT
+        : ControlBlockBase(true), object_constructed(false), resource(r) {}
+
+    T* get_object() FL_NOEXCEPT {
+        return fl::bit_cast<T*>(&storage[0]);
+    }
+
+    void destroy_object() FL_NOEXCEPT override {
+        if (object_constructed) {
+            get_object()->~T();
+            object_constructed = false;
+        }
+    }
+
+    void destroy_control_block() FL_NOEXCEPT override {
+        memory_resource* r = resource;
+        this->~ResourceControlBlock();
+        r->deallocate(this, sizeof(ResourceControlBlock));
+    }
+};
 
 } // namespace detail
 
@@ -400,6 +429,9 @@ private:
     template<typename Y, typename A, typename... Args>
     friend shared_ptr<Y> allocate_shared(const A& alloc, Args&&... args) FL_NOEXCEPT;
 
+    template<typename Y, typename... Args>
+    friend shared_ptr<Y> make_shared_with_resource(memory_resource* resource, Args&&... args) FL_NOEXCEPT;
+
     template<typename Y>
     friend shared_ptr<Y> make_shared_no_tracking(Y& obj) FL_NOEXCEPT;
 
@@ -452,6 +484,26 @@ shared_ptr<T> allocate_shared(const A& /* alloc */, Args&&... args) FL_NOEXCEPT
     return make_shared<T>(fl::forward<Args>(args)...);
 }
 
+// make_shared variant whose single allocation (control block + object) comes
+// from `resource`. A null resource falls back to make_shared. Types needing
+// more than alignof(fl::max_align_t) alignment should use make_shared.
+template<typename T, typename... Args>
+shared_ptr<T> make_shared_with_resource(memory_resource* resource, Args&&... args) FL_NOEXCEPT {
+    if (!resource) {
+        return make_shared<T>(fl::forward<Args>(args)...);
+    }
+    typedef detail::ResourceControlBlock<T> Block;
+    void* mem = resource->allocate(sizeof(Block));
+    if (!mem) {
+        return shared_ptr<T>();
+    }
+    Block* control = new (mem) Block(resource);
+    T* obj = control->get_object();
+    new(obj) T(fl::forward<Args>(args)...);
+    control->object_constructed = true;
+    return shared_ptr<T>(obj, control, detail::make_shared_tag{});
+}
+
 // Non-member comparison operators
 template<typename T, typename Y>
 bool operator==(const shared_ptr<T>& lhs, const shared_ptr<Y>& rhs) FL_NOEXCEPT {
@@ -85,6 +85,9 @@ int string::strcmp(const string& a, const string& b) FL_NOEXCEPT {
 string::string() FL_NOEXCEPT
     : string_n<FASTLED_STR_INLINED_SIZE>() {}
 
+string::string(allocator_arg_t tag, memory_resource* resource) FL_NOEXCEPT
+    : string_n<FASTLED_STR_INLINED_SIZE>(tag, resource) {}
+
 string::string(const char* str) FL_NOEXCEPT
     : string_n<FASTLED_STR_INLINED_SIZE>(str) {}
 
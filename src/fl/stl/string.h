@@ -5,6 +5,7 @@
 
 
 #include "fl/stl/basic_string.h"
+#include "fl/stl/memory_resource.h"
 #include "fl/stl/int.h"
 #include "fl/stl/cstring.h"
 #include "fl/stl/compiler_control.h"
@@ -100,6 +101,12 @@ class string_n : public basic_string {
     // non-template population helpers on the base.
     string_n() FL_NOEXCEPT : basic_string(mInlineBuffer, N) {}
 
+    // Empty string whose heap spill-over comes from `resource`. Tagged so
+    // that `string_n s(nullptr)` / `s(0)` stay unambiguous.
+    string_n(allocator_arg_t, memory_resource* resource) FL_NOEXCEPT : basic_string(mInlineBuffer, N) {
+        set_resource(resource);
+    }
+
     string_n(const char* str) FL_NOEXCEPT : basic_string(mInlineBuffer, N) {
         if (str) copy(str);
     }
@@ -216,6 +223,7 @@ class string : public string_n<FASTLED_STR_INLINED_SIZE> {
     // hygiene. Template ctors stay inline (they're parameterised
     // on caller types and can't be split out).
     string() FL_NOEXCEPT;
+    string(allocator_arg_t, memory_resource* resource) FL_NOEXCEPT;
     string(const char* str) FL_NOEXCEPT;
     string(const char* str, fl::size len) FL_NOEXCEPT;
     string(fl::size len, char c) FL_NOEXCEPT;
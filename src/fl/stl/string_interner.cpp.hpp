@@ -4,8 +4,9 @@
 #include "fl/stl/string.h"
 #include "fl/stl/detail/string_holder.h"
 #include "fl/stl/shared_ptr.h"
-#include "fl/stl/unordered_map.h"
+#include "fl/stl/swiss_map.h"
 #include "fl/stl/string_view.h"
+#include "fl/stl/cstring.h"
 #include "fl/stl/span.h"
 #include "fl/stl/mutex.h"
 #include "fl/stl/noexcept.h"
@@ -97,13 +98,115 @@ void StringInterner::clear() {
 }
 
 void StringInterner::reserve(fl::size count) {
-    // unordered_map doesn't have reserve(), but we can set the bucket count
-    // This pre-allocates buckets to avoid rehashing
+    // Pre-allocates slots to avoid rehashing
     if (count > 0) {
-        mEntries.rehash(count);
+        mEntries.reserve(count);
     }
 }
 
+// SymbolTable member function implementations
+
+SymbolTable::SymbolTable(fl::size chunk_bytes, memory_resource* resource) FL_NOEXCEPT
+    : mResource(resource ? resource : default_memory_resource()),
+      mChunkBytes(chunk_bytes < 64 ? 64 : chunk_bytes),
+      mChunks(mResource),
+      mSymbols(mResource),
+      mIndex(mResource) {}
+
+SymbolTable::~SymbolTable() FL_NOEXCEPT {
+    clear();
+}
+
+char* SymbolTable::allocate(fl::size bytes) {
+    if (bytes > mRemaining) {
+        // Large strings get a chunk of their own so the current chunk's
+        // free space is not thrown away.
+        const bool dedicated = bytes > mChunkBytes / 2;
+        const fl::size chunk_bytes = dedicated ? bytes : mChunkBytes;
+        Chunk chunk;
+        chunk.data = static_cast<char*>(mResource->allocate(chunk_bytes));
+        chunk.bytes = chunk_bytes;
+        if (!chunk.data) {
+            return nullptr;
+        }
+        mChunks.push_back(chunk);
+        mArenaBytes += chunk_bytes;
+        if (dedicated) {
+            return chunk.data;
+        }
+        mCursor = chunk.data;
+        mRemaining = chunk_bytes;
+    }
+    char* out = mCursor;
+    mCursor += bytes;
+    mRemaining -= bytes;
+    return out;
+}
+
+Symbol SymbolTable::intern(const string_view& sv) {
+    if (sv.empty()) return Symbol();
+    const u32* existing = mIndex.find_value(sv);
+    if (existing) {
+        return Symbol(*existing);
+    }
+
+    char* bytes = allocate(sv.size() + 1);
+    if (!bytes) {
+        return Symbol();
+    }
+    fl::memcpy(bytes, sv.data(), sv.size());
+    bytes[sv.size()] = '\0';
+
+    // The view points into the arena, which never moves.
+    string_view stored(bytes, sv.size());
+    mSymbols.push_back(stored);
+    const u32 id = static_cast<u32>(mSymbols.size());
+    mIndex.insert(stored, id);
+    return Symbol(id);
+}
+
+Symbol SymbolTable::intern(const char* str) {
+    if (!str) return Symbol();
+    return intern(string_view(str));
+}
+
+Symbol SymbolTable::find(const string_view& sv) const {
+    if (sv.empty()) return Symbol();
+    const u32* existing = mIndex.find_value(sv);
+    return existing ? Symbol(*existing) : Symbol();
+}
+
+string_view SymbolTable::resolve(Symbol sym) const {
+    if (sym.empty() || sym.id() > mSymbols.size()) {
+        return string_view();
+    }
+    return mSymbols[sym.id() - 1];
+}
+
+const char* SymbolTable::c_str(Symbol sym) const {
+    if (sym.empty() || sym.id() > mSymbols.size()) {
+        return "";
+    }
+    return mSymbols[sym.id() - 1].data();
+}
+
+void SymbolTable::clear() {
+    mIndex.clear();
+    mSymbols.clear();
+    for (fl::size i = 0; i < mChunks.size(); ++i) {
+        mResource->deallocate(mChunks[i].data, mChunks[i].bytes);
+    }
+    mChunks.clear();
+    mCursor = nullptr;
+    mRemaining = 0;
+    mArenaBytes = 0;
+}
+
+void SymbolTable::reserve(fl::size count) {
+    mSymbols.reserve(count);
+    mIndex.reserve(count);
+}
+
 // Global string interner singleton implementation
 StringInterner& global_interner() {
     return Singleton<StringInterner>::instance();
@@ -130,4 +233,21 @@ fl::string intern(const fl::span<const char>& sp) {
     return global_interner().intern(sp);
 }
 
+// Global symbol table (thread-safe via mutex)
+SymbolTable& global_symbols() {
+    return Singleton<SymbolTable>::instance();
+}
+
+Symbol symbol(const string_view& sv) {
+    fl::unique_lock<fl::mutex> lock(global_interner_mutex());
+    return global_symbols().intern(sv);
+}
+
+string_view symbol_name(Symbol sym) {
+    // Lock because intern() may grow the symbol list concurrently; the
+    // returned bytes themselves never move.
+    fl::unique_lock<fl::mutex> lock(global_interner_mutex());
+    return global_symbols().resolve(sym);
+}
+
 } // namespace fl
@@ -4,23 +4,32 @@
 // for efficient comparison and deduplication. Uses a hash map for O(1) average
 // lookup time instead of linear search.
 //
-// Implementation: unordered_map<string_view, shared_ptr<StringHolder>>
+// Implementation: swiss_map<string_view, shared_ptr<StringHolder>>
 // The string_view keys point into the StringHolder values' data (self-referential).
 // This is safe because StringHolder data is heap-allocated and never moves.
 //
 // All interned strings are heap-allocated to ensure stable pointers.
 // Copying interned strings is cheap (shared_ptr increment).
 // Outstanding strings survive interner.clear() due to reference counting.
+//
+// SymbolTable is the symbol-table mode: the bytes of every unique string are
+// packed into chunked arenas and callers hold a 32-bit Symbol instead of an
+// fl::string. Symbols compare and hash as integers and resolve back to a
+// string_view only when the text is needed. Use it for names that are
+// looked up over and over (RPC methods, JSON keys, UI element names).
 
+#include "fl/stl/hash.h"
 #include "fl/stl/int.h"
-#include "fl/stl/unordered_map.h"
+#include "fl/stl/memory_resource.h"
+#include "fl/stl/string_view.h"
+#include "fl/stl/swiss_map.h"
 #include "fl/stl/shared_ptr.h"
+#include "fl/stl/vector.h"
 #include "fl/stl/noexcept.h"
 
 namespace fl {
 
 class string;
-class string_view;  // IWYU pragma: keep
 class StringHolder;
 template <typename T, fl::size Extent> class span;  // IWYU pragma: keep
 
@@ -69,7 +78,88 @@ class StringInterner {
 
   private:
     using StringHolderPtr = fl::shared_ptr<StringHolder>;
-    fl::unordered_map<string_view, StringHolderPtr> mEntries;  // O(1) average lookup
+    fl::swiss_map<string_view, StringHolderPtr> mEntries;  // O(1) average lookup
+};
+
+// Symbol: 32-bit handle to a string in a SymbolTable. Ids are dense and
+// start at 1, so they can index arrays; Symbol() (id 0) is the empty string.
+// A symbol is only meaningful to the table that issued it.
+class Symbol {
+  public:
+    constexpr Symbol() FL_NOEXCEPT : mId(0) {}
+    constexpr explicit Symbol(u32 id) FL_NOEXCEPT : mId(id) {}
+
+    constexpr u32 id() const FL_NOEXCEPT { return mId; }
+    constexpr bool empty() const FL_NOEXCEPT { return mId == 0; }
+    constexpr explicit operator bool() const FL_NOEXCEPT { return mId != 0; }
+
+    constexpr bool operator==(Symbol other) const FL_NOEXCEPT { return mId == other.mId; }
+    constexpr bool operator!=(Symbol other) const FL_NOEXCEPT { return mId != other.mId; }
+    constexpr bool operator<(Symbol other) const FL_NOEXCEPT { return mId < other.mId; }
+
+  private:
+    u32 mId;
+};
+
+template <> struct Hash<Symbol> {
+    u32 operator()(Symbol sym) const FL_NOEXCEPT { return fast_hash32(sym.id()); }
+};
+
+// SymbolTable: interns strings into chunked arenas and hands out Symbols.
+// One allocation per chunk instead of one per string; strings longer than
+// a chunk get a chunk of their own. Arena bytes are NUL-terminated and never
+// move, so resolve() views and c_str() pointers stay valid until clear().
+// Thread-safety: NOT thread-safe. Synchronize externally if needed.
+class SymbolTable {
+  public:
+    explicit SymbolTable(fl::size chunk_bytes = 1024,
+                         memory_resource* resource = default_memory_resource()) FL_NOEXCEPT;
+    ~SymbolTable() FL_NOEXCEPT;
+
+    SymbolTable(const SymbolTable&) = delete;
+    SymbolTable& operator=(const SymbolTable&) = delete;
+
+    // Symbol for sv, adding it on first sight. The empty string is Symbol().
+    Symbol intern(const string_view& sv);
+    Symbol intern(const char* str);
+
+    // Symbol for sv if it was interned, Symbol() otherwise.
+    Symbol find(const string_view& sv) const;
+    bool contains(const string_view& sv) const { return sv.empty() || !find(sv).empty(); }
+
+    // Text of sym; empty for Symbol() and for ids this table never issued.
+    string_view resolve(Symbol sym) const;
+    const char* c_str(Symbol sym) const;
+
+    // Number of unique non-empty strings
+    fl::size size() const { return mSymbols.size(); }
+    bool empty() const { return mSymbols.empty(); }
+
+    // Bytes held by the arena chunks
+    fl::size arena_bytes() const { return mArenaBytes; }
+
+    // Drop every string. All outstanding Symbols become invalid.
+    void clear();
+
+    // Reserve capacity for expected number of strings
+    void reserve(fl::size count);
+
+  private:
+    struct Chunk {
+        char* data;
+        fl::size bytes;
+    };
+
+    char* allocate(fl::size bytes);
+
+    memory_resource* mResource;
+    fl::size mChunkBytes;
+    fl::vector<Chunk> mChunks;
+    char* mCursor = nullptr;  // Free space in the current chunk
+    fl::size mRemaining = 0;
+    fl::size mArenaBytes = 0;
+    fl::vector<string_view> mSymbols;  // Symbol id - 1 -> arena bytes
+    fl::swiss_map<string_view, u32> mIndex;
 };
 
 // Global string interner singleton (optional convenience)
@@ -86,4 +176,10 @@ fl::string intern(const fl::string& str);
 fl::string intern(const char* str);
 fl::string intern(const fl::span<const char>& sp);
 
+// Global symbol table (thread-safe via mutex). Symbols from it live for the
+// life of the program.
+SymbolTable& global_symbols();
+Symbol symbol(const string_view& sv);
+string_view symbol_name(Symbol sym);
+
 } // namespace fl
@@ -0,0 +1,564 @@
+#pragma once
+
+/*
+swiss_map: hash map in the Swiss-table layout, for lookup-heavy code.
+
+Every slot has one control byte: empty, deleted, or the low 7 bits of the
+key's hash. Slots are grouped 16 at a time and a lookup compares a whole
+group of control bytes against the hash tag with one SIMD match
+(fl::simd::match_u8_16), so most probes touch one group and only call the
+key comparison for real candidates. Groups are probed triangularly, which
+visits every group once when the group count is a power of two.
+
+Erase never leaves a tombstone when the slot's group still has an empty
+slot (no probe sequence can have continued past that group). Remaining
+tombstones are dropped by an in-place compaction instead of a growth when
+the table is mostly tombstones.
+
+The interface mirrors fl::unordered_map, including insert() overwriting an
+existing value, so the two are interchangeable. The table allocates nothing
+until the first insert and stores up to 7/8 of its capacity.
+*/
+
+#include "fl/math/simd/u8x16.h"
+#include "fl/stl/assert.h"  // IWYU pragma: keep
+#include "fl/stl/bit_cast.h"
+#include "fl/stl/bitset.h"
+#include "fl/stl/hash.h"
+#include "fl/stl/initializer_list.h"  // IWYU pragma: keep
+#include "fl/stl/int.h"
+#include "fl/stl/iterator.h"
+#include "fl/stl/memory_resource.h"
+#include "fl/stl/move.h"
+#include "fl/stl/noexcept.h"
+#include "fl/stl/pair.h"
+#include "fl/stl/unordered_map.h"  // EqualTo
+#include "fl/stl/vector.h"
+
+namespace fl {
+
+template <typename Key, typename T, typename Hash = Hash<Key>,
+          typename KeyEqual = EqualTo<Key>>
+class FL_ALIGN swiss_map {
+  public:
+    swiss_map() FL_NOEXCEPT {}
+
+    explicit swiss_map(memory_resource* resource) FL_NOEXCEPT
+        : mSlots(resource), mCtrl(resource) {}
+
+    explicit swiss_map(fl::size initial_capacity) { reserve(initial_capacity); }
+
+    swiss_map(const swiss_map& other) FL_NOEXCEPT
+        : mSlots(other.mSlots), mCtrl(other.mCtrl), mSize(other.mSize),
+          mGrowthLeft(other.mGrowthLeft), mHash(other.mHash),
+          mEqual(other.mEqual) {}
+
+    swiss_map(swiss_map&& other) FL_NOEXCEPT
+        : mSlots(fl::move(other.mSlots)), mCtrl(fl::move(other.mCtrl)),
+          mSize(other.mSize), mGrowthLeft(other.mGrowthLeft),
+          mHash(fl::move(other.mHash)), mEqual(fl::move(other.mEqual)) {
+        other.reset_moved_from();
+    }
+
+    template <typename InputIt> swiss_map(InputIt first, InputIt last) {
+        insert(first, last);
+    }
+
+    swiss_map(fl::initializer_list<pair<Key, T>> init) { insert(init); }
+
+    swiss_map& operator=(const swiss_map& other) FL_NOEXCEPT {
+        if (this != &other) {
+            mSlots = other.mSlots;
+            mCtrl = other.mCtrl;
+            mSize = other.mSize;
+            mGrowthLeft = other.mGrowthLeft;
+            mHash = other.mHash;
+            mEqual = other.mEqual;
+        }
+        return *this;
+    }
+
+    swiss_map& operator=(swiss_map&& other) FL_NOEXCEPT {
+        if (this != &other) {
+            mSlots = fl::move(other.mSlots);
+            mCtrl = fl::move(other.mCtrl);
+            mSize = other.mSize;
+            mGrowthLeft = other.mGrowthLeft;
+            mHash = fl::move(other.mHash);
+            mEqual = fl::move(other.mEqual);
+            other.reset_moved_from();
+        }
+        return *this;
+    }
+
+    swiss_map& operator=(fl::initializer_list<pair<Key, T>> init) FL_NOEXCEPT {
+        clear();
+        insert(init);
+        return *this;
+    }
+
+    struct iterator {
+        using value_type = pair<const Key, T>;
+        using pointer = value_type *;
+        using reference = value_type &;
+        using iterator_category = fl::forward_iterator_tag;
+
+        iterator() FL_NOEXCEPT : _map(nullptr), _idx(0) {}
+        iterator(swiss_map *m, fl::size idx) : _map(m), _idx(idx) {
+            advance_to_full();
+        }
+
+        reference operator*() const {
+            // Entry and pair<const Key, T> have the same memory layout
+            return *fl::bit_cast<value_type*>(&_map->mSlots[_idx]);
+        }
+        pointer operator->() const { return &(operator*()); }
+
+        iterator &operator++() {
+            ++_idx;
+            advance_to_full();
+            return *this;
+        }
+        iterator operator++(int) {
+            iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        bool operator==(const iterator &o) const {
+            return _map == o._map && _idx == o._idx;
+        }
+        bool operator!=(const iterator &o) const { return !(*this == o); }
+
+      private:
+        void advance_to_full() {
+            if (!_map)
+                return;
+            const fl::size cap = _map->capacity();
+            while (_idx < cap && !_map->is_full(_idx))
+                ++_idx;
+        }
+
+        swiss_map *_map;
+        fl::size _idx;
+        friend class swiss_map;
+    };
+
+    struct const_iterator {
+        using value_type = pair<const Key, T>;
+        using pointer = const value_type *;
+        using reference = const value_type &;
+        using iterator_category = fl::forward_iterator_tag;
+
+        const_iterator() FL_NOEXCEPT : _map(nullptr), _idx(0) {}
+        const_iterator(const swiss_map *m, fl::size idx) : _map(m), _idx(idx) {
+            advance_to_full();
+        }
+        const_iterator(const iterator &it) : _map(it._map), _idx(it._idx) {}
+
+        reference operator*() const {
+            return *fl::bit_cast<const value_type*>(&_map->mSlots[_idx]);
+        }
+        pointer operator->() const { return &(operator*()); }
+
+        const_iterator &operator++() {
+            ++_idx;
+            advance_to_full();
+            return *this;
+        }
+        const_iterator operator++(int) {
+            const_iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        bool operator==(const const_iterator &o) const {
+            return _map == o._map && _idx == o._idx;
+        }
+        bool operator!=(const const_iterator &o) const { return !(*this == o); }
+
+      private:
+        void advance_to_full() {
+            if (!_map)
+                return;
+            const fl::size cap = _map->capacity();
+            while (_idx < cap && !_map->is_full(_idx))
+                ++_idx;
+        }
+
+        const swiss_map *_map;
+        fl::size _idx;
+        friend class swiss_map;
+    };
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, capacity()); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, capacity()); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    // insert or overwrite - returns pair<iterator, bool>
+    // iterator points to element, bool is true if inserted, false if updated
+    pair<iterator, bool> insert(const Key &key, const T &value) {
+        pair<fl::size, bool> p = prepare_insert(key);
+        if (p.second) {
+            mSlots[p.first].key = key;
+        }
+        mSlots[p.first].value = value;
+        return {iterator(this, p.first), p.second};
+    }
+
+    pair<iterator, bool> insert(Key &&key, T &&value) {
+        pair<fl::size, bool> p = prepare_insert(key);
+        if (p.second) {
+            mSlots[p.first].key = fl::move(key);
+        }
+        mSlots[p.first].value = fl::move(value);
+        return {iterator(this, p.first), p.second};
+    }
+
+    pair<iterator, bool> insert(const pair<Key, T> &kv) {
+        return insert(kv.first, kv.second);
+    }
+
+    pair<iterator, bool> insert(pair<Key, T> &&kv) {
+        return insert(fl::move(kv.first), fl::move(kv.second));
+    }
+
+    template <typename InputIt> void insert(InputIt first, InputIt last) {
+        for (; first != last; ++first) {
+            insert(*first);
+        }
+    }
+
+    void insert(fl::initializer_list<pair<Key, T>> init) {
+        for (const auto &kv : init) {
+            insert(kv);
+        }
+    }
+
+    pair<iterator, bool> insert_or_assign(const Key &key, T &&value) {
+        pair<fl::size, bool> p = prepare_insert(key);
+        if (p.second) {
+            mSlots[p.first].key = key;
+        }
+        mSlots[p.first].value = fl::move(value);
+        return {iterator(this, p.first), p.second};
+    }
+
+    pair<iterator, bool> insert_or_assign(Key &&key, T &&value) {
+        return insert(fl::move(key), fl::move(value));
+    }
+
+    template <typename... Args> pair<iterator, bool> emplace(Args &&...args) {
+        pair<Key, T> kv(fl::forward<Args>(args)...);
+        return insert(fl::move(kv));
+    }
+
+    // try_emplace() - C++17: leaves an existing value untouched
+    template <typename... Args>
+    pair<iterator, bool> try_emplace(const Key &key, Args &&...args) {
+        pair<fl::size, bool> p = prepare_insert(key);
+        if (p.second) {
+            mSlots[p.first].key = key;
+            mSlots[p.first].value = T(fl::forward<Args>(args)...);
+        }
+        return {iterator(this, p.first), p.second};
+    }
+
+    template <typename... Args>
+    pair<iterator, bool> try_emplace(Key &&key, Args &&...args) {
+        pair<fl::size, bool> p = prepare_insert(key);
+        if (p.second) {
+            mSlots[p.first].key = fl::move(key);
+            mSlots[p.first].value = T(fl::forward<Args>(args)...);
+        }
+        return {iterator(this, p.first), p.second};
+    }
+
+    T &operator[](const Key &key) {
+        pair<fl::size, bool> p = prepare_insert(key);
+        if (p.second) {
+            mSlots[p.first].key = key;
+            mSlots[p.first].value = T{};
+        }
+        return mSlots[p.first].value;
+    }
+
+    // remove key; returns true if removed
+    bool remove(const Key &key) {
+        const fl::size idx = find_index(key);
+        if (idx == npos())
+            return false;
+        erase_at(idx);
+        return true;
+    }
+
+    bool erase(const Key &key) { return remove(key); }
+
+    iterator erase(iterator it) {
+        if (it._map != this || it._idx >= capacity() || !is_full(it._idx)) {
+            return end();
+        }
+        erase_at(it._idx);
+        ++it;
+        return it;
+    }
+
+    void clear() {
+        if (mSize == 0 && mGrowthLeft == max_fill(capacity())) {
+            return;
+        }
+        for (fl::size i = 0; i < capacity(); ++i) {
+            if (is_full(i)) {
+                mSlots[i] = Entry();  // Release the key and value now
+            }
+            mCtrl[i] = kEmpty;
+        }
+        mSize = 0;
+        mGrowthLeft = max_fill(capacity());
+    }
+
+    void swap(swiss_map &other) {
+        mSlots.swap(other.mSlots);
+        mCtrl.swap(other.mCtrl);
+        fl::swap(mSize, other.mSize);
+        fl::swap(mGrowthLeft, other.mGrowthLeft);
+        fl::swap(mHash, other.mHash);
+        fl::swap(mEqual, other.mEqual);
+    }
+
+    T *find_value(const Key &key) {
+        const fl::size idx = find_index(key);
+        return idx == npos() ? nullptr : &mSlots[idx].value;
+    }
+
+    const T *find_value(const Key &key) const {
+        const fl::size idx = find_index(key);
+        return idx == npos() ? nullptr : &mSlots[idx].value;
+    }
+
+    iterator find(const Key &key) {
+        const fl::size idx = find_index(key);
+        return idx == npos() ? end() : iterator(this, idx);
+    }
+
+    const_iterator find(const Key &key) const {
+        const fl::size idx = find_index(key);
+        return idx == npos() ? end() : const_iterator(this, idx);
+    }
+
+    bool contains(const Key &key) const { return find_index(key) != npos(); }
+
+    fl::size count(const Key &key) const { return contains(key) ? 1 : 0; }
+
+    T &at(const Key &key) {
+        T *value = find_value(key);
+        FASTLED_ASSERT(value != nullptr, "swiss_map::at: key not found");
+        return *value;
+    }
+
+    const T &at(const Key &key) const {
+        const T *value = find_value(key);
+        FASTLED_ASSERT(value != nullptr, "swiss_map::at: key not found");
+        return *value;
+    }
+
+    fl::size size() const { return mSize; }
+    bool empty() const { return mSize == 0; }
+    fl::size capacity() const { return mCtrl.size(); }
+    fl::size bucket_count() const { return capacity(); }
+
+    float load_factor() const {
+        return capacity() == 0 ? 0.0f
+                               : static_cast<float>(mSize) / static_cast<float>(capacity());
+    }
+
+    /// Grow so @p n elements fit without another rehash.
+    void reserve(fl::size n) {
+        fl::size cap = kGroupWidth;
+        while (max_fill(cap) < n) {
+            cap <<= 1;
+        }
+        if (cap > capacity()) {
+            rebuild(cap);
+        }
+    }
+
+    void rehash(fl::size n) {
+        if (n > capacity()) {
+            reserve(n - n / 8);
+        }
+    }
+
+    Hash hash_function() const { return mHash; }
+    KeyEqual key_eq() const { return mEqual; }
+
+    bool operator==(const swiss_map &other) const {
+        if (size() != other.size())
+            return false;
+        for (const auto &kv : *this) {
+            const T *value = other.find_value(kv.first);
+            if (!value || !(*value == kv.second))
+                return false;
+        }
+        return true;
+    }
+
+    bool operator!=(const swiss_map &other) const { return !(*this == other); }
+
+    memory_resource *get_memory_resource() const { return mSlots.get_resource(); }
+
+  private:
+    enum : u8 {
+        kEmpty = 0x80,
+        kDeleted = 0xFE,  // Full slots hold a 7-bit tag, so the high bit is clear
+    };
+    enum {
+        kGroupWidth = 16,
+    };
+
+    using EntryAlign = max_align<Key, T>;
+    struct FL_ALIGN_AS_T(EntryAlign::value) Entry {
+        Key key;
+        T value;
+    };
+
+    static fl::size npos() { return static_cast<fl::size>(-1); }
+
+    // 7/8 maximum load.
+    static fl::size max_fill(fl::size cap) { return cap - cap / 8; }
+
+    static u8 tag_of(u32 h) { return static_cast<u8>(h & 0x7F); }
+
+    bool is_full(fl::size idx) const { return (mCtrl[idx] & 0x80) == 0; }
+
+    u32 group_match(fl::size group, u8 value) const {
+        const simd::simd_u8x16 ctrl = simd::load_u8_16(mCtrl.data() + group * kGroupWidth);
+        return simd::match_u8_16(ctrl, value);
+    }
+
+    fl::size find_index(const Key &key) const {
+        if (mSize == 0) {
+            return npos();
+        }
+        return find_index_hashed(key, mHash(key));
+    }
+
+    fl::size find_index_hashed(const Key &key, u32 h) const {
+        const fl::size group_mask = capacity() / kGroupWidth - 1;
+        const u8 tag = tag_of(h);
+        fl::size group = (h >> 7) & group_mask;
+        for (fl::size probe = 1; probe <= group_mask + 1; ++probe) {
+            u32 match = group_match(group, tag);
+            while (match) {
+                const fl::size idx = group * kGroupWidth + fl::countr_zero(match);
+                if (mEqual(mSlots[idx].key, key)) {
+                    return idx;
+                }
+                match &= match - 1;
+            }
+            if (group_match(group, kEmpty)) {
+                return npos();  // The key would have been placed here
+            }
+            group = (group + probe) & group_mask;
+        }
+        return npos();
+    }
+
+    // First empty or deleted slot on the probe sequence of @p h.
+    fl::size find_free_slot(u32 h) const {
+        const fl::size group_mask = capacity() / kGroupWidth - 1;
+        fl::size group = (h >> 7) & group_mask;
+        for (fl::size probe = 1; probe <= group_mask + 1; ++probe) {
+            const u32 free = group_match(group, kEmpty) | group_match(group, kDeleted);
+            if (free) {
+                return group * kGroupWidth + fl::countr_zero(free);
+            }
+            group = (group + probe) & group_mask;
+        }
+        return npos();  // Unreachable: the load limit keeps a free slot
+    }
+
+    // Index of @p key, claiming a free slot (second == true) when it is
+    // missing. A claimed slot still needs its key and value assigned.
+    pair<fl::size, bool> prepare_insert(const Key &key) {
+        const u32 h = mHash(key);
+        if (mSize != 0) {
+            const fl::size idx = find_index_hashed(key, h);
+            if (idx != npos()) {
+                return {idx, false};
+            }
+        }
+        if (mGrowthLeft == 0) {
+            grow_or_compact();
+        }
+        const fl::size idx = find_free_slot(h);
+        if (mCtrl[idx] == kEmpty) {
+            --mGrowthLeft;  // Reusing a tombstone does not use up growth
+        }
+        mCtrl[idx] = tag_of(h);
+        ++mSize;
+        return {idx, true};
+    }
+
+    void erase_at(fl::size idx) {
+        mSlots[idx] = Entry();  // Release the key and value now
+        const fl::size group = idx / kGroupWidth;
+        // Lookups stop at a group with an empty slot, so if this group keeps
+        // one no probe sequence runs through it and the slot can be emptied.
+        if (group_match(group, kEmpty)) {
+            mCtrl[idx] = kEmpty;
+            ++mGrowthLeft;
+        } else {
+            mCtrl[idx] = kDeleted;
+        }
+        --mSize;
+    }
+
+    void grow_or_compact() {
+        const fl::size cap = capacity();
+        if (cap == 0) {
+            rebuild(kGroupWidth);
+        } else if (mSize <= max_fill(cap) / 2) {
+            rebuild(cap);  // Mostly tombstones: compact instead of growing
+        } else {
+            rebuild(cap * 2);
+        }
+    }
+
+    void rebuild(fl::size new_cap) {
+        memory_resource *resource = mSlots.get_resource();
+        fl::vector<Entry> old_slots(fl::move(mSlots));
+        fl::vector<u8> old_ctrl(fl::move(mCtrl));
+        mSlots = fl::vector<Entry>(new_cap, Entry(), resource);
+        mCtrl = fl::vector<u8>(new_cap, static_cast<u8>(kEmpty), resource);
+        mGrowthLeft = max_fill(new_cap) - mSize;
+        for (fl::size i = 0; i < old_ctrl.size(); ++i) {
+            if ((old_ctrl[i] & 0x80) != 0) {
+                continue;
+            }
+            const u32 h = mHash(old_slots[i].key);
+            const fl::size idx = find_free_slot(h);
+            mCtrl[idx] = tag_of(h);
+            mSlots[idx] = fl::move(old_slots[i]);
+        }
+    }
+
+    void reset_moved_from() {
+        mSlots.clear();
+        mCtrl.clear();
+        mSize = 0;
+        mGrowthLeft = 0;
+    }
+
+    fl::vector<Entry> mSlots;
+    fl::vector<u8> mCtrl;  // One control byte per slot
+    fl::size mSize = 0;
+    fl::size mGrowthLeft = 0;  // Empty slots that may still be filled
+    Hash mHash;
+    KeyEqual mEqual;
+};
+
+} // namespace fl
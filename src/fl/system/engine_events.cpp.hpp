@@ -1,4 +1,5 @@
 #include "fl/system/engine_events.h"
+#include "fl/system/frame_budget.h"
 #include "fl/stl/int.h"
 // Note: fl/stl/cstdio.h intentionally NOT included — workaround for
 // zackees/zccache#619 (Windows PCH path-spelling drift). The comment
@@ -87,6 +88,7 @@ void EngineEvents::_onBeginFrame() {
     ListenerList copy = mListeners;
     for (auto &item : copy) {
         auto listener = item.listener;
+        FrameBudget::Section section(listener, listener->listenerName());
         listener->onBeginFrame();
     }
 }
@@ -97,6 +99,7 @@ void EngineEvents::_onEndShowLeds() {
     ListenerList copy = mListeners;
     for (auto &item : copy) {
         auto listener = item.listener;
+        FrameBudget::Section section(listener, listener->listenerName());
         listener->onEndShowLeds();
     }
 }
@@ -107,6 +110,7 @@ void EngineEvents::_onEndFrame() {
     ListenerList copy = mListeners;
     for (auto &item : copy) {
         auto listener = item.listener;
+        FrameBudget::Section section(listener, listener->listenerName());
         listener->onEndFrame();
     }
 }
@@ -43,6 +43,8 @@ class EngineEvents {
         virtual void onPlatformPreLoop() FL_NOEXCEPT {}
         virtual void onPlatformPreLoop2() FL_NOEXCEPT {}
         virtual void onExit() FL_NOEXCEPT {}  // Called before engine shutdown
+        // Label for this listener's section in FrameBudget stats.
+        virtual const char *listenerName() const FL_NOEXCEPT { return "listener"; }
     };
 
     static void addListener(Listener *listener, int priority = 0) FL_NOEXCEPT {
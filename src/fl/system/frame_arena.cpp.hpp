@@ -0,0 +1,160 @@
+#include "fl/system/frame_arena.h"
+#include "fl/stl/cstddef.h"  // fl::max_align_t
+#include "fl/stl/noexcept.h"
+
+namespace fl {
+
+namespace {
+
+constexpr fl::size kArenaAlign = alignof(fl::max_align_t);
+
+inline fl::size arenaAlign(fl::size n) FL_NOEXCEPT {
+    return (n + kArenaAlign - 1) & ~(kArenaAlign - 1);
+}
+
+// Block size for a given peak: every allocation is padded to kArenaAlign,
+// so leave some room for it.
+inline fl::size arenaSizeFor(fl::size peak) FL_NOEXCEPT {
+    return arenaAlign(peak + peak / 4);
+}
+
+} // anonymous namespace
+
+constexpr fl::u32 frame_arena_resource::kShrinkFrames;
+
+frame_arena_resource::frame_arena_resource(fl::size initial_capacity,
+                                           memory_resource* upstream) FL_NOEXCEPT
+    : mUpstream(upstream ? upstream : default_memory_resource())
+    , mOverflow(mUpstream) {
+    if (initial_capacity > 0) {
+        mCapacity = arenaAlign(initial_capacity);
+        mBlock = static_cast<char*>(mUpstream->allocate(mCapacity));
+        if (!mBlock) {
+            mCapacity = 0;
+        }
+    }
+    mMinCapacity = mCapacity;
+    mCursor = mBlock;
+    EngineEvents::addListener(this);
+}
+
+frame_arena_resource::~frame_arena_resource() FL_NOEXCEPT {
+    EngineEvents::removeListener(this);
+    mOverflow.release();
+    mUpstream->deallocate(mBlock, mCapacity);
+}
+
+fl::size frame_arena_resource::used() const FL_NOEXCEPT {
+    return static_cast<fl::size>(mCursor - mBlock) + mOverflow.bytes_used();
+}
+
+bool frame_arena_resource::inPrimary(const void* p) const FL_NOEXCEPT {
+    const char* c = static_cast<const char*>(p);
+    return mBlock && c >= mBlock && c < mBlock + mCapacity;
+}
+
+void frame_arena_resource::notePeak() FL_NOEXCEPT {
+    const fl::size u = used();
+    if (u > mPeak) {
+        mPeak = u;
+    }
+}
+
+void frame_arena_resource::reset() FL_NOEXCEPT {
+    const fl::size framePeak = mPeak;
+    mLastFramePeak = framePeak;
+    mPeak = 0;
+    if (mOverflow.bytes_used() > 0 || framePeak > mCapacity) {
+        // Slow path, only after a frame that outgrew the primary block:
+        // hand the overflow back and resize so next frame stays in one block.
+        ++mOverflowFrames;
+        mOverflow.release();
+        if (framePeak > mCapacity) {
+            resizeBlock(arenaSizeFor(framePeak));
+        }
+        mQuietFrames = 0;
+        mQuietPeak = 0;
+    } else if (mCapacity > mMinCapacity && framePeak <= mCapacity / 2) {
+        // A one-off spike should not pin the block at its size forever.
+        if (framePeak > mQuietPeak) {
+            mQuietPeak = framePeak;
+        }
+        if (++mQuietFrames >= kShrinkFrames) {
+            const fl::size want = arenaSizeFor(mQuietPeak);
+            resizeBlock(want > mMinCapacity ? want : mMinCapacity);
+            mQuietFrames = 0;
+            mQuietPeak = 0;
+        }
+    } else {
+        mQuietFrames = 0;
+        mQuietPeak = 0;
+    }
+    mCursor = mBlock;
+    mLast = nullptr;
+}
+
+void frame_arena_resource::resizeBlock(fl::size bytes) FL_NOEXCEPT {
+    // Only called from reset(): nothing in the primary block is live.
+    if (bytes == 0) {
+        mUpstream->deallocate(mBlock, mCapacity);
+        mBlock = nullptr;
+        mCapacity = 0;
+        return;
+    }
+    char* block = static_cast<char*>(mUpstream->allocate(bytes));
+    if (block) {
+        mUpstream->deallocate(mBlock, mCapacity);
+        mBlock = block;
+        mCapacity = bytes;
+    }
+}
+
+void* frame_arena_resource::do_allocate(fl::size bytes) FL_NOEXCEPT {
+    const fl::size padded = arenaAlign(bytes);
+    if (mBlock && static_cast<fl::size>(mBlock + mCapacity - mCursor) >= padded) {
+        void* p = mCursor;
+        mLast = mCursor;
+        mCursor += padded;
+        notePeak();
+        return p;
+    }
+    void* p = mOverflow.allocate(bytes);
+    notePeak();
+    return p;
+}
+
+void frame_arena_resource::do_deallocate(void* p, fl::size bytes) FL_NOEXCEPT {
+    if (!inPrimary(p)) {
+        mOverflow.deallocate(p, bytes);
+        return;
+    }
+    // Roll back the most recent allocation; everything else waits for reset().
+    char* c = static_cast<char*>(p);
+    if (c == mLast && c + arenaAlign(bytes) == mCursor) {
+        mCursor = c;
+        mLast = nullptr;
+    }
+}
+
+void* frame_arena_resource::do_reallocate(void* p, fl::size old_bytes,
+                                          fl::size new_bytes) FL_NOEXCEPT {
+    if (!inPrimary(p)) {
+        return mOverflow.reallocate(p, old_bytes, new_bytes);
+    }
+    char* c = static_cast<char*>(p);
+    const fl::size padded = arenaAlign(new_bytes);
+    if (c == mLast && c + arenaAlign(old_bytes) == mCursor &&
+        static_cast<fl::size>(mBlock + mCapacity - c) >= padded) {
+        mCursor = c + padded;
+        notePeak();
+        return p;
+    }
+    return nullptr;
+}
+
+memory_resource* frame_memory_resource() FL_NOEXCEPT {
+    static frame_arena_resource instance;
+    return &instance;
+}
+
+} // namespace fl
@@ -0,0 +1,91 @@
+#pragma once
+
+/// @file frame_arena.h
+/// Per-frame bump allocator that rewinds at EngineEvents::onEndFrame.
+///
+/// Scratch objects created while drawing a frame (effect temporaries, JSON
+/// RPC documents, formatted strings) can be allocated from
+/// `fl::frame_memory_resource()` instead of the general heap. Nothing is
+/// freed individually; the whole arena is rewound in O(1) when the frame
+/// ends, so the heap never sees the churn and cannot fragment from it.
+///
+/// @code
+/// fl::vector<fl::vec2f> pts(fl::frame_memory_resource());
+/// fl::json doc = fl::json::parse(rpcText, fl::frame_memory_resource());
+/// @endcode
+///
+/// The primary block follows recent demand: it grows after a frame that
+/// overflowed it, and shrinks back once kShrinkFrames frames in a row have
+/// used less than half of it (never below the initial capacity).
+///
+/// Anything allocated from a frame arena must be destroyed before the frame
+/// ends. When FASTLED_HAS_ENGINE_EVENTS is 0 the arena is never rewound
+/// automatically; call reset() from the sketch loop instead.
+
+#include "fl/stl/int.h"
+#include "fl/stl/memory_resource.h"
+#include "fl/system/engine_events.h"
+#include "fl/stl/noexcept.h"
+
+namespace fl {
+
+class frame_arena_resource : public memory_resource,
+                             public EngineEvents::Listener {
+  public:
+    /// Consecutive lightly used frames before the primary block shrinks.
+    static constexpr fl::u32 kShrinkFrames = 120;
+
+    /// @param initial_capacity Size of the primary block (0 = grow on demand)
+    /// @param upstream Where the primary block and overflow chunks come from
+    explicit frame_arena_resource(
+        fl::size initial_capacity = 0,
+        memory_resource* upstream = default_memory_resource()) FL_NOEXCEPT;
+    ~frame_arena_resource() FL_NOEXCEPT override;
+
+    frame_arena_resource(const frame_arena_resource&) = delete;
+    frame_arena_resource& operator=(const frame_arena_resource&) = delete;
+
+    /// Invalidate every allocation made since the last reset. O(1) unless the
+    /// frame overflowed the primary block, in which case the overflow chunks
+    /// are returned and the primary block is regrown to the frame's peak so
+    /// the next frame fits; or unless the block is due to shrink.
+    void reset() FL_NOEXCEPT;
+
+    fl::size capacity() const FL_NOEXCEPT { return mCapacity; }
+    fl::size used() const FL_NOEXCEPT;
+    /// Highest usage so far in the current frame.
+    fl::size peak() const FL_NOEXCEPT { return mPeak; }
+    /// Highest usage of the frame ended by the last reset().
+    fl::size lastFramePeak() const FL_NOEXCEPT { return mLastFramePeak; }
+    fl::u32 overflowFrames() const FL_NOEXCEPT { return mOverflowFrames; }
+
+    void onEndFrame() FL_NOEXCEPT override { reset(); }
+
+  protected:
+    void* do_allocate(fl::size bytes) FL_NOEXCEPT override;
+    void do_deallocate(void* p, fl::size bytes) FL_NOEXCEPT override;
+    void* do_reallocate(void* p, fl::size old_bytes, fl::size new_bytes) FL_NOEXCEPT override;
+
+  private:
+    bool inPrimary(const void* p) const FL_NOEXCEPT;
+    void notePeak() FL_NOEXCEPT;
+    void resizeBlock(fl::size bytes) FL_NOEXCEPT;
+
+    memory_resource* mUpstream;
+    char* mBlock = nullptr;
+    fl::size mCapacity = 0;
+    char* mCursor = nullptr;
+    char* mLast = nullptr;  // start of the most recent primary allocation
+    monotonic_buffer_resource mOverflow;
+    fl::size mMinCapacity = 0;      // initial capacity; never shrink below
+    fl::size mPeak = 0;             // current frame
+    fl::size mLastFramePeak = 0;
+    fl::size mQuietPeak = 0;        // highest peak of the current quiet run
+    fl::u32 mQuietFrames = 0;       // consecutive frames under half capacity
+    fl::u32 mOverflowFrames = 0;
+};
+
+/// Process-wide frame arena, rewound at the end of every FastLED.show().
+memory_resource* frame_memory_resource() FL_NOEXCEPT;
+
+} // namespace fl
@@ -0,0 +1,278 @@
+#include "fl/system/frame_budget.h"
+#include "fl/remote/remote.h"
+#include "fl/stl/chrono.h"
+#include "fl/stl/json.h"
+#include "fl/stl/noexcept.h"
+
+namespace fl {
+
+namespace {
+
+// Run after every other onEndFrame listener so their time lands in the
+// frame being closed.
+constexpr int kFrameBudgetPriority = -1000;
+
+inline fl::u32 budgetEma(fl::u32 avg, fl::u32 sample) FL_NOEXCEPT {
+    const fl::i64 delta = static_cast<fl::i64>(sample) - static_cast<fl::i64>(avg);
+    return static_cast<fl::u32>(static_cast<fl::i64>(avg) + delta / 8);
+}
+
+} // anonymous namespace
+
+constexpr fl::u8 FrameBudget::kMaxLevel;
+constexpr int FrameBudget::kMaxSections;
+constexpr fl::u8 FrameBudget::kDegradeFrames;
+constexpr fl::u8 FrameBudget::kRecoverFrames;
+constexpr fl::u8 FrameBudget::kRecoverPercent;
+constexpr fl::u8 FrameBudget::kSettleFrames;
+
+FrameBudget* FrameBudget::sActive = nullptr;
+
+FrameBudget::FrameBudget() FL_NOEXCEPT = default;
+
+FrameBudget::~FrameBudget() FL_NOEXCEPT {
+    if (sActive == this) {
+        sActive = nullptr;
+    }
+    EngineEvents::removeListener(this);
+}
+
+void FrameBudget::setTargetFps(float fps) FL_NOEXCEPT {
+    mInFrame = false;
+    mHaveEnd = false;
+    mOverStreak = 0;
+    mUnderStreak = 0;
+    if (fps <= 0.0f) {
+        mTargetFps = 0.0f;
+        mBudgetMicros = 0;
+        if (sActive == this) {
+            sActive = nullptr;
+        }
+        EngineEvents::removeListener(this);
+        changeLevel(0);
+        return;
+    }
+    mTargetFps = fps;
+    mBudgetMicros = static_cast<fl::u32>(1000000.0f / fps);
+    sActive = this;
+    EngineEvents::addListener(this, kFrameBudgetPriority);
+}
+
+void FrameBudget::setLevel(fl::u8 level) FL_NOEXCEPT {
+    changeLevel(level > kMaxLevel ? kMaxLevel : level);
+}
+
+int FrameBudget::onQualityChanged(fl::function<void(fl::u8)> callback) FL_NOEXCEPT {
+    return mCallbacks.add(callback);
+}
+
+void FrameBudget::removeQualityCallback(int id) FL_NOEXCEPT {
+    mCallbacks.remove(id);
+}
+
+void FrameBudget::beginFrame(fl::u32 nowMicros) FL_NOEXCEPT {
+    mRender = mHaveEnd ? nowMicros - mLastEnd : 0;
+    mFrameStart = nowMicros;
+    mInFrame = true;
+}
+
+void FrameBudget::endFrame(fl::u32 nowMicros) FL_NOEXCEPT {
+    if (!mInFrame) {
+        return;
+    }
+    mInFrame = false;
+    mLastShow = nowMicros - mFrameStart;
+    mLastRender = mRender;
+    const bool complete = mHaveEnd;  // First frame has no render interval
+    mLastEnd = nowMicros;
+    mHaveEnd = true;
+    if (complete) {
+        closeFrame(mLastRender + mLastShow);
+    }
+}
+
+void FrameBudget::closeFrame(fl::u32 load) FL_NOEXCEPT {
+    ++mFrames;
+    mLastLoad = load;
+    mAvgLoad = (mFrames == 1) ? load : budgetEma(mAvgLoad, load);
+
+    for (int i = 0; i < mSectionCount; ++i) {
+        FrameSectionStats& s = mSections[i];
+        const fl::u32 us = mSectionMicros[i];
+        mSectionMicros[i] = 0;
+        s.lastMicros = us;
+        if (s.lastFrame != mFrames) {
+            continue;  // Did not run this frame
+        }
+        s.avgMicros = (s.frameCount == 0) ? us : budgetEma(s.avgMicros, us);
+        s.maxMicros = us > s.maxMicros ? us : s.maxMicros;
+        ++s.frameCount;
+    }
+
+    if (mBudgetMicros == 0) {
+        return;
+    }
+    const bool over = load > mBudgetMicros;
+    if (over) {
+        ++mOverruns;
+    }
+    if (mSettle > 0) {
+        --mSettle;
+        return;
+    }
+    if (over) {
+        mUnderStreak = 0;
+        if (++mOverStreak >= kDegradeFrames && mLevel < kMaxLevel) {
+            changeLevel(mLevel + 1);
+        }
+    } else if (static_cast<fl::u64>(load) * 100 <
+               static_cast<fl::u64>(mBudgetMicros) * kRecoverPercent) {
+        mOverStreak = 0;
+        if (++mUnderStreak >= kRecoverFrames && mLevel > 0) {
+            changeLevel(mLevel - 1);
+        }
+    } else {
+        // Inside the hysteresis band: hold the current level.
+        mOverStreak = 0;
+        mUnderStreak = 0;
+    }
+}
+
+void FrameBudget::changeLevel(fl::u8 level) FL_NOEXCEPT {
+    if (level == mLevel) {
+        return;
+    }
+    mLevel = level;
+    mOverStreak = 0;
+    mUnderStreak = 0;
+    mSettle = kSettleFrames;
+    mCallbacks.invoke(level);
+}
+
+int FrameBudget::sectionSlot(const void* key, const char* name) FL_NOEXCEPT {
+    for (int i = 0; i < mSectionCount; ++i) {
+        if (mSections[i].key == key) {
+            return i;
+        }
+    }
+    int slot = -1;
+    if (mSectionCount < kMaxSections) {
+        slot = mSectionCount++;
+    } else {
+        // Full: recycle the section that has been idle longest, e.g. an Fx
+        // that was destroyed. Sections already timed this frame are kept.
+        fl::u32 oldest = 0xFFFFFFFFu;
+        for (int i = 0; i < kMaxSections; ++i) {
+            if (mSections[i].lastFrame <= mFrames && mSections[i].lastFrame < oldest) {
+                oldest = mSections[i].lastFrame;
+                slot = i;
+            }
+        }
+        if (slot < 0) {
+            return -1;
+        }
+    }
+    FrameSectionStats& s = mSections[slot];
+    s = FrameSectionStats();
+    s.key = key;
+    s.name = name ? name : "section";
+    mSectionMicros[slot] = 0;
+    return slot;
+}
+
+void FrameBudget::record(const void* key, const char* name, fl::u32 micros) FL_NOEXCEPT {
+    const int slot = sectionSlot(key, name);
+    if (slot >= 0) {
+        mSectionMicros[slot] += micros;
+        mSections[slot].lastFrame = mFrames + 1;  // The frame being measured
+    }
+}
+
+const FrameSectionStats* FrameBudget::findSection(const void* key) const FL_NOEXCEPT {
+    for (int i = 0; i < mSectionCount; ++i) {
+        if (mSections[i].key == key) {
+            return &mSections[i];
+        }
+    }
+    return nullptr;
+}
+
+void FrameBudget::reset() FL_NOEXCEPT {
+    mFrames = 0;
+    mOverruns = 0;
+    mLastLoad = 0;
+    mAvgLoad = 0;
+    mLastRender = 0;
+    mLastShow = 0;
+    mOverStreak = 0;
+    mUnderStreak = 0;
+    mSettle = 0;
+    for (int i = 0; i < kMaxSections; ++i) {
+        mSections[i] = FrameSectionStats();
+        mSectionMicros[i] = 0;
+    }
+    mSectionCount = 0;
+}
+
+fl::json FrameBudget::stats() const FL_NOEXCEPT {
+    fl::json out = fl::json::object();
+    out.set("targetFps", mTargetFps);
+    out.set("budgetUs", static_cast<fl::i64>(mBudgetMicros));
+    out.set("level", static_cast<int>(mLevel));
+    out.set("maxLevel", static_cast<int>(kMaxLevel));
+    out.set("frames", static_cast<fl::i64>(mFrames));
+    out.set("overruns", static_cast<fl::i64>(mOverruns));
+    out.set("loadUs", static_cast<fl::i64>(mLastLoad));
+    out.set("avgLoadUs", static_cast<fl::i64>(mAvgLoad));
+    out.set("renderUs", static_cast<fl::i64>(mLastRender));
+    out.set("showUs", static_cast<fl::i64>(mLastShow));
+    fl::json sections = fl::json::array();
+    for (int i = 0; i < mSectionCount; ++i) {
+        const FrameSectionStats& s = mSections[i];
+        fl::json entry = fl::json::object();
+        entry.set("name", s.name);
+        entry.set("lastUs", static_cast<fl::i64>(s.lastMicros));
+        entry.set("avgUs", static_cast<fl::i64>(s.avgMicros));
+        entry.set("maxUs", static_cast<fl::i64>(s.maxMicros));
+        entry.set("frames", static_cast<fl::i64>(s.frameCount));
+        sections.push_back(entry);
+    }
+    out.set("sections", sections);
+    return out;
+}
+
+void FrameBudget::bindRemote(Remote& remote, const char* prefix) FL_NOEXCEPT {
+    const fl::string base(prefix);
+    remote.bind((base + ".stats").c_str(), [this]() -> fl::json { return stats(); });
+    remote.bind((base + ".setTargetFps").c_str(), [this](float fps) { setTargetFps(fps); });
+    remote.bind((base + ".reset").c_str(), [this]() { reset(); });
+}
+
+void FrameBudget::onBeginFrame() FL_NOEXCEPT {
+    beginFrame(fl::micros());
+}
+
+void FrameBudget::onEndFrame() FL_NOEXCEPT {
+    endFrame(fl::micros());
+}
+
+FrameBudget::Section::Section(const void* key, const char* name) FL_NOEXCEPT
+    : mBudget(sActive), mKey(key), mName(name), mStart(0) {
+    if (mBudget) {
+        mStart = fl::micros();
+    }
+}
+
+FrameBudget::Section::~Section() FL_NOEXCEPT {
+    // The budget may have been stopped while this scope was open.
+    if (mBudget && mBudget == sActive) {
+        mBudget->record(mKey, mName, fl::micros() - mStart);
+    }
+}
+
+FrameBudget& frame_budget() FL_NOEXCEPT {
+    static FrameBudget instance;
+    return instance;
+}
+
+} // namespace fl
@@ -0,0 +1,190 @@
+#pragma once
+
+/// @file frame_budget.h
+/// Frame-time budget scheduler with adaptive quality.
+///
+/// `fl::frame_budget()` listens to EngineEvents and measures every frame
+/// (the window between two `FastLED.show()` calls): time spent rendering in
+/// the sketch loop, time spent inside show(), and named sections for each
+/// EngineEvents listener and each Fx drawn through FxEngine. When the
+/// measured load keeps exceeding the target frame period it raises a quality
+/// level; effects that opt in read that level and shed work (lower wave
+/// supersampling, fewer noise octaves, fewer blur passes). Once the load
+/// falls well below the budget the level steps back down.
+///
+/// @code
+/// fl::frame_budget().setTargetFps(60);
+/// waveFx.setAdaptiveQuality(true);
+/// blend.setAdaptiveQuality(true);
+///
+/// // Custom effects scale their own work:
+/// fill_raw_2dnoise8(buf, w, h, fl::FrameBudget::scaleToQuality(4), ...);
+///
+/// // Stats over RPC: {"method": "frameBudget.stats"}
+/// fl::frame_budget().bindRemote(remote);
+/// @endcode
+///
+/// Load is measured from the end of one show() to the end of the next, so a
+/// blocking delay() in the loop or FastLED.setMaxRefreshRate() at the same
+/// rate counts as work. Pace the sketch with the target FPS instead.
+/// When FASTLED_HAS_ENGINE_EVENTS is 0 nothing is measured automatically;
+/// drive beginFrame()/endFrame() from the sketch loop.
+
+#include "fl/stl/function.h"
+#include "fl/stl/int.h"
+#include "fl/stl/string.h"
+#include "fl/system/engine_events.h"
+#include "fl/stl/noexcept.h"
+
+namespace fl {
+
+class json;
+class Remote;
+
+/// Timing for one measured section, refreshed once per frame.
+struct FrameSectionStats {
+    const void* key = nullptr;
+    fl::string name;
+    fl::u32 lastMicros = 0;  // Total time in the last completed frame
+    fl::u32 avgMicros = 0;   // Exponential moving average (1/8 weight)
+    fl::u32 maxMicros = 0;   // Worst frame since reset()
+    fl::u32 lastFrame = 0;   // Frame index the section last ran in
+    fl::u32 frameCount = 0;  // Frames the section ran in since reset()
+};
+
+class FrameBudget : public EngineEvents::Listener {
+  public:
+    /// Quality levels run from 0 (full quality) to kMaxLevel; each level
+    /// roughly halves the optional work an effect does.
+    static constexpr fl::u8 kMaxLevel = 3;
+    static constexpr int kMaxSections = 16;
+    /// Consecutive over-budget frames before degrading.
+    static constexpr fl::u8 kDegradeFrames = 3;
+    /// Consecutive frames under kRecoverPercent of budget before recovering.
+    static constexpr fl::u8 kRecoverFrames = 60;
+    static constexpr fl::u8 kRecoverPercent = 70;
+    /// Frames to ignore after a level change while the new load settles.
+    static constexpr fl::u8 kSettleFrames = 8;
+
+    FrameBudget() FL_NOEXCEPT;
+    ~FrameBudget() FL_NOEXCEPT override;
+
+    FrameBudget(const FrameBudget&) = delete;
+    FrameBudget& operator=(const FrameBudget&) = delete;
+
+    /// Start budgeting at @p fps and listen to EngineEvents. 0 stops
+    /// budgeting, detaches from EngineEvents and restores full quality.
+    void setTargetFps(float fps) FL_NOEXCEPT;
+    float targetFps() const FL_NOEXCEPT { return mTargetFps; }
+    fl::u32 budgetMicros() const FL_NOEXCEPT { return mBudgetMicros; }
+    bool enabled() const FL_NOEXCEPT { return mBudgetMicros != 0; }
+
+    fl::u8 level() const FL_NOEXCEPT { return mLevel; }
+    /// Pin the quality level, e.g. from a UI control. Adaptation resumes on
+    /// the next frame that crosses a threshold.
+    void setLevel(fl::u8 level) FL_NOEXCEPT;
+
+    /// Called with the new level whenever it changes. Returns an id for
+    /// removeQualityCallback().
+    int onQualityChanged(fl::function<void(fl::u8)> callback) FL_NOEXCEPT;
+    void removeQualityCallback(int id) FL_NOEXCEPT;
+
+    /// Frame boundaries. EngineEvents calls these from show(); they are
+    /// public so sketches without engine events (and tests) can drive them.
+    void beginFrame(fl::u32 nowMicros) FL_NOEXCEPT;
+    void endFrame(fl::u32 nowMicros) FL_NOEXCEPT;
+
+    /// Add @p micros to the section identified by @p key for the current
+    /// frame. @p name is copied when the section is first seen.
+    void record(const void* key, const char* name, fl::u32 micros) FL_NOEXCEPT;
+
+    fl::u32 frames() const FL_NOEXCEPT { return mFrames; }
+    fl::u32 overruns() const FL_NOEXCEPT { return mOverruns; }
+    fl::u32 lastLoadMicros() const FL_NOEXCEPT { return mLastLoad; }
+    fl::u32 avgLoadMicros() const FL_NOEXCEPT { return mAvgLoad; }
+    fl::u32 lastRenderMicros() const FL_NOEXCEPT { return mLastRender; }
+    fl::u32 lastShowMicros() const FL_NOEXCEPT { return mLastShow; }
+    int sectionCount() const FL_NOEXCEPT { return mSectionCount; }
+    const FrameSectionStats& section(int i) const FL_NOEXCEPT { return mSections[i]; }
+    const FrameSectionStats* findSection(const void* key) const FL_NOEXCEPT;
+
+    /// Clear counters and sections. The target and level are kept.
+    void reset() FL_NOEXCEPT;
+
+    /// Snapshot of the counters, suitable for an RPC response.
+    fl::json stats() const FL_NOEXCEPT;
+
+    /// Bind "<prefix>.stats", "<prefix>.setTargetFps" and "<prefix>.reset".
+    void bindRemote(Remote& remote, const char* prefix = "frameBudget") FL_NOEXCEPT;
+
+    /// Level of the budget that is currently running, 0 when none is.
+    static fl::u8 qualityLevel() FL_NOEXCEPT {
+        return sActive ? sActive->mLevel : 0;
+    }
+
+    /// @p full halved once per quality level, never below @p minimum.
+    /// Use for octave counts, blur passes, supersampling factors.
+    static fl::u8 scaleToQuality(fl::u8 full, fl::u8 minimum = 1) FL_NOEXCEPT {
+        const fl::u8 scaled = static_cast<fl::u8>(full >> qualityLevel());
+        return scaled < minimum ? (full < minimum ? full : minimum) : scaled;
+    }
+
+    /// Times a scope into the running budget's section for @p key. Costs one
+    /// pointer test when no budget is running.
+    class Section {
+      public:
+        explicit Section(const void* key, const char* name = nullptr) FL_NOEXCEPT;
+        ~Section() FL_NOEXCEPT;
+        Section(const Section&) = delete;
+        Section& operator=(const Section&) = delete;
+
+      private:
+        FrameBudget* mBudget;
+        const void* mKey;
+        const char* mName;
+        fl::u32 mStart;
+    };
+
+    // EngineEvents::Listener
+    void onBeginFrame() FL_NOEXCEPT override;
+    void onEndFrame() FL_NOEXCEPT override;
+    const char* listenerName() const FL_NOEXCEPT override { return "FrameBudget"; }
+
+  private:
+    void closeFrame(fl::u32 load) FL_NOEXCEPT;
+    void changeLevel(fl::u8 level) FL_NOEXCEPT;
+    int sectionSlot(const void* key, const char* name) FL_NOEXCEPT;
+
+    static FrameBudget* sActive;
+
+    float mTargetFps = 0.0f;
+    fl::u32 mBudgetMicros = 0;
+    fl::u8 mLevel = 0;
+    fl::u8 mOverStreak = 0;
+    fl::u8 mUnderStreak = 0;
+    fl::u8 mSettle = 0;
+
+    bool mInFrame = false;
+    bool mHaveEnd = false;
+    fl::u32 mFrameStart = 0;  // beginFrame() of the current frame
+    fl::u32 mLastEnd = 0;     // endFrame() of the previous frame
+    fl::u32 mRender = 0;      // Previous end to current begin
+
+    fl::u32 mFrames = 0;
+    fl::u32 mOverruns = 0;
+    fl::u32 mLastLoad = 0;
+    fl::u32 mAvgLoad = 0;
+    fl::u32 mLastRender = 0;
+    fl::u32 mLastShow = 0;
+
+    FrameSectionStats mSections[kMaxSections];
+    fl::u32 mSectionMicros[kMaxSections] = {};  // Accumulator for this frame
+    int mSectionCount = 0;
+
+    fl::function_list<void(fl::u8)> mCallbacks;
+};
+
+/// Process-wide frame budget. Idle until setTargetFps() is called.
+FrameBudget& frame_budget() FL_NOEXCEPT;
+
+} // namespace fl
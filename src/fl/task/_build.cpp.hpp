@@ -5,5 +5,6 @@
 #include "fl/task/executor.cpp.hpp"
 #include "fl/task/scheduler.cpp.hpp"
 #include "fl/task/task.cpp.hpp"
+#include "fl/task/worker_pool.cpp.hpp"
 
 // begin sub directory includes
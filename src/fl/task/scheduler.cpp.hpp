@@ -1,6 +1,8 @@
 #include "fl/task/scheduler.h"
 #include "fl/stl/singleton.h"
+#include "fl/stl/algorithm.h"
 #include "fl/stl/chrono.h"
+#include "fl/stl/limits.h"
 #include "fl/log/log.h"
 
 namespace fl {
@@ -11,56 +13,99 @@ Scheduler& Scheduler::instance() {
     return fl::Singleton<Scheduler>::instance();
 }
 
+namespace {
+
+// Wrap-safe deadline order; equal deadlines run in registration order.
+inline bool timer_before(u32 due_a, int seq_a, u32 due_b, int seq_b) {
+    const i32 delta = static_cast<i32>(due_a - due_b);
+    return delta < 0 || (delta == 0 && seq_a < seq_b);
+}
+
+} // namespace
+
 int Scheduler::add_task(Handle t) {
-    if (t.is_valid()) {
-        int task_id = mNextTaskId.fetch_add(1);
-        t._set_id(task_id);
-        mTasks.push_back(fl::move(t));
-        return task_id;
+    if (!t.is_valid()) {
+        return 0; // Invalid task
     }
-    return 0; // Invalid task
+    if (t._is_queued()) {
+        return t._id(); // Already registered, e.g. by then()
+    }
+    int task_id = mNextTaskId.fetch_add(1);
+    t._set_id(task_id);
+    t._set_queued(true);
+    switch (t._type()) {
+    case TaskType::kBeforeFrame:
+        mBeforeFrame.push_back(fl::move(t));
+        break;
+    case TaskType::kAfterFrame:
+        mAfterFrame.push_back(fl::move(t));
+        break;
+    case TaskType::kCoroutine:
+        mCoroutines.push_back(fl::move(t));
+        break;
+    default:
+        push_timer(t, fl::millis());
+        break;
+    }
+    return task_id;
 }
 
 void Scheduler::update() {
     u32 current_time = fl::millis();
 
-    // Use index-based iteration to avoid iterator invalidation issues
-    for (fl::size i = 0; i < mTasks.size();) {
-        Handle& t = mTasks[i];
+    // Coroutines run on their own; only drop the handles of finished ones.
+    fl::size kept = 0;
+    for (fl::size i = 0; i < mCoroutines.size(); ++i) {
+        if (mCoroutines[i].is_valid() && !mCoroutines[i]._is_canceled()) {
+            if (kept != i) {
+                mCoroutines[kept] = fl::move(mCoroutines[i]);
+            }
+            ++kept;
+        }
+    }
+    mCoroutines.resize(kept);
 
-        if (!t.is_valid() || t._is_canceled()) {
-            // erase() returns bool in fl::vector, not iterator
-            mTasks.erase(mTasks.begin() + i);
-            // Don't increment i since we just removed an element
+    // Pop everything that is due before running anything, so callbacks may
+    // add, cancel or reschedule timers freely and a zero interval task runs
+    // once per update().
+    fl::vector<Handle> due;
+    due.swap(mDue);
+    while (!mTimers.empty() &&
+           static_cast<i32>(current_time - mTimers[0].due) >= 0) {
+        due.push_back(take_timer(0));
+    }
+    if (due.size() > 1) {
+        fl::sort(due.begin(), due.end(), [](const Handle& a, const Handle& b) {
+            return a._id() < b._id();
+        });
+    }
+
+    for (fl::size i = 0; i < due.size(); ++i) {
+        Handle& t = due[i];
+        if (t._is_canceled()) {
+            continue; // Canceled by an earlier callback in this batch
+        }
+        // Update last run time for recurring tasks
+        t._set_last_run_time(current_time);
+
+        // Execute the task
+        if (t._has_then()) {
+            t._execute_then();
         } else {
-            // Check if task is ready to run (frame tasks will return false here)
-            bool should_run = t._ready_to_run(current_time);
-
-            if (should_run) {
-                // Update last run time for recurring tasks
-                t._set_last_run_time(current_time);
-
-                // Execute the task
-                if (t._has_then()) {
-                    t._execute_then();
-                } else {
-                    warn_no_then(t._id(), t._trace_label());
-                }
-
-                // Remove one-shot tasks, keep recurring ones
-                bool is_recurring = (t._type() == TaskType::kEveryMs || t._type() == TaskType::kAtFramerate);
-                if (is_recurring) {
-                    ++i; // Keep recurring tasks
-                } else {
-                    // erase() returns bool in fl::vector, not iterator
-                    mTasks.erase(mTasks.begin() + i);
-                    // Don't increment i since we just removed an element
-                }
-            } else {
-                ++i;
-            }
+            warn_no_then(t._id(), t._trace_label());
+        }
+
+        // Interval tasks are recurring: queue the next run unless the
+        // callback canceled the task or registered it again itself.
+        if (!t._is_canceled() && !t._is_queued()) {
+            t._set_queued(true);
+            push_timer(t, current_time);
         }
     }
+    due.clear();
+    if (mDue.empty()) {
+        mDue.swap(due);
+    }
 }
 
 void Scheduler::update_before_frame_tasks() {
@@ -72,41 +117,154 @@ void Scheduler::update_after_frame_tasks() {
 }
 
 void Scheduler::update_tasks_of_type(TaskType task_type) {
+    fl::vector<Handle>& queue =
+        (task_type == TaskType::kBeforeFrame) ? mBeforeFrame : mAfterFrame;
+    if (queue.empty()) {
+        return;
+    }
     u32 current_time = fl::millis();
 
-    // Use index-based iteration to avoid iterator invalidation issues
-    for (fl::size i = 0; i < mTasks.size();) {
-        Handle& t = mTasks[i];
-
+    // Frame tasks are always one-shot. Take the whole queue so tasks added
+    // by these callbacks wait for the next frame.
+    fl::vector<Handle> batch;
+    batch.swap(queue);
+    for (fl::size i = 0; i < batch.size(); ++i) {
+        Handle& t = batch[i];
+        t._set_queued(false);
         if (!t.is_valid() || t._is_canceled()) {
-            // erase() returns bool in fl::vector, not iterator
-            mTasks.erase(mTasks.begin() + i);
-            // Don't increment i since we just removed an element
-        } else if (t._type() == task_type) {
-            // This is a frame task of the type we're looking for
-            bool should_run = t._ready_to_run_frame_task(current_time);
-
-            if (should_run) {
-                // Update last run time for frame tasks (though they don't use it)
-                t._set_last_run_time(current_time);
-
-                // Execute the task
-                if (t._has_then()) {
-                    t._execute_then();
-                } else {
-                    warn_no_then(t._id(), t._trace_label());
-                }
-
-                // Frame tasks are always one-shot, so remove them after execution
-                mTasks.erase(mTasks.begin() + i);
-                // Don't increment i since we just removed an element
-            } else {
-                ++i;
-            }
+            continue;
+        }
+        // Update last run time for frame tasks (though they don't use it)
+        t._set_last_run_time(current_time);
+
+        // Execute the task
+        if (t._has_then()) {
+            t._execute_then();
+        } else {
+            warn_no_then(t._id(), t._trace_label());
+        }
+    }
+    batch.clear();
+    if (queue.empty()) {
+        queue.swap(batch); // Keep the capacity for the next frame
+    }
+}
+
+void Scheduler::clear_all_tasks() {
+    for (fl::size i = 0; i < mTimers.size(); ++i) {
+        mTimers[i].task._set_scheduler_slot(-1);
+        mTimers[i].task._set_queued(false);
+    }
+    fl::vector<Handle>* queues[] = {&mBeforeFrame, &mAfterFrame, &mCoroutines};
+    for (fl::vector<Handle>* queue : queues) {
+        for (fl::size i = 0; i < queue->size(); ++i) {
+            (*queue)[i]._set_queued(false);
+        }
+        queue->clear();
+    }
+    mTimers.clear();
+    mNextTaskId.store(1);
+}
+
+fl::size Scheduler::size() const {
+    return mTimers.size() + mBeforeFrame.size() + mAfterFrame.size() +
+           mCoroutines.size();
+}
+
+void Scheduler::push_timer(const Handle& t, u32 now) {
+    // Same readiness rule as TimeTask::ready_to_run(), as a deadline.
+    const u32 last = t.last_run_time();
+    const int interval = t.interval_ms();
+    TimerEntry entry;
+    if (last == (fl::numeric_limits<u32>::max)()) {
+        entry.due = now; // Never run: due immediately
+    } else {
+        entry.due = last + static_cast<u32>(interval > 0 ? interval : 0);
+    }
+    entry.seq = t._id();
+    entry.task = t;
+    mTimers.push_back(TimerEntry());
+    place_timer(mTimers.size() - 1, fl::move(entry));
+    sift_up(mTimers.size() - 1);
+}
+
+Handle Scheduler::take_timer(fl::size slot) {
+    Handle t = fl::move(mTimers[slot].task);
+    t._set_scheduler_slot(-1);
+    t._set_queued(false);
+    const fl::size last = mTimers.size() - 1;
+    if (slot != last) {
+        place_timer(slot, fl::move(mTimers[last]));
+    }
+    mTimers.pop_back();
+    if (slot < mTimers.size()) {
+        const TimerEntry& moved = mTimers[slot];
+        const TimerEntry* parent = slot > 0 ? &mTimers[(slot - 1) / 2] : nullptr;
+        if (parent && timer_before(moved.due, moved.seq, parent->due, parent->seq)) {
+            sift_up(slot);
         } else {
-            ++i; // Not the task type we're looking for
+            sift_down(slot);
+        }
+    }
+    return t;
+}
+
+void Scheduler::place_timer(fl::size slot, TimerEntry&& entry) {
+    mTimers[slot] = fl::move(entry);
+    mTimers[slot].task._set_scheduler_slot(static_cast<int>(slot));
+}
+
+void Scheduler::sift_up(fl::size slot) {
+    TimerEntry entry = fl::move(mTimers[slot]);
+    while (slot > 0) {
+        const fl::size parent = (slot - 1) / 2;
+        if (!timer_before(entry.due, entry.seq, mTimers[parent].due, mTimers[parent].seq)) {
+            break;
+        }
+        place_timer(slot, fl::move(mTimers[parent]));
+        slot = parent;
+    }
+    place_timer(slot, fl::move(entry));
+}
+
+void Scheduler::sift_down(fl::size slot) {
+    TimerEntry entry = fl::move(mTimers[slot]);
+    const fl::size count = mTimers.size();
+    for (;;) {
+        fl::size child = slot * 2 + 1;
+        if (child >= count) {
+            break;
+        }
+        if (child + 1 < count &&
+            timer_before(mTimers[child + 1].due, mTimers[child + 1].seq,
+                         mTimers[child].due, mTimers[child].seq)) {
+            ++child;
         }
+        if (!timer_before(mTimers[child].due, mTimers[child].seq, entry.due, entry.seq)) {
+            break;
+        }
+        place_timer(slot, fl::move(mTimers[child]));
+        slot = child;
+    }
+    place_timer(slot, fl::move(entry));
+}
+
+void Scheduler::reschedule(const Handle& t) {
+    const int slot = t._scheduler_slot();
+    if (slot < 0) {
+        return; // Not in the heap; the next push computes the deadline
+    }
+    Handle task = take_timer(static_cast<fl::size>(slot));
+    task._set_queued(true);
+    push_timer(task, fl::millis());
+}
+
+void Scheduler::unschedule(const Handle& t) {
+    const int slot = t._scheduler_slot();
+    if (slot >= 0) {
+        take_timer(static_cast<fl::size>(slot));
     }
+    // Frame tasks and coroutines are dropped when their queue is next drained.
 }
 
 void Scheduler::warn_no_then(int task_id, const fl::string& trace_label) {
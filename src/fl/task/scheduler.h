@@ -2,6 +2,11 @@
 
 /// @file fl/task/scheduler.h
 /// @brief Task scheduler — manages timer and frame-based tasks
+///
+/// Each TaskType has its own queue. Interval tasks (every_ms, at_framerate)
+/// live in a binary min-heap keyed on their next due time, so update() only
+/// touches tasks that are due and add/cancel/reschedule cost O(log n). Frame
+/// tasks sit in one queue per frame phase and are drained in one pass.
 
 #include "fl/task/task.h"
 #include "fl/stl/singleton.h"
@@ -24,11 +29,21 @@ public:
     void update_after_frame_tasks();
 
     // For testing: clear all tasks
-    void clear_all_tasks() { mTasks.clear(); mNextTaskId.store(1); }
+    void clear_all_tasks();
+
+    // Number of queued tasks of every type
+    fl::size size() const FL_NOEXCEPT;
 
 private:
     friend class fl::Singleton<Scheduler>;
-    Scheduler() FL_NOEXCEPT : mTasks(), mNextTaskId(1) {}
+    friend class Handle;  // cancel() and the timing setters reschedule
+    Scheduler() FL_NOEXCEPT : mNextTaskId(1) {}
+
+    struct TimerEntry {
+        u32 due = 0;  // millis() at which the task becomes ready
+        int seq = 0;  // Task id, keeps registration order among equal deadlines
+        Handle task;
+    };
 
     void warn_no_then(int task_id, const fl::string& trace_label);
     void warn_no_catch(int task_id, const fl::string& trace_label, const Error& error);
@@ -36,7 +51,21 @@ private:
     // Helper method for running specific task types
     void update_tasks_of_type(TaskType task_type);
 
-    fl::vector<Handle> mTasks;
+    // Timer heap, all O(log n). Entries store their index in the task so a
+    // task can be found without a search.
+    void push_timer(const Handle& t, u32 now);
+    Handle take_timer(fl::size slot);
+    void place_timer(fl::size slot, TimerEntry&& entry);
+    void sift_up(fl::size slot);
+    void sift_down(fl::size slot);
+    void reschedule(const Handle& t);
+    void unschedule(const Handle& t);
+
+    fl::vector<TimerEntry> mTimers;
+    fl::vector<Handle> mBeforeFrame;
+    fl::vector<Handle> mAfterFrame;
+    fl::vector<Handle> mCoroutines;
+    fl::vector<Handle> mDue;  // Scratch for update(), kept to reuse capacity
     fl::atomic<int> mNextTaskId;
 };
 
@@ -105,6 +105,11 @@ public:
     // Coroutine methods (no-op for non-coroutine tasks)
     virtual void stop() = 0;
     virtual bool isRunning() const = 0;
+
+    // Scheduler bookkeeping: index in the timer heap (-1 when not in it) and
+    // whether the task sits in any scheduler queue.
+    int mSchedulerSlot = -1;
+    bool mQueued = false;
 };
 
 //=============================================================================
@@ -294,6 +299,7 @@ Handle& Handle::catch_(function<void(const Error&)> on_catch) {
 Handle& Handle::cancel() {
     if (mImpl) {
         mImpl->set_canceled();
+        Scheduler::instance().unschedule(*this);
     }
     return *this;
 }
@@ -305,15 +311,30 @@ bool Handle::has_catch() const { return mImpl ? mImpl->has_catch() : false; }
 string Handle::trace_label() const { return mImpl ? mImpl->trace_label() : ""; }
 TaskType Handle::type() const { return mImpl ? mImpl->type() : TaskType::kEveryMs; }
 int Handle::interval_ms() const { return mImpl ? mImpl->interval_ms() : 0; }
-void Handle::set_interval_ms(int interval_ms) { if (mImpl) mImpl->set_interval_ms(interval_ms); }
+void Handle::set_interval_ms(int interval_ms) {
+    if (mImpl) {
+        mImpl->set_interval_ms(interval_ms);
+        Scheduler::instance().reschedule(*this);
+    }
+}
 fl::u32 Handle::last_run_time() const { return mImpl ? mImpl->last_run_time() : 0; }
-void Handle::set_last_run_time(fl::u32 time) { if (mImpl) mImpl->set_last_run_time(time); }
+void Handle::set_last_run_time(fl::u32 time) {
+    if (mImpl) {
+        mImpl->set_last_run_time(time);
+        Scheduler::instance().reschedule(*this);
+    }
+}
 bool Handle::ready_to_run(fl::u32 current_time) const { return mImpl ? mImpl->ready_to_run(current_time) : false; }
 bool Handle::is_valid() const { return mImpl != nullptr; }
 bool Handle::isCoroutine() const { return mImpl && mImpl->type() == TaskType::kCoroutine; }
 
 // Coroutine control
-void Handle::stop() { if (mImpl) mImpl->stop(); }
+void Handle::stop() {
+    if (mImpl) {
+        mImpl->stop();
+        Scheduler::instance().unschedule(*this);
+    }
+}
 bool Handle::isRunning() const { return mImpl ? mImpl->isRunning() : false; }
 
 // Free function builders (were static methods on class fl::task)
@@ -380,6 +401,10 @@ void Handle::_execute_then() { if (mImpl) mImpl->execute_then(); }
 void Handle::_execute_catch(const Error& error) { if (mImpl) mImpl->execute_catch(error); }
 TaskType Handle::_type() const { return mImpl ? mImpl->type() : TaskType::kEveryMs; }
 string Handle::_trace_label() const { return mImpl ? mImpl->trace_label() : ""; }
+int Handle::_scheduler_slot() const { return mImpl ? mImpl->mSchedulerSlot : -1; }
+void Handle::_set_scheduler_slot(int slot) { if (mImpl) mImpl->mSchedulerSlot = slot; }
+bool Handle::_is_queued() const { return mImpl ? mImpl->mQueued : false; }
+void Handle::_set_queued(bool queued) { if (mImpl) mImpl->mQueued = queued; }
 
 } // namespace task
 } // namespace fl
@@ -190,6 +190,10 @@ private:
     void _execute_catch(const Error& error) FL_NOEXCEPT;
     TaskType _type() const FL_NOEXCEPT;
     string _trace_label() const FL_NOEXCEPT;
+    int _scheduler_slot() const FL_NOEXCEPT;
+    void _set_scheduler_slot(int slot) FL_NOEXCEPT;
+    bool _is_queued() const FL_NOEXCEPT;
+    void _set_queued(bool queued) FL_NOEXCEPT;
 
     shared_ptr<ITaskImpl> mImpl;
 };
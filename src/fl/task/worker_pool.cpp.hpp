@@ -0,0 +1,163 @@
+#include "fl/task/worker_pool.h"
+#include "fl/stl/singleton.h"
+#include "fl/stl/thread.h"
+
+// fl::thread is a real OS thread only on the stub/WASM profile with
+// pthreads. Elsewhere it is ThreadFake, which runs its function inline and
+// would never return from workerLoop().
+#if (defined(FL_IS_STUB) || defined(FL_IS_WASM)) && FL_STUB_HAS_MULTITHREADED
+#define FL_WORKER_POOL_HAS_THREADS 1
+#else
+#define FL_WORKER_POOL_HAS_THREADS 0
+#endif
+
+#if FL_WORKER_POOL_HAS_THREADS
+#include "fl/stl/condition_variable.h"
+#include "fl/stl/mutex.h"
+#include "fl/stl/vector.h"
+#endif
+
+namespace fl {
+namespace task {
+
+#if FL_WORKER_POOL_HAS_THREADS
+
+struct WorkerPool::State {
+    fl::mutex mutex;
+    fl::condition_variable wake;  // a job was posted, or stop was requested
+    fl::condition_variable done;  // the last piece of the job finished
+    fl::vector<fl::unique_ptr<fl::thread>> threads;
+    int maxThreads = 0;
+    bool started = false;
+    bool stop = false;
+    bool busy = false;
+
+    // The job in flight. Pieces are claimed under the mutex; a piece is
+    // coarse enough (a band of rows) that the lock is never contended for
+    // long.
+    const fl::function<void(int)> *job = nullptr;
+    int count = 0;
+    int next = 0;
+    int finished = 0;
+
+    void workerLoop() {
+        fl::unique_lock<fl::mutex> lock(mutex);
+        for (;;) {
+            while (!stop && (!job || next >= count)) {
+                wake.wait(lock);
+            }
+            if (stop) {
+                return;
+            }
+            const fl::function<void(int)> *fn = job;
+            const int piece = next++;
+            lock.unlock();
+            (*fn)(piece);
+            lock.lock();
+            if (++finished == count) {
+                done.notify_all();
+            }
+        }
+    }
+
+    void startThreads() {
+        started = true;
+        for (int i = 0; i < maxThreads; ++i) {
+            threads.push_back(
+                fl::make_unique<fl::thread>([this]() { workerLoop(); }));
+        }
+    }
+};
+
+WorkerPool::WorkerPool(int workers) FL_NOEXCEPT
+    : mState(fl::make_unique<State>()) {
+    const int cores = static_cast<int>(fl::thread::hardware_concurrency());
+    if (cores <= 1) {
+        // No real threads here (or one core): workers would only add
+        // context switches.
+        workers = workers < 0 ? 0 : workers;
+    } else if (workers < 0) {
+        workers = cores - 1;
+    }
+    if (workers > FASTLED_WORKER_POOL_MAX_THREADS) {
+        workers = FASTLED_WORKER_POOL_MAX_THREADS;
+    }
+    mState->maxThreads = workers;
+}
+
+WorkerPool::~WorkerPool() FL_NOEXCEPT {
+    {
+        fl::unique_lock<fl::mutex> lock(mState->mutex);
+        mState->stop = true;
+        mState->wake.notify_all();
+    }
+    for (fl::size i = 0; i < mState->threads.size(); ++i) {
+        mState->threads[i]->join();
+    }
+}
+
+int WorkerPool::concurrency() const FL_NOEXCEPT {
+    return mState->maxThreads + 1;
+}
+
+void WorkerPool::parallelFor(int count,
+                             const fl::function<void(int)> &fn) FL_NOEXCEPT {
+    State &s = *mState;
+    fl::unique_lock<fl::mutex> lock(s.mutex);
+    if (count <= 1 || s.maxThreads == 0 || s.busy) {
+        lock.unlock();
+        for (int i = 0; i < count; ++i) {
+            fn(i);
+        }
+        return;
+    }
+    if (!s.started) {
+        s.startThreads();
+    }
+    s.busy = true;
+    s.job = &fn;
+    s.count = count;
+    s.next = 0;
+    s.finished = 0;
+    s.wake.notify_all();
+
+    // The caller works too rather than idling at the barrier.
+    while (s.next < s.count) {
+        const int piece = s.next++;
+        lock.unlock();
+        fn(piece);
+        lock.lock();
+        ++s.finished;
+    }
+    while (s.finished < s.count) {
+        s.done.wait(lock);
+    }
+    s.job = nullptr;
+    s.busy = false;
+}
+
+#else // !FL_WORKER_POOL_HAS_THREADS
+
+struct WorkerPool::State {};
+
+WorkerPool::WorkerPool(int workers) FL_NOEXCEPT { FASTLED_UNUSED(workers); }
+
+WorkerPool::~WorkerPool() FL_NOEXCEPT {}
+
+int WorkerPool::concurrency() const FL_NOEXCEPT { return 1; }
+
+void WorkerPool::parallelFor(int count,
+                             const fl::function<void(int)> &fn) FL_NOEXCEPT {
+    for (int i = 0; i < count; ++i) {
+        fn(i);
+    }
+}
+
+#endif // FL_WORKER_POOL_HAS_THREADS
+
+WorkerPool &WorkerPool::instance() FL_NOEXCEPT {
+    return fl::Singleton<WorkerPool>::instance();
+}
+
+} // namespace task
+} // namespace fl
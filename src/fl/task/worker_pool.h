@@ -0,0 +1,65 @@
+#pragma once
+
+/// @file fl/task/worker_pool.h
+/// @brief Fixed pool of worker threads for data-parallel frame work
+///
+/// The Executor pumps cooperative runners on the calling thread; it never
+/// runs two things at once. WorkerPool is its data-parallel counterpart: it
+/// splits one job into `count` independent pieces, runs them on parked
+/// worker threads plus the calling thread, and returns once every piece has
+/// finished (a barrier). It is meant for coarse pieces such as row bands of
+/// a frame, not for fine-grained tasks.
+///
+/// On single-threaded platforms (and where fl::thread is the synchronous
+/// fake) the pool has no workers and parallelFor() is a plain loop.
+///
+/// @section Usage
+/// @code
+/// fl::task::WorkerPool::instance().parallelFor(bands, [&](int band) {
+///     renderRows(band * rows / bands, (band + 1) * rows / bands);
+/// });
+/// @endcode
+
+#include "fl/stl/function.h"
+#include "fl/stl/int.h"
+#include "fl/stl/noexcept.h"
+#include "fl/stl/unique_ptr.h"
+
+#ifndef FASTLED_WORKER_POOL_MAX_THREADS
+#define FASTLED_WORKER_POOL_MAX_THREADS 7
+#endif
+
+namespace fl {
+namespace task {
+
+class WorkerPool {
+  public:
+    /// Shared pool sized to the hardware: one worker per core besides the
+    /// calling one, capped at FASTLED_WORKER_POOL_MAX_THREADS. Workers start
+    /// on the first parallelFor() that can use them.
+    static WorkerPool &instance() FL_NOEXCEPT;
+
+    /// A private pool with `workers` threads besides the caller; negative
+    /// sizes it to the hardware like instance(). Ignored (no workers) on
+    /// single-threaded platforms. Workers are joined on destruction.
+    explicit WorkerPool(int workers = -1) FL_NOEXCEPT;
+    ~WorkerPool() FL_NOEXCEPT;
+    WorkerPool(const WorkerPool &) FL_NOEXCEPT = delete;
+    WorkerPool &operator=(const WorkerPool &) FL_NOEXCEPT = delete;
+
+    /// Threads that execute pieces of a job, including the caller.
+    int concurrency() const FL_NOEXCEPT;
+
+    /// Runs fn(i) for every i in [0, count) and returns when all calls have
+    /// completed. Calls for different i may run concurrently and in any
+    /// order. A call made while the pool is already busy (from a worker, or
+    /// from a second thread) runs serially on the calling thread.
+    void parallelFor(int count, const fl::function<void(int)> &fn) FL_NOEXCEPT;
+
+  private:
+    struct State;
+    fl::unique_ptr<State> mState;
+};
+
+} // namespace task
+} // namespace fl
@@ -3,6 +3,7 @@
 /// Includes all implementation files in alphabetical order
 
 #include "fl/video/frame_interpolator.cpp.hpp"
+#include "fl/video/frame_ring.cpp.hpp"
 #include "fl/video/frame_tracker.cpp.hpp"
 #include "fl/video/pixel_stream.cpp.hpp"
 #include "fl/video/video_impl.cpp.hpp"
@@ -1,22 +1,31 @@
 #include "fl/video/frame_interpolator.h"
-#include "fl/stl/circular_buffer.h"
 #include "fl/math/math.h"
+#include "fl/stl/cstring.h"
 #include "fl/video/pixel_stream.h"
 
 #include "fl/log/log.h"
 
-#include "fl/math/math.h"
-#include "fl/math/math.h"
-
 #define DBG FL_DBG
 
 namespace fl {
 namespace video {
 
-FrameInterpolator::FrameInterpolator(size_t nframes, float fps)
-    : mFrameTracker(fps) {
-    size_t capacity = fl::max(1, nframes);
-    mFrames.reserve(capacity);
+FrameInterpolator::FrameInterpolator(size_t nframes, float fps,
+                                     size_t pixelsPerFrame)
+    : mFrames(pixelsPerFrame, fl::max(1, nframes)), mFrameTracker(fps) {}
+
+bool FrameInterpolator::insert(fl::u32 frameNumber, const Frame &frame) {
+    if (frame.size() != mFrames.pixelsPerFrame()) {
+        return false;
+    }
+    int slot = mFrames.reserve();
+    if (slot < 0) {
+        return false;
+    }
+    fl::span<CRGB> dst = mFrames.pixels(slot);
+    fl::memcpy(dst.data(), frame.rgb().data(), dst.size() * sizeof(CRGB));
+    mFrames.commit(slot, frameNumber);
+    return true;
 }
 
 bool FrameInterpolator::draw(fl::u32 now, Frame *dst) {
@@ -30,21 +39,23 @@ bool FrameInterpolator::draw(fl::u32 now, fl::span<CRGB> leds) {
     // DBG("now: " << now);
     mFrameTracker.get_interval_frames(now, &frameNumber, &nextFrameNumber,
                                       &amountOfNextFrame);
-    if (!has(frameNumber)) {
+    fl::span<const CRGB> frame1 = mFrames.get(frameNumber);
+    if (frame1.empty()) {
         return false;
     }
+    const size_t n = fl::min(frame1.size(), leds.size());
 
-    if (has(frameNumber) && !has(nextFrameNumber)) {
+    fl::span<const CRGB> frame2 = mFrames.get(nextFrameNumber);
+    if (frame2.empty()) {
         // just paint the current frame
-        Frame *frame = get(frameNumber).get();
-        frame->draw(leds);
+        fl::memcpy(leds.data(), frame1.data(), n * sizeof(CRGB));
         return true;
     }
 
-    Frame *frame1 = get(frameNumber).get();
-    Frame *frame2 = get(nextFrameNumber).get();
-
-    Frame::interpolate(*frame1, *frame2, amountOfNextFrame, leds);
+    // Blend straight out of the two ring slots.
+    for (size_t i = 0; i < n; ++i) {
+        leds[i] = CRGB::blend(frame1[i], frame2[i], amountOfNextFrame);
+    }
     return true;
 }
 
@@ -1,10 +1,9 @@
 #pragma once
 
 #include "fl/fx/frame.h"
-#include "fl/stl/flat_map.h"
 #include "fl/stl/shared_ptr.h"
 #include "fl/stl/span.h"
-#include "fl/fx/frame.h"
+#include "fl/video/frame_ring.h"
 #include "fl/video/frame_tracker.h"
 
 namespace fl {
@@ -15,13 +14,12 @@ FASTLED_SHARED_PTR(FrameInterpolator);
 // Holds onto frames and allow interpolation. This allows
 // effects to have high effective frame rate and also
 // respond to things like sound which can modify the timing.
+//
+// Frames live in a FrameRing: one pixel slab sized at construction whose
+// slots are recycled in place, so playback never allocates per frame.
 class FrameInterpolator {
   public:
-    struct Less {
-        bool operator()(fl::u32 a, fl::u32 b) const { return a < b; }
-    };
-    typedef fl::flat_map<fl::u32, FramePtr, Less> FrameBuffer;
-    FrameInterpolator(size_t nframes, float fpsVideo);
+    FrameInterpolator(size_t nframes, float fpsVideo, size_t pixelsPerFrame);
 
     // Will search through the array, select the two frames that are closest to
     // the current time and then interpolate between them, storing the results
@@ -33,11 +31,15 @@ class FrameInterpolator {
     // that this adjustable_time is allowed to go pause or go backward in time.
     bool draw(fl::u32 adjustable_time, Frame *dst);
     bool draw(fl::u32 adjustable_time, fl::span<CRGB> leds);
-    bool insert(fl::u32 frameNumber, FramePtr frame) {
-        FrameBuffer::insert_result result;
-        mFrames.insert(frameNumber, frame, &result);
-        return result != FrameBuffer::at_capacity;
-    }
+
+    // Copy a frame into the ring, evicting the oldest frame when full.
+    bool insert(fl::u32 frameNumber, const Frame &frame);
+
+    // Zero-copy loading, see FrameRing: reserve a slot, fill pixels(slot)
+    // in place, then commit it under its frame number.
+    int reserve(bool evictNewest = false) { return mFrames.reserve(evictNewest); }
+    fl::span<CRGB> pixels(int slot) { return mFrames.pixels(slot); }
+    void commit(int slot, fl::u32 frameNumber) { mFrames.commit(slot, frameNumber); }
 
     // Clear all frames
     void clear() { mFrames.clear(); }
@@ -46,29 +48,14 @@ class FrameInterpolator {
 
     bool has(fl::u32 frameNum) const { return mFrames.has(frameNum); }
 
-    FramePtr erase(fl::u32 frameNum) {
-        FramePtr out;
-        auto it = mFrames.find(frameNum);
-        if (it == mFrames.end()) {
-            return out;
-        }
-        out = it->second;
-        mFrames.erase(it);
-        return out;
-    }
+    bool erase(fl::u32 frameNum) { return mFrames.erase(frameNum); }
 
-    FramePtr get(fl::u32 frameNum) const {
-        auto it = mFrames.find(frameNum);
-        if (it != mFrames.end()) {
-            return it->second;
-        }
-        return FramePtr();
-    }
+    fl::span<const CRGB> get(fl::u32 frameNum) const { return mFrames.get(frameNum); }
 
     bool full() const { return mFrames.full(); }
     size_t capacity() const { return mFrames.capacity(); }
 
-    FrameBuffer *getFrames() { return &mFrames; }
+    FrameRing *getFrames() { return &mFrames; }
 
     bool needsFrame(fl::u32 now, fl::u32 *currentFrameNumber,
                     fl::u32 *nextFrameNumber) const {
@@ -78,21 +65,11 @@ class FrameInterpolator {
     }
 
     bool get_newest_frame_number(fl::u32 *frameNumber) const {
-        if (mFrames.empty()) {
-            return false;
-        }
-        auto &front = mFrames.back();
-        *frameNumber = front.first;
-        return true;
+        return mFrames.newest(frameNumber);
     }
 
     bool get_oldest_frame_number(fl::u32 *frameNumber) const {
-        if (mFrames.empty()) {
-            return false;
-        }
-        auto &front = mFrames.front();
-        *frameNumber = front.first;
-        return true;
+        return mFrames.oldest(frameNumber);
     }
 
     fl::u32 get_exact_timestamp_ms(fl::u32 frameNumber) const {
@@ -102,7 +79,7 @@ class FrameInterpolator {
     FrameTracker &getFrameTracker() { return mFrameTracker; }
 
   private:
-    FrameBuffer mFrames;
+    FrameRing mFrames;
     FrameTracker mFrameTracker;
 };
 
@@ -0,0 +1,119 @@
+#include "fl/video/frame_ring.h"
+#include "fl/stl/noexcept.h"
+
+namespace fl {
+namespace video {
+
+FrameRing::FrameRing(fl::size pixelsPerFrame, fl::size capacity)
+    : mPixelsPerFrame(pixelsPerFrame) {
+    mPixels.resize(pixelsPerFrame * capacity);
+    mSlots.resize(capacity);
+}
+
+int FrameRing::find(fl::u32 frameNumber) const {
+    for (fl::size i = 0; i < mSlots.size(); ++i) {
+        if (mSlots[i].used && mSlots[i].frameNumber == frameNumber) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+fl::span<const CRGB> FrameRing::get(fl::u32 frameNumber) const {
+    int slot = find(frameNumber);
+    if (slot < 0) {
+        return fl::span<const CRGB>();
+    }
+    return fl::span<const CRGB>(mPixels.data() + slot * mPixelsPerFrame,
+                                mPixelsPerFrame);
+}
+
+int FrameRing::reserve(bool evictNewest) {
+    int victim = -1;
+    for (fl::size i = 0; i < mSlots.size(); ++i) {
+        const Slot &s = mSlots[i];
+        if (!s.used) {
+            return static_cast<int>(i);
+        }
+        if (victim < 0) {
+            victim = static_cast<int>(i);
+            continue;
+        }
+        const fl::u32 best = mSlots[victim].frameNumber;
+        if (evictNewest ? s.frameNumber > best : s.frameNumber < best) {
+            victim = static_cast<int>(i);
+        }
+    }
+    if (victim >= 0) {
+        mSlots[victim].used = false;
+        --mCount;
+    }
+    return victim;
+}
+
+fl::span<CRGB> FrameRing::pixels(int slot) {
+    if (slot < 0 || static_cast<fl::size>(slot) >= mSlots.size()) {
+        return fl::span<CRGB>();
+    }
+    return fl::span<CRGB>(mPixels.data() + slot * mPixelsPerFrame,
+                          mPixelsPerFrame);
+}
+
+void FrameRing::commit(int slot, fl::u32 frameNumber) {
+    if (slot < 0 || static_cast<fl::size>(slot) >= mSlots.size()) {
+        return;
+    }
+    int stale = find(frameNumber);
+    if (stale >= 0 && stale != slot) {
+        mSlots[stale].used = false;
+        --mCount;
+    }
+    Slot &s = mSlots[slot];
+    if (!s.used) {
+        s.used = true;
+        ++mCount;
+    }
+    s.frameNumber = frameNumber;
+}
+
+bool FrameRing::erase(fl::u32 frameNumber) {
+    int slot = find(frameNumber);
+    if (slot < 0) {
+        return false;
+    }
+    mSlots[slot].used = false;
+    --mCount;
+    return true;
+}
+
+void FrameRing::clear() {
+    for (fl::size i = 0; i < mSlots.size(); ++i) {
+        mSlots[i].used = false;
+    }
+    mCount = 0;
+}
+
+bool FrameRing::oldest(fl::u32 *frameNumber) const {
+    bool found = false;
+    for (fl::size i = 0; i < mSlots.size(); ++i) {
+        if (mSlots[i].used && (!found || mSlots[i].frameNumber < *frameNumber)) {
+            *frameNumber = mSlots[i].frameNumber;
+            found = true;
+        }
+    }
+    return found;
+}
+
+bool FrameRing::newest(fl::u32 *frameNumber) const {
+    bool found = false;
+    for (fl::size i = 0; i < mSlots.size(); ++i) {
+        if (mSlots[i].used && (!found || mSlots[i].frameNumber > *frameNumber)) {
+            *frameNumber = mSlots[i].frameNumber;
+            found = true;
+        }
+    }
+    return found;
+}
+
+} // namespace video
+} // namespace fl
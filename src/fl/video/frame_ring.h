@@ -0,0 +1,72 @@
+#pragma once
+
+#include "crgb.h"  // IWYU pragma: keep
+#include "fl/stl/int.h"
+#include "fl/stl/span.h"
+#include "fl/stl/vector.h"
+#include "fl/stl/noexcept.h"
+
+namespace fl {
+namespace video {
+
+// Fixed-capacity store of decoded video frames, keyed by frame number.
+//
+// All pixel storage is one slab of capacity * pixelsPerFrame CRGB allocated
+// at construction (from PSRAM when a PSRAM allocator is installed, like
+// Frame). Slots are recycled in place: loading a new frame overwrites the
+// evicted slot's pixels, so steady-state playback performs no allocation and
+// clear()/rewind only drop slot labels.
+//
+// Loading is two-phase so a failed read never leaves a half-written frame
+// visible:
+//   int slot = ring.reserve(evictNewest);
+//   if (read(ring.pixels(slot))) ring.commit(slot, frameNumber);
+class FrameRing {
+  public:
+    FrameRing(fl::size pixelsPerFrame, fl::size capacity) FL_NOEXCEPT;
+
+    fl::size capacity() const FL_NOEXCEPT { return mSlots.size(); }
+    fl::size pixelsPerFrame() const FL_NOEXCEPT { return mPixelsPerFrame; }
+    fl::size size() const FL_NOEXCEPT { return mCount; }
+    bool empty() const FL_NOEXCEPT { return mCount == 0; }
+    bool full() const FL_NOEXCEPT { return mCount == mSlots.size(); }
+
+    bool has(fl::u32 frameNumber) const FL_NOEXCEPT { return find(frameNumber) >= 0; }
+
+    // Pixels of a stored frame, or an empty span if it is not present.
+    fl::span<const CRGB> get(fl::u32 frameNumber) const FL_NOEXCEPT;
+
+    // Pick a slot to load into: a free one if available, otherwise evict the
+    // oldest (lowest) frame number, or the newest when evictNewest is set
+    // (playing backwards). The slot is unlabelled until commit(). Returns -1
+    // only when capacity() is 0.
+    int reserve(bool evictNewest = false) FL_NOEXCEPT;
+    fl::span<CRGB> pixels(int slot) FL_NOEXCEPT;
+
+    // Publish a reserved slot as frameNumber. A stale copy of the same frame
+    // number in another slot is dropped.
+    void commit(int slot, fl::u32 frameNumber) FL_NOEXCEPT;
+
+    // Drop a frame. The pixels stay in the slab for the next reserve().
+    bool erase(fl::u32 frameNumber) FL_NOEXCEPT;
+    void clear() FL_NOEXCEPT;
+
+    bool oldest(fl::u32 *frameNumber) const FL_NOEXCEPT;
+    bool newest(fl::u32 *frameNumber) const FL_NOEXCEPT;
+
+  private:
+    struct Slot {
+        fl::u32 frameNumber = 0;
+        bool used = false;
+    };
+
+    int find(fl::u32 frameNumber) const FL_NOEXCEPT;
+
+    fl::size mPixelsPerFrame;
+    fl::size mCount = 0;
+    fl::vector_psram<CRGB> mPixels;  // capacity() * mPixelsPerFrame
+    fl::vector<Slot> mSlots;
+};
+
+} // namespace video
+} // namespace fl
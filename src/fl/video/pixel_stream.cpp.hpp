@@ -1,6 +1,7 @@
 
 #include "fl/video/pixel_stream.h"
 #include "fl/log/log.h"
+#include "fl/stl/cstring.h"
 #include "fl/stl/limits.h"
 #include "fl/stl/noexcept.h"
 
@@ -27,6 +28,74 @@ bool PixelStream::begin(filebuf_ptr h) {
 
 void PixelStream::close() {
     mHandle.reset();
+    mPrefetchCount = 0;
+}
+
+void PixelStream::setPrefetchFrames(fl::u32 frames) {
+    mPrefetchFrames = frames;
+    mPrefetchCount = 0;
+    mPrefetch.clear();
+    mPrefetch.shrink_to_fit();
+}
+
+bool PixelStream::fillPrefetch(fl::u32 frameNumber) {
+    const size_t total = mHandle->size();
+    const size_t frameBytes = size_t(mbytesPerFrame);
+    if (mPrefetchFrames == 0 || frameBytes == 0 ||
+        size_t(frameNumber) * frameBytes >= total) {
+        return false;
+    }
+    // Stepping just below the cached block means playback runs backwards,
+    // so read the group that ends at frameNumber instead of starting there.
+    fl::u32 first = frameNumber;
+    if (mPrefetchCount && frameNumber + 1 == mPrefetchFirst) {
+        first = frameNumber + 1 >= mPrefetchFrames
+                    ? frameNumber + 1 - mPrefetchFrames
+                    : 0;
+    }
+    const size_t offset = size_t(first) * frameBytes;
+    size_t want = size_t(mPrefetchFrames) * frameBytes;
+    if (want > total - offset) {
+        want = total - offset;
+    }
+    if (mPrefetch.size() < size_t(mPrefetchFrames) * frameBytes) {
+        mPrefetch.resize(size_t(mPrefetchFrames) * frameBytes);
+    }
+    size_t n = mHandle->read_at(offset, reinterpret_cast<char *>(mPrefetch.data()), // ok reinterpret cast
+                                want);
+    mPrefetchFirst = first;
+    mPrefetchCount = fl::u32(n / frameBytes);
+    return frameNumber - first < mPrefetchCount;
+}
+
+fl::span<const CRGB> PixelStream::frameView(fl::u32 frameNumber) {
+    if (!mHandle || mType == kStreaming || mbytesPerFrame <= 0) {
+        return fl::span<const CRGB>();
+    }
+    const size_t frameBytes = size_t(mbytesPerFrame);
+    const size_t pixels = frameBytes / 3;
+    const size_t offset = size_t(frameNumber) * frameBytes;
+    const u8 *src = nullptr;
+    fl::span<const u8> map = mHandle->mapped();
+    if (!map.empty()) {
+        if (offset + frameBytes <= map.size()) {
+            src = map.data() + offset;
+        }
+    } else if (mPrefetchFrames) {
+        bool cached = mPrefetchCount && frameNumber >= mPrefetchFirst &&
+                      frameNumber - mPrefetchFirst < mPrefetchCount;
+        if (cached || fillPrefetch(frameNumber)) {
+            src = mPrefetch.data() + (frameNumber - mPrefetchFirst) * frameBytes;
+        }
+    }
+    if (!src) {
+        return fl::span<const CRGB>();
+    }
+    // Leave the handle where a plain read would have, so framesRemaining()
+    // and atEnd() keep tracking playback.
+    mHandle->seek(offset + frameBytes);
+    // CRGB is three packed bytes, so .rgb data can be viewed in place.
+    return fl::span<const CRGB>(reinterpret_cast<const CRGB *>(src), pixels); // ok reinterpret cast
 }
 
 i32 PixelStream::bytesPerFrame() { return mbytesPerFrame; }
@@ -54,10 +123,14 @@ bool PixelStream::readFrame(Frame *frame) {
     if (!frame) {
         return false;
     }
+    return readFrame(frame->rgb());
+}
+
+bool PixelStream::readFrame(fl::span<CRGB> dst) {
     if (mType == kFile && !framesRemaining()) {
         return false;
     }
-    size_t n = mHandle->readRGB8(frame->rgb());
+    size_t n = mHandle->readRGB8(dst);
     if (mType == kFile) {
         DBG("pos: " << mHandle->pos());
     }
@@ -75,17 +148,29 @@ bool PixelStream::hasFrame(fl::u32 frameNumber) {
 }
 
 bool PixelStream::readFrameAt(fl::u32 frameNumber, Frame *frame) {
+    if (!frame) {
+        return false;
+    }
+    return readFrameAt(frameNumber, frame->rgb());
+}
+
+bool PixelStream::readFrameAt(fl::u32 frameNumber, fl::span<CRGB> dst) {
     if (mType == kStreaming) {
         // Streaming handle doesn't support seeking
         FL_DBG("Streaming handle doesn't support seeking");
         return false;
     }
+    fl::span<const CRGB> view = frameView(frameNumber);
+    if (!view.empty()) {
+        size_t n = view.size() < dst.size() ? view.size() : dst.size();
+        fl::memcpy(dst.data(), view.data(), n * sizeof(CRGB));
+        return n * 3 == size_t(mbytesPerFrame);
+    }
     mHandle->seek(frameNumber * mbytesPerFrame);
     if (mHandle->bytesLeft() == 0) {
         return false;
     }
-    size_t read =
-        mHandle->readRGB8(frame->rgb()) * 3;
+    size_t read = mHandle->readRGB8(dst) * 3;
 
     bool ok = int(read) == mbytesPerFrame;
     if (!ok) {
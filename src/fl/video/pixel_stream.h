@@ -3,6 +3,8 @@
 #include "fl/system/file_system.h"
 #include "fl/stl/shared_ptr.h"         // For FASTLED_SHARED_PTR macros
 #include "fl/stl/int.h"
+#include "fl/stl/span.h"
+#include "fl/stl/vector.h"
 #include "fl/stl/noexcept.h"
 namespace fl {
 class filebuf;
@@ -17,6 +19,12 @@ FASTLED_SHARED_PTR(PixelStream);
 // PixelStream reads frames from a filebuf to serve data to the video system.
 // A single handle is used for both seekable files and non-seekable streams.
 // Seekability is auto-detected via seek() at begin() time.
+//
+// Seekable files have a fast path for random access. When the handle exposes
+// a mapped() view (e.g. mmap on the native host), frames are served straight
+// from the mapping. Otherwise, setPrefetchFrames(n) reads groups of n frames
+// with one filebuf::read_at() (a single large block read on SD cards) and
+// serves the following frames from that block.
 class PixelStream {
   public:
     enum Type {
@@ -37,6 +45,17 @@ class PixelStream {
 
     bool readFrame(Frame *frame);
     bool readFrameAt(fl::u32 frameNumber, Frame *frame);
+    // Read straight into caller-owned pixels (e.g. a FrameRing slot).
+    bool readFrame(fl::span<CRGB> dst);
+    bool readFrameAt(fl::u32 frameNumber, fl::span<CRGB> dst);
+    // Zero-copy view of a frame in the mapped file or prefetch block. Empty
+    // for streams, missing frames, or when neither path is available. The
+    // view is valid until the next read from this PixelStream.
+    fl::span<const CRGB> frameView(fl::u32 frameNumber);
+    // Frames fetched per block read when the handle is not mapped. 0 (the
+    // default) reads one frame at a time with no extra buffering.
+    void setPrefetchFrames(fl::u32 frames);
+    fl::u32 prefetchFrames() const { return mPrefetchFrames; }
     bool hasFrame(fl::u32 frameNumber);
     i32 framesRemaining() const; // -1 if this is a stream.
     i32 framesDisplayed() const;
@@ -49,9 +68,15 @@ class PixelStream {
     Type getType() const;
 
   private:
+    bool fillPrefetch(fl::u32 frameNumber);
+
     fl::i32 mbytesPerFrame;
     fl::filebuf_ptr mHandle;
     Type mType;
+    fl::u32 mPrefetchFrames = 0;
+    fl::vector_psram<fl::u8> mPrefetch;  // mPrefetchFrames * mbytesPerFrame
+    fl::u32 mPrefetchFirst = 0;          // First frame held in mPrefetch.
+    fl::u32 mPrefetchCount = 0;          // Whole frames held in mPrefetch.
 
   public:
     virtual ~PixelStream() FL_NOEXCEPT;
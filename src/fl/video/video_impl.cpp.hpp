@@ -19,7 +19,8 @@ VideoImpl::VideoImpl(size_t pixelsPerFrame, float fpsVideo,
                      size_t nFramesInBuffer)
     : mPixelsPerFrame(pixelsPerFrame),
       mFrameInterpolator(
-          fl::make_shared<FrameInterpolator>(fl::max(1, nFramesInBuffer), fpsVideo)) {}
+          fl::make_shared<FrameInterpolator>(fl::max(1, nFramesInBuffer),
+                                             fpsVideo, pixelsPerFrame)) {}
 
 void VideoImpl::pause(fl::u32 now) {
     if (!mTime) {
@@ -46,6 +47,13 @@ void VideoImpl::setFade(fl::u32 fadeInTime, fl::u32 fadeOutTime) {
     mFadeOutTime = fadeOutTime;
 }
 
+void VideoImpl::setPrefetchFrames(fl::u32 frames) {
+    mPrefetchFrames = frames;
+    if (mStream) {
+        mStream->setPrefetchFrames(frames);
+    }
+}
+
 bool VideoImpl::needsFrame(fl::u32 now) const {
     fl::u32 f1, f2;
     bool out = mFrameInterpolator->needsFrame(now, &f1, &f2);
@@ -57,6 +65,7 @@ VideoImpl::~VideoImpl() FL_NOEXCEPT { end(); }
 void VideoImpl::begin(filebuf_ptr h) {
     end();
     mStream = fl::make_shared<PixelStream>(mPixelsPerFrame * kSizeRGB8);
+    mStream->setPrefetchFrames(mPrefetchFrames);
     mStream->begin(h);
     mPrevNow = 0;
 }
@@ -67,7 +76,7 @@ void VideoImpl::end() {
     mStream.reset();
 }
 
-bool VideoImpl::full() const { return mFrameInterpolator->getFrames()->full(); }
+bool VideoImpl::full() const { return mFrameInterpolator->full(); }
 
 bool VideoImpl::draw(fl::u32 now, Frame *frame) {
     return draw(now, frame->rgb());
@@ -184,28 +193,16 @@ bool VideoImpl::updateBufferFromStream(fl::u32 now) {
     }
 
     for (size_t i = 0; i < frame_numbers.size(); ++i) {
-        FramePtr recycled_frame;
-        if (mFrameInterpolator->full()) {
-            fl::u32 frame_to_erase = 0;
-            bool ok =
-                mFrameInterpolator->get_oldest_frame_number(&frame_to_erase);
-            if (!ok) {
-                FL_WARN("get_oldest_frame_number failed");
-                return false;
-            }
-            recycled_frame = mFrameInterpolator->erase(frame_to_erase);
-            if (!recycled_frame) {
-                FL_WARN("erase failed for frame: " << frame_to_erase);
-                return false;
-            }
+        // Recycle a ring slot in place (the oldest frame when full).
+        int slot = mFrameInterpolator->reserve();
+        if (slot < 0) {
+            FL_WARN("reserve failed");
+            return false;
         }
+        fl::span<CRGB> pixels = mFrameInterpolator->pixels(slot);
         fl::u32 frame_to_fetch = frame_numbers[i];
-        if (!recycled_frame) {
-            // Happens when we are not full and we need to allocate a new frame.
-            recycled_frame = fl::make_shared<Frame>(mPixelsPerFrame);
-        }
 
-        if (!mStream->readFrame(recycled_frame.get())) {
+        if (!mStream->readFrame(pixels)) {
             if (mStream->atEnd()) {
                 if (!mStream->rewind()) {
                     FL_WARN("rewind failed");
@@ -213,8 +210,7 @@ bool VideoImpl::updateBufferFromStream(fl::u32 now) {
                 }
                 mTime->reset(now);
                 frame_to_fetch = 0;
-                if (!mStream->readFrameAt(frame_to_fetch,
-                                          recycled_frame.get())) {
+                if (!mStream->readFrameAt(frame_to_fetch, pixels)) {
                     FL_WARN("readFrameAt failed");
                     return false;
                 }
@@ -229,11 +225,7 @@ bool VideoImpl::updateBufferFromStream(fl::u32 now) {
                 return false;
             }
         }
-        bool ok = mFrameInterpolator->insert(frame_to_fetch, recycled_frame);
-        if (!ok) {
-            FL_WARN("insert failed");
-            return false;
-        }
+        mFrameInterpolator->commit(slot, frame_to_fetch);
     }
     return true;
 }
@@ -266,39 +258,18 @@ bool VideoImpl::updateBufferFromFile(fl::u32 now, bool forward) {
     }
 
     for (size_t i = 0; i < frame_numbers.size(); ++i) {
-        FramePtr recycled_frame;
-        if (mFrameInterpolator->full()) {
-            fl::u32 frame_to_erase = 0;
-            bool ok = false;
-            if (forward) {
-                ok = mFrameInterpolator->get_oldest_frame_number(
-                    &frame_to_erase);
-                if (!ok) {
-                    FL_WARN("get_oldest_frame_number failed");
-                    return false;
-                }
-            } else {
-                ok = mFrameInterpolator->get_newest_frame_number(
-                    &frame_to_erase);
-                if (!ok) {
-                    FL_WARN("get_newest_frame_number failed");
-                    return false;
-                }
-            }
-            recycled_frame = mFrameInterpolator->erase(frame_to_erase);
-            if (!recycled_frame) {
-                FL_WARN("erase failed for frame: " << frame_to_erase);
-                return false;
-            }
+        // Recycle a ring slot in place: when full, drop the frame furthest
+        // behind the play direction.
+        int slot = mFrameInterpolator->reserve(!forward);
+        if (slot < 0) {
+            FL_WARN("reserve failed");
+            return false;
         }
+        fl::span<CRGB> pixels = mFrameInterpolator->pixels(slot);
         fl::u32 frame_to_fetch = frame_numbers[i];
-        if (!recycled_frame) {
-            // Happens when we are not full and we need to allocate a new frame.
-            recycled_frame = fl::make_shared<Frame>(mPixelsPerFrame);
-        }
 
         do { // only to use break
-            if (!mStream->readFrameAt(frame_to_fetch, recycled_frame.get())) {
+            if (!mStream->readFrameAt(frame_to_fetch, pixels)) {
                 if (!forward) {
                     // nothing more we can do, we can't go negative.
                     return false;
@@ -310,8 +281,7 @@ bool VideoImpl::updateBufferFromFile(fl::u32 now, bool forward) {
                     }
                     mTime->reset(now);
                     frame_to_fetch = 0;
-                    if (!mStream->readFrameAt(frame_to_fetch,
-                                              recycled_frame.get())) {
+                    if (!mStream->readFrameAt(frame_to_fetch, pixels)) {
                         FL_WARN("readFrameAt failed");
                         return false;
                     }
@@ -323,11 +293,7 @@ bool VideoImpl::updateBufferFromFile(fl::u32 now, bool forward) {
             break;
         } while (false);
 
-        bool ok = mFrameInterpolator->insert(frame_to_fetch, recycled_frame);
-        if (!ok) {
-            FL_WARN("insert failed");
-            return false;
-        }
+        mFrameInterpolator->commit(slot, frame_to_fetch);
     }
     return true;
 }
@@ -47,6 +47,8 @@ class VideoImpl {
     bool full() const;
     void setTimeScale(float timeScale);
     float timeScale() const { return mTimeScale; }
+    // Frames per block read for seekable, unmapped files. See PixelStream.
+    void setPrefetchFrames(fl::u32 frames);
     size_t pixelsPerFrame() const { return mPixelsPerFrame; }
     void pause(fl::u32 now);
     void resume(fl::u32 now);
@@ -65,6 +67,7 @@ class VideoImpl {
     fl::u32 mFadeInTime = 1000;
     fl::u32 mFadeOutTime = 1000;
     float mTimeScale = 1.0f;
+    fl::u32 mPrefetchFrames = 0;
 };
 
 } // namespace video
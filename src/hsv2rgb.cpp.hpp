@@ -12,6 +12,11 @@
 
 #include "hsv2rgb.h"
 
+// Batch hsv2rgb_rainbow() runs its scaling stage on platform-neutral SIMD.
+#if !defined(FL_IS_AVR)
+#include "fl/math/simd.h"
+#endif
+
 
 /// HSV to RGB implementation in raw C, platform independent
 void hsv2rgb_raw_C (const CHSV & hsv, CRGB & rgb);
@@ -524,12 +529,117 @@ void hsv2rgb_raw(const CHSV * phsv, CRGB * prgb, int numLeds) {
     }
 }
 
-void hsv2rgb_rainbow( const CHSV* phsv, CRGB * prgb, int numLeds) {
-    for(int i = 0; i < numLeds; ++i) {
+#if !defined(FL_IS_AVR) && (FASTLED_SCALE8_FIXED == 1)
+namespace {
+
+// Fully saturated, full brightness rainbow color for every hue.
+struct RainbowHueTable {
+    fl::u8 rgb[256 * 3];
+    RainbowHueTable() {
+        for (int h = 0; h < 256; ++h) {
+            CRGB c;
+            hsv2rgb_rainbow(CHSV(static_cast<fl::u8>(h), 255, 255), c);
+            rgb[h * 3 + 0] = c.r;
+            rgb[h * 3 + 1] = c.g;
+            rgb[h * 3 + 2] = c.b;
+        }
+    }
+};
+
+const fl::u8* rainbowHueTable() {
+    static const RainbowHueTable table;
+    return table.rgb;
+}
+
+// scale8_video(v, v) per lane: (v * v >> 8) + (v != 0)
+FASTLED_FORCE_INLINE fl::simd::simd_u8x16 rainbowSquareVideo(fl::simd::simd_u8x16 v,
+                                                             fl::simd::simd_u8x16 ones) {
+    namespace fsimd = fl::simd; // ok bare using
+    auto lo = fsimd::widen_lo_u8_to_u16(v);
+    auto hi = fsimd::widen_hi_u8_to_u16(v);
+    auto sq = fsimd::narrow_u16_to_u8(fsimd::srli_u16_8(fsimd::mullo_u16_8(lo, lo), 8),
+                                      fsimd::srli_u16_8(fsimd::mullo_u16_8(hi, hi), 8));
+    return fsimd::add_sat_u8_16(sq, fsimd::min_u8_16(v, ones));
+}
+
+// scale8(c, s) per lane, with s + 1 already widened to 16 bits.
+FASTLED_FORCE_INLINE fl::simd::simd_u8x16 rainbowScale(fl::simd::simd_u8x16 c,
+                                                       fl::simd::simd_u16x8 mul_lo,
+                                                       fl::simd::simd_u16x8 mul_hi) {
+    namespace fsimd = fl::simd; // ok bare using
+    return fsimd::narrow_u16_to_u8(
+        fsimd::srli_u16_8(fsimd::mullo_u16_8(fsimd::widen_lo_u8_to_u16(c), mul_lo), 8),
+        fsimd::srli_u16_8(fsimd::mullo_u16_8(fsimd::widen_hi_u8_to_u16(c), mul_hi), 8));
+}
+
+// The scalar conversion's sat == 255, sat == 0, val == 255 and val == 0
+// branches all fall out of the general formulas, so every lane runs the
+// same code: desaturate, add the brightness floor, then scale by value.
+void hsv2rgb_rainbow_x16(const CHSV* phsv, CRGB* prgb, const fl::u8* table) {
+    namespace fsimd = fl::simd; // ok bare using
+    fl::u8 s[16], v[16], r[16], g[16], b[16];
+    for (int i = 0; i < 16; ++i) {
+        const fl::u8* e = table + phsv[i].hue * 3;
+        r[i] = e[0];
+        g[i] = e[1];
+        b[i] = e[2];
+        s[i] = phsv[i].sat;
+        v[i] = phsv[i].val;
+    }
+    const auto one16 = fsimd::set1_u16_8(1);
+    const auto ones = fsimd::narrow_u16_to_u8(one16, one16);
+    const auto ff = fsimd::narrow_u16_to_u8(fsimd::set1_u16_8(255), fsimd::set1_u16_8(255));
+
+    const auto desat = rainbowSquareVideo(fsimd::xor_u8_16(fsimd::load_u8_16(s), ff), ones);
+    const auto satscale = fsimd::xor_u8_16(desat, ff);
+    const auto sat_lo = fsimd::add_u16_8(fsimd::widen_lo_u8_to_u16(satscale), one16);
+    const auto sat_hi = fsimd::add_u16_8(fsimd::widen_hi_u8_to_u16(satscale), one16);
+
+    const auto val = rainbowSquareVideo(fsimd::load_u8_16(v), ones);
+    const auto val_lo = fsimd::add_u16_8(fsimd::widen_lo_u8_to_u16(val), one16);
+    const auto val_hi = fsimd::add_u16_8(fsimd::widen_hi_u8_to_u16(val), one16);
+
+    auto vr = fsimd::add_sat_u8_16(rainbowScale(fsimd::load_u8_16(r), sat_lo, sat_hi), desat);
+    auto vg = fsimd::add_sat_u8_16(rainbowScale(fsimd::load_u8_16(g), sat_lo, sat_hi), desat);
+    auto vb = fsimd::add_sat_u8_16(rainbowScale(fsimd::load_u8_16(b), sat_lo, sat_hi), desat);
+    fsimd::store_u8_16(r, rainbowScale(vr, val_lo, val_hi));
+    fsimd::store_u8_16(g, rainbowScale(vg, val_lo, val_hi));
+    fsimd::store_u8_16(b, rainbowScale(vb, val_lo, val_hi));
+    for (int i = 0; i < 16; ++i) {
+        prgb[i].r = r[i];
+        prgb[i].g = g[i];
+        prgb[i].b = b[i];
+    }
+}
+
+} // namespace
+#endif
+
+void hsv2rgb_rainbow(fl::span<const CHSV> hsv, fl::span<CRGB> rgb) {
+    const fl::size n = hsv.size() < rgb.size() ? hsv.size() : rgb.size();
+    const CHSV* phsv = hsv.data();
+    CRGB* prgb = rgb.data();
+    fl::size i = 0;
+#if !defined(FL_IS_AVR) && (FASTLED_SCALE8_FIXED == 1)
+    if (n >= 16) {
+        const fl::u8* table = rainbowHueTable();
+        for (; i + 16 <= n; i += 16) {
+            hsv2rgb_rainbow_x16(phsv + i, prgb + i, table);
+        }
+    }
+#endif
+    for (; i < n; ++i) {
         hsv2rgb_rainbow(phsv[i], prgb[i]);
     }
 }
 
+void hsv2rgb_rainbow( const CHSV* phsv, CRGB * prgb, int numLeds) {
+    if (numLeds <= 0) {
+        return;
+    }
+    hsv2rgb_rainbow(fl::span<const CHSV>(phsv, numLeds), fl::span<CRGB>(prgb, numLeds));
+}
+
 void hsv2rgb_spectrum( const CHSV* phsv, CRGB * prgb, int numLeds) {
     for(int i = 0; i < numLeds; ++i) {
         hsv2rgb_spectrum(phsv[i], prgb[i]);
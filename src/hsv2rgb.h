@@ -6,6 +6,7 @@
 // Forward declarations
 #include "fl/gfx/crgb.h"  // for fl::CRGB
 #include "fl/gfx/hsv.h"   // for fl::hsv8
+#include "fl/stl/span.h"
 
 /// @file hsv2rgb.h
 /// Functions to convert from the HSV colorspace to the RGB colorspace
@@ -69,6 +70,12 @@ using CHSV = fl::hsv8;  // Bring the typedef into this namespace for consistency
 /// @param prgb CRGB array to store the result of the conversion (will be modified)
 /// @param numLeds the number of array values to process
 void hsv2rgb_rainbow( const CHSV* phsv, CRGB * prgb, int numLeds);
+
+/// Batch form of hsv2rgb_rainbow(const CHSV&, CRGB&): converts the first
+/// min(hsv.size(), rgb.size()) pixels. Hues come from a 256-entry table and
+/// the saturation/value scaling runs 16 pixels at a time on fl/math/simd.
+/// Results are identical to the per-pixel conversion.
+void hsv2rgb_rainbow(fl::span<const CHSV> hsv, fl::span<CRGB> rgb);
 void hsv2rgb_rainbow( const CHSV& hsv, CRGB& rgb);
 CRGB hsv2rgb_rainbow( const CHSV& hsv);
 
@@ -17,6 +17,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/stl/cstring.h"
 #include "fl/math/math.h"
+#include "fl/math/simd.h"
 // Compiler throws a warning about stack usage possibly being unbounded even
 // though bounds are checked, silence that so users don't see it
 FL_DISABLE_WARNING_PUSH
@@ -958,4 +959,315 @@ void fill_2dnoise16(CRGB *leds, int width, int height, bool serpentine,
   }
 }
 
+// Noise fields: inoise16() over a regular grid, one row at a time.
+
+namespace noise_detail {
+
+// Columns produced per pass over a row. Octaves are summed chunk by chunk,
+// so the scratch buffers stay on the stack whatever the field size.
+static const int kNoiseFieldChunk = 64;
+static const int kNoiseFieldMaxOctaves = 8;
+
+#if !defined(FL_IS_AVR) && !defined(FADE_12) && FASTLED_NOISE_ALLOW_AVERAGE_TO_OVERFLOW == 0 && FASTLED_SCALE8_FIXED == 1
+#define FASTLED_NOISE_FIELD_SIMD 1
+#else
+#define FASTLED_NOISE_FIELD_SIMD 0
+#endif
+
+#if FASTLED_NOISE_FIELD_SIMD
+
+using fl::simd::simd_u32x4;
+
+// One corner's grad16() for a whole lattice cell. grad16() averages two of
+// the corner offsets (x, y, z), each possibly negated, chosen by the hash.
+// Along a row y and z are constant and the hash is constant within a cell,
+// so a component is either the per-lane x offset or a constant:
+//   c = pickX ? x : constant;  c = (c ^ sign) - sign
+struct NoiseFieldGrad {
+    simd_u32x4 uPickX, uConst, uSign;
+    simd_u32x4 vPickX, vConst, vSign;
+};
+
+static inline __attribute__((always_inline)) simd_u32x4 noiseFieldMask(bool on) {
+    return fl::simd::set1_u32_4(on ? 0xFFFFFFFFu : 0u);
+}
+
+static inline __attribute__((always_inline)) void noiseFieldSetGrad(NoiseFieldGrad &g, bool uX, fl::i32 uC, bool vX, fl::i32 vC, fl::u8 hash) {
+    g.uPickX = noiseFieldMask(uX);
+    g.uConst = fl::simd::set1_u32_4(static_cast<fl::u32>(uC));
+    g.uSign = noiseFieldMask(hash & 1);
+    g.vPickX = noiseFieldMask(vX);
+    g.vConst = fl::simd::set1_u32_4(static_cast<fl::u32>(vC));
+    g.vSign = noiseFieldMask(hash & 2);
+}
+
+// grad16(hash, x, y, z) with y and z fixed.
+static inline __attribute__((always_inline)) void noiseFieldGrad3(NoiseFieldGrad &g, fl::u8 hash, fl::i32 y, fl::i32 z) {
+    hash = hash & 15;
+    const bool vX = hash == 12 || hash == 14;
+    noiseFieldSetGrad(g, hash < 8, y, vX, hash < 4 ? y : z, hash);
+}
+
+// grad16(hash, x, y) with y fixed.
+static inline __attribute__((always_inline)) void noiseFieldGrad2(NoiseFieldGrad &g, fl::u8 hash, fl::i32 y) {
+    hash = hash & 7;
+    noiseFieldSetGrad(g, hash < 4, y, hash >= 4, y, hash);
+}
+
+// Negation wraps at 16 bits exactly as it does on the scalar i16.
+static inline __attribute__((always_inline)) simd_u32x4 noiseFieldComponent(simd_u32x4 x, simd_u32x4 pickX, simd_u32x4 c, simd_u32x4 sign) {
+    simd_u32x4 v = fl::simd::xor_u32_4(c, fl::simd::and_u32_4(fl::simd::xor_u32_4(x, c), pickX));
+    v = fl::simd::sub_i32_4(fl::simd::xor_u32_4(v, sign), sign);
+    return fl::simd::sra_i32_4(fl::simd::sll_u32_4(v, 16), 16);
+}
+
+static inline __attribute__((always_inline)) simd_u32x4 noiseFieldGradEval(const NoiseFieldGrad &g, simd_u32x4 x, simd_u32x4 one) {
+    simd_u32x4 u = noiseFieldComponent(x, g.uPickX, g.uConst, g.uSign);
+    simd_u32x4 v = noiseFieldComponent(x, g.vPickX, g.vConst, g.vSign);
+    // AVG15(u, v)
+    return fl::simd::add_i32_4(fl::simd::add_i32_4(fl::simd::sra_i32_4(u, 1), fl::simd::sra_i32_4(v, 1)), fl::simd::and_u32_4(u, one));
+}
+
+// lerp15by16(a, b, frac) with frac1 = frac + 1. |b - a| * frac1 fits in 32
+// bits, so the high half of the unsigned product is exactly scale16().
+static inline __attribute__((always_inline)) simd_u32x4 noiseFieldLerp(simd_u32x4 a, simd_u32x4 b, simd_u32x4 frac1) {
+    simd_u32x4 d = fl::simd::sub_i32_4(b, a);
+    simd_u32x4 s = fl::simd::sra_i32_4(d, 31);
+    simd_u32x4 scaled = fl::simd::mulhi_u32_4(fl::simd::sub_i32_4(fl::simd::xor_u32_4(d, s), s), frac1);
+    return fl::simd::add_i32_4(a, fl::simd::sub_i32_4(fl::simd::xor_u32_4(scaled, s), s));
+}
+
+// EASE16() of 16-bit fractions, plus one (ready for noiseFieldLerp()).
+static inline __attribute__((always_inline)) simd_u32x4 noiseFieldEase1(simd_u32x4 u, simd_u32x4 one) {
+#if FASTLED_NOISE_FIXED == 0
+    return fl::simd::add_i32_4(fl::simd::mulhi_u32_4(u, fl::simd::add_i32_4(u, one)), one);
+#else
+    // ease16InOutQuad(): mirror the top half into the bottom, square, mirror back.
+    simd_u32x4 m = fl::simd::and_u32_4(fl::simd::sub_i32_4(fl::simd::set1_u32_4(0), fl::simd::srl_u32_4(u, 15)), fl::simd::set1_u32_4(0xFFFF));
+    simd_u32x4 j = fl::simd::xor_u32_4(u, m);
+    simd_u32x4 jj = fl::simd::mulhi_u32_4(j, fl::simd::add_i32_4(j, one));
+    return fl::simd::add_i32_4(fl::simd::xor_u32_4(fl::simd::sll_u32_4(jj, 1), m), one);
+#endif
+}
+
+static inline __attribute__((always_inline)) fl::u16 noiseFieldEaseScalar(fl::u16 u) {
+    return EASE16(u);
+}
+
+// Writes inoise16() for count samples at x + i*scale_x into out, which must
+// have room for count + 3 values (the last group of four is stored whole).
+static void noiseFieldRow(fl::u32 *out, int count, fl::u32 x, fl::i32 scale_x, fl::u32 y, fl::u32 z, bool use_z) {
+    const simd_u32x4 one = fl::simd::set1_u32_4(1);
+    const simd_u32x4 lowMask = fl::simd::set1_u32_4(0xFFFF);
+    const simd_u32x4 half = fl::simd::set1_u32_4(0x8000);
+    const fl::u32 step = static_cast<fl::u32>(scale_x);
+    const simd_u32x4 groupStep = fl::simd::set1_u32_4(step * 4);
+
+    // Row constants.
+    const fl::u8 Y = (y >> 16) & 0xFF;
+    const fl::u8 Z = (z >> 16) & 0xFF;
+    const fl::i32 yy = ((y & 0xFFFF) >> 1) & 0x7FFF;
+    const fl::i32 zz = ((z & 0xFFFF) >> 1) & 0x7FFF;
+    const fl::i32 N = 0x8000;
+    const simd_u32x4 v1 = fl::simd::set1_u32_4(noiseFieldEaseScalar(y & 0xFFFF) + 1u);
+    const simd_u32x4 w1 = fl::simd::set1_u32_4(noiseFieldEaseScalar(z & 0xFFFF) + 1u);
+    const simd_u32x4 bias = fl::simd::set1_u32_4(use_z ? 19052u : 17308u);
+    const simd_u32x4 gain = fl::simd::set1_u32_4(use_z ? (440u << 8) : (484u << 8));
+
+    NoiseFieldGrad g[8];
+    int i = 0;
+    while (i < count) {
+        // Samples left in the current cell.
+        const fl::u32 xi = x + static_cast<fl::u32>(i) * step;
+        const fl::u32 frac = xi & 0xFFFF;
+        fl::u32 run;
+        if (scale_x > 0) {
+            run = (0x10000u - frac + step - 1) / step;
+        } else if (scale_x < 0) {
+            run = frac / (0u - step) + 1;
+        } else {
+            run = static_cast<fl::u32>(count - i);
+        }
+        const int end = (run < static_cast<fl::u32>(count - i)) ? i + static_cast<int>(run) : count;
+
+        // Hash the cell corners once for every sample in it.
+        const fl::u8 X = (xi >> 16) & 0xFF;
+        if (use_z) {
+            fl::u8 A = NOISE_P(X) + Y;
+            fl::u8 AA = NOISE_P(A) + Z;
+            fl::u8 AB = NOISE_P(A + 1) + Z;
+            fl::u8 B = NOISE_P(X + 1) + Y;
+            fl::u8 BA = NOISE_P(B) + Z;
+            fl::u8 BB = NOISE_P(B + 1) + Z;
+            noiseFieldGrad3(g[0], NOISE_P(AA), yy, zz);
+            noiseFieldGrad3(g[1], NOISE_P(BA), yy, zz);
+            noiseFieldGrad3(g[2], NOISE_P(AB), yy - N, zz);
+            noiseFieldGrad3(g[3], NOISE_P(BB), yy - N, zz);
+            noiseFieldGrad3(g[4], NOISE_P(AA + 1), yy, zz - N);
+            noiseFieldGrad3(g[5], NOISE_P(BA + 1), yy, zz - N);
+            noiseFieldGrad3(g[6], NOISE_P(AB + 1), yy - N, zz - N);
+            noiseFieldGrad3(g[7], NOISE_P(BB + 1), yy - N, zz - N);
+        } else {
+            fl::u8 A = NOISE_P(X) + Y;
+            fl::u8 AA = NOISE_P(A);
+            fl::u8 AB = NOISE_P(A + 1);
+            fl::u8 B = NOISE_P(X + 1) + Y;
+            fl::u8 BA = NOISE_P(B);
+            fl::u8 BB = NOISE_P(B + 1);
+            noiseFieldGrad2(g[0], NOISE_P(AA), yy);
+            noiseFieldGrad2(g[1], NOISE_P(BA), yy);
+            noiseFieldGrad2(g[2], NOISE_P(AB), yy - N);
+            noiseFieldGrad2(g[3], NOISE_P(BB), yy - N);
+        }
+
+        simd_u32x4 xs = fl::simd::set_u32_4(xi, xi + step, xi + 2 * step, xi + 3 * step);
+        for (; i < end; i += 4, xs = fl::simd::add_i32_4(xs, groupStep)) {
+            simd_u32x4 u = fl::simd::and_u32_4(xs, lowMask);
+            simd_u32x4 x0 = fl::simd::srl_u32_4(u, 1);
+            simd_u32x4 x1 = fl::simd::sub_i32_4(x0, half);
+            simd_u32x4 u1 = noiseFieldEase1(u, one);
+
+            simd_u32x4 ans;
+            if (use_z) {
+                simd_u32x4 X1 = noiseFieldLerp(noiseFieldGradEval(g[0], x0, one), noiseFieldGradEval(g[1], x1, one), u1);
+                simd_u32x4 X2 = noiseFieldLerp(noiseFieldGradEval(g[2], x0, one), noiseFieldGradEval(g[3], x1, one), u1);
+                simd_u32x4 X3 = noiseFieldLerp(noiseFieldGradEval(g[4], x0, one), noiseFieldGradEval(g[5], x1, one), u1);
+                simd_u32x4 X4 = noiseFieldLerp(noiseFieldGradEval(g[6], x0, one), noiseFieldGradEval(g[7], x1, one), u1);
+                simd_u32x4 Y1 = noiseFieldLerp(X1, X2, v1);
+                simd_u32x4 Y2 = noiseFieldLerp(X3, X4, v1);
+                ans = noiseFieldLerp(Y1, Y2, w1);
+            } else {
+                simd_u32x4 X1 = noiseFieldLerp(noiseFieldGradEval(g[0], x0, one), noiseFieldGradEval(g[1], x1, one), u1);
+                simd_u32x4 X2 = noiseFieldLerp(noiseFieldGradEval(g[2], x0, one), noiseFieldGradEval(g[3], x1, one), u1);
+                ans = noiseFieldLerp(X1, X2, v1);
+            }
+            // inoise16() scaling: ((raw + bias) * k) >> 8, kept to 16 bits.
+            ans = fl::simd::and_u32_4(fl::simd::mulhi_u32_4(fl::simd::add_i32_4(ans, bias), gain), lowMask);
+            fl::simd::store_u32_4(out + i, ans);
+        }
+        // A run ending mid-group leaves i past end; the next cell rewrites
+        // those samples.
+        i = end;
+    }
+}
+
+#else // !FASTLED_NOISE_FIELD_SIMD
+
+static void noiseFieldRow(fl::u32 *out, int count, fl::u32 x, fl::i32 scale_x, fl::u32 y, fl::u32 z, bool use_z) {
+    const fl::u32 step = static_cast<fl::u32>(scale_x);
+    for (int i = 0; i < count; ++i, x += step) {
+        out[i] = use_z ? inoise16(x, y, z) : inoise16(x, y);
+    }
+}
+
+#endif // FASTLED_NOISE_FIELD_SIMD
+
+// Runs the field chunk by chunk, handing each finished chunk of 16-bit
+// samples to sink(index, samples, count).
+template <typename Sink>
+static void noiseFieldFill(const NoiseField &field, Sink &sink) {
+    if (field.width <= 0 || field.height <= 0) {
+        return;
+    }
+    const int depth = field.use_z ? field.depth : 1;
+    int octaves = field.octaves;
+    if (octaves < 1) {
+        octaves = 1;
+    } else if (octaves > kNoiseFieldMaxOctaves) {
+        octaves = kNoiseFieldMaxOctaves;
+    }
+    // Octave weights sum to (2^octaves - 1) / 2^(octaves - 1); gain is the
+    // 16.16 reciprocal that stretches the sum back to the single-octave range.
+    const fl::u32 gain = (0x10000u << (octaves - 1)) / ((1u << octaves) - 1);
+
+    fl::u32 samples[kNoiseFieldChunk + 4];
+    fl::i32 acc[kNoiseFieldChunk];
+    const fl::u32 sx = static_cast<fl::u32>(field.scale_x);
+    fl::u32 index = 0;
+    for (int k = 0; k < depth; ++k) {
+        const fl::u32 z = field.z + static_cast<fl::u32>(k) * static_cast<fl::u32>(field.scale_z);
+        for (int j = 0; j < field.height; ++j) {
+            const fl::u32 y = field.y + static_cast<fl::u32>(j) * static_cast<fl::u32>(field.scale_y);
+            for (int c = 0; c < field.width; c += kNoiseFieldChunk) {
+                const int n = field.width - c < kNoiseFieldChunk ? field.width - c : kNoiseFieldChunk;
+                const fl::u32 x = field.x + static_cast<fl::u32>(c) * sx;
+                if (octaves == 1) {
+                    noiseFieldRow(samples, n, x, field.scale_x, y, z, field.use_z);
+                } else {
+                    for (int i = 0; i < n; ++i) {
+                        acc[i] = 0;
+                    }
+                    for (int o = 0; o < octaves; ++o) {
+                        noiseFieldRow(samples, n, x << o, static_cast<fl::i32>(sx << o), y << o, z << o, field.use_z);
+                        for (int i = 0; i < n; ++i) {
+                            acc[i] += (static_cast<fl::i32>(samples[i]) - 32768) >> o;
+                        }
+                    }
+                    for (int i = 0; i < n; ++i) {
+                        fl::i32 v = 32768 + static_cast<fl::i32>((static_cast<fl::i64>(acc[i]) * gain) >> 16);
+                        samples[i] = static_cast<fl::u32>(v < 0 ? 0 : (v > 65535 ? 65535 : v));
+                    }
+                }
+                sink(index, samples, n);
+                index += static_cast<fl::u32>(n);
+            }
+        }
+    }
+}
+
+struct NoiseFieldSink16 {
+    fl::u16 *out;
+    void operator()(fl::u32 index, const fl::u32 *samples, int n) {
+        for (int i = 0; i < n; ++i) {
+            out[index + i] = static_cast<fl::u16>(samples[i]);
+        }
+    }
+};
+
+struct NoiseFieldSink8 {
+    fl::u8 *out;
+    void operator()(fl::u32 index, const fl::u32 *samples, int n) {
+        for (int i = 0; i < n; ++i) {
+            out[index + i] = static_cast<fl::u8>(samples[i] >> 8);
+        }
+    }
+};
+
+struct NoiseFieldSinkPalette {
+    CRGB *out;
+    const fl::CRGBPalette16 *palette;
+    fl::u8 brightness;
+    fl::TBlendType blendType;
+    void operator()(fl::u32 index, const fl::u32 *samples, int n) {
+        for (int i = 0; i < n; ++i) {
+            out[index + i] = ColorFromPalette(*palette, static_cast<fl::u8>(samples[i] >> 8), brightness, blendType);
+        }
+    }
+};
+
+} // namespace noise_detail
+
+void fill_noise_field(fl::u16 *pData, const NoiseField &field) {
+    noise_detail::NoiseFieldSink16 sink;
+    sink.out = pData;
+    noise_detail::noiseFieldFill(field, sink);
+}
+
+void fill_noise_field(fl::u8 *pData, const NoiseField &field) {
+    noise_detail::NoiseFieldSink8 sink;
+    sink.out = pData;
+    noise_detail::noiseFieldFill(field, sink);
+}
+
+void fill_noise_field(CRGB *leds, const NoiseField &field,
+                      const fl::CRGBPalette16 &palette, fl::u8 brightness,
+                      fl::TBlendType blendType) {
+    noise_detail::NoiseFieldSinkPalette sink;
+    sink.out = leds;
+    sink.palette = &palette;
+    sink.brightness = brightness;
+    sink.blendType = blendType;
+    noise_detail::noiseFieldFill(field, sink);
+}
+
 FL_DISABLE_WARNING_POP
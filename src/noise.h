@@ -8,6 +8,7 @@
 #include "fl/math/math.h"
 #include "fl/math/qfx.h"
 #include "fl/math/intmap.h"
+#include "fl/gfx/colorutils.h"
 
 /// @file noise.h
 /// Functions to generate and fill arrays with noise.
@@ -269,5 +270,61 @@ void fill_2dnoise16(CRGB *leds, int width, int height, bool serpentine,
 
 /// @} Fill Functions
 
+
+/// @name Noise Field Functions
+/// Evaluate inoise16() over a whole regular grid at once.
+/// A row of samples shares its y and z coordinates, and consecutive samples
+/// usually fall in the same lattice cell, so the permutation-table hashes
+/// and gradient choices are worked out once per cell and the samples of
+/// the cell are interpolated four at a time in SIMD lanes. With one octave
+/// every sample is bit-identical to the matching inoise16() call.
+/// @{
+
+/// A grid of sample points on the inoise16() lattice.
+/// Coordinates are 16.16 fixed point, as for inoise16(). Sample (i, j, k)
+/// is taken at (x + i*scale_x, y + j*scale_y, z + k*scale_z) and stored at
+/// index (k*height + j)*width + i.
+struct NoiseField {
+    int width = 0;          ///< samples per row
+    int height = 1;         ///< rows per slice
+    int depth = 1;          ///< slices along z (ignored for 2D noise)
+    fl::u32 x = 0;          ///< x coordinate of the first sample
+    fl::i32 scale_x = 0;    ///< x distance between columns
+    fl::u32 y = 0;          ///< y coordinate of the first sample
+    fl::i32 scale_y = 0;    ///< y distance between rows
+    fl::u32 z = 0;          ///< z coordinate (usually time) of the first slice
+    fl::i32 scale_z = 0;    ///< z distance between slices
+    bool use_z = true;      ///< 3D inoise16(x, y, z) when true, else 2D inoise16(x, y)
+    /// Octaves to sum, 1 to 8. Octave n samples at 2^n times the
+    /// coordinates with 1/2^n of the weight, and the sum is rescaled to
+    /// the full 16-bit range.
+    fl::u8 octaves = 1;
+};
+
+/// Fill a buffer of width*height*depth 16-bit values with noise.
+/// @param pData the array to fill
+/// @param field the grid to sample
+void fill_noise_field(fl::u16 *pData, const NoiseField &field);
+
+/// Fill a buffer of width*height*depth 8-bit values with noise: the high
+/// byte of each 16-bit sample.
+/// @copydetails fill_noise_field(fl::u16*, const NoiseField&)
+void fill_noise_field(fl::u8 *pData, const NoiseField &field);
+
+/// Fill an LED array of width*height*depth pixels with palette colors,
+/// using the high byte of each 16-bit sample as the palette index.
+/// @param leds the LEDs to fill, in field order (wrap with an XYMap for
+///        serpentine or other layouts)
+/// @param field the grid to sample
+/// @param palette palette to map the noise through
+/// @param brightness brightness passed to ColorFromPalette()
+/// @param blendType blend type passed to ColorFromPalette()
+void fill_noise_field(CRGB *leds, const NoiseField &field,
+                      const fl::CRGBPalette16 &palette,
+                      fl::u8 brightness = 255,
+                      fl::TBlendType blendType = fl::LINEARBLEND);
+
+/// @} Noise Field Functions
+
 /// @} NoiseFill
 /// @} Noise
@@ -198,6 +198,18 @@ FASTLED_FORCE_INLINE FL_IRAM simd_u8x16 andnot_u8_16(simd_u8x16 a, simd_u8x16 b)
     return vbicq_u8(b, a);  // Note: vbicq_u8(x, y) computes x & ~y, so we swap parameters
 }
 
+FASTLED_FORCE_INLINE FL_IRAM u16 match_u8_16(simd_u8x16 vec, u8 value) FL_NOEXCEPT {
+    // Weight each matching lane by its bit, then fold the halves with
+    // pairwise adds (no movemask on NEON).
+    static const uint8_t kLaneBits[16] = {1, 2, 4, 8, 16, 32, 64, 128,
+                                          1, 2, 4, 8, 16, 32, 64, 128};
+    const uint8x16_t bits = vandq_u8(vceqq_u8(vec, vdupq_n_u8(value)), vld1q_u8(kLaneBits));
+    uint8x8_t sum = vpadd_u8(vget_low_u8(bits), vget_high_u8(bits));
+    sum = vpadd_u8(sum, sum);
+    sum = vpadd_u8(sum, sum);
+    return static_cast<u16>(vget_lane_u8(sum, 0) | (vget_lane_u8(sum, 1) << 8));
+}
+
 //==============================================================================
 // Float32 SIMD Operations (NEON)
 //==============================================================================
@@ -757,6 +769,14 @@ FASTLED_FORCE_INLINE FL_IRAM simd_u8x16 andnot_u8_16(simd_u8x16 a, simd_u8x16 b)
     return result;
 }
 
+FASTLED_FORCE_INLINE FL_IRAM u16 match_u8_16(simd_u8x16 vec, u8 value) FL_NOEXCEPT {
+    u16 mask = 0;
+    for (int i = 0; i < 16; ++i) {
+        mask = static_cast<u16>(mask | ((vec.data[i] == value ? 1u : 0u) << i));
+    }
+    return mask;
+}
+
 //==============================================================================
 // Int32 SIMD Operations (Scalar Fallback)
 //==============================================================================
@@ -299,6 +299,14 @@ FASTLED_FORCE_INLINE FL_IRAM simd_u8x16 andnot_u8_16(simd_u8x16 a, simd_u8x16 b)
     return result;
 }
 
+FASTLED_FORCE_INLINE FL_IRAM u16 match_u8_16(simd_u8x16 vec, u8 value) FL_NOEXCEPT {
+    u16 mask = 0;
+    for (int i = 0; i < 16; ++i) {
+        mask = static_cast<u16>(mask | ((vec.data[i] == value ? 1u : 0u) << i));
+    }
+    return mask;
+}
+
 
 FASTLED_FORCE_INLINE FL_IRAM simd_u8x16 sub_sat_u8_16(simd_u8x16 a, simd_u8x16 b) FL_NOEXCEPT {
     simd_u8x16 result;
@@ -273,6 +273,11 @@ FASTLED_FORCE_INLINE FL_IRAM simd_u8x16 andnot_u8_16(simd_u8x16 a, simd_u8x16 b)
     return _mm_andnot_si128(a, b);
 }
 
+FASTLED_FORCE_INLINE FL_IRAM u16 match_u8_16(simd_u8x16 vec, u8 value) FL_NOEXCEPT {
+    const __m128i eq = _mm_cmpeq_epi8(vec, _mm_set1_epi8(static_cast<char>(value)));
+    return static_cast<u16>(_mm_movemask_epi8(eq));
+}
+
 //==============================================================================
 // Int32 SIMD Operations (SSE2)
 //==============================================================================
@@ -900,6 +905,14 @@ FASTLED_FORCE_INLINE FL_IRAM simd_u8x16 andnot_u8_16(simd_u8x16 a, simd_u8x16 b)
     return result;
 }
 
+FASTLED_FORCE_INLINE FL_IRAM u16 match_u8_16(simd_u8x16 vec, u8 value) FL_NOEXCEPT {
+    u16 mask = 0;
+    for (int i = 0; i < 16; ++i) {
+        mask = static_cast<u16>(mask | ((vec.data[i] == value ? 1u : 0u) << i));
+    }
+    return mask;
+}
+
 //==============================================================================
 // Int32 SIMD Operations
 //==============================================================================
@@ -10,10 +10,21 @@
 /// calls fl::stub::simulateWS2812Output() on enqueue(), which fires
 /// SimEdgeObserver callbacks. NativeRxDevice registers as an observer in
 /// begin() and captures those edges, completing the TX→RX loopback simulation.
+///
+/// setSimulatedTransmit(true) switches to a wall-clock model of the wire:
+/// frames occupy `bytes * 8 * bit period + reset` microseconds back to back,
+/// stay `isInUse()` until that time has elapsed, and every frame's
+/// enqueue / transmit-start / transmit-end timestamps are recorded. This is
+/// what makes the pipelined encode mode (ChannelManager::setPipelineDepth())
+/// observable on host: with depth > 1, frame N+1's enqueue lands before
+/// frame N's transmit-end.
 
 #include "fl/channels/driver.h"
 #include "fl/channels/data.h"
+#include "fl/stl/chrono.h"
+#include "fl/stl/span.h"
 #include "fl/stl/string.h"
+#include "fl/stl/vector.h"
 #include "platforms/stub/stub_gpio.h"
 #include "fl/stl/noexcept.h"
 
@@ -33,10 +44,45 @@ public:
         return data && data->isClockless();
     }
 
+    /// @brief Timestamps (fl::micros()) of one frame in simulated-transmit mode
+    struct FrameTiming {
+        u32 frame;      ///< Sequence number, assigned at enqueue()
+        u32 enqueueUs;  ///< Channel finished encoding and handed the frame over
+        u32 txStartUs;  ///< Wire became free and transmission began
+        u32 txEndUs;    ///< Last bit plus reset latch clocked out
+    };
+
+    /// @brief Model wire time instead of completing inside enqueue()
+    /// @param enabled true to simulate transmission duration
+    /// @param framesInFlight value reported by maxFramesInFlight() while enabled
+    void setSimulatedTransmit(bool enabled, u8 framesInFlight = 2) FL_NOEXCEPT {
+        mSimulate = enabled;
+        mFramesInFlight = framesInFlight < 1 ? 1 : framesInFlight;
+    }
+
+    /// @brief Per-frame timing recorded while simulated transmit is enabled
+    fl::span<const FrameTiming> timeline() const FL_NOEXCEPT {
+        return fl::span<const FrameTiming>(mTimeline.data(), mTimeline.size());
+    }
+
+    void clearTimeline() FL_NOEXCEPT { mTimeline.clear(); }
+
     virtual void enqueue(ChannelDataPtr channelData) FL_NOEXCEPT override {
         if (!channelData || channelData->getData().empty()) return;
         if (!channelData->isClockless()) return;
 
+        if (mSimulate) {
+            channelData->setInUse(true);
+            Frame frame;
+            frame.data = channelData;
+            frame.timing.frame = mNextFrame++;
+            frame.timing.enqueueUs = fl::micros();
+            frame.timing.txStartUs = 0;
+            frame.timing.txEndUs = 0;
+            mPending.push_back(frame);
+            return;
+        }
+
         // Simulate WS2812 GPIO output — fires SimEdgeObserver callbacks so
         // any registered NativeRxDevice captures the edges.
         const fl::ChipsetTimingConfig& timing = channelData->getTiming();
@@ -49,11 +95,52 @@ public:
     }
 
     virtual void show() FL_NOEXCEPT override {
-        // No hardware to drive — transmission is synchronous in enqueue()
+        // Without simulation there is no hardware to drive — transmission
+        // is synchronous in enqueue().
+        for (fl::size i = 0; i < mPending.size(); ++i) {
+            // Honour maxFramesInFlight(): block until a slot retires.
+            while (mInFlight.size() >= mFramesInFlight) {
+                poll();
+            }
+            Frame frame = mPending[i];
+            const u32 now = fl::micros();
+            const fl::ChipsetTimingConfig& timing = frame.data->getTiming();
+            const u32 wireUs = static_cast<u32>(
+                (static_cast<fl::u64>(frame.data->getSize()) * 8u *
+                 timing.total_period_ns()) / 1000u) + timing.reset_us;
+            // One wire: a frame starts when the previous one is fully out.
+            const bool wireBusy = !mInFlight.empty() &&
+                                  static_cast<i32>(mWireFreeUs - now) > 0;
+            frame.timing.txStartUs = wireBusy ? mWireFreeUs : now;
+            frame.timing.txEndUs = frame.timing.txStartUs + wireUs;
+            mWireFreeUs = frame.timing.txEndUs;
+            fl::stub::simulateWS2812Output(frame.data->getPin(),
+                                           frame.data->getData(), timing);
+            mTimeline.push_back(frame.timing);
+            mInFlight.push_back(frame);
+        }
+        mPending.clear();
     }
 
     virtual DriverState poll() FL_NOEXCEPT override {
-        return DriverState(DriverState::READY);
+        if (mInFlight.empty()) {
+            return DriverState(DriverState::READY);
+        }
+        const u32 now = fl::micros();
+        fl::size kept = 0;
+        for (fl::size i = 0; i < mInFlight.size(); ++i) {
+            if (static_cast<i32>(now - mInFlight[i].timing.txEndUs) >= 0) {
+                mInFlight[i].data->setInUse(false);
+            } else {
+                mInFlight[kept++] = mInFlight[i];
+            }
+        }
+        mInFlight.resize(kept);
+        return DriverState(kept ? DriverState::DRAINING : DriverState::READY);
+    }
+
+    virtual u8 maxFramesInFlight() const FL_NOEXCEPT override {
+        return mSimulate ? mFramesInFlight : 1;
     }
 
     virtual fl::string getName() const FL_NOEXCEPT override {
@@ -63,6 +150,20 @@ public:
     virtual Capabilities getCapabilities() const FL_NOEXCEPT override {
         return Capabilities(true, false);  // Clockless only
     }
+
+private:
+    struct Frame {
+        ChannelDataPtr data;
+        FrameTiming timing;
+    };
+
+    bool mSimulate = false;
+    u8 mFramesInFlight = 1;
+    u32 mNextFrame = 0;
+    u32 mWireFreeUs = 0;
+    fl::vector<Frame> mPending;
+    fl::vector<Frame> mInFlight;
+    fl::vector<FrameTiming> mTimeline;
 };
 
 }  // namespace stub
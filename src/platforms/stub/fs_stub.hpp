@@ -13,6 +13,7 @@
 #include "fl/stl/fstream.h"  // For file I/O operations
 #include "fl/stl/string.h"   // For fl::string
 #include "fl/stl/algorithm.h"  // For fl::replace in path conversion
+#include "fl/stl/cstring.h"    // For fl::memcpy in read_at
 #include <cstdio>     // For file operations (remove, etc.)
 #include <errno.h>    // For errno
 #include "platforms/win/is_win.h"
@@ -24,6 +25,8 @@
   #include <unistd.h>
   #include <sys/stat.h>
   #include <dirent.h>   // For directory iteration
+  #include <fcntl.h>    // For open() when mapping files
+  #include <sys/mman.h> // For mmap() in StubFileHandle
 #include "fl/stl/noexcept.h"
 #endif
 
@@ -35,6 +38,35 @@ private:
     fl::string mPath;
     fl::size_t mSize;
     fl::size_t mPos;
+    // Read-only mapping of the whole file (POSIX hosts only), so large
+    // pre-rendered shows are served without going through the stream.
+    const fl::u8* mMap = nullptr;
+
+    void mapFile() FL_NOEXCEPT {
+#ifndef FL_IS_WIN
+        if (mSize == 0) {
+            return;
+        }
+        int fd = ::open(mPath.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return;
+        }
+        void* p = ::mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);  // The mapping keeps its own reference.
+        if (p != MAP_FAILED) {
+            mMap = static_cast<const fl::u8*>(p);
+        }
+#endif
+    }
+
+    void unmapFile() FL_NOEXCEPT {
+#ifndef FL_IS_WIN
+        if (mMap) {
+            ::munmap(const_cast<fl::u8*>(mMap), mSize);
+        }
+#endif
+        mMap = nullptr;
+    }
 
 public:
     StubFileHandle(const fl::string& path) FL_NOEXCEPT : mPath(path), mPos(0) {
@@ -42,17 +74,35 @@ public:
         if (mFile.is_open()) {
             mSize = mFile.tellg();
             mFile.seekg(0, fl::ios::seekdir::beg);
+            mapFile();
         } else {
             mSize = 0;
         }
     }
 
     ~StubFileHandle() override {
+        unmapFile();
         if (mFile.is_open()) {
             mFile.close();
         }
     }
 
+    fl::size_t read_at(fl::size_t offset, char* dst, fl::size_t count) FL_NOEXCEPT override {
+        if (!mMap) {
+            return filebuf::read_at(offset, dst, count);
+        }
+        if (offset >= mSize) {
+            return 0;
+        }
+        fl::size_t n = (count < mSize - offset) ? count : mSize - offset;
+        fl::memcpy(dst, mMap + offset, n);
+        return n;
+    }
+
+    fl::span<const fl::u8> mapped() const FL_NOEXCEPT override {
+        return mMap ? fl::span<const fl::u8>(mMap, mSize) : fl::span<const fl::u8>();
+    }
+
     bool is_open() const FL_NOEXCEPT override {
         return mFile.is_open();
     }
@@ -116,6 +166,7 @@ public:
     using filebuf::seek; // Pull in single-arg overload
 
     void close() FL_NOEXCEPT override {
+        unmapFile();
         if (mFile.is_open()) {
             mFile.close();
         }
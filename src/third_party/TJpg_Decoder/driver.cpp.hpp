@@ -105,11 +105,9 @@ bool TJpgInstanceDecoder::initializeDecoder() {
     fl::u16 height = jdec->height;
 
 
-    // Apply scaling based on jpg_scale setting
-    if (embedded_tjpg_.jpg_scale > 1) {
-        width /= embedded_tjpg_.jpg_scale;
-        height /= embedded_tjpg_.jpg_scale;
-    }
+    // jpg_scale is a shift (0..3); tjpgd emits exactly (size >> scale) pixels
+    width >>= embedded_tjpg_.jpg_scale;
+    height >>= embedded_tjpg_.jpg_scale;
 
 
     // Allocate frame buffer
@@ -382,6 +380,84 @@ int TJpgInstanceDecoder::outputCallback(JDEC* jd, void* bitmap, JRECT* rect) {
     return 1; // Success
 }
 
+TJpgBlockDecoder::TJpgBlockDecoder() {
+    fl::memset(workspace_, 0, sizeof(workspace_));
+}
+
+bool TJpgBlockDecoder::prepare(fl::span<const fl::u8> data) {
+    data_ = data.data();
+    size_ = data.size();
+    index_ = 0;
+    prepared_ = false;
+    error_message_.clear();
+    if (!data_ || size_ == 0) {
+        error_message_ = "Empty JPEG data";
+        return false;
+    }
+
+    JDEC* jdec = reinterpret_cast<JDEC*>(workspace_);
+    fl::u8* pool = workspace_ + sizeof(JDEC);
+    fl::size pool_size = sizeof(workspace_) - sizeof(JDEC);
+    JRESULT res = jd_prepare(jdec, inputCallback, pool, pool_size, this);
+    if (res != JDR_OK) {
+        setError("jd_prepare failed", res);
+        return false;
+    }
+    width_ = jdec->width;
+    height_ = jdec->height;
+    prepared_ = true;
+    return true;
+}
+
+bool TJpgBlockDecoder::decompress(fl::u8 scale, TJpgBlockSink sink, void* ctx) {
+    if (!prepared_) {
+        if (error_message_.empty()) {
+            error_message_ = "Decoder not prepared";
+        }
+        return false;
+    }
+    // jd_prepare() consumed the headers; the decoder can only run once.
+    prepared_ = false;
+    sink_ = sink;
+    sink_ctx_ = ctx;
+    JDEC* jdec = reinterpret_cast<JDEC*>(workspace_);
+    JRESULT res = jd_decomp(jdec, outputCallback, scale);
+    sink_ = nullptr;
+    sink_ctx_ = nullptr;
+    if (res != JDR_OK) {
+        setError("Decode error", res);
+        return false;
+    }
+    return true;
+}
+
+void TJpgBlockDecoder::setError(const char* what, int code) {
+    char err_str[48];
+    fl::snprintf(err_str, sizeof(err_str), "%s: %d", what, code);
+    error_message_ = err_str;
+}
+
+fl::size TJpgBlockDecoder::inputCallback(JDEC* jd, fl::u8* buff, fl::size nbyte) {
+    TJpgBlockDecoder* self = static_cast<TJpgBlockDecoder*>(jd->device);
+    fl::size remaining = self->size_ - self->index_;
+    fl::size to_read = (nbyte < remaining) ? nbyte : remaining;
+    if (buff) {
+        fl::memcpy(buff, self->data_ + self->index_, to_read);
+    }
+    self->index_ += to_read;
+    return to_read;
+}
+
+int TJpgBlockDecoder::outputCallback(JDEC* jd, void* bitmap, JRECT* rect) {
+    TJpgBlockDecoder* self = static_cast<TJpgBlockDecoder*>(jd->device);
+    if (!self->sink_) {
+        return 0;
+    }
+    return self->sink_(self->sink_ctx_, rect->left, rect->top,
+                       rect->right - rect->left + 1, rect->bottom - rect->top + 1,
+                       static_cast<const fl::u8*>(bitmap)) ? 1 : 0;
+}
+
 // Factory function
 TJpgInstanceDecoderPtr createTJpgInstanceDecoder() {
     return fl::make_shared<TJpgInstanceDecoder>();
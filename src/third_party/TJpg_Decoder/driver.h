@@ -134,6 +134,52 @@ public:
     fl::size getBytesProcessed() const;
 };
 
+// Receives one decoded MCU in RGB888, already descaled by the decoder.
+// x/y/w/h are in scaled image coordinates. Return false to abort decoding.
+typedef bool (*TJpgBlockSink)(void* ctx, fl::u16 x, fl::u16 y, fl::u16 w, fl::u16 h,
+                              const fl::u8* rgb);
+
+// Decodes a JPEG held in memory straight into a block sink. Unlike
+// TJpgInstanceDecoder it neither copies the input nor allocates a frame,
+// so peak RAM is the tjpgd workspace plus whatever the sink keeps.
+class TJpgBlockDecoder {
+public:
+    TJpgBlockDecoder();
+
+    // Parses the headers. The data must outlive decompress().
+    bool prepare(fl::span<const fl::u8> data);
+
+    // Full-resolution image size, valid after prepare().
+    fl::u16 width() const { return width_; }
+    fl::u16 height() const { return height_; }
+
+    // scale: 0 = 1:1, 1 = 1/2, 2 = 1/4, 3 = 1/8 (DC only, no IDCT).
+    // The scaled image is (width() >> scale) x (height() >> scale).
+    bool decompress(fl::u8 scale, TJpgBlockSink sink, void* ctx);
+
+    const fl::string& error() const { return error_message_; }
+
+private:
+#ifdef FL_IS_AVR
+    fl::u8 workspace_[4096];
+#else
+    fl::u8 workspace_[4096] __attribute__((aligned(4)));
+#endif
+    const fl::u8* data_ = nullptr;
+    fl::size size_ = 0;
+    fl::size index_ = 0;
+    fl::u16 width_ = 0;
+    fl::u16 height_ = 0;
+    bool prepared_ = false;
+    TJpgBlockSink sink_ = nullptr;
+    void* sink_ctx_ = nullptr;
+    fl::string error_message_;
+
+    void setError(const char* what, int code);
+    static fl::size inputCallback(JDEC* jd, fl::u8* buff, fl::size nbyte);
+    static int outputCallback(JDEC* jd, void* bitmap, JRECT* rect);
+};
+
 // Factory function
 TJpgInstanceDecoderPtr createTJpgInstanceDecoder();
 
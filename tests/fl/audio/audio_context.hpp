@@ -183,3 +183,26 @@ FL_TEST_CASE("audio::Context - silence flag") {
     ctx.setSilent(true);
     FL_CHECK(ctx.isSilent());
 }
+
+FL_TEST_CASE("audio::Context - chroma is computed once per frame") {
+    audio::Sample sample = makeSineAudioSample(440.0f, 1000);
+    audio::Context ctx(sample);
+
+    span<const float> chroma = ctx.getChroma();
+    FL_REQUIRE_EQ(chroma.size(), 12u);
+    // Normalized so the strongest pitch class is exactly 1.0.
+    float maxVal = 0.0f;
+    for (int i = 0; i < 12; i++) {
+        FL_CHECK_GE(chroma[i], 0.0f);
+        maxVal = fl::max(maxVal, chroma[i]);
+    }
+    FL_CHECK_EQ(maxVal, 1.0f);
+    // Second call in the same frame returns the cached profile.
+    FL_CHECK(ctx.getChroma().data() == chroma.data());
+
+    // Silence: a new sample invalidates the cache and nothing accumulates.
+    ctx.setSample(audio::Sample(fl::vector<fl::i16>(512, 0), 2000));
+    for (int i = 0; i < 12; i++) {
+        FL_CHECK_EQ(ctx.getChroma()[i], 0.0f);
+    }
+}
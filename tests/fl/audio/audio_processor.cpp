@@ -641,4 +641,93 @@ FL_TEST_CASE("audio::detector::FrequencyBands - burst mode identical timestamps
     FL_CHECK_GT(bassNorm, 0.5f);
 }
 
+FL_TEST_CASE("audio::Processor - STFT mode analyses overlapping windows per hop") {
+    audio::Processor processor;
+    processor.setStftMode(1024, 256);
+    FL_CHECK(processor.isStftEnabled());
+
+    int frames = 0;
+    processor.onEnergy([&frames](float) { ++frames; });
+
+    // 8 x 512 samples = 4096: windows end at 1024, 1280, ..., 4096.
+    for (int i = 0; i < 8; ++i) {
+        processor.update(makeSample(440.0f, 100 + i * 12, 10000.0f, 512));
+    }
+    FL_CHECK_EQ(frames, 13);
+
+    auto ctx = processor.getContext();
+    FL_CHECK_EQ(ctx->getPCM().size(), 1024u);
+    FL_CHECK_EQ(ctx->getFrameAdvance(), 256u);
+    // The last window ends with the last buffer.
+    FL_CHECK_EQ(ctx->getTimestamp(), 100u + 7 * 12);
+
+    processor.disableStft();
+    FL_CHECK_FALSE(processor.isStftEnabled());
+    processor.update(makeSample(440.0f, 200, 10000.0f, 512));
+    FL_CHECK_EQ(frames, 14);
+    FL_CHECK_EQ(processor.getContext()->getPCM().size(), 512u);
+    FL_CHECK_EQ(processor.getContext()->getFrameAdvance(), 512u);
+}
+
+FL_TEST_CASE("audio::Processor - detector graph runs dependencies first") {
+    audio::Processor processor;
+    FL_CHECK_EQ(processor.getActiveDetectorCount(), 0u);
+
+    // Backbeat pulls in Beat and Downbeat; nothing else is created.
+    processor.onBackbeat([](u8, float, float) {});
+    FL_CHECK_EQ(processor.getActiveDetectorCount(), 3u);
+
+    processor.setDetectorProfiling(true);
+    for (int i = 0; i < 4; ++i) {
+        processor.update(makeSample(440.0f, 1000 + i * 12));
+    }
+
+    vector<audio::DetectorStats> stats = processor.getDetectorStats();
+    FL_REQUIRE_EQ(stats.size(), 3u);
+    FL_CHECK_EQ(fl::string(stats[0].name), fl::string("Beat"));
+    FL_CHECK_EQ(fl::string(stats[1].name), fl::string("Downbeat"));
+    FL_CHECK_EQ(fl::string(stats[2].name), fl::string("Backbeat"));
+    for (const auto& s : stats) {
+        FL_CHECK_EQ(s.updates, 4u);
+        FL_CHECK_LE(s.maxMicros, s.totalMicros);
+    }
+
+    processor.resetDetectorStats();
+    FL_CHECK_EQ(processor.getDetectorStats()[0].updates, 0u);
+    FL_CHECK_EQ(fl::string(processor.getDetectorStats()[0].name), fl::string("Beat"));
+
+    // Profiling off: detectors still run, counters stay put.
+    processor.setDetectorProfiling(false);
+    processor.update(makeSample(440.0f, 2000));
+    FL_CHECK_EQ(processor.getDetectorStats()[0].updates, 0u);
+}
+
+FL_TEST_CASE("audio::Processor - only live detectors run") {
+    audio::Processor processor;
+    processor.setDetectorProfiling(true);
+    processor.onEnergy([](float) {});   // callback: runs for good
+    (void)processor.getCurrentNote();   // poll: Note, and Pitch through it
+    FL_CHECK_EQ(processor.getDetectorCount(), 3u);
+
+    const int frames = static_cast<int>(audio::Processor::kPollKeepAliveFrames) + 8;
+    for (int i = 0; i < frames; ++i) {
+        processor.update(makeSample(440.0f, 1000 + i * 12, 3000.0f, 64));
+    }
+    // The poll went stale: Pitch and Note stopped, EnergyAnalyzer did not.
+    FL_CHECK_EQ(processor.getActiveDetectorCount(), 1u);
+    vector<audio::DetectorStats> stats = processor.getDetectorStats();
+    FL_REQUIRE_EQ(stats.size(), 3u);
+    FL_CHECK_EQ(fl::string(stats[0].name), fl::string("EnergyAnalyzer"));
+    FL_CHECK_EQ(stats[0].updates, static_cast<u32>(frames));
+    FL_CHECK_EQ(stats[1].updates, audio::Processor::kPollKeepAliveFrames);
+    FL_CHECK_EQ(stats[2].updates, audio::Processor::kPollKeepAliveFrames);
+
+    // Polling again wakes the detector and its dependency.
+    (void)processor.getNoteVelocity();
+    processor.update(makeSample(440.0f, 9000, 3000.0f, 64));
+    FL_CHECK_EQ(processor.getActiveDetectorCount(), 3u);
+    FL_CHECK_EQ(processor.getDetectorStats()[1].updates,
+                audio::Processor::kPollKeepAliveFrames + 1);
+}
+
 } // FL_TEST_FILE
@@ -7,6 +7,7 @@
 
 #include "test.h"
 #include "fl/audio/fft/fft.h"
+#include "fl/audio/fft/fft_batch.h"
 #include "fl/audio/fft/fft_impl.h"
 #include "fl/stl/int.h"
 #include "fl/log/log.h"
@@ -17,6 +18,7 @@
 #include "fl/stl/string.h"
 #include "fl/stl/strstream.h"
 #include "fl/stl/vector.h"
+#include "third_party/cq_kernel/kiss_fftr.h"
 
 FL_TEST_FILE(FL_FILEPATH) {
 
@@ -1399,4 +1401,152 @@ FL_TEST_CASE("Args::resolveModeEnums") {
     }
 }
 
+static void fillBatchTestSignal(fl::vector<fl::i16> &buf, int n, int seed) {
+    buf.resize(n);
+    for (int i = 0; i < n; ++i) {
+        float t = static_cast<float>(i) / static_cast<float>(n);
+        float v = 0.5f * fl::sinf(2.0f * FL_PI * (5.0f + seed) * t) +
+                  0.3f * fl::sinf(2.0f * FL_PI * (37.0f + 3.0f * seed) * t) +
+                  0.1f * fl::sinf(2.0f * FL_PI * (101.0f + seed) * t);
+        buf[i] = static_cast<fl::i16>(v * 20000.0f);
+    }
+}
+
+FL_TEST_CASE("BatchRealFFT matches kiss_fftr on every lane") {
+    // 256 exercises the leading radix-2 pass, 512 and 64 are pure radix-4.
+    const int sizes[] = {64, 256, 512};
+    for (int n : sizes) {
+        FL_REQUIRE(fl::audio::fft::BatchRealFFT::supports(n));
+        fl::audio::fft::BatchRealFFT plan(n);
+        kiss_fftr_cfg cfg = kiss_fftr_alloc(n, 0, nullptr, nullptr);
+
+        fl::vector<fl::i16> input[4];
+        fl::vector<kiss_fft_cpx> batchOut[4];
+        const kiss_fft_scalar *in[4];
+        kiss_fft_cpx *out[4];
+        for (int l = 0; l < 4; ++l) {
+            fillBatchTestSignal(input[l], n, l);
+            batchOut[l].resize(n / 2 + 1);
+            in[l] = input[l].data();
+            out[l] = batchOut[l].data();
+        }
+        // Three lanes: the unused fourth lane must not disturb the others.
+        plan.forward(in, out, 3);
+        plan.forward(in + 3, out + 3, 1);
+
+        fl::vector<kiss_fft_cpx> ref(n / 2 + 1);
+        for (int l = 0; l < 4; ++l) {
+            kiss_fftr(cfg, in[l], ref.data());
+            int maxErr = 0;
+            for (int k = 0; k <= n / 2; ++k) {
+                int er = fl::abs(static_cast<int>(ref[k].r) - static_cast<int>(batchOut[l][k].r));
+                int ei = fl::abs(static_cast<int>(ref[k].i) - static_cast<int>(batchOut[l][k].i));
+                maxErr = fl::max(maxErr, fl::max(er, ei));
+            }
+#if FASTLED_FFT_PRECISION == FASTLED_FFT_FIXED16
+            // kiss rounds after every stage; the batch plan rounds once.
+            FL_CHECK_LE(maxErr, 4);
+#else
+            FL_CHECK_LE(maxErr, 1);
+#endif
+        }
+        kiss_fftr_free(cfg);
+    }
+    FL_CHECK_FALSE(fl::audio::fft::BatchRealFFT::supports(500));
+}
+
+// SIMD lanes agree with the scalar path to within FFT rounding. kiss'
+// per-stage rounding leaves a small noise floor in near-empty bins (a few
+// counts after log-rebin summing) that the float lanes do not have.
+static bool batchBinsClose(float batch, float scalar) {
+    return fl::abs(batch - scalar) <= 10.0f + 0.02f * scalar;
+}
+
+FL_TEST_CASE("Impl::runBatch matches run() in every mode") {
+    const int n = 512;
+    const fl::audio::fft::Mode modes[] = {
+        fl::audio::fft::Mode::LOG_REBIN, fl::audio::fft::Mode::CQ_NAIVE,
+        fl::audio::fft::Mode::CQ_OCTAVE, fl::audio::fft::Mode::CQ_HYBRID};
+    // Five buffers: one full group of four SIMD lanes plus a single lane.
+    const int kBuffers = 5;
+    fl::vector<fl::i16> input[kBuffers];
+    fl::span<const fl::i16> spans[kBuffers];
+    for (int b = 0; b < kBuffers; ++b) {
+        fillBatchTestSignal(input[b], n, b);
+        spans[b] = input[b];
+    }
+
+    for (fl::audio::fft::Mode mode : modes) {
+        fl::audio::fft::Args args(n, 32, 90.0f, 14080.0f, 44100, mode);
+        fl::audio::fft::Impl fft(args);
+
+        fl::vector<fl::audio::fft::Bins> batchBins;
+        fl::vector<fl::audio::fft::Bins *> outs;
+        for (int b = 0; b < kBuffers; ++b) {
+            batchBins.push_back(fl::audio::fft::Bins(32));
+        }
+        for (int b = 0; b < kBuffers; ++b) {
+            outs.push_back(&batchBins[b]);
+        }
+        FL_REQUIRE(fft.runBatch(fl::span<const fl::span<const fl::i16>>(spans, kBuffers), outs).ok);
+
+        for (int b = 0; b < kBuffers; ++b) {
+            fl::audio::fft::Bins single(32);
+            fft.run(input[b], &single);
+            FL_REQUIRE_EQ(batchBins[b].raw().size(), single.raw().size());
+            FL_REQUIRE_EQ(batchBins[b].linear().size(), single.linear().size());
+            for (fl::size i = 0; i < single.raw().size(); ++i) {
+                float a = batchBins[b].raw()[i];
+                float e = single.raw()[i];
+                if (b == kBuffers - 1) {
+                    // A lone trailing buffer takes the scalar path.
+                    FL_CHECK_EQ(a, e);
+                } else {
+                    FL_CHECK(batchBinsClose(a, e));
+                }
+            }
+        }
+    }
+
+    // Mismatched sizes are rejected.
+    fl::audio::fft::Args args(n, 16);
+    fl::audio::fft::Impl fft(args);
+    fl::audio::fft::Bins out(16);
+    fl::audio::fft::Bins *outPtr = &out;
+    fl::span<const fl::i16> shortSpan(input[0].data(), n / 2);
+    FL_CHECK_FALSE(fft.runBatch(fl::span<const fl::span<const fl::i16>>(&shortSpan, 1),
+                                fl::span<fl::audio::fft::Bins *>(&outPtr, 1)).ok);
+}
+
+FL_TEST_CASE("FFT::runBatch groups jobs by configuration") {
+    const int n = 512;
+    fl::vector<fl::i16> left, right;
+    fillBatchTestSignal(left, n, 0);
+    fillBatchTestSignal(right, n, 4);
+
+    fl::audio::fft::Args coarse(n, 16);
+    fl::audio::fft::Args fine(n, 64, 90.0f, 14080.0f, 44100,
+                              fl::audio::fft::Mode::CQ_HYBRID);
+    fl::audio::fft::Bins l16(16), r16(16), l64(64), r64(64);
+    fl::audio::fft::FFT::Job jobs[] = {
+        fl::audio::fft::FFT::Job(left, &l16, coarse),
+        fl::audio::fft::FFT::Job(left, &l64, fine),
+        fl::audio::fft::FFT::Job(right, &r16, coarse),
+        fl::audio::fft::FFT::Job(right, &r64, fine),
+    };
+    fl::audio::fft::FFT fft;
+    fft.runBatch(jobs);
+
+    FL_CHECK_EQ(l16.raw().size(), 16u);
+    FL_CHECK_EQ(r16.raw().size(), 16u);
+    FL_CHECK_EQ(l64.raw().size(), 64u);
+    FL_CHECK_EQ(r64.raw().size(), 64u);
+
+    fl::audio::fft::Bins ref(64);
+    fft.run(right, &ref, fine);
+    for (fl::size i = 0; i < ref.raw().size(); ++i) {
+        FL_CHECK(batchBinsClose(r64.raw()[i], ref.raw()[i]));
+    }
+}
+
 } // FL_TEST_FILE
@@ -0,0 +1,70 @@
+// Unit tests for audio::StftFramer
+// standalone test
+
+#include "fl/audio/stft_framer.h"
+#include "fl/stl/vector.h"
+
+using namespace fl;
+
+FL_TEST_CASE("audio::StftFramer - default framer is disabled") {
+    audio::StftFramer framer;
+    FL_CHECK_FALSE(framer.enabled());
+    i16 pcm[4] = {1, 2, 3, 4};
+    FL_CHECK_EQ(framer.consume(span<const i16>(pcm, 4)), 0u);
+    FL_CHECK_FALSE(framer.frameReady());
+}
+
+FL_TEST_CASE("audio::StftFramer - hop is clamped to [1, window]") {
+    audio::StftConfig config;
+    config.windowSize = 8;
+    config.hopSize = 0;
+    audio::StftFramer framer(config);
+    FL_CHECK_EQ(framer.hopSize(), 1u);
+    config.hopSize = 100;
+    framer.configure(config);
+    FL_CHECK_EQ(framer.hopSize(), 8u);
+}
+
+FL_TEST_CASE("audio::StftFramer - overlapping windows across uneven chunks") {
+    audio::StftConfig config;
+    config.windowSize = 8;
+    config.hopSize = 2;
+    audio::StftFramer framer(config);
+
+    // Ramp 0..19 fed in chunks of 3, 5, 1, 11 samples.
+    vector<i16> ramp;
+    for (int i = 0; i < 20; ++i) {
+        ramp.push_back(static_cast<i16>(i));
+    }
+    const fl::size chunks[] = {3, 5, 1, 11};
+    vector<i16> firstSamples;
+    fl::size offset = 0;
+    for (fl::size c : chunks) {
+        span<const i16> pcm(ramp.data() + offset, c);
+        offset += c;
+        fl::size used = 0;
+        while (used < pcm.size()) {
+            used += framer.consume(pcm.subspan(used));
+            if (framer.frameReady()) {
+                audio::Sample frame = framer.takeFrame(0);
+                span<const i16> f = frame.pcm();
+                FL_REQUIRE_EQ(f.size(), 8u);
+                // Each window is contiguous and oldest-first.
+                for (fl::size i = 1; i < f.size(); ++i) {
+                    FL_CHECK_EQ(f[i], static_cast<i16>(f[0] + i));
+                }
+                firstSamples.push_back(f[0]);
+            }
+        }
+    }
+
+    // Windows start at 0, 2, ..., 12: (20 - 8) / 2 + 1 frames.
+    FL_REQUIRE_EQ(firstSamples.size(), 7u);
+    for (fl::size i = 0; i < firstSamples.size(); ++i) {
+        FL_CHECK_EQ(firstSamples[i], static_cast<i16>(2 * i));
+    }
+
+    framer.reset();
+    FL_CHECK_EQ(framer.consume(span<const i16>(ramp.data(), 4)), 4u);
+    FL_CHECK_FALSE(framer.frameReady());
+}
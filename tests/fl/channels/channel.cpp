@@ -645,3 +645,139 @@ FL_TEST_CASE("[#2517] Re-enabling the driver resumes enqueue and re-arms the lat
     channel->showLeds(0);
     FL_CHECK_EQ(fakeDriver->enqueueCount, 2);
 }
+
+// ============ Incremental (dirty-range) re-encode ============
+
+FL_TEST_CASE("DirtySpans coalesces overlapping, touching and overflowing ranges") {
+    DirtySpans spans;
+    spans.add(10, 5);   // [10,15)
+    spans.add(20, 5);   // [20,25)
+    spans.add(15, 5);   // touches both -> [10,25)
+    FL_REQUIRE_EQ(spans.size(), 1);
+    FL_CHECK_EQ(spans[0].begin, 10u);
+    FL_CHECK_EQ(spans[0].end, 25u);
+    spans.add(0, 0);    // no-op
+    FL_CHECK_EQ(spans.size(), 1);
+
+    // Overflow: the closest pair is fused, coverage stays a superset.
+    spans.clear();
+    for (u32 i = 0; i <= DirtySpans::kMaxSpans; ++i) {
+        spans.add(i * 100, 1);
+    }
+    spans.add(1000 + 2, 1);  // gap of 1 to the span at 1000 -> fused first
+    FL_CHECK_EQ(spans.size(), static_cast<u8>(DirtySpans::kMaxSpans));
+    for (u32 i = 0; i <= DirtySpans::kMaxSpans; ++i) {
+        bool covered = false;
+        for (const DirtySpans::Span& s : spans) {
+            covered = covered || (s.begin <= i * 100 && i * 100 < s.end);
+        }
+        FL_CHECK(covered);
+    }
+}
+
+FL_TEST_CASE("Incremental encode splices dirty pixels and matches a full encode") {
+    const int NUM_LEDS = 64;
+    CRGB leds[NUM_LEDS];
+    for (int i = 0; i < NUM_LEDS; ++i) {
+        leds[i] = CRGB(i, 255 - i, i * 3);
+    }
+
+    auto mockEngine = fl::make_shared<ByteCapturingMockEngine>("INCREMENTAL_CAPTURE");
+    ChannelManager& manager = ChannelManager::instance();
+    manager.addDriver(2003, mockEngine);
+
+    auto timing = makeTimingConfig<TIMING_WS2812_800KHZ>();
+    ChannelOptions options;
+    options.mDitherMode = DISABLE_DITHER;
+    ChannelOptions incrementalOptions = options;
+    incrementalOptions.mIncrementalEncode = true;
+
+    auto reference = Channel::create(ChannelConfig(
+        1, timing, fl::span<CRGB>(leds, NUM_LEDS), GRB, options));
+    auto incremental = Channel::create(ChannelConfig(
+        2, timing, fl::span<CRGB>(leds, NUM_LEDS), GRB, incrementalOptions));
+    auto cleanup = fl::make_scope_exit([&]() {
+        reference->removeFromDrawList();
+        incremental->removeFromDrawList();
+        manager.removeDriver(mockEngine);
+    });
+
+    auto showBoth = [&]() {
+        mockEngine->mCapturedChannels.clear();
+        reference->showLeds(200);
+        incremental->showLeds(200);
+        FL_REQUIRE_EQ(mockEngine->mCapturedChannels.size(), 2u);
+        const auto& a = mockEngine->mCapturedChannels[0]->getData();
+        const auto& b = mockEngine->mCapturedChannels[1]->getData();
+        FL_REQUIRE_EQ(a.size(), b.size());
+        for (fl::size i = 0; i < a.size(); ++i) {
+            FL_REQUIRE_EQ(a[i], b[i]);
+        }
+    };
+
+    // Frame 1: nothing to diff against, full encode.
+    showBoth();
+    FL_CHECK_EQ(incremental->encodeStats().fullFrames, 1u);
+    FL_CHECK_EQ(incremental->encodeStats().incrementalFrames, 0u);
+
+    // Frame 2: two isolated edits -> two dirty spans, everything else reused.
+    manager.resetEncodeStats();
+    incremental->resetEncodeStats();
+    leds[3] = CRGB::White;
+    leds[40] = CRGB(1, 2, 3);
+    showBoth();
+    const ChannelEncodeStats& stats = incremental->encodeStats();
+    FL_CHECK_EQ(stats.incrementalFrames, 1u);
+    FL_CHECK_EQ(stats.bytesEncoded, 6u);
+    FL_CHECK_EQ(stats.bytesSkipped, static_cast<u32>(NUM_LEDS * 3 - 6));
+    const DirtySpans& dirty = mockEngine->mCapturedChannels[1]->dirtyBytes();
+    FL_REQUIRE_EQ(dirty.size(), 2);
+    FL_CHECK_EQ(dirty[0].begin, 9u);
+    FL_CHECK_EQ(dirty[1].begin, 120u);
+    // The manager aggregates both channels: the reference did a full frame.
+    FL_CHECK_EQ(manager.encodeStats().fullFrames, 1u);
+    FL_CHECK_EQ(manager.encodeStats().incrementalFrames, 1u);
+    FL_CHECK_EQ(manager.encodeStats().bytesSkipped, stats.bytesSkipped);
+
+    // Frame 3: explicit hint is trusted instead of diffing.
+    leds[10] = CRGB::Red;
+    incremental->markDirty(8, 4);
+    showBoth();
+    FL_CHECK_EQ(incremental->encodeStats().incrementalFrames, 2u);
+    FL_CHECK_EQ(incremental->encodeStats().bytesEncoded, 6u + 12u);
+
+    // Frame 4: brightness change rescales every byte -> full re-encode.
+    mockEngine->mCapturedChannels.clear();
+    reference->showLeds(100);
+    incremental->showLeds(100);
+    FL_CHECK_EQ(incremental->encodeStats().fullFrames, 1u);
+    const auto& a = mockEngine->mCapturedChannels[0]->getData();
+    const auto& b = mockEngine->mCapturedChannels[1]->getData();
+    FL_CHECK(a == b);
+}
+
+FL_TEST_CASE("Incremental encode falls back to full encode while dithering") {
+    const int NUM_LEDS = 8;
+    CRGB leds[NUM_LEDS];
+    fl::fill_solid(leds, NUM_LEDS, CRGB(10, 20, 30));
+
+    auto mockEngine = fl::make_shared<ByteCapturingMockEngine>("INCREMENTAL_DITHER");
+    ChannelManager& manager = ChannelManager::instance();
+    manager.addDriver(2004, mockEngine);
+
+    ChannelOptions options;  // BINARY_DITHER by default
+    options.mIncrementalEncode = true;
+    auto channel = Channel::create(ChannelConfig(
+        1, makeTimingConfig<TIMING_WS2812_800KHZ>(),
+        fl::span<CRGB>(leds, NUM_LEDS), GRB, options));
+    auto cleanup = fl::make_scope_exit([&]() {
+        channel->removeFromDrawList();
+        manager.removeDriver(mockEngine);
+    });
+
+    channel->showLeds(128);
+    channel->showLeds(128);
+    FL_CHECK_EQ(channel->encodeStats().fullFrames, 2u);
+    FL_CHECK_EQ(channel->encodeStats().incrementalFrames, 0u);
+    FL_CHECK_EQ(channel->encodeStats().bytesSkipped, 0u);
+}
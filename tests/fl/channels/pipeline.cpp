@@ -0,0 +1,110 @@
+/// @file pipeline.cpp
+/// @brief Pipelined (double/triple-buffered) channel encoding
+///
+/// With ChannelManager::setPipelineDepth() > 1 and a driver that reports
+/// maxFramesInFlight() > 1, a channel encodes frame N+1 into a spare
+/// ChannelData while frame N is still on the wire. The stub clockless
+/// driver's simulated-transmit mode records per-frame timestamps so the
+/// overlap is directly observable.
+
+#include "FastLED.h"
+#include "fl/channels/channel.h"
+#include "fl/channels/data.h"
+#include "fl/channels/manager.h"
+#include "fl/chipsets/chipset_timing_config.h"
+#include "fl/stl/scope_exit.h"
+#include "fl/stl/shared_ptr.h"
+#include "fl/stl/span.h"
+#include "platforms/stub/clockless_channel_engine_stub.h"
+#include "test.h"
+
+FL_TEST_FILE(FL_FILEPATH) {
+
+namespace pipeline_test {
+
+using namespace fl;
+using FrameTiming = stub::ClocklessChannelEngineStub::FrameTiming;
+
+// 1000 WS2812 pixels = 24000 bits ≈ 30 ms on the simulated wire, orders of
+// magnitude longer than encoding them, so the ordering checks below are not
+// sensitive to host scheduling noise.
+const int kNumLeds = 1000;
+
+struct PipelineFixture {
+    CRGB leds[kNumLeds];
+    fl::shared_ptr<stub::ClocklessChannelEngineStub> driver;
+    ChannelPtr channel;
+
+    explicit PipelineFixture(u8 depth) {
+        driver = fl::make_shared<stub::ClocklessChannelEngineStub>();
+        driver->setSimulatedTransmit(true, 3);
+        ChannelManager::instance().addDriver(3001, driver);
+        ChannelManager::instance().setPipelineDepth(depth);
+        channel = Channel::create(ChannelConfig(
+            5, makeTimingConfig<TIMING_WS2812_800KHZ>(),
+            fl::span<CRGB>(leds, kNumLeds), GRB, ChannelOptions()));
+    }
+
+    ~PipelineFixture() {
+        ChannelManager::instance().waitForReady();
+        ChannelManager::instance().setPipelineDepth(1);
+        channel->removeFromDrawList();
+        ChannelManager::instance().removeDriver(driver);
+    }
+};
+
+FL_TEST_CASE("Depth 1: next frame is encoded only after the previous one is out") {
+    PipelineFixture fx(1);
+    fx.channel->showLeds(255);
+    fx.channel->showLeds(255);
+
+    fl::span<const FrameTiming> t = fx.driver->timeline();
+    FL_REQUIRE_EQ(t.size(), 2u);
+    FL_CHECK(static_cast<i32>(t[1].enqueueUs - t[0].txEndUs) >= 0);
+}
+
+FL_TEST_CASE("Depth 2: frame N+1 encodes while frame N is transmitting") {
+    PipelineFixture fx(2);
+    fx.channel->showLeds(255);
+    fx.channel->showLeds(255);
+
+    fl::span<const FrameTiming> t = fx.driver->timeline();
+    FL_REQUIRE_EQ(t.size(), 2u);
+    // Overlap: frame 1 was handed over before frame 0 finished...
+    FL_CHECK(static_cast<i32>(t[0].txEndUs - t[1].enqueueUs) > 0);
+    // ...and still goes out strictly after it on the single wire.
+    FL_CHECK(static_cast<i32>(t[1].txStartUs - t[0].txEndUs) >= 0);
+}
+
+FL_TEST_CASE("Depth 3 cycles through distinct buffers and never reuses one in flight") {
+    PipelineFixture fx(3);
+    for (int i = 0; i < 5; ++i) {
+        fx.leds[0] = CRGB(static_cast<u8>(i), 0, 0);
+        fx.channel->showLeds(255);
+    }
+    fl::span<const FrameTiming> t = fx.driver->timeline();
+    FL_REQUIRE_EQ(t.size(), 5u);
+    for (fl::size i = 1; i < t.size(); ++i) {
+        FL_CHECK(static_cast<i32>(t[i].txStartUs - t[i - 1].txEndUs) >= 0);
+    }
+    // Three buffers: frame i reuses frame i-3's buffer, so it can only be
+    // encoded once that frame has fully left the wire.
+    for (fl::size i = 3; i < t.size(); ++i) {
+        FL_CHECK(static_cast<i32>(t[i].enqueueUs - t[i - 3].txEndUs) >= 0);
+    }
+    // But it did not wait for the frame immediately before it.
+    FL_CHECK(static_cast<i32>(t[3].txEndUs - t[4].enqueueUs) > 0);
+}
+
+FL_TEST_CASE("setPipelineDepth clamps to [1, kMaxPipelineDepth]") {
+    ChannelManager& mgr = ChannelManager::instance();
+    mgr.setPipelineDepth(0);
+    FL_CHECK_EQ(mgr.pipelineDepth(), 1);
+    mgr.setPipelineDepth(200);
+    FL_CHECK_EQ(mgr.pipelineDepth(), 3);
+    mgr.setPipelineDepth(1);
+}
+
+} // namespace pipeline_test
+
+} // FL_TEST_FILE
@@ -0,0 +1,167 @@
+#include "platforms/shared/spi_hw_4.h"
+#include "platforms/stub/spi_4_stub.h"
+#include "fl/channels/spi/multi_lane_device.h"
+#include "fl/stl/shared_ptr.h"
+#include "fl/stl/stdint.h"
+#include "fl/stl/vector.h"
+#include "fl/task/executor.h"
+#include "fl/task/promise.h"
+#include "test.h"
+
+FL_TEST_FILE(FL_FILEPATH) {
+
+using namespace fl::spi;
+using fl::u8;
+using fl::u32;
+
+namespace {
+
+MultiLaneDevice::Config quadConfig() {
+    MultiLaneDevice::Config config;
+    config.clock_pin = 18;
+    config.data_pins.push_back(23);
+    config.data_pins.push_back(19);
+    config.data_pins.push_back(5);
+    config.data_pins.push_back(4);
+    config.clock_speed_hz = 20000000;
+    return config;
+}
+
+// The quad controller picked by MultiLaneDevice::begin() (the first free one)
+fl::SpiHw4Stub* activeQuadStub() {
+    for (const auto& ctrl : fl::SpiHw4::getAll()) {
+        if (ctrl->isInitialized()) {
+            return fl::toStub(ctrl.get());
+        }
+    }
+    return nullptr;
+}
+
+void writeFrame(MultiLaneDevice& spi, u8 base) {
+    for (size_t i = 0; i < spi.numLanes(); i++) {
+        u8 data[3] = {static_cast<u8>(base + i), static_cast<u8>(base + 0x10),
+                      static_cast<u8>(base + 0x20)};
+        spi.lane(i).write(data, 3);
+    }
+}
+
+} // namespace
+
+FL_TEST_CASE("MultiLaneDevice flushAsync double-buffers frames") {
+    MultiLaneDevice spi(quadConfig());
+    FL_REQUIRE(!spi.begin());
+    fl::SpiHw4Stub* stub = activeQuadStub();
+    FL_REQUIRE(stub != nullptr);
+    stub->reset();
+
+    fl::vector<u32> done;
+    auto onDone = [&done](const FlushInfo& info) { done.push_back(info.frame); };
+
+    // Frame 1 goes straight to DMA; the lanes are free for the next frame.
+    writeFrame(spi, 0x40);
+    fl::task::Promise<FlushInfo> first = spi.flushAsync();
+    first.then(onDone);
+    FL_CHECK(first.valid());
+    FL_CHECK_EQ(stub->getTransmissionCount(), 1u);
+    FL_CHECK_EQ(spi.lane(0).bufferSize(), 0u);
+    FL_CHECK(spi.isBusy());
+
+    // Frame 2 is transposed into the back buffer while frame 1 is on the wire.
+    writeFrame(spi, 0x80);
+    fl::task::Promise<FlushInfo> second = spi.flushAsync();
+    second.then(onDone);
+    FL_CHECK_EQ(stub->getTransmissionCount(), 1u);
+    FL_CHECK(!first.is_completed());
+    FL_CHECK(!second.is_completed());
+
+    // Simulated DMA completion, picked up by the task loop.
+    stub->waitComplete();
+    fl::task::Executor::instance().update_all();
+    FL_CHECK(first.is_resolved());
+    FL_CHECK_EQ(first.value().frame, 1u);
+    FL_CHECK_EQ(first.value().bytes_per_lane, 3u);
+    FL_CHECK_EQ(stub->getTransmissionCount(), 2u);
+    FL_CHECK(!second.is_completed());
+
+    // The bytes on the wire are exactly what a blocking flush() sends.
+    fl::vector<u8> async_bytes = stub->getLastTransmission();
+    FL_CHECK(spi.waitComplete());
+    FL_CHECK(second.is_resolved());
+    FL_CHECK_EQ(second.value().frame, 2u);
+    FL_CHECK(!spi.isBusy());
+    FL_REQUIRE_EQ(done.size(), 2u);
+    FL_CHECK_EQ(done[0], 1u);
+    FL_CHECK_EQ(done[1], 2u);
+
+    writeFrame(spi, 0x80);
+    FL_CHECK(spi.flush().ok());
+    FL_CHECK(stub->getLastTransmission() == async_bytes);
+
+    spi.end();
+}
+
+FL_TEST_CASE("MultiLaneDevice flushAsync blocks only when both buffers are full") {
+    MultiLaneDevice spi(quadConfig());
+    FL_REQUIRE(!spi.begin());
+    fl::SpiHw4Stub* stub = activeQuadStub();
+    FL_REQUIRE(stub != nullptr);
+    stub->reset();
+
+    writeFrame(spi, 0x01);
+    fl::task::Promise<FlushInfo> a = spi.flushAsync();
+    writeFrame(spi, 0x02);
+    fl::task::Promise<FlushInfo> b = spi.flushAsync();
+    writeFrame(spi, 0x03);
+    fl::task::Promise<FlushInfo> c = spi.flushAsync();
+
+    // Frame 3 needed the back buffer, so frame 1 was waited out and frame 2
+    // moved into the DMA buffer.
+    FL_CHECK(a.is_resolved());
+    FL_CHECK(!b.is_completed());
+    FL_CHECK(!c.is_completed());
+    FL_CHECK_EQ(stub->getTransmissionCount(), 2u);
+
+    // A blocking flush() sends everything queued first, in order.
+    writeFrame(spi, 0x04);
+    FL_CHECK(spi.flush().ok());
+    FL_CHECK(b.is_resolved());
+    FL_CHECK(c.is_resolved());
+    FL_CHECK_EQ(c.value().frame, 3u);
+    FL_CHECK_EQ(stub->getTransmissionCount(), 4u);
+
+    spi.end();
+}
+
+FL_TEST_CASE("MultiLaneDevice flushAsync errors") {
+    MultiLaneDevice spi(quadConfig());
+
+    writeFrame(spi, 0x10);
+    fl::task::Promise<FlushInfo> notReady = spi.flushAsync();
+    FL_CHECK(notReady.is_rejected());
+
+    FL_REQUIRE(!spi.begin());
+    u8 one = 1;
+    u8 two[2] = {1, 2};
+    spi.lane(0).clear();
+    spi.lane(1).clear();
+    spi.lane(2).clear();
+    spi.lane(3).clear();
+    spi.lane(0).write(&one, 1);
+    spi.lane(1).write(two, 2);
+    fl::task::Promise<FlushInfo> mismatch = spi.flushAsync();
+    FL_CHECK(mismatch.is_rejected());
+
+    // end() sends whatever is still queued before releasing the hardware.
+    spi.lane(0).clear();
+    spi.lane(1).clear();
+    writeFrame(spi, 0x20);
+    fl::task::Promise<FlushInfo> sent = spi.flushAsync();
+    writeFrame(spi, 0x30);
+    fl::task::Promise<FlushInfo> queued = spi.flushAsync();
+    spi.end();
+    FL_CHECK(sent.is_resolved());
+    FL_CHECK(queued.is_resolved());
+    FL_CHECK(!spi.isBusy());
+}
+
+} // FL_TEST_FILE
@@ -6,8 +6,11 @@
 #include "fl/channels/wave8.h"
 #include "fl/channels/detail/wave8.hpp"
 #include "fl/stl/cstring.h"
+#include "fl/stl/span.h"
+#include "fl/stl/vector.h"
 #include "test.h"
 #include "fl/chipsets/led_timing.h"
+#include "fl/math/transposition.h"
 
 FL_TEST_FILE(FL_FILEPATH) {
 
@@ -1225,4 +1228,115 @@ FL_TEST_CASE("wave8Transpose_16x4_pipe4 == four sequential wave8Transpose_16 (ra
     }
 }
 
+FL_TEST_CASE("wave8EncodeLanes == per-position wave8Transpose_16/8 (ragged lanes)") {
+    // The fused encoder must match the per-position transpose for every byte
+    // position, zero-padding lanes that are shorter than the longest one and
+    // lanes that are not supplied at all.
+    ChipsetTiming timing;
+    timing.T1 = 250;
+    timing.T2 = 625;
+    timing.T3 = 375;
+    Wave8BitExpansionLut nib_lut = buildWave8ExpansionLUT(timing);
+    Wave8ByteExpansionLut byte_lut = buildWave8ByteExpansionLUT(nib_lut);
+
+    const u8 widths[2] = {8, 16};
+    u32 seed = 0x2468ACE1u;
+    for (int w = 0; w < 2; w++) {
+        const u8 width = widths[w];
+        const size_t numLanes = width - 3;  // leave the top lanes unused
+        fl::vector<fl::vector<u8>> laneData(numLanes);
+        fl::vector<fl::span<const u8>> lanes;
+        for (size_t l = 0; l < numLanes; l++) {
+            const size_t len = 37 + l * 5;  // ragged
+            for (size_t i = 0; i < len; i++) {
+                seed = seed * 1664525u + 1013904223u;
+                laneData[l].push_back(static_cast<u8>(seed >> 24));
+            }
+            lanes.push_back(fl::span<const u8>(laneData[l].data(), laneData[l].size()));
+        }
+        const size_t maxBytes = laneData[numLanes - 1].size();
+        const size_t blockSize = width * sizeof(Wave8Byte);
+
+        fl::vector<u32> storage((wave8EncodedSize(maxBytes, width) + 3) / 4);
+        fl::span<u8> output(reinterpret_cast<u8*>(storage.data()),  // ok reinterpret cast
+                            wave8EncodedSize(maxBytes, width));
+        const size_t written = wave8EncodeLanes(lanes, width, byte_lut, output);
+        FL_REQUIRE(written == maxBytes * blockSize);
+
+        for (size_t i = 0; i < maxBytes; i++) {
+            u8 pos[16] = {0};
+            for (size_t l = 0; l < numLanes; l++) {
+                pos[l] = i < laneData[l].size() ? laneData[l][i] : 0;
+            }
+            u8 ref[16 * sizeof(Wave8Byte)];
+            if (width == 16) {
+                wave8Transpose_16(pos, byte_lut, ref);
+            } else {
+                wave8Transpose_8(*reinterpret_cast<const u8(*)[8]>(pos), byte_lut,  // ok reinterpret cast
+                                 *reinterpret_cast<u8(*)[8 * sizeof(Wave8Byte)]>(ref));  // ok reinterpret cast
+            }
+            for (size_t b = 0; b < blockSize; b++) {
+                FL_REQUIRE(output[i * blockSize + b] == ref[b]);
+            }
+        }
+    }
+}
+
+FL_TEST_CASE("wave8EncodeLanes == expand + transpose_wave8byte_parlio (8-lane two-pass)") {
+    ChipsetTiming timing;
+    timing.T1 = 400;
+    timing.T2 = 450;
+    timing.T3 = 400;
+    Wave8ByteExpansionLut byte_lut =
+        buildWave8ByteExpansionLUT(buildWave8ExpansionLUT(timing));
+
+    u8 laneData[8][24];
+    fl::span<const u8> lanes[8];
+    u32 seed = 0x13579BDFu;
+    for (int l = 0; l < 8; l++) {
+        for (int i = 0; i < 24; i++) {
+            seed = seed * 1664525u + 1013904223u;
+            laneData[l][i] = static_cast<u8>(seed >> 24);
+        }
+        lanes[l] = fl::span<const u8>(laneData[l], 24);
+    }
+
+    u32 storage[24 * 8 * sizeof(Wave8Byte) / 4];
+    fl::span<u8> output(reinterpret_cast<u8*>(storage), sizeof(storage));  // ok reinterpret cast
+    FL_REQUIRE(wave8EncodeLanes(fl::span<const fl::span<const u8>>(lanes, 8), 8,
+                                byte_lut, output) == sizeof(storage));
+
+    for (int i = 0; i < 24; i++) {
+        Wave8Byte waves[8];
+        for (int l = 0; l < 8; l++) {
+            detail::wave8_expand_byte(laneData[l][i], byte_lut, &waves[l]);
+        }
+        u8 ref[8 * sizeof(Wave8Byte)];
+        const size_t n = transpose_wave8byte_parlio(
+            reinterpret_cast<const u8*>(waves), 8, ref);  // ok reinterpret cast
+        FL_REQUIRE(n == sizeof(ref));
+        FL_REQUIRE(fl::memcmp(output.data() + i * sizeof(ref), ref, sizeof(ref)) == 0);
+    }
+}
+
+FL_TEST_CASE("wave8EncodeLanes rejects unsupported widths and bad buffers") {
+    ChipsetTiming timing;
+    timing.T1 = 400;
+    timing.T2 = 450;
+    timing.T3 = 400;
+    Wave8ByteExpansionLut byte_lut =
+        buildWave8ByteExpansionLUT(buildWave8ExpansionLUT(timing));
+
+    u8 data[4] = {1, 2, 3, 4};
+    fl::span<const u8> lanes[1] = {fl::span<const u8>(data, 4)};
+    u32 storage[64];
+    fl::span<u8> output(reinterpret_cast<u8*>(storage), sizeof(storage));  // ok reinterpret cast
+    fl::span<const fl::span<const u8>> laneSpan(lanes, 1);
+
+    FL_CHECK(wave8EncodeLanes(laneSpan, 4, byte_lut, output) == 0);
+    FL_CHECK(wave8EncodeLanes(laneSpan, 16, byte_lut, output.subspan(0, 100)) == 0);
+    FL_CHECK(wave8EncodeLanes(laneSpan, 8, byte_lut, output.subspan(1)) == 0);
+    FL_CHECK(wave8EncodeLanes(laneSpan, 8, byte_lut, output) == 4 * 8 * sizeof(Wave8Byte));
+}
+
 } // FL_TEST_FILE
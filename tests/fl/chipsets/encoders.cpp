@@ -5,6 +5,7 @@
 #include "tests/fl/chipsets/encoders/lpd6803.hpp"
 #include "tests/fl/chipsets/encoders/lpd8806.hpp"
 #include "tests/fl/chipsets/encoders/p9813.hpp"
+#include "tests/fl/chipsets/encoders/pixel_pipeline.hpp"
 #include "tests/fl/chipsets/encoders/sk9822.hpp"
 #include "tests/fl/chipsets/encoders/sm16716.hpp"
 #include "tests/fl/chipsets/encoders/ws2801.hpp"
@@ -0,0 +1,117 @@
+/// @file pixel_pipeline.hpp
+/// @brief The specialized RGB pipeline must match the PixelIterator path byte for byte
+
+#include "fl/chipsets/encoders/pixel_pipeline.h"
+#include "fl/gfx/pixel_iterator_any.h"
+#include "fl/stl/vector.h"
+#include "pixel_controller.h"
+#include "test.h"
+
+using namespace fl;
+
+namespace test_pixel_pipeline {
+
+fl::vector<CRGB> makePixels(int count) {
+    fl::vector<CRGB> leds;
+    u32 seed = 12345;
+    for (int i = 0; i < count; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        CRGB c(static_cast<u8>(seed >> 8), static_cast<u8>(seed >> 16), static_cast<u8>(seed >> 24));
+        if (i % 7 == 0) c.r = 0;    // black channels skip dithering
+        if (i % 11 == 0) c.g = 255; // saturating dither
+        leds.push_back(c);
+    }
+    return leds;
+}
+
+ColorAdjustment makeAdjustment(u8 r, u8 g, u8 b) {
+    ColorAdjustment adj = ColorAdjustment::noAdjustment();
+    adj.premixed = CRGB(r, g, b);
+    return adj;
+}
+
+fl::vector<u8> encodeReference(const PixelController<RGB>& pixels, EOrder order) {
+    PixelController<RGB> copy(pixels);
+    PixelIteratorAny iterator(copy, order, RgbwInvalid());
+    fl::vector<u8> out;
+    iterator.get().writeWS2812(&out);
+    return out;
+}
+
+fl::vector<u8> encodePipeline(const PixelController<RGB>& pixels, EOrder order) {
+    PixelPipelineParams params;
+    FL_REQUIRE(makePixelPipelineParams(pixels, &params));
+    fl::vector<u8> out(static_cast<fl::size>(params.count) * 3);
+    runPixelPipeline(params, order, out.data());
+    return out;
+}
+
+} // namespace test_pixel_pipeline
+
+FL_TEST_CASE("PixelPipeline - matches PixelIterator for every order and stage set") {
+    using namespace test_pixel_pipeline;
+    const EOrder orders[] = {RGB, RBG, GRB, GBR, BRG, BGR};
+    const int counts[] = {0, 1, 2, 15, 16, 17, 33, 100};
+    const ColorAdjustment adjustments[] = {
+        makeAdjustment(255, 255, 255),  // no scale stage
+        makeAdjustment(64, 128, 200),
+        makeAdjustment(0, 255, 17),
+    };
+    const EDitherMode dithers[] = {DISABLE_DITHER, BINARY_DITHER};
+
+    for (int count : counts) {
+        fl::vector<CRGB> leds = makePixels(count);
+        for (const ColorAdjustment& adj : adjustments) {
+            for (EDitherMode dither : dithers) {
+                // One controller per frame: BINARY_DITHER advances the frame phase
+                PixelController<RGB> pixels(leds.data(), count, adj, dither);
+                for (EOrder order : orders) {
+                    FL_CAPTURE(count);
+                    FL_CAPTURE(static_cast<int>(order));
+                    FL_CAPTURE(static_cast<int>(dither));
+                    FL_CAPTURE(static_cast<int>(adj.premixed.r));
+                    FL_CHECK(encodePipeline(pixels, order) == encodeReference(pixels, order));
+                }
+            }
+        }
+    }
+}
+
+FL_TEST_CASE("PixelPipeline - stage selection") {
+    PixelPipelineParams params;
+    FL_CHECK_EQ(pixelPipelineStages(params), 0);
+    params.scale[1] = 128;
+    FL_CHECK_EQ(pixelPipelineStages(params), PixelPipelineStage::kScale);
+    params.e[2] = 3;
+    FL_CHECK_EQ(pixelPipelineStages(params),
+                PixelPipelineStage::kScale | PixelPipelineStage::kDither);
+}
+
+FL_TEST_CASE("PixelPipeline - gamma LUT runs after scaling, in wire order") {
+    u8 lut[256];
+    for (int i = 0; i < 256; ++i) {
+        lut[i] = static_cast<u8>(255 - i);
+    }
+    const CRGB leds[2] = {CRGB(10, 20, 30), CRGB(0, 255, 128)};
+    PixelController<RGB> pixels(leds, 2, test_pixel_pipeline::makeAdjustment(255, 255, 128),
+                                DISABLE_DITHER);
+    PixelPipelineParams params;
+    FL_REQUIRE(makePixelPipelineParams(pixels, &params, lut));
+    FL_CHECK(pixelPipelineStages(params) & PixelPipelineStage::kGamma);
+
+    u8 out[6];
+    runPixelPipeline(params, GRB, out);
+    FL_CHECK_EQ(out[0], 255 - 20);
+    FL_CHECK_EQ(out[1], 255 - 10);
+    FL_CHECK_EQ(out[2], 255 - scale8(30, 128));
+    FL_CHECK_EQ(out[3], 255 - 255);
+    FL_CHECK_EQ(out[4], 255 - 0);
+    FL_CHECK_EQ(out[5], 255 - scale8(128, 128));
+}
+
+FL_TEST_CASE("PixelPipeline - showColor() input is rejected") {
+    const CRGB color(1, 2, 3);
+    PixelController<RGB> pixels(color, 10, ColorAdjustment::noAdjustment(), DISABLE_DITHER);
+    PixelPipelineParams params;
+    FL_CHECK_FALSE(makePixelPipelineParams(pixels, &params));
+}
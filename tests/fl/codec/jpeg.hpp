@@ -3,6 +3,8 @@
 #include "fl/codec/jpeg.h"
 #include "fl/stl/detail/memory_file_handle.h"
 #include "fl/fx/frame.h"
+#include "fl/math/xymap.h"
+#include "fl/stl/vector.h"
 #include "platforms/stub/fs_stub.hpp" // ok platform headers
 
 
@@ -132,3 +134,101 @@ FL_TEST_CASE("JPEG file loading and decoding") {
     handle.close();
     fs.end();
 }
+
+static fl::vector<fl::u8> loadCodecFile_jpeg(fl::FileSystem& fs, const char* path) {
+    fl::ifstream handle = fs.openRead(path);
+    FL_REQUIRE(handle.is_open());
+    fl::vector<fl::u8> data(handle.size());
+    FL_REQUIRE_EQ(handle.read(data.data(), data.size()), data.size());
+    handle.close();
+    return data;
+}
+
+FL_TEST_CASE("JPEG decodeToLeds box-filters into an XYMap") {
+    fl::FileSystem fs = setupCodecFilesystem_jpeg();
+    fl::vector<fl::u8> file_data = loadCodecFile_jpeg(fs, "data/codec/progressive.jpg");
+    fl::span<const fl::u8> data(file_data.data(), file_data.size());
+
+    // Reference: full-resolution frame, averaged over 8x8 boxes.
+    fl::FramePtr full = fl::Jpeg::decode(data);
+    FL_REQUIRE(full);
+    FL_REQUIRE_EQ(full->getWidth(), 128);
+    FL_REQUIRE_EQ(full->getHeight(), 128);
+    const CRGB* px = full->rgb().data();
+    CRGB expected[16 * 16];
+    for (int ly = 0; ly < 16; ++ly) {
+        for (int lx = 0; lx < 16; ++lx) {
+            fl::u32 r = 0, g = 0, b = 0;
+            for (int y = ly * 8; y < ly * 8 + 8; ++y) {
+                for (int x = lx * 8; x < lx * 8 + 8; ++x) {
+                    r += px[y * 128 + x].r;
+                    g += px[y * 128 + x].g;
+                    b += px[y * 128 + x].b;
+                }
+            }
+            expected[ly * 16 + lx] = CRGB(r / 64, g / 64, b / 64);
+        }
+    }
+
+    // At 1:1 the LED path does the same box filter, without the frame.
+    fl::XYMap grid = fl::XYMap::constructRectangularGrid(16, 16);
+    CRGB leds[16 * 16];
+    fl::string error;
+    FL_REQUIRE(fl::Jpeg::decodeToLeds(data, grid, leds, fl::Jpeg::Scale::Full, &error));
+    for (int i = 0; i < 16 * 16; ++i) {
+        FL_CHECK(leds[i] == expected[i]);
+    }
+
+    // Auto picks 1/8 (DC only) for a 16x16 map; close to the exact average.
+    CRGB dc[16 * 16];
+    FL_REQUIRE(fl::Jpeg::decodeToLeds(data, grid, dc, fl::Jpeg::Scale::Auto, &error));
+    int worst = 0;
+    for (int i = 0; i < 16 * 16; ++i) {
+        for (int c = 0; c < 3; ++c) {
+            int diff = static_cast<int>(dc[i][c]) - static_cast<int>(expected[i][c]);
+            worst = fl::max(worst, diff < 0 ? -diff : diff);
+        }
+    }
+    FL_CHECK(worst <= 16);
+
+    // Serpentine layout receives the same pixels in wired order.
+    fl::XYMap serpentine = fl::XYMap::constructSerpentine(16, 16);
+    CRGB wired[16 * 16];
+    FL_REQUIRE(fl::Jpeg::decodeToLeds(data, serpentine, wired, fl::Jpeg::Scale::Full, &error));
+    for (fl::u16 y = 0; y < 16; ++y) {
+        for (fl::u16 x = 0; x < 16; ++x) {
+            FL_CHECK(wired[serpentine(x, y)] == expected[y * 16 + x]);
+        }
+    }
+
+    // Maps larger than the image repeat source pixels.
+    fl::XYMap big = fl::XYMap::constructRectangularGrid(40, 24);
+    fl::vector<CRGB> bigLeds(40 * 24);
+    FL_REQUIRE(fl::Jpeg::decodeToLeds(data, big, bigLeds, fl::Jpeg::Scale::Eighth, &error));
+    FL_CHECK(bigLeds[0] == dc[0]);
+    FL_CHECK(bigLeds[40 * 24 - 1] == dc[16 * 16 - 1]);
+
+    FL_CHECK_FALSE(fl::Jpeg::decodeToLeds(fl::span<const fl::u8>(file_data.data(), 16),
+                                          grid, leds, fl::Jpeg::Scale::Auto, &error));
+    FL_CHECK_FALSE(error.empty());
+    fs.end();
+}
+
+FL_TEST_CASE("JPEG scaled frame decode matches the scaled image size") {
+    fl::FileSystem fs = setupCodecFilesystem_jpeg();
+    fl::vector<fl::u8> file_data = loadCodecFile_jpeg(fs, "data/codec/progressive.jpg");
+    fl::span<const fl::u8> data(file_data.data(), file_data.size());
+
+    fl::JpegConfig config(fl::JpegConfig::Quality::Medium);  // 1/4
+    fl::FramePtr frame = fl::Jpeg::decode(config, data);
+    FL_REQUIRE(frame);
+    FL_CHECK_EQ(frame->getWidth(), 32);
+    FL_CHECK_EQ(frame->getHeight(), 32);
+
+    config.quality = fl::JpegConfig::Quality::Low;  // 1/8
+    frame = fl::Jpeg::decode(config, data);
+    FL_REQUIRE(frame);
+    FL_CHECK_EQ(frame->getWidth(), 16);
+    FL_CHECK_EQ(frame->getHeight(), 16);
+    fs.end();
+}
@@ -2,6 +2,7 @@
 // ok cpp include
 #include "tests/fl/fx/2d/animartrix_test.hpp"
 #include "tests/fl/fx/2d/animartrix_detail/perlin_s16x16.hpp"
+#include "tests/fl/fx/2d/animartrix_detail/polar_geometry.hpp"
 #include "tests/fl/fx/2d/animartrix_fp.hpp"
 #include "tests/fl/fx/2d/blend.hpp"
 #include "tests/fl/fx/2d/chasing_spirals.hpp"
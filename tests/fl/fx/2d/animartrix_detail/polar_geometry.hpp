@@ -0,0 +1,71 @@
+// Unit tests for the shared Animartrix polar geometry cache.
+
+#include "test.h"
+#include "fl/fx/2d/animartrix_detail.h"
+#include "fl/fx/2d/animartrix_detail/engine.h"
+#include "fl/math/fixed_point/s16x16.h"
+
+namespace fl {
+
+static u16 polarGeometryTestXY(u16 x, u16 y, void *) {
+    return static_cast<u16>(y * 12 + x);
+}
+
+FL_TEST_CASE("PolarGeometry - engines on the same grid share one table") {
+    CRGB leds[12 * 10];
+    Context a;
+    Context b;
+    Context c;
+    for (Context *ctx : {&a, &b, &c}) {
+        ctx->leds = fl::span<CRGB>(leds, 12 * 10);
+        ctx->xyMapFn = &polarGeometryTestXY;
+    }
+    init(a, 12, 10);
+    init(b, 12, 10);
+    init(c, 10, 12);
+
+    FL_CHECK(a.mEngine->geometry.get() == b.mEngine->geometry.get());
+    FL_CHECK(a.mEngine->geometry.get() != c.mEngine->geometry.get());
+
+    // Re-initializing at a new size releases the old table once unused.
+    init(a, 10, 12);
+    FL_CHECK(a.mEngine->geometry.get() == c.mEngine->geometry.get());
+    FL_CHECK_EQ(b.mEngine->geometry.use_count(), 1);
+}
+
+FL_TEST_CASE("PolarGeometry - flat layout matches the [x][y] definition") {
+    PolarGeometryKey key;
+    key.num_x = 7;
+    key.num_y = 5;
+    key.center_x = 2.5f;
+    key.center_y = 1.5f;
+    fl::shared_ptr<const PolarGeometry> g = PolarGeometry::acquire(key);
+
+    FL_REQUIRE_EQ(g->count(), 35);
+    FL_CHECK_EQ(g->padded(), 36);
+    // Every array starts on a cache line.
+    const int align = PolarGeometry::kAlignBytes;
+    FL_CHECK_EQ(reinterpret_cast<fl::uptr>(g->theta()) % align, 0u);  // ok reinterpret cast
+    FL_CHECK_EQ(reinterpret_cast<fl::uptr>(g->distance()) % align, 0u);  // ok reinterpret cast
+    FL_CHECK_EQ(reinterpret_cast<fl::uptr>(g->thetaRaw()) % align, 0u);  // ok reinterpret cast
+    FL_CHECK_EQ(reinterpret_cast<fl::uptr>(g->distanceRaw()) % align, 0u);  // ok reinterpret cast
+    FL_CHECK_EQ(reinterpret_cast<fl::uptr>(g->sqrtDistanceRaw()) % align, 0u);  // ok reinterpret cast
+
+    PolarGeometry::Table theta = g->thetaTable();
+    PolarGeometry::Table dist = g->distanceTable();
+    for (int x = 0; x < key.num_x; x++) {
+        for (int y = 0; y < key.num_y; y++) {
+            const int idx = x * key.num_y + y;
+            const float dx = x - key.center_x;
+            const float dy = y - key.center_y;
+            FL_CHECK(dist[x][y] == fl::hypotf(dx, dy));
+            FL_CHECK(theta[x][y] == fl::atan2f(dy, dx));
+            FL_CHECK_EQ(g->thetaRaw()[idx], fl::s16x16(theta[x][y]).raw());
+            FL_CHECK_EQ(g->distanceRaw()[idx], fl::s16x16(dist[x][y]).raw());
+            FL_CHECK_EQ(g->sqrtDistanceRaw()[idx],
+                        fl::s16x16(dist[x][y]).sqrt().raw());
+        }
+    }
+}
+
+} // namespace fl
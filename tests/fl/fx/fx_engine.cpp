@@ -20,6 +20,8 @@
 #include "fl/stl/string.h"
 #include "fl/stl/utility.h"
 #include "fl/math/xymap.h"
+#include "fl/fx/2d/noisepalette.h"
+#include "fl/math/random8.h"
 
 FL_TEST_FILE(FL_FILEPATH) {
 
@@ -223,4 +225,278 @@ FL_TEST_CASE("test_fixed_fps") {
     FL_CHECK_EQ(leds[0], CRGB(127, 0, 0));
 }
 
+namespace {
+
+// Adds one to the red channel of whatever the previous frame left behind,
+// so continuity of the layer's own state is observable.
+class AccumulateFx : public fl::Fx {
+  public:
+    explicit AccumulateFx(uint16_t numLeds) : fl::Fx(numLeds) {}
+    void draw(fl::Fx::DrawContext ctx) override {
+        ++draws;
+        for (uint16_t i = 0; i < mNumLeds; ++i) {
+            ctx.leds[i].r += 1;
+        }
+    }
+    fl::string fxName() const override { return "AccumulateFx"; }
+    int draws = 0;
+};
+
+class CountingFx : public fl::Fx {
+  public:
+    CountingFx(uint16_t numLeds, CRGB color) : fl::Fx(numLeds), mColor(color) {}
+    void draw(fl::Fx::DrawContext ctx) override {
+        ++draws;
+        for (uint16_t i = 0; i < mNumLeds; ++i) {
+            ctx.leds[i] = mColor;
+        }
+    }
+    fl::string fxName() const override { return "CountingFx"; }
+    int draws = 0;
+
+  private:
+    CRGB mColor;
+};
+
+u8 referenceBlend(u8 a, u8 b, fl::BlendMode mode) {
+    switch (mode) {
+    case fl::BlendMode::kNormal: return b;
+    case fl::BlendMode::kAdd: return static_cast<u8>(fl::min(255, a + b));
+    case fl::BlendMode::kScreen: return static_cast<u8>(255 - (255 - a) * (255 - b) / 255);
+    case fl::BlendMode::kMultiply: return static_cast<u8>(a * b / 255);
+    case fl::BlendMode::kMax: return a > b ? a : b;
+    }
+    return b;
+}
+
+} // anonymous namespace
+
+FL_TEST_CASE("blendSpans matches per-channel reference") {
+    // 37 pixels = 111 bytes: six full SIMD blocks plus a scalar tail.
+    const int N = 37;
+    CRGB under[N], over[N], out[N];
+    for (int i = 0; i < N; ++i) {
+        under[i] = CRGB(static_cast<u8>(i * 37 + 17), static_cast<u8>(i * 11),
+                        static_cast<u8>(255 - i * 3));
+        over[i] = CRGB(static_cast<u8>(i * 59 + 31), static_cast<u8>(200 - i),
+                       static_cast<u8>(i * 83 + 47));
+    }
+    const fl::BlendMode modes[] = {fl::BlendMode::kNormal, fl::BlendMode::kAdd,
+                                   fl::BlendMode::kScreen, fl::BlendMode::kMultiply,
+                                   fl::BlendMode::kMax};
+    const u8 opacities[] = {0, 1, 128, 254, 255};
+    for (fl::BlendMode mode : modes) {
+        for (u8 opacity : opacities) {
+            fl::blendSpans(out, under, over, mode, opacity);
+            bool ok = true;
+            for (int i = 0; i < N; ++i) {
+                for (int c = 0; c < 3; ++c) {
+                    u8 a = under[i].raw[c];
+                    u8 f = referenceBlend(a, over[i].raw[c], mode);
+                    u8 expect = opacity == 255 ? f
+                        : static_cast<u8>((a * (256 - opacity) + f * opacity + 128) >> 8);
+                    ok = ok && out[i].raw[c] == expect;
+                }
+            }
+            FL_CHECK_MESSAGE(ok, "mode " << int(mode) << " opacity " << int(opacity));
+        }
+    }
+    // In place: out aliases under.
+    CRGB inplace[N];
+    for (int i = 0; i < N; ++i) inplace[i] = under[i];
+    fl::blendSpans(inplace, inplace, over, fl::BlendMode::kMax, 255);
+    for (int i = 0; i < N; ++i) {
+        FL_CHECK_EQ(inplace[i].g, referenceBlend(under[i].g, over[i].g, fl::BlendMode::kMax));
+    }
+}
+
+FL_TEST_CASE("FxEngine layers blend over the base effect") {
+    constexpr uint16_t NUM_LEDS = 20;
+    fl::FxEngine engine(NUM_LEDS, false);
+    CRGB leds[NUM_LEDS];
+    auto base = fl::make_shared<CountingFx>(NUM_LEDS, CRGB(200, 0, 10));
+    auto overlay = fl::make_shared<CountingFx>(NUM_LEDS, CRGB(100, 0, 250));
+    engine.addFx(base);
+
+    int layer = engine.addLayer(overlay, fl::BlendMode::kAdd);
+    FL_REQUIRE_EQ(layer, 0);
+    engine.draw(0, leds);
+    FL_CHECK_EQ(leds[NUM_LEDS - 1], CRGB(255, 0, 255));
+
+    FL_CHECK(engine.setLayerBlendMode(layer, fl::BlendMode::kMax));
+    engine.draw(10, leds);
+    FL_CHECK_EQ(leds[0], CRGB(200, 0, 250));
+
+    // A transparent layer is skipped entirely.
+    FL_CHECK(engine.setLayerOpacity(layer, 0));
+    int overlayDraws = overlay->draws;
+    engine.draw(20, leds);
+    FL_CHECK_EQ(overlay->draws, overlayDraws);
+    FL_CHECK_EQ(leds[0], CRGB(200, 0, 10));
+
+    // A static layer is drawn once and reused.
+    FL_CHECK(engine.setLayerOpacity(layer, 255));
+    FL_CHECK(engine.setLayerStatic(layer, true));
+    engine.draw(30, leds);
+    engine.draw(40, leds);
+    engine.draw(50, leds);
+    FL_CHECK_EQ(overlay->draws, overlayDraws);  // cached since the first draw
+    FL_CHECK(engine.invalidateLayer(layer));
+    engine.draw(60, leds);
+    FL_CHECK_EQ(overlay->draws, overlayDraws + 1);
+
+    FL_CHECK(engine.removeLayer(layer));
+    FL_CHECK_FALSE(engine.removeLayer(layer));
+    FL_CHECK_FALSE(engine.setLayerOpacity(layer, 10));
+    engine.draw(70, leds);
+    FL_CHECK_EQ(leds[0], CRGB(200, 0, 10));
+}
+
+FL_TEST_CASE("FxEngine layer shorter than the base leaves the tail to the base") {
+    constexpr uint16_t NUM_LEDS = 20;
+    fl::FxEngine engine(NUM_LEDS, false);
+    CRGB leds[NUM_LEDS];
+    engine.addFx(fl::make_shared<CountingFx>(NUM_LEDS, CRGB(200, 0, 10)));
+    engine.addLayer(fl::make_shared<CountingFx>(NUM_LEDS / 2, CRGB(0, 40, 0)),
+                    fl::BlendMode::kAdd);
+    for (uint32_t t = 0; t < 3; ++t) {
+        for (uint16_t i = 0; i < NUM_LEDS; ++i) leds[i] = CRGB(1, 2, 3);
+        engine.draw(t * 10, leds);
+        FL_CHECK_EQ(leds[0], CRGB(200, 40, 10));
+        FL_CHECK_EQ(leds[NUM_LEDS / 2 - 1], CRGB(200, 40, 10));
+        FL_CHECK_EQ(leds[NUM_LEDS / 2], CRGB(200, 0, 10));
+        FL_CHECK_EQ(leds[NUM_LEDS - 1], CRGB(200, 0, 10));
+    }
+}
+
+FL_TEST_CASE("FxEngine keeps base layer state across direct and layered frames") {
+    constexpr uint16_t NUM_LEDS = 4;
+    fl::FxEngine engine(NUM_LEDS, false);
+    CRGB leds[NUM_LEDS];
+    auto acc = fl::make_shared<AccumulateFx>(NUM_LEDS);
+    engine.addFx(acc);
+
+    // Single layer: rendered straight into leds.
+    engine.draw(0, leds);
+    engine.draw(1, leds);
+    FL_CHECK_EQ(leds[0].r, 2);
+
+    // With an overlay the base renders into its own surface, carrying on
+    // from where the direct frames left off.
+    auto overlay = fl::make_shared<CountingFx>(NUM_LEDS, CRGB(0, 50, 0));
+    int layer = engine.addLayer(overlay, fl::BlendMode::kAdd);
+    engine.draw(2, leds);
+    FL_CHECK_EQ(leds[0], CRGB(3, 50, 0));
+    engine.draw(3, leds);
+    FL_CHECK_EQ(leds[0], CRGB(4, 50, 0));
+
+    // And back to direct rendering without losing the accumulated state.
+    engine.removeLayer(layer);
+    engine.draw(4, leds);
+    FL_CHECK_EQ(leds[0], CRGB(5, 0, 0));
+    FL_CHECK_EQ(acc->draws, 5);
+}
+
+FL_TEST_CASE("FxEngine takes base layer state from the buffer passed to draw") {
+    constexpr uint16_t NUM_LEDS = 4;
+    fl::FxEngine engine(NUM_LEDS, false);
+    CRGB front[NUM_LEDS];
+    CRGB back[NUM_LEDS];
+    auto acc = fl::make_shared<AccumulateFx>(NUM_LEDS);
+    engine.addFx(acc);
+
+    engine.draw(0, front);
+    engine.draw(1, front);
+    FL_CHECK_EQ(front[0].r, 2);
+
+    // The caller switches buffers as the overlay appears; the base layer
+    // continues from the frame handed back to it.
+    for (uint16_t i = 0; i < NUM_LEDS; ++i) back[i] = front[i];
+    int layer = engine.addLayer(fl::make_shared<CountingFx>(NUM_LEDS, CRGB(0, 50, 0)),
+                                fl::BlendMode::kAdd);
+    engine.draw(2, back);
+    FL_CHECK_EQ(back[0], CRGB(3, 50, 0));
+
+    // Back to direct rendering into the other buffer: the base layer's own
+    // surface is current, so the stale contents of `front` are replaced.
+    engine.removeLayer(layer);
+    engine.draw(3, front);
+    FL_CHECK_EQ(front[0], CRGB(4, 0, 0));
+}
+
+namespace {
+
+// Row-independent effect: each row gets its row number in red; records how
+// many bands it was offered and how many drawRows() calls it saw.
+class RowBandFx : public fl::Fx2d {
+  public:
+    RowBandFx(u16 w, u16 h) : Fx2d(XYMap::constructRectangularGrid(w, h)) {}
+    void draw(DrawContext context) override { drawBanded(context); }
+    u8 rowPasses() const override { return 1; }
+    void beginFrame(DrawContext &context) override {
+        lastBands = context.bands;
+        calls = 0;
+    }
+    void drawRows(DrawContext context, u8, u16 yBegin, u16 yEnd) override {
+        for (u16 y = yBegin; y < yEnd; ++y) {
+            for (u16 x = 0; x < getWidth(); ++x) {
+                context.leds[xyMap(x, y)] = CRGB(static_cast<u8>(y), 0, 0);
+            }
+        }
+        fl::unique_lock<fl::mutex> lock(mutex);
+        ++calls;
+    }
+    fl::string fxName() const override { return "RowBandFx"; }
+
+    fl::mutex mutex;
+    u8 lastBands = 0;
+    int calls = 0;
+};
+
+} // anonymous namespace
+
+FL_TEST_CASE("FxEngine render bands reach row-independent Fx2d") {
+    const u16 W = 5, H = 9;
+    fl::FxEngine engine(W * H, false);
+    auto fx = fl::make_shared<RowBandFx>(W, H);
+    engine.addFx(fx);
+    CRGB leds[W * H];
+
+    engine.draw(0, leds);
+    FL_CHECK_EQ(fx->lastBands, 1);
+    FL_CHECK_EQ(fx->calls, 1);
+
+    engine.setRenderBands(4);
+    FL_CHECK_EQ(engine.getRenderBands(), 4);
+    engine.draw(1, leds);
+    FL_CHECK_EQ(fx->lastBands, 4);
+    FL_CHECK_EQ(fx->calls, 4);
+    for (u16 y = 0; y < H; ++y) {
+        for (u16 x = 0; x < W; ++x) {
+            FL_CHECK_EQ(leds[y * W + x].r, y);
+        }
+    }
+}
+
+FL_TEST_CASE("NoisePalette renders identically in bands and serially") {
+    const u16 W = 16, H = 11;
+    XYMap xy = XYMap::constructRectangularGrid(W, H);
+    random16_set_seed(1234);
+    NoisePalette serial(xy);
+    random16_set_seed(1234);
+    NoisePalette banded(xy);
+    CRGB a[W * H];
+    CRGB b[W * H];
+    for (int frame = 0; frame < 4; ++frame) {
+        Fx::DrawContext ca(frame * 16, a);
+        Fx::DrawContext cb(frame * 16, b);
+        cb.bands = 3;
+        serial.draw(ca);
+        banded.draw(cb);
+        for (u16 i = 0; i < W * H; ++i) {
+            FL_REQUIRE_EQ(a[i], b[i]);
+        }
+    }
+}
+
 } // FL_TEST_FILE
@@ -603,6 +603,72 @@ FL_TEST_CASE("blur2d with rectangular XYMap matches Canvas path") {
     }
 }
 
+// ── Classic keep/seep blur: vectorized paths vs scalar reference ───────
+
+// Pixel-at-a-time reference for blur1d along a strided line.
+static void reference_blur_line(CRGB *px, int count, int stride,
+                                fl::u8 amount) {
+    fl::u8 keep = 255 - amount;
+    fl::u8 seep = amount >> 1;
+    CRGB carryover = CRGB::Black;
+    for (int i = 0; i < count; ++i) {
+        CRGB cur = px[i * stride];
+        CRGB part = cur;
+        part.nscale8(seep);
+        cur.nscale8(keep);
+        cur += carryover;
+        if (i)
+            px[(i - 1) * stride] += part;
+        px[i * stride] = cur;
+        carryover = part;
+    }
+}
+
+static void reference_blur2d(CRGB *px, int w, int h, fl::u8 amount) {
+    for (int y = 0; y < h; ++y)
+        reference_blur_line(px + y * w, w, 1, amount);
+    for (int x = 0; x < w; ++x)
+        reference_blur_line(px + x, h, w, amount);
+}
+
+FL_TEST_CASE("blur1d/blur2d match scalar reference bit-exactly") {
+    const int sizes[][2] = {{1, 1}, {5, 3}, {7, 13}, {16, 16}, {33, 9}, {64, 64}};
+    const fl::u8 amounts[] = {0, 1, 64, 172, 200, 255};
+    static CRGB ref[64 * 64];
+    static CRGB got[64 * 64];
+    for (const auto &sz : sizes) {
+        const int w = sz[0], h = sz[1], n = w * h;
+        for (fl::u8 amount : amounts) {
+            // Saturating input so the qadd8 clamping is exercised too.
+            for (int i = 0; i < n; ++i) {
+                ref[i] = CRGB(static_cast<fl::u8>(i * 37 + 17),
+                              (i % 3) ? 255 : 250,
+                              static_cast<fl::u8>(i * 83 + 47));
+                got[i] = ref[i];
+            }
+            reference_blur2d(ref, w, h, amount);
+            gfx::Canvas<CRGB> canvas(fl::span<CRGB>(got, n), w, h);
+            gfx::blur2d(canvas, alpha8(amount));
+            bool same = true;
+            for (int i = 0; i < n; ++i)
+                same = same && ref[i] == got[i];
+            FL_CHECK_MESSAGE(same, "blur2d " << w << "x" << h << " amount " << int(amount));
+
+            for (int i = 0; i < n; ++i) {
+                ref[i] = CRGB(static_cast<fl::u8>(i * 59 + 31), 255,
+                              static_cast<fl::u8>(i * 7));
+                got[i] = ref[i];
+            }
+            reference_blur_line(ref, n, 1, amount);
+            gfx::blur1d(fl::span<CRGB>(got, n), amount);
+            same = true;
+            for (int i = 0; i < n; ++i)
+                same = same && ref[i] == got[i];
+            FL_CHECK_MESSAGE(same, "blur1d n=" << n << " amount " << int(amount));
+        }
+    }
+}
+
 // ── CanvasMapped tests: verify identical results to Canvas ──────────────
 
 // Helper: fill pixel arrays with deterministic test data.
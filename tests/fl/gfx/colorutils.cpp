@@ -1,4 +1,5 @@
 #include "FastLED.h"
+#include "fl/stl/vector.h"
 #include "test.h"
 
 namespace {
@@ -252,4 +253,108 @@ FL_TEST_CASE("ColorFromPaletteHD supports existing RGB palette families") {
         0u);
 }
 
+FL_TEST_CASE("batch ColorFromPalette matches per-pixel lookups") {
+    CRGBPalette16 pal16;
+    for (int i = 0; i < 16; ++i) {
+        pal16[i] = make_rgb(i * 16 + 3);
+    }
+    fl::vector<fl::u8> indices(600);
+    for (int i = 0; i < 600; ++i) {
+        indices[i] = static_cast<fl::u8>(i * 37 + (i >> 3));
+    }
+    const TBlendType blends[] = {NOBLEND, LINEARBLEND, LINEARBLEND_NOWRAP};
+    const fl::u8 brightnesses[] = {255, 254, 128, 1, 0};
+    // 600 pixels take the expanded-palette path, 20 the per-pixel one.
+    const fl::size counts[] = {600, 20};
+    fl::vector<CRGB> out(600);
+    for (TBlendType blend : blends) {
+        for (fl::u8 brightness : brightnesses) {
+            for (fl::size count : counts) {
+                ColorFromPalette(pal16, fl::span<const fl::u8>(indices.data(), count),
+                                 fl::span<CRGB>(out.data(), count), brightness, blend);
+                for (fl::size i = 0; i < count; ++i) {
+                    check_rgb_eq(out[i], ColorFromPalette(pal16, indices[i], brightness, blend));
+                }
+            }
+        }
+    }
+
+    // The 256-entry kernel applies brightness after the gather.
+    CRGBPalette256 pal256(pal16);
+    for (fl::u8 brightness : brightnesses) {
+        ColorFromPalette(pal256, fl::span<const fl::u8>(indices.data(), 299),
+                         fl::span<CRGB>(out.data(), 299), brightness);
+        for (fl::size i = 0; i < 299; ++i) {
+            check_rgb_eq(out[i], ColorFromPalette(pal256, indices[i], brightness));
+        }
+    }
+
+    CRGBPalette256 expanded;
+    ExpandPalette(pal16, expanded, 200, NOBLEND);
+    for (int i = 0; i < 256; ++i) {
+        check_rgb_eq(expanded[static_cast<fl::u8>(i)],
+                     ColorFromPalette(pal16, static_cast<fl::u8>(i), 200, NOBLEND));
+    }
+}
+
+FL_TEST_CASE("batch ColorFromPaletteExtended matches per-pixel lookups") {
+    CRGBPalette16 pal16;
+    for (int i = 0; i < 16; ++i) {
+        pal16[i] = make_rgb(i * 16 + 3);
+    }
+    CRGBPalette32 pal32(pal16);
+    CRGBPalette256 pal256(pal16);
+    // Covers every entry, offset 0 and the wrap from the last entry.
+    fl::vector<fl::u16> indices(203);
+    for (int i = 0; i < 203; ++i) {
+        indices[i] = static_cast<fl::u16>(i * 4099 + (i & 1) * 0xFFF0);
+    }
+    indices[0] = 0;
+    indices[1] = 0xFFFF;
+    const TBlendType blends[] = {NOBLEND, LINEARBLEND};
+    const fl::u8 brightnesses[] = {255, 254, 128, 1, 0};
+    fl::vector<CRGB> out(indices.size());
+    fl::span<const fl::u16> in(indices.data(), indices.size());
+    for (TBlendType blend : blends) {
+        for (fl::u8 brightness : brightnesses) {
+            ColorFromPaletteExtended(pal16, in, out, brightness, blend);
+            for (fl::size i = 0; i < out.size(); ++i) {
+                check_rgb_eq(out[i], ColorFromPaletteExtended(pal16, indices[i], brightness, blend));
+            }
+            ColorFromPaletteExtended(pal32, in, out, brightness, blend);
+            for (fl::size i = 0; i < out.size(); ++i) {
+                check_rgb_eq(out[i], ColorFromPaletteExtended(pal32, indices[i], brightness, blend));
+            }
+            ColorFromPaletteExtended(pal256, in, out, brightness, blend);
+            for (fl::size i = 0; i < out.size(); ++i) {
+                check_rgb_eq(out[i], ColorFromPaletteExtended(pal256, indices[i], brightness, blend));
+            }
+        }
+    }
+}
+
+FL_TEST_CASE("fill_palette and map_data_into_colors_through_palette use the batch path") {
+    CRGBPalette16 pal16;
+    for (int i = 0; i < 16; ++i) {
+        pal16[i] = make_rgb(i * 11 + 5);
+    }
+    fl::vector<CRGB> filled(600);
+    fill_palette(filled.data(), 600, 7, 3, pal16, 180, LINEARBLEND);
+    fl::u8 index = 7;
+    for (int i = 0; i < 600; ++i) {
+        check_rgb_eq(filled[i], ColorFromPalette(pal16, index, 180, LINEARBLEND));
+        index += 3;
+    }
+
+    fl::vector<fl::u8> data(600);
+    for (int i = 0; i < 600; ++i) {
+        data[i] = static_cast<fl::u8>(i * 13);
+    }
+    fl::vector<CRGB> mapped(600);
+    map_data_into_colors_through_palette(data.data(), 600, mapped.data(), pal16, 90);
+    for (int i = 0; i < 600; ++i) {
+        check_rgb_eq(mapped[i], ColorFromPalette(pal16, data[i], 90));
+    }
+}
+
 } // FL_TEST_FILE
@@ -257,4 +257,34 @@ FL_TEST_CASE("HSV to RGB Conversion - Hue Sweep Test") {
     FL_WARN("");
 }
 
+FL_TEST_CASE("Batch hsv2rgb_rainbow matches the per-pixel conversion") {
+    // Every (hue, sat, val) triple, 256 hues per call; 250 pixels per call
+    // also exercises the scalar tail after the 16-pixel blocks.
+    vector<CHSV> hsv(256);
+    vector<CRGB> batch(256);
+    int mismatches = 0;
+    for (int sat = 0; sat < 256; ++sat) {
+        for (int val = 0; val < 256; ++val) {
+            for (int hue = 0; hue < 256; ++hue) {
+                hsv[hue] = CHSV(hue, sat, val);
+            }
+            const fl::size count = (sat + val) % 2 ? 256 : 250;
+            hsv2rgb_rainbow(fl::span<const CHSV>(hsv.data(), count),
+                            fl::span<CRGB>(batch.data(), count));
+            for (fl::size i = 0; i < count; ++i) {
+                CRGB expected;
+                hsv2rgb_rainbow(hsv[i], expected);
+                if (!(batch[i] == expected)) {
+                    ++mismatches;
+                }
+            }
+        }
+    }
+    FL_CHECK_EQ(mismatches, 0);
+
+    // The pointer array form goes through the same kernel.
+    hsv2rgb_rainbow(hsv.data(), batch.data(), 37);
+    FL_CHECK(batch[36] == hsv2rgb_rainbow(hsv[36]));
+}
+
 } // FL_TEST_FILE
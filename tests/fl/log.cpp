@@ -4,5 +4,6 @@
 #include "tests/fl/log/async_logger.hpp"
 #include "tests/fl/log/async_logger_error_detection.hpp"
 #include "tests/fl/log/async_logger_output.hpp"
+#include "tests/fl/log/binary_log_queue.hpp"
 #include "tests/fl/log/log.hpp"
 #include "tests/fl/system/trace.hpp"
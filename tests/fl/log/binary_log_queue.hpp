@@ -0,0 +1,165 @@
+#include "fl/log/binary_log_queue.h"
+#include "fl/log/async_logger.h"
+#include "fl/stl/atomic.h"
+#include "fl/stl/sstream.h"
+#include "fl/stl/string.h"
+#include "fl/stl/thread.h"
+#include "test.h"
+
+using namespace fl;
+
+namespace {
+
+fl::string formatRecord(const BinaryLogRecord& record) {
+    fl::sstream out;
+    formatBinaryLogRecord(record, out);
+    return out.str();
+}
+
+} // namespace
+
+FL_TEST_CASE("fl::BinaryLogQueue - captures raw arguments") {
+    BinaryLogQueue<8, 4> queue;
+    FL_CHECK(queue.empty());
+    FL_CHECK_EQ(queue.capacity(), 8);
+
+    const char* fmt = "ch%d %u symbols %.2f %s";
+    fl::u8 channel = 3;
+    FL_CHECK(queue.push(1, fmt, -2, channel, 1.5f, "ok"));
+    FL_CHECK_EQ(queue.size(), 1);
+
+    BinaryLogRecord record;
+    FL_REQUIRE(queue.tryPop(&record));
+    FL_CHECK(record.mFormat == fmt);  // Pointer captured, not copied
+    FL_CHECK_EQ(record.mProducer, 1);
+    FL_CHECK_EQ(record.mArgCount, 4);
+    FL_CHECK(record.mTypes[0] == LogArgType::Int);
+    FL_CHECK_EQ(record.mArgs[0].i, -2);
+    FL_CHECK(record.mTypes[1] == LogArgType::Uint);
+    FL_CHECK_EQ(record.mArgs[1].u, 3u);
+    FL_CHECK(record.mTypes[2] == LogArgType::Float);
+    FL_CHECK(record.mTypes[3] == LogArgType::Str);
+    FL_CHECK(queue.empty());
+    FL_CHECK_FALSE(queue.tryPop(&record));
+}
+
+FL_TEST_CASE("fl::BinaryLogQueue - deferred formatting matches fl::printf") {
+    BinaryLogQueue<8, 4> queue;
+    BinaryLogRecord record;
+
+    queue.push(0, "plain");
+    queue.push(0, "%d|%5u|%x|%s|%c|100%%", -7, 42u, 255, "str", 'A');
+    queue.push(0, "%.3f", 3.14159);
+    queue.push(0, "%d and %d", 1);
+    queue.push(0, "%p", static_cast<const void*>(nullptr));
+
+    FL_REQUIRE(queue.tryPop(&record));
+    FL_CHECK_EQ(formatRecord(record), "plain");
+    FL_REQUIRE(queue.tryPop(&record));
+    FL_CHECK_EQ(formatRecord(record), "-7|   42|ff|str|A|100%");
+    FL_REQUIRE(queue.tryPop(&record));
+    FL_CHECK_EQ(formatRecord(record), "3.142");
+    FL_REQUIRE(queue.tryPop(&record));
+    FL_CHECK_EQ(formatRecord(record), "1 and <missing_arg>");
+    FL_REQUIRE(queue.tryPop(&record));
+    FL_CHECK_EQ(formatRecord(record), "0x0");
+}
+
+FL_TEST_CASE("fl::BinaryLogQueue - per-producer drop counters") {
+    BinaryLogQueue<8, 4> queue;
+    for (int i = 0; i < 8; i++) {
+        FL_CHECK(queue.push(0, "fill %d", i));
+    }
+    FL_CHECK_EQ(queue.size(), 8);
+
+    FL_CHECK_FALSE(queue.push(1, "dropped"));
+    FL_CHECK_FALSE(queue.push(2, "dropped"));
+    FL_CHECK_FALSE(queue.push(2, "dropped"));
+    FL_CHECK_FALSE(queue.push(9, "dropped"));  // Out of range: shares the last counter
+    FL_CHECK_EQ(queue.droppedCount(0), 0);
+    FL_CHECK_EQ(queue.droppedCount(1), 1);
+    FL_CHECK_EQ(queue.droppedCount(2), 2);
+    FL_CHECK_EQ(queue.droppedCount(3), 1);
+    FL_CHECK_EQ(queue.droppedCount(), 4);
+
+    // Draining frees slots for the next lap, in FIFO order
+    BinaryLogRecord record;
+    FL_REQUIRE(queue.tryPop(&record));
+    FL_CHECK_EQ(formatRecord(record), "fill 0");
+    FL_CHECK(queue.push(1, "lap %d", 2));
+    for (int i = 1; i < 8; i++) {
+        FL_REQUIRE(queue.tryPop(&record));
+        FL_CHECK_EQ(record.mArgs[0].i, i);
+    }
+    FL_REQUIRE(queue.tryPop(&record));
+    FL_CHECK_EQ(formatRecord(record), "lap 2");
+    FL_CHECK(queue.empty());
+}
+
+#if FASTLED_MULTITHREADED
+FL_TEST_CASE("fl::BinaryLogQueue - concurrent producers") {
+    static BinaryLogQueue<64, 16> queue;  // ~4.5KB, keep off the test stack
+    const int kProducers = 4;
+    const int kPerProducer = 2000;
+    fl::atomic<int> accepted(0);
+    fl::atomic<bool> producersDone(false);
+
+    int received[kProducers] = {};
+    int lastSeen[kProducers] = {-1, -1, -1, -1};
+    bool ordered = true;
+    fl::thread consumer([&]() {
+        BinaryLogRecord record;
+        for (;;) {
+            const bool done = producersDone.load();
+            if (queue.tryPop(&record)) {
+                const int p = record.mProducer;
+                const int seq = static_cast<int>(record.mArgs[0].i);
+                if (seq <= lastSeen[p]) ordered = false;  // FIFO per producer
+                lastSeen[p] = seq;
+                received[p]++;
+            } else if (done) {
+                break;
+            }
+        }
+    });
+
+    fl::thread producers[kProducers];
+    for (int p = 0; p < kProducers; p++) {
+        producers[p] = fl::thread([&, p]() {
+            for (int i = 0; i < kPerProducer; i++) {
+                if (queue.push(static_cast<fl::u8>(p), "p%d #%d", i, p)) {
+                    accepted.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (int p = 0; p < kProducers; p++) {
+        producers[p].join();
+    }
+    producersDone.store(true);
+    consumer.join();
+
+    int total = 0;
+    for (int p = 0; p < kProducers; p++) {
+        FL_CAPTURE(p);
+        FL_CHECK_EQ(received[p] + static_cast<int>(queue.droppedCount(static_cast<fl::u8>(p))),
+                    kPerProducer);
+        total += received[p];
+    }
+    FL_CHECK(ordered);
+    FL_CHECK_EQ(total, accepted.load());
+    FL_CHECK(queue.empty());
+}
+#endif
+
+FL_TEST_CASE("fl::BinaryLogger - flush drains the shared queue") {
+    BinaryLogger& logger = get_binary_logger();
+    logger.clear();
+    FL_LOG_BIN(LogCategory::RMT_ISR, "rmt ch%u done", 2u);
+    FL_LOG_BIN(LogCategory::SPI_MAIN, "spi %d bytes", 64);
+    FL_CHECK_EQ(logger.size(), 2);
+    FL_CHECK_EQ(logger.flushN(1), 1);
+    FL_CHECK_EQ(logger.size(), 1);
+    FL_LOG_BIN_FLUSH();
+    FL_CHECK(logger.empty());
+}
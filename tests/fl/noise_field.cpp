@@ -0,0 +1,115 @@
+#include "noise.h"
+#include "fl/stl/stdint.h"
+#include "fl/stl/vector.h"
+#include "test.h"
+
+FL_TEST_FILE(FL_FILEPATH) {
+using namespace fl;
+
+namespace {
+
+// Compares a single-octave field against point-wise inoise16().
+int noiseFieldMismatches(const NoiseField &field) {
+    const int count = field.width * field.height * (field.use_z ? field.depth : 1);
+    fl::vector<u16> out(count, 0);
+    fill_noise_field(out.data(), field);
+    int mismatches = 0;
+    int index = 0;
+    for (int k = 0; k < (field.use_z ? field.depth : 1); ++k) {
+        const u32 z = field.z + static_cast<u32>(k) * static_cast<u32>(field.scale_z);
+        for (int j = 0; j < field.height; ++j) {
+            const u32 y = field.y + static_cast<u32>(j) * static_cast<u32>(field.scale_y);
+            for (int i = 0; i < field.width; ++i, ++index) {
+                const u32 x = field.x + static_cast<u32>(i) * static_cast<u32>(field.scale_x);
+                const u16 expected = field.use_z ? inoise16(x, y, z) : inoise16(x, y);
+                if (out[index] != expected) {
+                    ++mismatches;
+                }
+            }
+        }
+    }
+    return mismatches;
+}
+
+} // namespace
+
+FL_TEST_CASE("fill_noise_field matches inoise16 sample for sample") {
+    // Steps below, at and above one lattice cell, both directions, plus a
+    // constant row; widths exercise partial SIMD groups and chunking.
+    const i32 steps[] = {1, 777, 4096, 7680, 0x10000, 0x18001, -5000, -0x20000, 0};
+    const int widths[] = {1, 5, 67, 130};
+    for (bool use_z : {true, false}) {
+        for (i32 step : steps) {
+            for (int width : widths) {
+                NoiseField field;
+                field.width = width;
+                field.height = 3;
+                field.depth = 2;
+                field.x = 0x12345678u;
+                field.scale_x = step;
+                field.y = 0xFFFF0000u;  // first row on a lattice line
+                field.scale_y = 0x9001;
+                field.z = 0x0003FFFFu;
+                field.scale_z = 123457;
+                field.use_z = use_z;
+                FL_CHECK_EQ(noiseFieldMismatches(field), 0);
+            }
+        }
+    }
+}
+
+FL_TEST_CASE("fill_noise_field 8-bit and palette outputs") {
+    NoiseField field;
+    field.width = 16;
+    field.height = 8;
+    field.x = 1000;
+    field.scale_x = 3000;
+    field.y = 2000;
+    field.scale_y = 3000;
+    field.z = 77777;
+
+    u16 wide[16 * 8];
+    u8 narrow[16 * 8];
+    CRGB leds[16 * 8];
+    fill_noise_field(wide, field);
+    fill_noise_field(narrow, field);
+    CRGBPalette16 palette = RainbowColors_p;
+    fill_noise_field(leds, field, palette, 200, NOBLEND);
+    for (int i = 0; i < 16 * 8; ++i) {
+        FL_CHECK_EQ(narrow[i], static_cast<u8>(wide[i] >> 8));
+        FL_CHECK(leds[i] == ColorFromPalette(palette, narrow[i], 200, NOBLEND));
+    }
+}
+
+FL_TEST_CASE("fill_noise_field octaves") {
+    NoiseField field;
+    field.width = 32;
+    field.height = 32;
+    field.scale_x = 5000;
+    field.scale_y = 5000;
+    field.z = 0x00420000u;
+
+    u16 one[32 * 32];
+    u16 three[32 * 32];
+    u16 again[32 * 32];
+    field.octaves = 1;
+    fill_noise_field(one, field);
+    field.octaves = 3;
+    fill_noise_field(three, field);
+    fill_noise_field(again, field);
+
+    int differ = 0;
+    u16 lo = 0xFFFF;
+    u16 hi = 0;
+    for (int i = 0; i < 32 * 32; ++i) {
+        FL_CHECK_EQ(three[i], again[i]);
+        differ += one[i] != three[i];
+        lo = three[i] < lo ? three[i] : lo;
+        hi = three[i] > hi ? three[i] : hi;
+    }
+    FL_CHECK(differ > 32 * 32 / 2);
+    // The summed octaves are rescaled, not squashed into the middle.
+    FL_CHECK(hi - lo > 20000);
+}
+
+} // FL_TEST_FILE
@@ -0,0 +1,336 @@
+#include "test.h"
+#include "fl/remote/remote.h"
+#include "fl/remote/rpc/msgpack.h"
+#include "fl/remote/rpc/msgpack_to_type.h"
+#include "fl/remote/rpc/rpc.h"
+#include "fl/remote/transport/serial.h"
+#include "fl/stl/json.h"
+#include "fl/stl/span.h"
+#include "fl/stl/vector.h"
+
+FL_TEST_FILE(FL_FILEPATH) {
+
+namespace {
+
+// {"method": method, "params": [...written by fn...], "id": id}
+template <typename ParamsFn>
+fl::vector<fl::u8> makeMsgPackRequest(const char* method, fl::size paramCount,
+                                      ParamsFn writeParams, int id = 1) {
+    fl::MsgPackWriter w;
+    w.writeMapHeader(id >= 0 ? 3 : 2);
+    w.writeString("method");
+    w.writeString(method);
+    w.writeString("params");
+    w.writeArrayHeader(paramCount);
+    writeParams(w);
+    if (id >= 0) {
+        w.writeString("id");
+        w.writeInt(id);
+    }
+    return w.buffer();
+}
+
+fl::json decodeResponse(const fl::vector<fl::u8>& bytes) {
+    fl::json out;
+    fl::MsgPackReader r(bytes);
+    FL_REQUIRE(r.readJson(&out));
+    FL_CHECK(r.atEnd());
+    return out;
+}
+
+struct MockSerialIn {
+    fl::vector<fl::u8> data;
+    fl::size pos = 0;
+    int peek() { return pos < data.size() ? data[pos] : -1; }
+    int read() { return pos < data.size() ? data[pos++] : -1; }
+};
+
+} // namespace
+
+FL_TEST_CASE("MsgPack: writer/reader round trip") {
+    fl::MsgPackWriter w;
+    w.writeNil();
+    w.writeBool(true);
+    w.writeInt(5);
+    w.writeInt(-33);
+    w.writeInt(70000);
+    w.writeInt(-5000000000LL);
+    w.writeFloat(1.5f);
+    w.writeString("hello");
+    const fl::u8 blob[] = {1, 2, 3, 255};
+    w.writeBinary(blob);
+    w.writeArrayHeader(2);
+    w.writeInt(1);
+    w.writeString("x");
+
+    // Compact encodings
+    FL_CHECK_EQ(w.buffer()[0], 0xC0);
+    FL_CHECK_EQ(w.buffer()[1], 0xC3);
+    FL_CHECK_EQ(w.buffer()[2], 0x05);
+
+    fl::MsgPackReader r(w.data());
+    FL_CHECK(r.readNil());
+    bool b = false;
+    FL_CHECK(r.readBool(&b));
+    FL_CHECK(b);
+    fl::i64 i = 0;
+    FL_CHECK(r.readInt(&i));
+    FL_CHECK_EQ(i, 5);
+    FL_CHECK(r.readInt(&i));
+    FL_CHECK_EQ(i, -33);
+    FL_CHECK(r.readInt(&i));
+    FL_CHECK_EQ(i, 70000);
+    FL_CHECK(r.readInt(&i));
+    FL_CHECK_EQ(i, -5000000000LL);
+    double d = 0;
+    FL_CHECK_FALSE(r.readInt(&i));  // type mismatch leaves the cursor alone
+    FL_CHECK(r.readFloat(&d));
+    FL_CHECK_EQ(d, 1.5);
+    fl::string_view s;
+    FL_CHECK(r.readString(&s));
+    FL_CHECK(s == fl::string_view("hello"));
+    fl::span<const fl::u8> bytes;
+    FL_CHECK(r.readBinary(&bytes));
+    FL_REQUIRE_EQ(bytes.size(), 4u);
+    FL_CHECK_EQ(bytes[3], 255);
+    // Zero-copy: the span points into the encoded buffer
+    FL_CHECK(bytes.data() > w.data().data());
+    FL_CHECK(bytes.data() < w.data().data() + w.size());
+    fl::json arr;
+    FL_CHECK(r.readJson(&arr));
+    FL_REQUIRE(arr.is_array());
+    FL_CHECK_EQ(arr[1].as_string().value(), "x");
+    FL_CHECK(r.atEnd());
+    FL_CHECK(r.peekType() == fl::MsgPackReader::Type::Invalid);
+}
+
+FL_TEST_CASE("MsgPack: json conversion and truncated input") {
+    fl::json obj = fl::json::object();
+    obj.set("name", "strip");
+    obj.set("count", 3);
+    obj.set("on", true);
+    fl::MsgPackWriter w;
+    w.writeJson(obj);
+
+    fl::json back = decodeResponse(w.buffer());
+    FL_CHECK_EQ(back["name"].as_string().value(), "strip");
+    FL_CHECK_EQ(back["count"].as_int().value(), 3);
+    FL_CHECK(back["on"].is_bool());
+
+    fl::vector<fl::u8> truncated = w.buffer();
+    truncated.pop_back();
+    fl::MsgPackReader r(truncated);
+    fl::json out;
+    FL_CHECK_FALSE(r.readJson(&out));
+    FL_CHECK_FALSE(r.skip());
+    FL_CHECK_EQ(r.position(), 0u);
+}
+
+FL_TEST_CASE("MsgPack: Rpc binds typed arguments and byte spans from the wire") {
+    fl::Rpc rpc;
+    const fl::u8* seenData = nullptr;
+    fl::size seenSize = 0;
+    int seenOffset = -1;
+    rpc.bind("leds.write", [&](int offset, fl::span<const fl::u8> rgb) {
+        seenOffset = offset;
+        seenData = rgb.data();
+        seenSize = rgb.size();
+        return static_cast<int>(rgb.size() / 3);
+    });
+    FL_CHECK(rpc.bindsMsgPackDirectly("leds.write"));
+    FL_CHECK_FALSE(rpc.bindsMsgPackDirectly("missing"));
+
+    fl::vector<fl::u8> pixels(30, 0x7F);
+    fl::vector<fl::u8> request = makeMsgPackRequest("leds.write", 2, [&](fl::MsgPackWriter& w) {
+        w.writeInt(4);
+        w.writeBinary(pixels);
+    }, 9);
+
+    fl::vector<fl::u8> response;
+    FL_REQUIRE(rpc.handleMsgPack(request, &response));
+    FL_CHECK_EQ(seenOffset, 4);
+    FL_CHECK_EQ(seenSize, 30u);
+    // The handler saw the request frame itself, not a copy
+    FL_CHECK(seenData >= request.data());
+    FL_CHECK(seenData < request.data() + request.size());
+
+    fl::json decoded = decodeResponse(response);
+    FL_CHECK_EQ(decoded["id"].as_int().value(), 9);
+    FL_CHECK_EQ(decoded["result"].as_int().value(), 10);
+    FL_CHECK_FALSE(decoded.contains("jsonrpc"));
+}
+
+FL_TEST_CASE("MsgPack: Rpc reports warnings, errors and notifications") {
+    fl::Rpc rpc;
+    int last = 0;
+    rpc.bind("set", [&last](int v) { last = v; });
+
+    FL_SUBCASE("float truncation is a warning") {
+        fl::vector<fl::u8> request = makeMsgPackRequest("set", 1, [](fl::MsgPackWriter& w) {
+            w.writeFloat(2.5f);
+        });
+        fl::vector<fl::u8> response;
+        FL_REQUIRE(rpc.handleMsgPack(request, &response));
+        FL_CHECK_EQ(last, 2);
+        fl::json decoded = decodeResponse(response);
+        FL_CHECK(decoded["result"].is_null());
+        FL_REQUIRE(decoded.contains("warnings"));
+        FL_CHECK_EQ(decoded["warnings"].size(), 1u);
+    }
+
+    FL_SUBCASE("wrong type is an invalid params error") {
+        fl::vector<fl::u8> request = makeMsgPackRequest("set", 1, [](fl::MsgPackWriter& w) {
+            w.writeString("nope");
+        });
+        fl::vector<fl::u8> response;
+        FL_REQUIRE(rpc.handleMsgPack(request, &response));
+        fl::json decoded = decodeResponse(response);
+        FL_CHECK_EQ(decoded["id"].as_int().value(), 1);
+        FL_CHECK_FALSE(decoded.contains("result"));
+        FL_CHECK_EQ(decoded["error"]["code"].as_int().value(), -32602);
+    }
+
+    FL_SUBCASE("unknown method goes through the JSON semantics") {
+        fl::vector<fl::u8> request = makeMsgPackRequest("missing", 0, [](fl::MsgPackWriter&) {});
+        fl::vector<fl::u8> response;
+        FL_REQUIRE(rpc.handleMsgPack(request, &response));
+        fl::json decoded = decodeResponse(response);
+        FL_CHECK_EQ(decoded["error"]["code"].as_int().value(), -32601);
+    }
+
+    FL_SUBCASE("notifications get no reply") {
+        fl::vector<fl::u8> request = makeMsgPackRequest("set", 1, [](fl::MsgPackWriter& w) {
+            w.writeInt(7);
+        }, -1);
+        fl::vector<fl::u8> response;
+        FL_CHECK_FALSE(rpc.handleMsgPack(request, &response));
+        FL_CHECK_EQ(last, 7);
+    }
+
+    FL_SUBCASE("malformed envelope") {
+        fl::MsgPackWriter w;
+        w.writeArrayHeader(0);
+        fl::vector<fl::u8> response;
+        FL_REQUIRE(rpc.handleMsgPack(w.data(), &response));
+        fl::json decoded = decodeResponse(response);
+        FL_CHECK_EQ(decoded["error"]["code"].as_int().value(), -32600);
+    }
+}
+
+FL_TEST_CASE("MsgPack: array counts larger than the frame are rejected") {
+    // array32 header claiming 2^32-1 elements with nothing behind it
+    fl::MsgPackWriter w;
+    w.writeArrayHeader(0xFFFFFFFFu);
+
+    fl::MsgPackReader ints(w.data());
+    auto intResult = fl::detail::MsgPackToType<fl::vector<int>>::convert(ints);
+    FL_CHECK(fl::get<1>(intResult).hasError());
+    FL_CHECK(fl::get<0>(intResult).empty());
+
+    fl::MsgPackReader bytes(w.data());
+    auto byteResult = fl::detail::MsgPackToType<fl::vector<fl::u8>>::convert(bytes);
+    FL_CHECK(fl::get<1>(byteResult).hasError());
+    FL_CHECK(fl::get<0>(byteResult).empty());
+}
+
+FL_TEST_CASE("MsgPack: rpc.encodings advertises the binary framing") {
+    fl::Rpc rpc;
+    fl::json request = fl::json::object();
+    request.set("method", "rpc.encodings");
+    request.set("id", 1);
+
+    fl::json response = rpc.handle(request);
+    FL_REQUIRE(response["result"].is_array());
+    FL_CHECK_EQ(response["result"].size(), 1u);
+
+    rpc.setMsgPackEnabled(true);
+    response = rpc.handle(request);
+    FL_REQUIRE_EQ(response["result"].size(), 2u);
+    FL_CHECK_EQ(response["result"][1].as_string().value(), "msgpack");
+}
+
+FL_TEST_CASE("MsgPack: Remote pulls frames from a binary transport") {
+    fl::vector<fl::vector<fl::u8>> incoming;
+    fl::vector<fl::vector<fl::u8>> outgoing;
+    fl::Remote remote(
+        []() -> fl::optional<fl::json> { return fl::nullopt; },
+        [](const fl::json&) {});
+    remote.setMsgPackTransport(
+        [&incoming]() -> fl::optional<fl::vector<fl::u8>> {
+            if (incoming.empty()) return fl::nullopt;
+            fl::vector<fl::u8> frame = incoming[0];
+            incoming.erase(incoming.begin());
+            return frame;
+        },
+        [&outgoing](fl::span<const fl::u8> bytes) {
+            outgoing.push_back(fl::vector<fl::u8>(bytes.begin(), bytes.end()));
+        });
+
+    fl::size total = 0;
+    remote.bind("sum", [&total](fl::span<const fl::u8> bytes) {
+        for (fl::size i = 0; i < bytes.size(); i++) total += bytes[i];
+        return static_cast<int>(total);
+    });
+
+    const fl::u8 data[] = {1, 2, 3};
+    incoming.push_back(makeMsgPackRequest("sum", 1, [&](fl::MsgPackWriter& w) {
+        w.writeBinary(data);
+    }, 5));
+    remote.update(0);
+
+    FL_CHECK_EQ(total, 6u);
+    FL_REQUIRE_EQ(outgoing.size(), 1u);
+    fl::json decoded = decodeResponse(outgoing[0]);
+    FL_CHECK_EQ(decoded["id"].as_int().value(), 5);
+    FL_CHECK_EQ(decoded["result"].as_int().value(), 6);
+}
+
+FL_TEST_CASE("MsgPack: serial framing") {
+    const fl::u8 payload[] = {0x81, 0xA1, 'a', 0x01};
+    fl::vector<fl::u8> frame = fl::formatMsgPackFrame(payload);
+    FL_REQUIRE_EQ(frame.size(), 9u);
+    FL_CHECK_EQ(frame[0], fl::kSerialMsgPackMarker);
+    FL_CHECK_EQ(frame[4], 4);
+
+    FL_SUBCASE("frame is read back") {
+        MockSerialIn in;
+        in.data = frame;
+        fl::optional<fl::vector<fl::u8>> got = fl::readSerialMsgPackFrame(in, 1024);
+        FL_REQUIRE(got.has_value());
+        FL_CHECK(*got == fl::vector<fl::u8>(payload, payload + 4));
+        FL_CHECK_EQ(in.pos, frame.size());
+    }
+
+    FL_SUBCASE("JSON lines are left alone") {
+        MockSerialIn in;
+        in.data.push_back('{');
+        FL_CHECK_FALSE(fl::readSerialMsgPackFrame(in, 1024).has_value());
+        FL_CHECK_EQ(in.pos, 0u);
+    }
+
+    FL_SUBCASE("oversized frames are dropped up to the next line") {
+        MockSerialIn in;
+        in.data = frame;
+        in.data.push_back('\n');
+        in.data.push_back('{');
+        FL_CHECK_FALSE(fl::readSerialMsgPackFrame(in, 2).has_value());
+        FL_CHECK_EQ(in.pos, frame.size() + 1);
+    }
+
+    FL_SUBCASE("corrupted length is rejected without waiting") {
+        MockSerialIn in;
+        const fl::u8 bad[] = {fl::kSerialMsgPackMarker, 0xFF, 0xFF, 0xFF, 0xFF, 'x', 'y'};
+        in.data.assign(bad, bad + sizeof(bad));
+        in.data.insert(in.data.end(), frame.begin(), frame.end());
+        fl::u32 start = fl::millis();
+        FL_CHECK_FALSE(fl::readSerialMsgPackFrame(in, 1024, 500).has_value());
+        FL_CHECK_LT(fl::millis() - start, 500u);
+        // Resynchronised on the next marker
+        FL_CHECK_EQ(in.pos, sizeof(bad));
+        fl::optional<fl::vector<fl::u8>> got = fl::readSerialMsgPackFrame(in, 1024);
+        FL_REQUIRE(got.has_value());
+        FL_CHECK(*got == fl::vector<fl::u8>(payload, payload + 4));
+    }
+}
+
+} // FL_TEST_FILE
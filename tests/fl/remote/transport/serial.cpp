@@ -36,6 +36,25 @@ FL_TEST_CASE("Serial: createSerialRequestSource - basic JSON") {
     FL_REQUIRE(result->contains("id"));
 }
 
+FL_TEST_CASE("Serial: createSerialRequestSource - stray MessagePack marker") {
+    // JSON-only remote: nothing would ever consume the marker, so it must
+    // not block the line behind it
+    fl::string input = "\xC1{\"method\":\"test\",\"params\":[],\"id\":1}\n";
+    fl::size pos = 0;
+    fl::inject_available_handler([&]() { return static_cast<int>(input.size() - pos); });
+    fl::inject_read_handler([&]() {
+        return pos < input.size() ? static_cast<int>(static_cast<fl::u8>(input[pos++])) : -1;
+    });
+
+    auto requestSource = fl::createSerialRequestSource();
+    fl::optional<fl::json> request = requestSource();
+    fl::clear_io_handlers();
+
+    FL_REQUIRE(request.has_value());
+    FL_CHECK_EQ(request->operator[]("method").as_string().value(), fl::string("test"));
+    FL_CHECK_EQ(pos, input.size());
+}
+
 FL_TEST_CASE("Serial: String view prefix stripping - zero copy") {
     // Test that prefix stripping using string_view is zero-copy
     fl::string input = "PREFIX: {\"method\":\"test\",\"params\":[]}";
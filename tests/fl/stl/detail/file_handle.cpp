@@ -189,4 +189,40 @@ FL_TEST_CASE("posix_filebuf path() for default constructed") {
     FL_CHECK_EQ(fl::string(fh.path()), fl::string(""));
 }
 
+FL_TEST_CASE("filebuf::read_at() default seeks and reads") {
+    FilebufTestGuard guard("test_fh_read_at");
+    fl::string path = guard.filePath("data.bin");
+    fl::StubFileSystem::createTextFile(path, "0123456789");
+
+    fl::detail::posix_filebuf fh(path.c_str(), "rb");
+    FL_REQUIRE(fh.is_open());
+    FL_CHECK(fh.mapped().empty());
+    char buf[4] = {};
+    FL_CHECK_EQ(fh.read_at(6, buf, 4), 4);
+    FL_CHECK_EQ(fl::string(buf, 4), fl::string("6789"));
+    FL_CHECK_EQ(fh.read_at(8, buf, 4), 2);
+}
+
+#ifndef FL_IS_WIN
+FL_TEST_CASE("StubFileHandle maps the file for positional reads") {
+    FilebufTestGuard guard("test_fh_mapped");
+    fl::string path = guard.filePath("data.bin");
+    fl::StubFileSystem::createTextFile(path, "0123456789");
+
+    fl::StubFileHandle fh(path);
+    FL_REQUIRE(fh.is_open());
+    fl::span<const fl::u8> map = fh.mapped();
+    FL_REQUIRE_EQ(map.size(), 10);
+    FL_CHECK_EQ(map[3], '3');
+
+    char buf[3] = {};
+    FL_CHECK_EQ(fh.read_at(2, buf, 3), 3);
+    FL_CHECK_EQ(fl::string(buf, 3), fl::string("234"));
+    FL_CHECK_EQ(fh.tell(), 0);  // Mapped reads leave the position alone.
+
+    fh.close();
+    FL_CHECK(fh.mapped().empty());
+}
+#endif
+
 } // FL_TEST_FILE
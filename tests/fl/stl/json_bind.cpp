@@ -0,0 +1,161 @@
+#include "test.h"
+
+#include "fl/stl/json_bind.h"
+#include "fl/stl/string.h"
+#include "fl/stl/string_view.h"
+#include "fl/stl/vector.h"
+
+namespace {
+
+struct Segment {
+    int start = 0;
+    int stop = 0;
+};
+
+struct Preset {
+    fl::string name;
+    int bri = 0;
+    bool on = false;
+    float speed = 0.0f;
+    fl::vector<Segment> seg;
+    fl::vector<fl::u8> col;
+};
+
+} // namespace
+
+namespace fl {
+
+template <>
+struct JsonFields<Segment> {
+    template <typename V>
+    static void visit(Segment& s, V& v) {
+        v("start", s.start);
+        v("stop", s.stop);
+    }
+};
+
+template <>
+struct JsonFields<Preset> {
+    template <typename V>
+    static void visit(Preset& p, V& v) {
+        v("n", p.name);
+        v("bri", p.bri);
+        v("on", p.on);
+        v("sx", p.speed);
+        v("seg", p.seg);
+        v("col", p.col);
+    }
+};
+
+} // namespace fl
+
+FL_TEST_FILE(FL_FILEPATH) {
+
+using Event = fl::JsonReader::Event;
+
+namespace {
+
+const char* kPreset =
+    "{\"n\":\"Sunset\",\"bri\":200,\"ignored\":{\"deep\":[1,2,{\"x\":null}]},"
+    "\"on\":true,\"sx\":0.5,\"seg\":[{\"start\":0,\"stop\":30},{\"stop\":60,\"start\":30}],"
+    "\"col\":[255,128,0],\"extra\":\"skip me\"}";
+
+void checkPreset(const Preset& p) {
+    FL_CHECK_EQ(p.name, fl::string("Sunset"));
+    FL_CHECK_EQ(p.bri, 200);
+    FL_CHECK(p.on);
+    FL_CHECK_EQ(p.speed, 0.5f);
+    FL_REQUIRE_EQ(p.seg.size(), 2u);
+    FL_CHECK_EQ(p.seg[1].start, 30);
+    FL_CHECK_EQ(p.seg[1].stop, 60);
+    FL_REQUIRE_EQ(p.col.size(), 3u);
+    FL_CHECK_EQ(p.col[1], 128);
+}
+
+} // namespace
+
+FL_TEST_CASE("JsonBinder: struct from a complete document") {
+    Preset preset;
+    const char* error = nullptr;
+    FL_REQUIRE(fl::JsonBinder::parse(kPreset, preset, &error));
+    checkPreset(preset);
+}
+
+FL_TEST_CASE("JsonBinder: struct from chunked input") {
+    const fl::string_view doc(kPreset);
+    for (fl::size chunk = 1; chunk <= 7; chunk++) {
+        FL_CAPTURE(chunk);
+        Preset preset;
+        fl::JsonReader reader;
+        fl::JsonBinder binder(preset);
+        for (fl::size pos = 0; pos < doc.size(); pos += chunk) {
+            reader.feed(doc.substr(pos, fl::min(chunk, doc.size() - pos)));
+            FL_REQUIRE(binder.pump(reader) == Event::NeedInput);
+        }
+        reader.finish();
+        FL_REQUIRE(binder.pump(reader) == Event::End);
+        checkPreset(preset);
+    }
+}
+
+FL_TEST_CASE("JsonBinder: JsonEach walks an array without storing it") {
+    int count = 0;
+    int lastStop = 0;
+    fl::JsonEach<Segment> each([&](Segment& s) {
+        count++;
+        lastStop = s.stop;
+    });
+    FL_REQUIRE(fl::JsonBinder::parse("[{\"start\":0,\"stop\":5},{\"stop\":9},null]", each));
+    FL_CHECK_EQ(count, 3);
+    FL_CHECK_EQ(lastStop, 0);  // null element leaves a default-constructed item
+
+    fl::vector<fl::vector<int>> grid;
+    FL_REQUIRE(fl::JsonBinder::parse("[[1,2],[],[3]]", grid));
+    FL_REQUIRE_EQ(grid.size(), 3u);
+    FL_CHECK_EQ(grid[0][1], 2);
+    FL_CHECK(grid[1].empty());
+    FL_CHECK_EQ(grid[2][0], 3);
+}
+
+FL_TEST_CASE("JsonBinder: type mismatches and syntax errors") {
+    const char* error = nullptr;
+    Preset preset;
+    FL_CHECK_FALSE(fl::JsonBinder::parse("{\"bri\":\"high\"}", preset, &error));
+    FL_CHECK_EQ(fl::string(error), fl::string("type mismatch"));
+    FL_CHECK_FALSE(fl::JsonBinder::parse("{\"seg\":{}}", preset, &error));
+    FL_CHECK_FALSE(fl::JsonBinder::parse("[1]", preset, &error));
+    FL_CHECK_FALSE(fl::JsonBinder::parse("{\"bri\":1", preset, &error));
+    FL_CHECK_EQ(fl::string(error), fl::string("unexpected end of input"));
+}
+
+FL_TEST_CASE("JsonBinder: integers out of range or fractional are rejected") {
+    const char* error = nullptr;
+    fl::vector<fl::u8> bytes;
+    FL_CHECK(fl::JsonBinder::parse("[0,255,2.0,1e2]", bytes, &error));
+    FL_REQUIRE_EQ(bytes.size(), 4u);
+    FL_CHECK_EQ(bytes[2], 2);
+    FL_CHECK_EQ(bytes[3], 100);
+
+    const char* bad[] = {"[256]", "[-1]", "[1.5]", "[3e2]", "[-0.5]"};
+    for (const char* doc : bad) {
+        FL_CAPTURE(doc);
+        fl::vector<fl::u8> out;
+        FL_CHECK_FALSE(fl::JsonBinder::parse(doc, out, &error));
+        FL_CHECK_EQ(fl::string(error), fl::string("type mismatch"));
+    }
+
+    fl::vector<fl::i8> small;
+    FL_CHECK(fl::JsonBinder::parse("[-128,127]", small));
+    FL_CHECK_FALSE(fl::JsonBinder::parse("[-129]", small));
+
+    fl::vector<int> ints;
+    FL_CHECK_FALSE(fl::JsonBinder::parse("[4294967296]", ints));
+
+    fl::vector<fl::u64> wide;
+    FL_REQUIRE(fl::JsonBinder::parse("[1e19]", wide));  // beyond i64
+    FL_CHECK_EQ(wide[0], 10000000000000000000ull);
+    FL_CHECK_FALSE(fl::JsonBinder::parse("[2e19]", wide));
+    FL_CHECK_FALSE(fl::JsonBinder::parse("[-1]", wide));
+}
+
+} // FL_TEST_FILE
@@ -0,0 +1,147 @@
+#include "test.h"
+
+#include "fl/stl/json_reader.h"
+#include "fl/stl/string.h"
+#include "fl/stl/string_view.h"
+#include "fl/stl/vector.h"
+
+FL_TEST_FILE(FL_FILEPATH) {
+
+using fl::JsonReader;
+using Event = fl::JsonReader::Event;
+
+namespace {
+
+// Feed `doc` in pieces of `chunk` bytes and describe every event, e.g.
+// "{ k:a s:x n:1 b:1 ~ }" (~ = null). Stops at End or Error.
+fl::string readAll(const char* doc, fl::size chunk, Event* last = nullptr) {
+    const fl::string_view text(doc);
+    JsonReader reader;
+    fl::string out;
+    fl::size pos = 0;
+    for (;;) {
+        const Event e = reader.next();
+        if (e == Event::NeedInput) {
+            if (pos >= text.size()) {
+                reader.finish();
+            } else {
+                const fl::size n = fl::min(chunk, text.size() - pos);
+                reader.feed(text.substr(pos, n));
+                pos += n;
+            }
+            continue;
+        }
+        if (last) *last = e;
+        if (e == Event::End || e == Event::Error) break;
+        if (!out.empty()) out += " ";
+        switch (e) {
+        case Event::BeginObject: out += "{"; break;
+        case Event::EndObject: out += "}"; break;
+        case Event::BeginArray: out += "["; break;
+        case Event::EndArray: out += "]"; break;
+        case Event::Key: out += "k:"; out += fl::string(reader.text()); break;
+        case Event::String: out += "s:"; out += fl::string(reader.text()); break;
+        case Event::Number: out += "n:"; out += fl::string(reader.text()); break;
+        case Event::Bool: out += reader.boolValue() ? "b:1" : "b:0"; break;
+        case Event::Null: out += "~"; break;
+        default: break;
+        }
+    }
+    return out;
+}
+
+const char* kDoc =
+    "{\"name\": \"lamp \\\"A\\\"\", \"on\": true, \"off\": false, \"none\": null,"
+    " \"bri\": 128, \"scale\": -1.5e2, \"seg\": [1, [2, 3], {}], \"u\": \"\\u00e9\\ud83d\\ude00\"}";
+
+const char* kEvents =
+    "{ k:name s:lamp \"A\" k:on b:1 k:off b:0 k:none ~ k:bri n:128 k:scale n:-1.5e2"
+    " k:seg [ n:1 [ n:2 n:3 ] { } ] k:u s:\xC3\xA9\xF0\x9F\x98\x80 }";
+
+} // namespace
+
+FL_TEST_CASE("JsonReader: events for a whole document") {
+    Event last = Event::Error;
+    FL_CHECK_EQ(readAll(kDoc, 1024, &last), fl::string(kEvents));
+    FL_CHECK(last == Event::End);
+}
+
+FL_TEST_CASE("JsonReader: any chunk split gives the same events") {
+    for (fl::size chunk = 1; chunk <= 9; chunk++) {
+        FL_CAPTURE(chunk);
+        Event last = Event::Error;
+        FL_CHECK_EQ(readAll(kDoc, chunk, &last), fl::string(kEvents));
+        FL_CHECK(last == Event::End);
+    }
+    // A top-level number is only terminated by finish()
+    FL_CHECK_EQ(readAll("12345", 2), fl::string("n:12345"));
+}
+
+FL_TEST_CASE("JsonReader: strings without escapes are not copied") {
+    const char* doc = "[\"abc\"]";
+    JsonReader reader;
+    reader.feed(fl::string_view(doc));
+    reader.finish();
+    FL_CHECK(reader.next() == Event::BeginArray);
+    FL_REQUIRE(reader.next() == Event::String);
+    FL_CHECK(reader.text().data() == doc + 2);
+}
+
+FL_TEST_CASE("JsonReader: numbers") {
+    JsonReader reader;
+    reader.feed(fl::string_view("[42, -9223372036854775808, 1.25, 3e2, 99999999999999999999]"));
+    reader.finish();
+    fl::i64 v = 0;
+    FL_CHECK(reader.next() == Event::BeginArray);
+    FL_CHECK(reader.next() == Event::Number);
+    FL_CHECK(reader.intValue(&v));
+    FL_CHECK_EQ(v, 42);
+    FL_CHECK(reader.next() == Event::Number);
+    FL_CHECK(reader.intValue(&v));
+    FL_CHECK(v == fl::numeric_limits<fl::i64>::min());
+    FL_CHECK(reader.next() == Event::Number);
+    FL_CHECK_FALSE(reader.intValue(&v));
+    FL_CHECK_EQ(reader.floatValue(), 1.25);
+    FL_CHECK(reader.next() == Event::Number);
+    FL_CHECK_FALSE(reader.intValue(&v));
+    FL_CHECK_EQ(reader.floatValue(), 300.0);
+    FL_CHECK(reader.next() == Event::Number);
+    FL_CHECK_FALSE(reader.intValue(&v));  // overflow
+}
+
+FL_TEST_CASE("JsonReader: skip() drops a container across chunks") {
+    JsonReader reader;
+    reader.feed(fl::string_view("{\"big\": [1, {\"x\": [2, 3]"));
+    FL_CHECK(reader.next() == Event::BeginObject);
+    FL_CHECK(reader.next() == Event::Key);
+    FL_CHECK(reader.next() == Event::BeginArray);
+    reader.skip();
+    FL_CHECK(reader.next() == Event::NeedInput);
+    reader.feed(fl::string_view("}, 4], \"keep\": 5}"));
+    reader.finish();
+    FL_REQUIRE(reader.next() == Event::Key);
+    FL_CHECK(reader.text() == "keep");
+    FL_CHECK(reader.next() == Event::Number);
+    FL_CHECK(reader.next() == Event::EndObject);
+    FL_CHECK(reader.next() == Event::End);
+}
+
+FL_TEST_CASE("JsonReader: malformed input") {
+    const char* bad[] = {
+        "{\"a\" 1}", "[1,]", "[1 2]", "{\"a\":1]", "[tru]", "[01.]",
+        "\"open", "[1", "{} {}", "{a:1}", "[\"\\q\"]", "",
+    };
+    for (const char* doc : bad) {
+        FL_CAPTURE(doc);
+        Event last = Event::End;
+        readAll(doc, 3, &last);
+        FL_CHECK(last == Event::Error);
+    }
+
+    fl::string deep(JsonReader::kMaxDepth + 1, '[');
+    Event last = Event::End;
+    readAll(deep.c_str(), 64, &last);
+    FL_CHECK(last == Event::Error);
+}
+
+} // FL_TEST_FILE
@@ -0,0 +1,330 @@
+#include "fl/stl/memory_resource.h"
+#include "fl/stl/json.h"
+#include "fl/stl/shared_ptr.h"
+#include "fl/stl/string.h"
+#include "fl/stl/vector.h"
+#include "fl/system/frame_arena.h"
+#include "test.h"
+
+FL_TEST_FILE(FL_FILEPATH) {
+
+namespace memory_resource_test {
+
+using namespace fl;
+
+// Upstream that counts outstanding bytes so tests can see what reached it.
+class CountingResource : public memory_resource {
+  public:
+    fl::size liveBytes = 0;
+    fl::size allocations = 0;
+
+  protected:
+    void* do_allocate(fl::size bytes) override {
+        liveBytes += bytes;
+        ++allocations;
+        return default_memory_resource()->allocate(bytes);
+    }
+    void do_deallocate(void* p, fl::size bytes) override {
+        liveBytes -= bytes;
+        default_memory_resource()->deallocate(p, bytes);
+    }
+};
+
+// Upstream with nothing to give, so a bounded arena really runs out.
+class EmptyResource : public memory_resource {
+  protected:
+    void* do_allocate(fl::size) override { return nullptr; }
+    void do_deallocate(void*, fl::size) override {}
+};
+
+bool isAligned(const void* p) {
+    return (reinterpret_cast<fl::uptr>(p) % alignof(fl::max_align_t)) == 0;  // ok reinterpret cast
+}
+
+FL_TEST_CASE("monotonic_buffer_resource bumps, rolls back the tail and releases") {
+    CountingResource upstream;
+    {
+        monotonic_buffer_resource mono(&upstream);
+        void* a = mono.allocate(3);
+        void* b = mono.allocate(10);
+        FL_CHECK(isAligned(a));
+        FL_CHECK(isAligned(b));
+        FL_CHECK(a != b);
+        FL_CHECK_EQ(upstream.allocations, 1u);
+
+        // Freeing the most recent block hands its bytes straight back.
+        mono.deallocate(b, 10);
+        void* c = mono.allocate(10);
+        FL_CHECK(c == b);
+
+        // Growing the tail allocation happens in place.
+        FL_CHECK(mono.reallocate(c, 10, 40) == c);
+        // A non-tail block cannot move the cursor.
+        FL_CHECK(mono.reallocate(a, 3, 64) == nullptr);
+
+        // Exhaust the first chunk; the next one comes from upstream.
+        for (int i = 0; i < 64; ++i) {
+            mono.allocate(64);
+        }
+        FL_CHECK(upstream.allocations > 1u);
+        mono.release();
+        FL_CHECK_EQ(upstream.liveBytes, 0u);
+        FL_CHECK_EQ(mono.bytes_used(), 0u);
+    }
+    FL_CHECK_EQ(upstream.liveBytes, 0u);
+}
+
+FL_TEST_CASE("monotonic_buffer_resource serves a caller buffer before upstream") {
+    CountingResource upstream;
+    alignas(fl::max_align_t) char buffer[256];
+    monotonic_buffer_resource mono(buffer, sizeof(buffer), &upstream);
+    void* p = mono.allocate(100);
+    FL_CHECK(p >= static_cast<void*>(buffer));
+    FL_CHECK(p < static_cast<void*>(buffer + sizeof(buffer)));
+    FL_CHECK_EQ(upstream.allocations, 0u);
+    mono.allocate(200);
+    FL_CHECK_EQ(upstream.allocations, 1u);
+    mono.release();
+    // After release the caller buffer is reused from the start.
+    FL_CHECK(mono.allocate(100) == p);
+}
+
+FL_TEST_CASE("unsynchronized_pool_resource recycles blocks per size class") {
+    CountingResource upstream;
+    pool_options opts;
+    opts.largest_required_pool_block = 100;  // rounds up to 128
+    unsynchronized_pool_resource pool(opts, &upstream);
+    FL_CHECK_EQ(pool.options().largest_required_pool_block, 128u);
+
+    void* a = pool.allocate(24);
+    void* b = pool.allocate(24);
+    FL_CHECK(a != b);
+    const fl::size chunks = upstream.allocations;
+    pool.deallocate(a, 24);
+    // 17..32 bytes share a class, so the freed block comes straight back.
+    FL_CHECK(pool.allocate(30) == a);
+    FL_CHECK_EQ(upstream.allocations, chunks);
+
+    // Same class: realloc is a no-op; different class: caller must move.
+    FL_CHECK(pool.reallocate(b, 24, 32) == b);
+    FL_CHECK(pool.reallocate(b, 24, 64) == nullptr);
+
+    // Oversized requests bypass the pools and are tracked for release().
+    void* big = pool.allocate(1000);
+    FL_CHECK(big != nullptr);
+    FL_CHECK(isAligned(big));
+    void* big2 = pool.allocate(2000);
+    pool.deallocate(big, 1000);
+    (void)big2;
+    pool.release();
+    FL_CHECK_EQ(upstream.liveBytes, 0u);
+}
+
+FL_TEST_CASE("frame_arena_resource rewinds in O(1) and grows to the peak") {
+    CountingResource upstream;
+    frame_arena_resource arena(64, &upstream);
+    FL_CHECK_EQ(arena.capacity(), 64u);
+
+    void* first = arena.allocate(16);
+    arena.allocate(16);
+    arena.reset();
+    // Steady state: same memory handed out again, no upstream traffic.
+    const fl::size before = upstream.allocations;
+    FL_CHECK(arena.allocate(16) == first);
+    FL_CHECK_EQ(upstream.allocations, before);
+    arena.reset();
+
+    // Overflow the primary block; the next reset resizes it.
+    for (int i = 0; i < 20; ++i) {
+        arena.allocate(32);
+    }
+    FL_CHECK(arena.peak() > 64u);
+    arena.reset();
+    FL_CHECK_EQ(arena.overflowFrames(), 1u);
+    FL_CHECK(arena.capacity() >= arena.lastFramePeak());
+    FL_CHECK_EQ(arena.peak(), 0u);
+    const fl::size afterGrow = upstream.allocations;
+    for (int i = 0; i < 20; ++i) {
+        arena.allocate(32);
+    }
+    arena.reset();
+    FL_CHECK_EQ(upstream.allocations, afterGrow);
+    FL_CHECK_EQ(arena.overflowFrames(), 1u);
+}
+
+FL_TEST_CASE("frame_arena_resource shrinks back after a spike") {
+    CountingResource upstream;
+    frame_arena_resource arena(64, &upstream);
+    for (int i = 0; i < 100; ++i) {
+        arena.allocate(64);
+    }
+    arena.reset();
+    const fl::size grown = arena.capacity();
+    FL_CHECK(grown > 4096u);
+
+    // Light frames: the block stays put until the quiet run is long enough.
+    for (fl::u32 f = 0; f + 1 < frame_arena_resource::kShrinkFrames; ++f) {
+        arena.allocate(16);
+        arena.reset();
+    }
+    FL_CHECK_EQ(arena.capacity(), grown);
+    arena.allocate(16);
+    arena.reset();
+    FL_CHECK_EQ(arena.capacity(), 64u);  // back to the initial capacity
+    FL_CHECK_EQ(upstream.liveBytes, 64u);
+
+    // A busy frame in the middle of a quiet run restarts it.
+    arena.allocate(1000);
+    arena.reset();
+    const fl::size regrown = arena.capacity();
+    for (fl::u32 f = 0; f < frame_arena_resource::kShrinkFrames / 2; ++f) {
+        arena.reset();
+    }
+    void* p = arena.allocate(regrown - 16);
+    FL_CHECK(p != nullptr);
+    arena.reset();
+    for (fl::u32 f = 0; f < frame_arena_resource::kShrinkFrames / 2 + 1; ++f) {
+        arena.reset();
+    }
+    FL_CHECK_EQ(arena.capacity(), regrown);
+}
+
+FL_TEST_CASE("frame_arena_resource resets on EngineEvents::onEndFrame") {
+    frame_arena_resource arena(256);
+    void* p = arena.allocate(32);
+    FL_CHECK(arena.used() > 0u);
+    EngineEvents::onEndFrame();
+#if FASTLED_HAS_ENGINE_EVENTS
+    FL_CHECK_EQ(arena.used(), 0u);
+    FL_CHECK(arena.allocate(32) == p);
+#else
+    (void)p;
+#endif
+}
+
+FL_TEST_CASE("make_shared_with_resource returns the block to the resource") {
+    CountingResource res;
+    {
+        shared_ptr<int> p = make_shared_with_resource<int>(&res, 42);
+        FL_CHECK_EQ(*p, 42);
+        FL_CHECK(res.liveBytes > 0u);
+        shared_ptr<int> q = p;
+        p.reset();
+        FL_CHECK(res.liveBytes > 0u);
+    }
+    FL_CHECK_EQ(res.liveBytes, 0u);
+}
+
+FL_TEST_CASE("fl::string spills to its memory_resource") {
+    CountingResource res;
+    {
+        fl::string s(fl::allocator_arg, &res);
+        FL_CHECK(s.get_resource() == &res);
+        s = "short";
+        FL_CHECK_EQ(res.liveBytes, 0u);  // fits inline
+        FL_CHECK(s.get_resource() == &res);
+        for (int i = 0; i < 10; ++i) {
+            s.append("0123456789");
+        }
+        FL_CHECK(res.liveBytes > 0u);
+        FL_CHECK_EQ(s.size(), 105u);
+
+        // A copy does not inherit the resource, and must not share a buffer
+        // that lives in it.
+        fl::string copy(s);
+        FL_CHECK(copy.get_resource() == nullptr);
+        FL_CHECK(copy == s);
+        FL_CHECK(copy.c_str() != s.c_str());
+
+        // A move carries the resource along.
+        fl::string moved(fl::move(s));
+        FL_CHECK(moved.get_resource() == &res);
+
+        // Dropping back to inline storage keeps it for the next spill.
+        moved = "tiny";
+        FL_CHECK(moved.get_resource() == &res);
+        fl::size before = res.liveBytes;
+        moved.append(copy);
+        FL_CHECK(res.liveBytes > before);
+    }
+    FL_CHECK_EQ(res.liveBytes, 0u);
+}
+
+FL_TEST_CASE("fl::string falls back to the heap when its resource runs out") {
+    EmptyResource empty;
+    alignas(fl::max_align_t) char buffer[256];
+    monotonic_buffer_resource arena(buffer, sizeof(buffer), &empty);
+
+    // Growing past the arena moves the content to the heap.
+    fl::string grown(fl::allocator_arg, &arena);
+    fl::string expected;
+    for (int i = 0; i < 40; ++i) {
+        grown.append("0123456789");
+        expected.append("0123456789");
+    }
+    FL_CHECK(grown == expected);
+    FL_CHECK(grown.get_resource() == &arena);
+
+    // Once the arena is full, new holders cannot even get a control block.
+    fl::string fresh(fl::allocator_arg, &arena);
+    fresh = expected;
+    FL_CHECK(fresh == expected);
+    fresh.append("!");
+    FL_CHECK_EQ(fresh.size(), expected.size() + 1);
+}
+
+FL_TEST_CASE("fl::string resource constructor is tagged") {
+    // A bare pointer or 0 still means "C string", not "memory resource".
+    fl::string fromNull(nullptr);
+    fl::string fromZero(0);
+    fl::string_n<8> small(nullptr);
+    FL_CHECK(fromNull.empty());
+    FL_CHECK(fromZero.empty());
+    FL_CHECK(small.empty());
+    FL_CHECK(fromNull.get_resource() == nullptr);
+}
+
+FL_TEST_CASE("fl::string without a resource pays nothing for the option") {
+    // The resource lives in the heap holder or the storage variant, not in
+    // a dedicated member.
+    FL_CHECK_EQ(sizeof(fl::basic_string),
+                3 * sizeof(fl::size) +
+                    sizeof(fl::variant<fl::NotNullStringHolderPtr,
+                                       fl::basic_string::ConstLiteral,
+                                       fl::basic_string::ConstView>));
+    fl::string plain("a string long enough to live on the heap, not inline, for sure......");
+    FL_CHECK(plain.get_resource() == nullptr);
+}
+
+FL_TEST_CASE("fl::vector and fl::json allocate from a resource") {
+    CountingResource res;
+    {
+        fl::vector<int> v(&res);
+        for (int i = 0; i < 100; ++i) {
+            v.push_back(i);
+        }
+        FL_CHECK(res.liveBytes >= 100 * sizeof(int));
+    }
+    FL_CHECK_EQ(res.liveBytes, 0u);
+
+    {
+        const fl::string text =
+            "{\"name\":\"a string that is definitely longer than the sixty-four byte inline buffer\","
+            "\"vals\":[1,2,3],\"nested\":{\"x\":1.5,\"list\":[\"p\",\"q\"]}}";
+        fl::json doc = fl::json::parse(text, &res);
+        FL_CHECK(res.allocations > 0u);
+        FL_CHECK(doc["name"].as_string().has_value());
+        FL_CHECK_EQ(doc["vals"].size(), 3u);
+        FL_CHECK_EQ(doc["nested"]["list"][1].as_string().value(), fl::string("q"));
+        FL_CHECK_EQ(doc.to_string(), fl::json::parse(text).to_string());
+
+        fl::json arr = fl::json::array(&res);
+        arr.push_back(fl::json(1));
+        FL_CHECK_EQ(arr.size(), 1u);
+    }
+    FL_CHECK_EQ(res.liveBytes, 0u);
+}
+
+} // namespace memory_resource_test
+
+} // FL_TEST_FILE
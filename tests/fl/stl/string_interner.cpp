@@ -206,4 +206,61 @@ FL_TEST_CASE("string::intern() - method chaining") {
     FL_CHECK(&result == &s);
 }
 
+FL_TEST_CASE("SymbolTable - interns to dense ids and resolves back") {
+    fl::SymbolTable table;
+    fl::Symbol a = table.intern("led.brightness");
+    fl::Symbol b = table.intern(fl::string_view("led.speed"));
+    fl::Symbol a2 = table.intern(fl::string("led.brightness").c_str());
+    FL_CHECK_EQ(a.id(), 1u);
+    FL_CHECK_EQ(b.id(), 2u);
+    FL_CHECK(a == a2);
+    FL_CHECK(a != b);
+    FL_CHECK_EQ(table.size(), 2u);
+
+    FL_CHECK(table.resolve(a) == fl::string_view("led.brightness"));
+    FL_CHECK(fl::strcmp(table.c_str(b), "led.speed") == 0);
+    FL_CHECK(table.find("led.speed") == b);
+    FL_CHECK(table.find("missing").empty());
+    FL_CHECK(table.contains("led.brightness"));
+
+    // The empty string is the null symbol.
+    FL_CHECK(table.intern("").empty());
+    FL_CHECK(table.resolve(fl::Symbol()).empty());
+    FL_CHECK(table.resolve(fl::Symbol(99)).empty());
+    FL_CHECK(fl::Hash<fl::Symbol>()(a) == fl::Hash<fl::Symbol>()(a2));
+}
+
+FL_TEST_CASE("SymbolTable - arena chunks keep resolved views stable") {
+    fl::SymbolTable table(64);
+    fl::Symbol first = table.intern("first_symbol");
+    const char* first_bytes = table.c_str(first);
+
+    char name[32];
+    for (int i = 0; i < 500; ++i) {
+        fl::snprintf(name, sizeof(name), "key_%d", i);
+        table.intern(name);
+    }
+    fl::string long_name(200, 'x');  // Larger than a chunk: own allocation
+    fl::Symbol big = table.intern(fl::string_view(long_name.c_str(), long_name.size()));
+    FL_CHECK_EQ(table.resolve(big).size(), 200u);
+
+    FL_CHECK(table.c_str(first) == first_bytes);
+    FL_CHECK(table.resolve(table.find("key_321")) == fl::string_view("key_321"));
+    FL_CHECK_EQ(table.size(), 502u);
+    // Packed: far fewer bytes than one allocation per string would cost.
+    FL_CHECK(table.arena_bytes() < 502u * 32u);
+
+    table.clear();
+    FL_CHECK(table.empty());
+    FL_CHECK_EQ(table.arena_bytes(), 0u);
+    FL_CHECK(table.find("key_1").empty());
+}
+
+FL_TEST_CASE("SymbolTable - global symbols") {
+    fl::Symbol s1 = fl::symbol("rpc.method.setBrightness");
+    fl::Symbol s2 = fl::symbol(fl::string_view("rpc.method.setBrightness"));
+    FL_CHECK(s1 == s2);
+    FL_CHECK(fl::symbol_name(s1) == fl::string_view("rpc.method.setBrightness"));
+}
+
 } // FL_TEST_FILE
@@ -0,0 +1,190 @@
+#include "fl/stl/swiss_map.h"
+#include "fl/math/simd/u8x16.h"
+#include "fl/stl/memory_resource.h"
+#include "fl/stl/shared_ptr.h"
+#include "fl/stl/string.h"
+#include "fl/stl/unordered_map.h"
+#include "test.h"
+
+FL_TEST_FILE(FL_FILEPATH) {
+
+namespace swiss_map_test {
+
+using namespace fl;
+
+class CountingResource : public memory_resource {
+  public:
+    fl::size liveBytes = 0;
+    fl::size allocations = 0;
+
+  protected:
+    void* do_allocate(fl::size bytes) override {
+        liveBytes += bytes;
+        ++allocations;
+        return default_memory_resource()->allocate(bytes);
+    }
+    void do_deallocate(void* p, fl::size bytes) override {
+        liveBytes -= bytes;
+        default_memory_resource()->deallocate(p, bytes);
+    }
+};
+
+// Every key lands in the same group with the same tag.
+struct CollidingHash {
+    u32 operator()(int) const { return 5; }
+};
+
+FL_TEST_CASE("match_u8_16 reports matching lanes as a bitmask") {
+    u8 bytes[16] = {};
+    bytes[0] = 7;
+    bytes[5] = 7;
+    bytes[15] = 7;
+    const simd::simd_u8x16 v = simd::load_u8_16(bytes);
+    FL_CHECK_EQ(simd::match_u8_16(v, 7), (1u << 0) | (1u << 5) | (1u << 15));
+    FL_CHECK_EQ(simd::match_u8_16(v, 0), 0xFFFFu & ~((1u << 0) | (1u << 5) | (1u << 15)));
+    FL_CHECK_EQ(simd::match_u8_16(v, 9), 0u);
+}
+
+FL_TEST_CASE("swiss_map basic insert, find and overwrite") {
+    swiss_map<int, int> m;
+    FL_CHECK(m.empty());
+    FL_CHECK_EQ(m.capacity(), 0u);  // Nothing allocated until the first insert
+    FL_CHECK(m.find(1) == m.end());
+
+    FL_CHECK(m.insert(1, 10).second);
+    FL_CHECK(m.insert(2, 20).second);
+    FL_CHECK_FALSE(m.insert(1, 11).second);  // Overwrites like unordered_map
+    FL_CHECK_EQ(m.size(), 2u);
+    FL_CHECK_EQ(*m.find_value(1), 11);
+    FL_CHECK_EQ(m.at(2), 20);
+    FL_CHECK(m.contains(2));
+    FL_CHECK_FALSE(m.contains(3));
+
+    m[3] = 30;
+    FL_CHECK_EQ(m[3], 30);
+    FL_CHECK_FALSE(m.try_emplace(3, 99).second);
+    FL_CHECK_EQ(m[3], 30);
+
+    int sum = 0;
+    for (const auto& kv : m) {
+        sum += kv.first;
+    }
+    FL_CHECK_EQ(sum, 6);
+}
+
+FL_TEST_CASE("swiss_map grows and matches unordered_map under churn") {
+    swiss_map<int, int> m;
+    unordered_map<int, int> ref;
+    u32 seed = 12345;
+    for (int i = 0; i < 20000; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        const int key = static_cast<int>((seed >> 8) % 3000);
+        if ((seed & 3) == 0) {
+            FL_CHECK_EQ(m.erase(key), ref.erase(key));
+        } else {
+            m[key] = i;
+            ref[key] = i;
+        }
+    }
+    FL_REQUIRE_EQ(m.size(), ref.size());
+    for (const auto& kv : ref) {
+        const int* value = m.find_value(kv.first);
+        FL_REQUIRE(value != nullptr);
+        FL_CHECK_EQ(*value, kv.second);
+    }
+    fl::size visited = 0;
+    for (auto it = m.begin(); it != m.end(); ++it) {
+        ++visited;
+    }
+    FL_CHECK_EQ(visited, m.size());
+    // Churn at a steady size must not keep doubling the table.
+    FL_CHECK(m.capacity() <= 4096u);
+}
+
+FL_TEST_CASE("swiss_map erase leaves no tombstone in a group with room") {
+    swiss_map<int, int, CollidingHash> m;
+    for (int i = 0; i < 4; ++i) {
+        m[i] = i;
+    }
+    const fl::size cap = m.capacity();
+    // Erase and reinsert far more often than the table could hold tombstones.
+    for (int round = 0; round < 1000; ++round) {
+        FL_REQUIRE(m.erase(round % 4));
+        m[round % 4] = round;
+    }
+    FL_CHECK_EQ(m.capacity(), cap);
+    FL_CHECK_EQ(m.size(), 4u);
+
+    // A full group overflows into the next one and lookups follow it.
+    for (int i = 4; i < 40; ++i) {
+        m[i] = i;
+    }
+    for (int i = 4; i < 40; ++i) {
+        FL_REQUIRE(m.contains(i));
+    }
+    FL_CHECK(m.erase(10));
+    FL_CHECK_FALSE(m.contains(10));
+    FL_CHECK(m.contains(39));
+}
+
+FL_TEST_CASE("swiss_map erase releases values and iterator erase continues") {
+    shared_ptr<int> payload = make_shared<int>(1);
+    swiss_map<int, shared_ptr<int>> m;
+    m[1] = payload;
+    m[2] = payload;
+    m[3] = payload;
+    FL_CHECK_EQ(payload.use_count(), 4);
+    m.erase(1);
+    FL_CHECK_EQ(payload.use_count(), 3);
+
+    for (auto it = m.begin(); it != m.end();) {
+        it = m.erase(it);
+    }
+    FL_CHECK(m.empty());
+    FL_CHECK_EQ(payload.use_count(), 1);
+}
+
+FL_TEST_CASE("swiss_map honors memory_resource") {
+    CountingResource upstream;
+    {
+        swiss_map<fl::string, int> m(&upstream);
+        FL_CHECK_EQ(upstream.allocations, 0u);
+        for (int i = 0; i < 100; ++i) {
+            m[fl::to_string(i)] = i;
+        }
+        FL_CHECK(upstream.allocations > 0u);
+        FL_CHECK(m.get_memory_resource() == &upstream);
+        FL_CHECK_EQ(m["42"], 42);
+
+        swiss_map<fl::string, int> moved(fl::move(m));
+        FL_CHECK_EQ(moved.size(), 100u);
+        FL_CHECK(m.empty());
+        FL_CHECK_FALSE(m.contains("1"));
+    }
+    FL_CHECK_EQ(upstream.liveBytes, 0u);
+}
+
+FL_TEST_CASE("swiss_map copy, clear and equality") {
+    swiss_map<int, int> a = {{1, 1}, {2, 2}, {3, 3}};
+    swiss_map<int, int> b(a);
+    FL_CHECK(a == b);
+    b[4] = 4;
+    FL_CHECK(a != b);
+    b.clear();
+    FL_CHECK(b.empty());
+    FL_CHECK(b.find(1) == b.end());
+    b = a;
+    FL_CHECK(a == b);
+
+    swiss_map<int, int> reserved;
+    reserved.reserve(100);
+    const fl::size cap = reserved.capacity();
+    for (int i = 0; i < 100; ++i) {
+        reserved[i] = i;
+    }
+    FL_CHECK_EQ(reserved.capacity(), cap);
+}
+
+} // namespace swiss_map_test
+
+} // FL_TEST_FILE
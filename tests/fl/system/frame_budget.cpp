@@ -0,0 +1,224 @@
+/// @file frame_budget.cpp
+/// @brief Tests for the frame-time budget scheduler
+
+#include "fl/system/frame_budget.h"
+#include "crgb.h"
+#include "fl/fx/2d/wave.h"
+#include "fl/math/xymap.h"
+#include "fl/remote/remote.h"
+#include "fl/stl/json.h"
+#include "fl/stl/vector.h"
+#include "test.h"
+
+using namespace fl;
+
+namespace {
+
+// One frame: the sketch renders for renderUs, then show() takes showUs.
+void runFrame(FrameBudget& budget, u32& now, u32 renderUs, u32 showUs) {
+    now += renderUs;
+    budget.beginFrame(now);
+    now += showUs;
+    budget.endFrame(now);
+}
+
+struct TestListener : public EngineEvents::Listener {
+    TestListener() { EngineEvents::addListener(this); }
+    ~TestListener() { EngineEvents::removeListener(this); }
+    void onEndFrame() FL_NOEXCEPT override { ++calls; }
+    const char* listenerName() const FL_NOEXCEPT override { return "TestListener"; }
+    int calls = 0;
+};
+
+} // namespace
+
+FL_TEST_CASE("FrameBudget - load is render plus show time") {
+    FrameBudget budget;
+    budget.setTargetFps(100.0f);
+    FL_CHECK_EQ(budget.budgetMicros(), 10000u);
+
+    u32 now = 1000;
+    runFrame(budget, now, 0, 2000);  // First frame has no render interval
+    FL_CHECK_EQ(budget.frames(), 0u);
+    runFrame(budget, now, 3000, 2000);
+    FL_CHECK_EQ(budget.frames(), 1u);
+    FL_CHECK_EQ(budget.lastRenderMicros(), 3000u);
+    FL_CHECK_EQ(budget.lastShowMicros(), 2000u);
+    FL_CHECK_EQ(budget.lastLoadMicros(), 5000u);
+    FL_CHECK_EQ(budget.overruns(), 0u);
+    budget.setTargetFps(0.0f);
+}
+
+FL_TEST_CASE("FrameBudget - degrades on sustained overrun and recovers with hysteresis") {
+    FrameBudget budget;
+    budget.setTargetFps(100.0f);  // 10ms
+    fl::vector<int> changes;
+    budget.onQualityChanged([&changes](u8 level) { changes.push_back(level); });
+
+    u32 now = 0;
+    runFrame(budget, now, 0, 1000);
+    // A single spike does not degrade.
+    runFrame(budget, now, 14000, 1000);
+    runFrame(budget, now, 5000, 1000);
+    FL_CHECK_EQ(budget.level(), 0);
+    FL_CHECK_EQ(budget.overruns(), 1u);
+
+    for (int i = 0; i < FrameBudget::kDegradeFrames; ++i) {
+        runFrame(budget, now, 14000, 1000);
+    }
+    FL_CHECK_EQ(budget.level(), 1);
+    FL_CHECK_EQ(FrameBudget::qualityLevel(), 1);
+    FL_CHECK_EQ(FrameBudget::scaleToQuality(4), 2);
+    FL_REQUIRE_EQ(changes.size(), 1u);
+    FL_CHECK_EQ(changes[0], 1);
+
+    // 80% of budget sits in the hysteresis band: the level holds.
+    for (int i = 0; i < 200; ++i) {
+        runFrame(budget, now, 7000, 1000);
+    }
+    FL_CHECK_EQ(budget.level(), 1);
+
+    // Comfortably under budget: recover after the settle + recover window.
+    for (int i = 0; i < FrameBudget::kRecoverFrames; ++i) {
+        runFrame(budget, now, 3000, 1000);
+    }
+    FL_CHECK_EQ(budget.level(), 0);
+    FL_REQUIRE_EQ(changes.size(), 2u);
+    FL_CHECK_EQ(changes[1], 0);
+
+    // Level saturates at kMaxLevel.
+    for (int i = 0; i < 200; ++i) {
+        runFrame(budget, now, 30000, 1000);
+    }
+    FL_CHECK_EQ(budget.level(), FrameBudget::kMaxLevel);
+    FL_CHECK_EQ(FrameBudget::scaleToQuality(8), 1);
+    FL_CHECK_EQ(FrameBudget::scaleToQuality(1, 0), 0);
+
+    // Stopping the budget restores full quality for everyone.
+    budget.setTargetFps(0.0f);
+    FL_CHECK_EQ(budget.level(), 0);
+    FL_CHECK_EQ(FrameBudget::qualityLevel(), 0);
+    FL_CHECK_EQ(FrameBudget::scaleToQuality(4), 4);
+}
+
+FL_TEST_CASE("FrameBudget - sections accumulate per frame") {
+    FrameBudget budget;
+    budget.setTargetFps(60.0f);
+    int a = 0;
+    int b = 0;
+
+    u32 now = 0;
+    runFrame(budget, now, 0, 100);
+    budget.record(&a, "a", 100);
+    budget.record(&a, "ignored", 50);  // Name is fixed on first sight
+    budget.record(&b, "b", 400);
+    runFrame(budget, now, 1000, 100);
+    FL_REQUIRE_EQ(budget.sectionCount(), 2);
+    const FrameSectionStats* sa = budget.findSection(&a);
+    FL_REQUIRE(sa != nullptr);
+    FL_CHECK_EQ(sa->name, "a");
+    FL_CHECK_EQ(sa->lastMicros, 150u);
+    FL_CHECK_EQ(sa->maxMicros, 150u);
+
+    // Not seen this frame: last drops to zero, the average is kept.
+    runFrame(budget, now, 1000, 100);
+    FL_CHECK_EQ(sa->lastMicros, 0u);
+    FL_CHECK_EQ(sa->avgMicros, 150u);
+
+    // Scoped timing lands in the running budget.
+    {
+        FrameBudget::Section section(&b, "b");
+    }
+    runFrame(budget, now, 1000, 100);
+    FL_CHECK_EQ(budget.findSection(&b)->lastFrame, budget.frames());
+
+    budget.reset();
+    FL_CHECK_EQ(budget.sectionCount(), 0);
+    FL_CHECK_EQ(budget.frames(), 0u);
+    budget.setTargetFps(0.0f);
+}
+
+FL_TEST_CASE("FrameBudget - EngineEvents listeners are timed by name") {
+    FrameBudget budget;
+    budget.setTargetFps(60.0f);
+    TestListener listener;
+
+    EngineEvents::onBeginFrame();
+    EngineEvents::onEndFrame();
+    EngineEvents::onBeginFrame();
+    EngineEvents::onEndFrame();
+    FL_CHECK_EQ(listener.calls, 2);
+    const FrameSectionStats* s = budget.findSection(&listener);
+    FL_REQUIRE(s != nullptr);
+    FL_CHECK_EQ(s->name, "TestListener");
+    FL_CHECK_EQ(budget.frames(), 1u);
+    budget.setTargetFps(0.0f);
+}
+
+FL_TEST_CASE("FrameBudget - stats over Remote") {
+    FrameBudget budget;
+    budget.setTargetFps(50.0f);
+    int key = 0;
+    u32 now = 0;
+    runFrame(budget, now, 0, 100);
+    budget.record(&key, "fx", 700);
+    runFrame(budget, now, 25000, 100);
+
+    fl::Remote remote([]() { return fl::optional<fl::json>(); },
+                      [](const fl::json&) {});
+    budget.bindRemote(remote);
+    FL_CHECK(remote.has("frameBudget.stats"));
+    FL_CHECK(remote.has("frameBudget.setTargetFps"));
+    FL_CHECK(remote.has("frameBudget.reset"));
+
+    fl::json request = fl::json::object();
+    request.set("method", "frameBudget.stats");
+    request.set("params", fl::json::array());
+    request.set("id", 1);
+    fl::json response = remote.processRpc(request);
+    FL_REQUIRE(response.contains("result"));
+    fl::json result = response["result"];
+    FL_CHECK_EQ(result["budgetUs"].as_int().value(), 20000);
+    FL_CHECK_EQ(result["overruns"].as_int().value(), 1);
+    FL_CHECK_EQ(result["loadUs"].as_int().value(), 25100);
+    FL_REQUIRE_EQ(result["sections"].size(), 1u);
+    FL_CHECK_EQ(result["sections"][0]["name"].as_string().value(), "fx");
+    FL_CHECK_EQ(result["sections"][0]["lastUs"].as_int().value(), 700);
+
+    fl::json params = fl::json::array();
+    params.push_back(25.0f);
+    request.set("method", "frameBudget.setTargetFps");
+    request.set("params", params);
+    remote.processRpc(request);
+    FL_CHECK_EQ(budget.budgetMicros(), 40000u);
+    budget.setTargetFps(0.0f);
+}
+
+FL_TEST_CASE("FrameBudget - WaveFx drops supersampling when adaptive") {
+    FrameBudget budget;
+    budget.setTargetFps(60.0f);
+    XYMap xymap = XYMap::constructRectangularGrid(8, 8);
+    WaveFx::Args args;
+    args.factor = SuperSample::SUPER_SAMPLE_8X;
+    WaveFx wave(xymap, args);
+    CRGB leds[64];
+    Fx::DrawContext ctx(0, leds);
+
+    budget.setLevel(2);
+    wave.draw(ctx);
+    FL_CHECK(wave.mWaveSim.getSuperSample() == SuperSample::SUPER_SAMPLE_8X);
+
+    wave.setf(3, 3, 1.0f);
+    const float before = wave.mWaveSim.getf(3, 3);
+    FL_CHECK(before > 0.5f);
+    wave.setAdaptiveQuality(true);
+    FL_CHECK(wave.mWaveSim.getSuperSample() == SuperSample::SUPER_SAMPLE_2X);
+    // The downsampled field is carried across the switch.
+    FL_CHECK(fl::abs(wave.mWaveSim.getf(3, 3) - before) < 0.01f);
+    FL_CHECK_EQ(wave.mWaveSim.getf(0, 0), 0.0f);
+
+    budget.setLevel(0);
+    wave.draw(ctx);
+    FL_CHECK(wave.mWaveSim.getSuperSample() == SuperSample::SUPER_SAMPLE_8X);
+    budget.setTargetFps(0.0f);
+}
@@ -2,6 +2,7 @@
 
 #include "test.h"
 #include "fl/task/task.h"
+#include "fl/task/scheduler.h"
 #include "fl/task/executor.h"
 #include "fl/system/engine_events.h"
 #include "fl/stl/chrono.h"
@@ -9,6 +10,7 @@
 #include "fl/stl/new.h"
 #include "fl/stl/function.h"
 #include "fl/stl/move.h"
+#include "fl/stl/vector.h"
 
 FL_TEST_FILE(FL_FILEPATH) {
 
@@ -280,4 +282,69 @@ FL_TEST_CASE("Task self-registration and destruction behavior [task]") {
     }
 } 
 
+FL_TEST_CASE("Scheduler runs due interval tasks in registration order [task]") {
+    fl::task::Scheduler& scheduler = fl::task::Scheduler::instance();
+    scheduler.clear_all_tasks();
+    fl::u32 now = fl::millis();
+
+    fl::vector<int> order;
+    fl::vector<fl::task::Handle> tasks;
+    for (int i = 0; i < 200; ++i) {
+        // Deadlines are scattered so heap order differs from registration order.
+        auto task = fl::task::every_ms(1000 + (i * 37) % 500)
+            .then([&order, i]() { order.push_back(i); });
+        tasks.push_back(task);
+    }
+    FL_CHECK_EQ(scheduler.size(), 200u);
+
+    scheduler.update();  // Every task is due on its first update
+    FL_REQUIRE_EQ(order.size(), 200u);
+    for (int i = 0; i < 200; ++i) {
+        FL_CHECK_EQ(order[i], i);
+    }
+
+    // Only the tasks whose interval has elapsed run again.
+    order.clear();
+    now = fl::millis();
+    tasks[150].set_last_run_time(now - 5000);
+    tasks[3].set_last_run_time(now - 5000);
+    scheduler.update();
+    FL_REQUIRE_EQ(order.size(), 2u);
+    FL_CHECK_EQ(order[0], 3);
+    FL_CHECK_EQ(order[1], 150);
+    FL_CHECK_EQ(scheduler.size(), 200u);
+
+    scheduler.clear_all_tasks();
+    FL_CHECK_EQ(scheduler.size(), 0u);
+}
+
+FL_TEST_CASE("Scheduler cancel removes interval tasks immediately [task]") {
+    fl::task::Scheduler& scheduler = fl::task::Scheduler::instance();
+    scheduler.clear_all_tasks();
+
+    int runs_a = 0;
+    int runs_b = 0;
+    auto a = fl::task::every_ms(0).then([&runs_a]() { runs_a++; });
+    auto b = fl::task::every_ms(0).then([&runs_b, &a]() {
+        runs_b++;
+        a.cancel();  // Cancel from inside a callback of the same batch
+    });
+    FL_CHECK_EQ(scheduler.size(), 2u);
+
+    scheduler.update();
+    FL_CHECK_EQ(runs_a, 1);  // Registered first, ran before b canceled it
+    FL_CHECK_EQ(runs_b, 1);
+    FL_CHECK_EQ(scheduler.size(), 1u);
+
+    scheduler.update();  // Zero interval tasks run once per update
+    FL_CHECK_EQ(runs_a, 1);
+    FL_CHECK_EQ(runs_b, 2);
+
+    b.cancel();
+    FL_CHECK_EQ(scheduler.size(), 0u);
+    scheduler.update();
+    FL_CHECK_EQ(runs_b, 2);
+    scheduler.clear_all_tasks();
+}
+
 } // FL_TEST_FILE
@@ -0,0 +1,41 @@
+#include "fl/task/worker_pool.h"
+#include "test.h"
+#include "fl/stl/atomic.h"
+
+FL_TEST_FILE(FL_FILEPATH) {
+
+using fl::task::WorkerPool;
+
+FL_TEST_CASE("WorkerPool::parallelFor runs every piece exactly once") {
+    FL_CHECK(WorkerPool::instance().concurrency() >= 1);
+
+    // A private pool with workers exercises the threaded path even on a
+    // single-core host.
+    WorkerPool pool(3);
+    for (int count : {0, 1, 2, 7, 64}) {
+        fl::atomic<int> hits[64];
+        for (int i = 0; i < count; ++i) {
+            hits[i].store(0);
+        }
+        pool.parallelFor(count, [&hits](int i) { hits[i].fetch_add(1); });
+        for (int i = 0; i < count; ++i) {
+            FL_CHECK_EQ(hits[i].load(), 1);
+        }
+    }
+}
+
+FL_TEST_CASE("WorkerPool::parallelFor is a barrier and allows nesting") {
+    WorkerPool pool(2);
+    fl::atomic<int> inner(0);
+    fl::atomic<int> outer(0);
+    pool.parallelFor(4, [&](int) {
+        // Nested jobs run serially on the calling thread.
+        pool.parallelFor(3, [&](int) { inner.fetch_add(1); });
+        outer.fetch_add(1);
+    });
+    // Every piece has finished by the time parallelFor returns.
+    FL_CHECK_EQ(outer.load(), 4);
+    FL_CHECK_EQ(inner.load(), 12);
+}
+
+} // FL_TEST_FILE
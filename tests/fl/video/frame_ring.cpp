@@ -0,0 +1,95 @@
+#include "fl/video/frame_ring.h"
+#include "fl/video/frame_interpolator.h"
+#include "fl/fx/frame.h"
+#include "fl/stl/stdint.h"
+#include "test.h"
+
+FL_TEST_FILE(FL_FILEPATH) {
+using namespace fl;
+using namespace fl::video;
+
+namespace {
+void fillSlot(FrameRing &ring, fl::u32 frameNumber, u8 value,
+              bool evictNewest = false) {
+    int slot = ring.reserve(evictNewest);
+    FL_REQUIRE(slot >= 0);
+    fl::span<CRGB> px = ring.pixels(slot);
+    for (size_t i = 0; i < px.size(); ++i) {
+        px[i] = CRGB(value, value, value);
+    }
+    ring.commit(slot, frameNumber);
+}
+} // namespace
+
+FL_TEST_CASE("FrameRing recycles slots in place") {
+    FrameRing ring(4, 3);
+    FL_CHECK_EQ(ring.capacity(), 3u);
+    FL_CHECK(ring.empty());
+
+    fillSlot(ring, 10, 1);
+    fillSlot(ring, 11, 2);
+    fillSlot(ring, 12, 3);
+    FL_CHECK(ring.full());
+    const CRGB *slab = ring.get(10).data();
+
+    // Full: the oldest frame (10) gives up its slot, same memory.
+    fillSlot(ring, 13, 4);
+    FL_CHECK_FALSE(ring.has(10));
+    FL_CHECK(ring.get(13).data() == slab);
+    FL_CHECK_EQ(ring.get(13)[3].r, 4);
+    FL_CHECK_EQ(ring.get(11)[0].r, 2);
+
+    fl::u32 n = 0;
+    FL_CHECK(ring.oldest(&n));
+    FL_CHECK_EQ(n, 11u);
+    FL_CHECK(ring.newest(&n));
+    FL_CHECK_EQ(n, 13u);
+
+    // Playing backwards evicts the newest frame instead.
+    fillSlot(ring, 9, 5, true);
+    FL_CHECK_FALSE(ring.has(13));
+    FL_CHECK(ring.has(9));
+}
+
+FL_TEST_CASE("FrameRing reserve without commit hides the frame") {
+    FrameRing ring(2, 2);
+    fillSlot(ring, 0, 1);
+    fillSlot(ring, 1, 2);
+    int slot = ring.reserve();
+    FL_CHECK(slot >= 0);
+    // The evicted frame is gone even though nothing was committed.
+    FL_CHECK_FALSE(ring.has(0));
+    FL_CHECK_EQ(ring.size(), 1u);
+
+    // Re-committing an existing frame number replaces the stale copy.
+    ring.commit(slot, 1);
+    FL_CHECK_EQ(ring.size(), 1u);
+    FL_CHECK(ring.erase(1));
+    FL_CHECK(ring.empty());
+
+    ring.clear();
+    fl::u32 n = 0;
+    FL_CHECK_FALSE(ring.oldest(&n));
+}
+
+FL_TEST_CASE("FrameInterpolator blends between ring slots") {
+    FrameInterpolator interp(2, 1.0f, 3);  // 1 fps: 1000 ms per frame
+    Frame a(3), b(3);
+    for (int i = 0; i < 3; ++i) {
+        a.rgb()[i] = CRGB(0, 0, 0);
+        b.rgb()[i] = CRGB(200, 200, 200);
+    }
+    FL_CHECK(interp.insert(0, a));
+    FL_CHECK(interp.insert(1, b));
+
+    CRGB leds[3];
+    FL_CHECK(interp.draw(500, fl::span<CRGB>(leds, 3)));
+    FL_CHECK_GT(leds[0].r, 80);
+    FL_CHECK_LT(leds[0].r, 120);
+
+    // Mismatched frame size is rejected.
+    Frame wrong(5);
+    FL_CHECK_FALSE(interp.insert(2, wrong));
+}
+
+} // FL_TEST_FILE
@@ -0,0 +1,130 @@
+#include "fl/video/pixel_stream.h"
+#include "fl/stl/detail/file_handle.h"
+#include "fl/stl/shared_ptr.h"
+#include "fl/stl/vector.h"
+#include "fl/stl/stdint.h"
+#include "test.h"
+
+FL_TEST_FILE(FL_FILEPATH) {
+using namespace fl;
+using namespace fl::video;
+
+namespace {
+
+// Seekable RAM file that counts backend reads and can pose as mapped.
+class CountingFilebuf : public fl::filebuf {
+  public:
+    CountingFilebuf(size_t frames, size_t bytesPerFrame, bool mappable)
+        : mMappable(mappable) {
+        for (size_t f = 0; f < frames; ++f) {
+            for (size_t i = 0; i < bytesPerFrame; ++i) {
+                data.push_back(static_cast<u8>(f * 16 + i));
+            }
+        }
+    }
+    bool is_open() const override { return true; }
+    size_t size() const override { return data.size(); }
+    size_t read(char *dst, size_t n) override {
+        ++reads;
+        size_t i = 0;
+        for (; i < n && mPos < data.size(); ++i, ++mPos) {
+            dst[i] = static_cast<char>(data[mPos]);
+        }
+        return i;
+    }
+    using fl::filebuf::read;
+    size_t write(const char *, size_t) override { return 0; }
+    size_t tell() override { return mPos; }
+    const char *path() const override { return "counting"; }
+    bool seek(size_t pos, fl::seek_dir dir) override {
+        if (dir != fl::seek_dir::beg || pos > data.size()) {
+            return false;
+        }
+        mPos = pos;
+        return true;
+    }
+    using fl::filebuf::seek;
+    void close() override {}
+    bool is_eof() const override { return mPos >= data.size(); }
+    bool has_error() const override { return false; }
+    void clear_error() override {}
+    int error_code() const override { return 0; }
+    const char *error_message() const override { return "No error"; }
+    fl::span<const u8> mapped() const override {
+        return mMappable ? fl::span<const u8>(data.data(), data.size())
+                         : fl::span<const u8>();
+    }
+
+    fl::vector<u8> data;
+    size_t mPos = 0;
+    int reads = 0;
+
+  private:
+    bool mMappable;
+};
+
+const int kPixels = 2;
+const int kBytesPerFrame = kPixels * 3;
+
+} // namespace
+
+FL_TEST_CASE("PixelStream serves mapped frames without reading") {
+    auto file = fl::make_shared<CountingFilebuf>(5, kBytesPerFrame, true);
+    PixelStream stream(kBytesPerFrame);
+    FL_REQUIRE(stream.begin(file));
+
+    fl::span<const CRGB> view = stream.frameView(3);
+    FL_REQUIRE_EQ(view.size(), size_t(kPixels));
+    FL_CHECK(reinterpret_cast<const u8 *>(view.data()) == // ok reinterpret cast
+             file->data.data() + 3 * kBytesPerFrame);
+    FL_CHECK_EQ(view[1].r, 3 * 16 + 3);
+    FL_CHECK_EQ(stream.framesRemaining(), 1);
+
+    CRGB dst[kPixels];
+    FL_CHECK(stream.readFrameAt(4, fl::span<CRGB>(dst, kPixels)));
+    FL_CHECK_EQ(dst[0].r, 4 * 16);
+    FL_CHECK_EQ(file->reads, 0);
+    FL_CHECK(stream.atEnd());
+    FL_CHECK(stream.frameView(5).empty());
+}
+
+FL_TEST_CASE("PixelStream prefetches frame groups") {
+    auto file = fl::make_shared<CountingFilebuf>(10, kBytesPerFrame, false);
+    PixelStream stream(kBytesPerFrame);
+    stream.setPrefetchFrames(4);
+    FL_REQUIRE(stream.begin(file));
+
+    CRGB dst[kPixels];
+    fl::span<CRGB> out(dst, kPixels);
+    for (fl::u32 f = 0; f < 10; ++f) {
+        FL_REQUIRE(stream.readFrameAt(f, out));
+        FL_CHECK_EQ(dst[0].r, f * 16);
+        FL_CHECK_EQ(stream.framesRemaining(), int(9 - f));
+    }
+    // Blocks [0,4) [4,8) [8,10).
+    FL_CHECK_EQ(file->reads, 3);
+
+    // Stepping backwards below the block reads the group ending there.
+    file->reads = 0;
+    FL_REQUIRE(stream.readFrameAt(7, out));
+    FL_CHECK_EQ(file->reads, 1);
+    for (int f = 6; f >= 4; --f) {
+        FL_REQUIRE(stream.readFrameAt(f, out));
+        FL_CHECK_EQ(dst[1].g, f * 16 + 4);
+    }
+    FL_CHECK_EQ(file->reads, 1);
+}
+
+FL_TEST_CASE("PixelStream without prefetch reads each frame") {
+    auto file = fl::make_shared<CountingFilebuf>(3, kBytesPerFrame, false);
+    PixelStream stream(kBytesPerFrame);
+    FL_REQUIRE(stream.begin(file));
+    FL_CHECK(stream.frameView(0).empty());
+
+    CRGB dst[kPixels];
+    FL_CHECK(stream.readFrameAt(2, fl::span<CRGB>(dst, kPixels)));
+    FL_CHECK_EQ(dst[0].b, 2 * 16 + 2);
+    FL_CHECK(!stream.readFrameAt(3, fl::span<CRGB>(dst, kPixels)));
+}
+
+} // FL_TEST_FILE
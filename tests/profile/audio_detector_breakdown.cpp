@@ -9,8 +9,11 @@
 //   ./audio_detector_breakdown baseline     # JSON output for profiling pipeline
 
 #include "fl/audio/audio_processor.h"
+#include "fl/audio/detector/chord.h"
+#include "fl/audio/detector/key.h"
+#include "fl/audio/detector/mood_analyzer.h"
 #include "fl/audio/input.h"
-#include "fl/audio/audio_sample.h"
+#include "fl/audio/audio.h"
 #include "fl/stl/int.h"
 #include "fl/stl/stdio.h"
 #include "fl/stl/chrono.h"
@@ -26,7 +29,7 @@ public:
     explicit SynthAudioGenerator(int sampleRate = 16000)
         : mSampleRate(sampleRate), mPhase(0) {}
 
-    Sample generateSample() {
+    audio::Sample generateSample() {
         const int bufferSize = mSampleRate / 100;  // 10ms at 16kHz = 160 samples
         fl::vector<fl::i16> pcm(bufferSize);
 
@@ -40,7 +43,7 @@ public:
         }
 
         mPhase += bufferSize;
-        return Sample(fl::span<const fl::i16>(pcm.data(), pcm.size()), 0);
+        return audio::Sample(fl::span<const fl::i16>(pcm.data(), pcm.size()), 0);
     }
 
 private:
@@ -274,6 +277,46 @@ int runProfiler(bool jsonOutput) {
                         fftCostTotal_us / static_cast<float>(ITERATIONS), detectorCost});
     }
 
+    // ===== PHASE 5: All detectors, per-detector instrumentation =====
+    // One processor with every detector subscribed, timed by the processor
+    // itself. Shared features (FFT bins, chroma) are charged to whichever
+    // detector asks first in update order.
+    fl::vector<fl::audio::DetectorStats> graphStats;
+    float graphTotalUs = 0.0f;
+    {
+        fl::audio::Processor processor;
+        processor.setSampleRate(SAMPLE_RATE);
+        processor.onEnergy([](float) {});
+        processor.onBeat([]() {});
+        processor.onTempo([](float) {});
+        processor.onTransient([]() {});
+        processor.onFrequencyBands([](float, float, float) {});
+        processor.onPitch([](float) {});
+        processor.onNoteOn([](fl::u8, fl::u8) {});
+        processor.onBackbeat([](fl::u8, float, float) {});
+        processor.onVocal([](fl::u8) {});
+        processor.onKick([]() {});
+        processor.onChord([](const fl::audio::detector::Chord&) {});
+        processor.onKey([](const fl::audio::detector::Key&) {});
+        processor.onMood([](const fl::audio::detector::Mood&) {});
+        processor.onBuildupStart([]() {});
+        processor.onDrop([]() {});
+        processor.onVibeLevels([](const fl::audio::detector::VibeLevels&) {});
+
+        for (int i = 0; i < 10; i++) {
+            processor.update(audioGen.generateSample());
+        }
+
+        processor.setDetectorProfiling(true);
+        fl::u32 t0 = fl::micros();
+        for (int i = 0; i < ITERATIONS; i++) {
+            processor.update(audioGen.generateSample());
+        }
+        fl::u32 t1 = fl::micros();
+        graphTotalUs = (t1 - t0) / static_cast<float>(ITERATIONS);
+        graphStats = processor.getDetectorStats();
+    }
+
     if (jsonOutput) {
         ProfileResultBuilder::print_result("baseline", "audio_detectors_breakdown",
                                           ITERATIONS, baselineTotal_us);
@@ -303,6 +346,17 @@ int runProfiler(bool jsonOutput) {
         fl::printf("───────────────────────────────────────────────────────────────────────────────\n");
         fl::printf("\n");
 
+        fl::printf("PER-DETECTOR COST, ALL DETECTORS ACTIVE (µs per update, in update order)\n");
+        fl::printf("───────────────────────────────────────────────────────────────────────────────\n");
+        fl::printf("%-30s %10s    %10s\n", "Detector", "Average", "Max");
+        fl::printf("───────────────────────────────────────────────────────────────────────────────\n");
+        for (const auto& st : graphStats) {
+            fl::printf("%-30s %10.2f    %10u\n", st.name, st.averageMicros(), st.maxMicros);
+        }
+        fl::printf("%-30s %10.2f\n", "Total update()", graphTotalUs);
+        fl::printf("───────────────────────────────────────────────────────────────────────────────\n");
+        fl::printf("\n");
+
         fl::printf("Summary:\n");
         fl::printf("  Baseline (EnergyAnalyzer):   %.2f µs/call\n", costs[0].totalCostUs);
         fl::printf("  FFT Computation:              %.2f µs/call (reused by multiple detector)\n",
@@ -0,0 +1,146 @@
+// Performance comparison: classic keep/seep blur2d (scalar reference vs the
+// vectorized library path) and the separable blurGaussian kernels, on the
+// 64x64 and 128x128 matrices our post-processing effects run at.
+// ok standalone
+
+#include "FastLED.h"
+#include "fl/gfx/blur.h"
+#include "fl/stl/int.h"
+#include "fl/stl/cstring.h"
+#include "fl/stl/stdio.h"
+#include "profile_result.h"
+
+using namespace fl;
+
+static const int WARMUP_CALLS = 20;
+static const int MAX_SIDE = 128;
+
+volatile u8 g_sink = 0;
+
+static CRGB g_pixels[MAX_SIDE * MAX_SIDE];
+
+static void init_test_data(int n) {
+    for (int i = 0; i < n; i++) {
+        g_pixels[i] = CRGB(static_cast<u8>((i * 37 + 17) & 0xFF),
+                           static_cast<u8>((i * 59 + 31) & 0xFF),
+                           static_cast<u8>((i * 83 + 47) & 0xFF));
+    }
+}
+
+// Pixel-at-a-time blur2d as it was before the SIMD path: one blur1d per
+// row, then one strided blur1d per column.
+static void reference_blur_line(CRGB *px, int count, int stride, u8 amount) {
+    u8 keep = 255 - amount;
+    u8 seep = amount >> 1;
+    CRGB carryover = CRGB::Black;
+    for (int i = 0; i < count; ++i) {
+        CRGB cur = px[i * stride];
+        CRGB part = cur;
+        part.nscale8(seep);
+        cur.nscale8(keep);
+        cur += carryover;
+        if (i)
+            px[(i - 1) * stride] += part;
+        px[i * stride] = cur;
+        carryover = part;
+    }
+}
+
+__attribute__((noinline)) static void reference_blur2d(CRGB *px, int w, int h,
+                                                       u8 amount) {
+    for (int y = 0; y < h; ++y)
+        reference_blur_line(px + y * w, w, 1, amount);
+    for (int x = 0; x < w; ++x)
+        reference_blur_line(px + x, h, w, amount);
+}
+
+enum Variant { kScalarBlur2d, kSimdBlur2d, kGaussianR1, kGaussianR2 };
+
+static const char *variant_name(Variant v) {
+    switch (v) {
+    case kScalarBlur2d: return "blur2d_scalar";
+    case kSimdBlur2d: return "blur2d_simd";
+    case kGaussianR1: return "blurGaussian_r1";
+    case kGaussianR2: return "blurGaussian_r2";
+    }
+    return "?";
+}
+
+__attribute__((noinline)) static void run(Variant v, int side, int iterations) {
+    const int n = side * side;
+    u8 local_sink = 0;
+    for (int iter = 0; iter < iterations; iter++) {
+        // Re-seed occasionally so repeated blurring doesn't converge to black.
+        if ((iter & 15) == 0) {
+            init_test_data(n);
+        }
+        asm volatile("" : : : "memory");
+        gfx::Canvas<CRGB> canvas(fl::span<CRGB>(g_pixels, n), side, side);
+        switch (v) {
+        case kScalarBlur2d: reference_blur2d(g_pixels, side, side, 64); break;
+        case kSimdBlur2d: gfx::blur2d(canvas, alpha8(64)); break;
+        case kGaussianR1: gfx::blurGaussian<1, 1>(canvas); break;
+        case kGaussianR2: gfx::blurGaussian<2, 2>(canvas); break;
+        }
+        local_sink ^= g_pixels[iter % n].r;
+        asm volatile("" : "+r"(local_sink) : : "memory");
+    }
+    g_sink = local_sink;
+}
+
+// The vectorized blur2d must be a drop-in replacement: verify bit-exactness
+// before timing anything.
+static bool verify(int side) {
+    static CRGB expect[MAX_SIDE * MAX_SIDE];
+    const int n = side * side;
+    init_test_data(n);
+    fl::memcpy(expect, g_pixels, sizeof(CRGB) * n);
+    reference_blur2d(expect, side, side, 64);
+    gfx::Canvas<CRGB> canvas(fl::span<CRGB>(g_pixels, n), side, side);
+    gfx::blur2d(canvas, alpha8(64));
+    return fl::memcmp(expect, g_pixels, sizeof(CRGB) * n) == 0;
+}
+
+int main(int argc, char *argv[]) {
+    bool json_output = (argc > 1 && fl::strcmp(argv[1], "baseline") == 0);
+
+    const int sides[] = {64, 128};
+    const Variant variants[] = {kScalarBlur2d, kSimdBlur2d, kGaussianR1,
+                                kGaussianR2};
+
+    if (!json_output) {
+        fl::printf("\n=== blur2d / blurGaussian Performance ===\n\n");
+    }
+    for (int side : sides) {
+        if (!verify(side)) {
+            fl::printf("ERROR: blur2d SIMD path differs from scalar at %dx%d\n",
+                       side, side);
+            return 1;
+        }
+        const int iterations = side == 64 ? 4000 : 1000;
+        for (Variant v : variants) {
+            run(v, side, WARMUP_CALLS);
+            u32 t0 = ::micros();
+            run(v, side, iterations);
+            u32 t1 = ::micros();
+            u32 elapsed_us = t1 - t0;
+            if (json_output) {
+                char target[48];
+                fl::snprintf(target, sizeof(target), "%s_%dx%d",
+                             variant_name(v), side, side);
+                ProfileResultBuilder::print_result("baseline", target,
+                                                   iterations, elapsed_us);
+            } else {
+                double us_per_frame =
+                    static_cast<double>(elapsed_us) / iterations;
+                fl::printf("%-16s %3dx%-3d  %8.2f us/frame  %7.2f ns/pixel\n",
+                           variant_name(v), side, side, us_per_frame,
+                           us_per_frame * 1000.0 / (side * side));
+            }
+        }
+    }
+    if (!json_output) {
+        fl::printf("=========================================\n");
+    }
+    return 0;
+}
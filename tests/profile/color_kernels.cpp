@@ -0,0 +1,127 @@
+// ok standalone
+// Batch color kernels vs their per-pixel loops, on 256 and 1024 pixels:
+//   hsv_scalar / hsv_batch:           hsv2rgb_rainbow() with random CHSV
+//   palette_scalar / palette_batch:   ColorFromPalette() of a CRGBPalette16
+//                                     over noise-like indices, brightness 200
+//   palette_expanded:                 same lookups through a palette already
+//                                     expanded with ExpandPalette()
+// palette_batch only expands the palette from 512 pixels up, so at 256 it
+// matches the per-pixel loop. Times are per pixel.
+
+#include "FastLED.h"
+#include "fl/stl/cstring.h"
+#include "fl/stl/stdio.h"
+#include "fl/stl/vector.h"
+#include "profile_result.h"
+
+using namespace fl;
+
+static const int PIXELS_TOTAL = 1 << 20;
+static volatile u32 gSink = 0;
+
+static fl::vector<CHSV> gHsv;
+static fl::vector<u8> gIndices;
+static fl::vector<CRGB> gOut;
+static CRGBPalette16 gPalette;
+static CRGBPalette256 gExpanded;
+
+static u32 runHsvScalar(int n) {
+    u32 t0 = ::micros();
+    for (int r = 0; r < PIXELS_TOTAL / n; r++) {
+        for (int i = 0; i < n; i++) {
+            hsv2rgb_rainbow(gHsv[i], gOut[i]);
+        }
+        gSink = gSink + gOut[r % n].r;
+    }
+    return ::micros() - t0;
+}
+
+static u32 runHsvBatch(int n) {
+    u32 t0 = ::micros();
+    for (int r = 0; r < PIXELS_TOTAL / n; r++) {
+        hsv2rgb_rainbow(span<const CHSV>(gHsv.data(), n), span<CRGB>(gOut.data(), n));
+        gSink = gSink + gOut[r % n].r;
+    }
+    return ::micros() - t0;
+}
+
+static u32 runPaletteScalar(int n) {
+    u32 t0 = ::micros();
+    for (int r = 0; r < PIXELS_TOTAL / n; r++) {
+        for (int i = 0; i < n; i++) {
+            gOut[i] = ColorFromPalette(gPalette, gIndices[i], 200);
+        }
+        gSink = gSink + gOut[r % n].r;
+    }
+    return ::micros() - t0;
+}
+
+static u32 runPaletteBatch(int n) {
+    u32 t0 = ::micros();
+    for (int r = 0; r < PIXELS_TOTAL / n; r++) {
+        ColorFromPalette(gPalette, span<const u8>(gIndices.data(), n),
+                         span<CRGB>(gOut.data(), n), 200);
+        gSink = gSink + gOut[r % n].r;
+    }
+    return ::micros() - t0;
+}
+
+static u32 runPaletteExpanded(int n) {
+    u32 t0 = ::micros();
+    for (int r = 0; r < PIXELS_TOTAL / n; r++) {
+        ColorFromPalette(gExpanded, span<const u8>(gIndices.data(), n),
+                         span<CRGB>(gOut.data(), n));
+        gSink = gSink + gOut[r % n].r;
+    }
+    return ::micros() - t0;
+}
+
+int main(int argc, char* argv[]) {
+    bool json_output = (argc > 1 && fl::strcmp(argv[1], "baseline") == 0);
+    const int sizes[] = {256, 1024};
+
+    u32 seed = 1;
+    for (int i = 0; i < 1024; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        gHsv.push_back(CHSV(seed >> 24, seed >> 16, seed >> 8));
+        // Smooth ramps with jumps, like a mapped noise field.
+        gIndices.push_back(static_cast<u8>((i * 3) + (seed >> 28)));
+    }
+    gOut.resize(1024);
+    gPalette = RainbowColors_p;
+    ExpandPalette(gPalette, gExpanded, 200);
+
+    struct Case {
+        const char* name;
+        u32 (*fn)(int);
+    };
+    const Case cases[] = {
+        {"hsv_scalar", runHsvScalar},
+        {"hsv_batch", runHsvBatch},
+        {"palette_scalar", runPaletteScalar},
+        {"palette_batch", runPaletteBatch},
+        {"palette_expanded", runPaletteExpanded},
+    };
+
+    if (!json_output) {
+        fl::printf("\n=== Color kernels, %d pixels per case ===\n\n", PIXELS_TOTAL);
+    }
+    for (int n : sizes) {
+        for (const Case& c : cases) {
+            c.fn(n);  // Warm up
+            u32 elapsed_us = c.fn(n);
+            if (json_output) {
+                char target[64];
+                fl::snprintf(target, sizeof(target), "color_%s_%d", c.name, n);
+                ProfileResultBuilder::print_result("baseline", target, PIXELS_TOTAL, elapsed_us);
+            } else {
+                fl::printf("%5d %-17s %8.2f ns/pixel\n", n, c.name,
+                           static_cast<double>(elapsed_us) * 1000.0 / PIXELS_TOTAL);
+            }
+        }
+    }
+    if (!json_output) {
+        fl::printf("=====================================\n");
+    }
+    return 0;
+}
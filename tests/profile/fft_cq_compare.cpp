@@ -3,6 +3,9 @@
 // Benchmarks LOG_REBIN, CQ_NAIVE, CQ_HYBRID, and CQ_OCTAVE to compare
 // speed, spectral leakage, and accuracy.
 //
+// Also measures batch throughput: four buffers per Impl::runBatch() call
+// (SIMD lanes, shared twiddles/kernels) against four sequential run() calls.
+//
 // Usage:
 //   ./fft_cq_compare.exe baseline    # JSON output
 //   ./fft_cq_compare.exe report      # Human-readable report
@@ -23,6 +26,11 @@
 
 namespace fl {
 
+using audio::fft::Args;
+using audio::fft::Bins;
+using audio::fft::Impl;
+using audio::fft::Mode;
+
 // Generate a synthetic audio buffer: mix of sine waves spanning the
 // frequency range to exercise all CQ bins.
 static void generateTestSignal(fl::vector<fl::i16> &buf, int samples,
@@ -118,6 +126,64 @@ static BenchResult benchMode(Mode mode, const char *name,
     return {name, ns, iterations};
 }
 
+// Batch throughput: time per buffer for BATCH buffers, either as BATCH
+// sequential run() calls or one runBatch() call.
+static const int BATCH = 4;
+
+struct BatchBench {
+    fl::i64 seqNs;
+    fl::i64 batchNs;
+    int buffers;  // total buffers transformed by each variant
+    double seqNsPerBuffer() const {
+        return static_cast<double>(seqNs) / buffers;
+    }
+    double batchNsPerBuffer() const {
+        return static_cast<double>(batchNs) / buffers;
+    }
+};
+
+static BatchBench benchBatch(Mode mode,
+                             const fl::vector<fl::i16> (&signals)[BATCH],
+                             int bands, float fmin, float fmax,
+                             int sampleRate, int iterations) {
+    Args args(static_cast<int>(signals[0].size()), bands, fmin, fmax,
+              sampleRate, mode);
+    Impl fft(args);
+    fl::vector<Bins> bins;
+    fl::vector<Bins *> outs;
+    fl::span<const fl::i16> spans[BATCH];
+    for (int b = 0; b < BATCH; b++) {
+        bins.push_back(Bins(bands));
+        spans[b] = signals[b];
+    }
+    for (int b = 0; b < BATCH; b++) {
+        outs.push_back(&bins[b]);
+    }
+    fl::span<const fl::span<const fl::i16>> batch(spans, BATCH);
+
+    for (int i = 0; i < 10; i++) {
+        fft.runBatch(batch, outs);
+    }
+
+    fl::u32 t0 = fl::micros();
+    for (int i = 0; i < iterations; i++) {
+        for (int b = 0; b < BATCH; b++) {
+            fft.run(spans[b], outs[b]);
+        }
+    }
+    fl::u32 t1 = fl::micros();
+    for (int i = 0; i < iterations; i++) {
+        fft.runBatch(batch, outs);
+    }
+    fl::u32 t2 = fl::micros();
+
+    BatchBench r;
+    r.seqNs = static_cast<fl::i64>(t1 - t0) * 1000LL;
+    r.batchNs = static_cast<fl::i64>(t2 - t1) * 1000LL;
+    r.buffers = iterations * BATCH;
+    return r;
+}
+
 // Find the bin with the highest magnitude
 static int peakBin(fl::span<const float> bins) {
     int best = 0;
@@ -275,6 +341,13 @@ int runBenchmark(bool jsonOutput) {
     fl::vector<fl::i16> pink;
     generatePinkNoise(pink, SAMPLES);
 
+    // Four different channels for the batch benchmark.
+    fl::vector<fl::i16> batchSignals[BATCH];
+    generateTestSignal(batchSignals[0], SAMPLES, SAMPLE_RATE);
+    generateWhiteNoise(batchSignals[1], SAMPLES);
+    generatePinkNoise(batchSignals[2], SAMPLES);
+    generateSine(batchSignals[3], SAMPLES, SAMPLE_RATE, 440.0f);
+
     if (jsonOutput) {
         fl::span<const fl::i16> signals[] = {sines, white, pink};
         const char *names[] = {"sines", "white", "pink"};
@@ -286,6 +359,14 @@ int runBenchmark(bool jsonOutput) {
                 "baseline", r.name, r.iterations,
                 static_cast<fl::u32>(r.totalNs / 1000));
         }
+        BatchBench bb = benchBatch(Mode::CQ_HYBRID, batchSignals, bands,
+                                   fmin, fmax, SAMPLE_RATE, ITERATIONS);
+        ProfileResultBuilder::print_result(
+            "sequential", "hybrid_x4", bb.buffers,
+            static_cast<fl::u32>(bb.seqNs / 1000));
+        ProfileResultBuilder::print_result(
+            "batch", "hybrid_x4", bb.buffers,
+            static_cast<fl::u32>(bb.batchNs / 1000));
     } else {
         fl::printf("\n");
         fl::printf("======================================================\n");
@@ -345,6 +426,21 @@ int runBenchmark(bool jsonOutput) {
             fl::printf("    Ratio:     %.2fx\n", hyUs / lrUs);
         }
 
+        // Batch throughput: BATCH channels per call
+        fl::printf("\n  Batch throughput (%d buffers/call, us/buffer):\n",
+                   BATCH);
+        fl::printf("  %-8s %10s %10s %8s\n", "Mode", "run()", "runBatch",
+                   "Speedup");
+        fl::printf("  ------------------------------------------\n");
+        for (int m = 0; m < NUM_MODES; m++) {
+            BatchBench bb = benchBatch(MODES[m].mode, batchSignals, bands,
+                                       fmin, fmax, SAMPLE_RATE, ITERATIONS);
+            double seqUs = bb.seqNsPerBuffer() / 1000.0;
+            double batchUs = bb.batchNsPerBuffer() / 1000.0;
+            fl::printf("  %-8s %10.1f %10.1f %7.2fx\n", MODES[m].label,
+                       seqUs, batchUs, batchUs > 0.0 ? seqUs / batchUs : 0.0);
+        }
+
         fl::printf("\n");
 
         // Accuracy comparison
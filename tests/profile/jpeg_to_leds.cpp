@@ -0,0 +1,100 @@
+// ok standalone
+// Decoding a 128x128 JPEG onto 16x16 and 32x32 LED matrices:
+//   frame_downscale: full-resolution Frame, then fl::downscale() onto the map
+//   leds_auto:       Jpeg::decodeToLeds() at the scale it picks (1/8, 1/4)
+//   leds_full:       Jpeg::decodeToLeds() forced to 1:1, box filter only
+// Run from the repo root; reads tests/data/codec/progressive.jpg.
+
+#include "FastLED.h"
+#include "fl/codec/jpeg.h"
+#include "fl/gfx/downscale.h"
+#include "fl/math/xymap.h"
+#include "fl/stl/cstring.h"
+#include "fl/stl/stdio.h"
+#include "fl/stl/vector.h"
+#include "fl/system/file_system.h"
+#include "profile_result.h"
+
+using namespace fl;
+
+static const int ROUNDS = 200;
+static volatile u32 gSink = 0;
+
+static fl::vector<u8> gJpeg;
+
+static u32 runFrameDownscale(const XYMap& map, CRGB* leds) {
+    u32 t0 = ::micros();
+    for (int r = 0; r < ROUNDS; r++) {
+        FramePtr frame = Jpeg::decode(span<const u8>(gJpeg.data(), gJpeg.size()));
+        XYMap srcMap = XYMap::constructRectangularGrid(frame->getWidth(), frame->getHeight());
+        downscale(frame->rgb().data(), srcMap, leds, map);
+        gSink = gSink + leds[0].r;
+    }
+    return ::micros() - t0;
+}
+
+static u32 runLeds(const XYMap& map, CRGB* leds, Jpeg::Scale scale) {
+    u32 t0 = ::micros();
+    for (int r = 0; r < ROUNDS; r++) {
+        Jpeg::decodeToLeds(span<const u8>(gJpeg.data(), gJpeg.size()), map,
+                           span<CRGB>(leds, map.getTotal()), scale);
+        gSink = gSink + leds[0].r;
+    }
+    return ::micros() - t0;
+}
+
+static bool loadJpeg() {
+    FileSystem fs;
+    if (!fs.begin(make_sdcard_filesystem(0))) {
+        return false;
+    }
+    ifstream fh = fs.openRead("tests/data/codec/progressive.jpg");
+    if (!fh.is_open()) {
+        return false;
+    }
+    gJpeg.resize(fh.size());
+    bool ok = fh.read(gJpeg.data(), gJpeg.size()) == gJpeg.size();
+    fh.close();
+    return ok;
+}
+
+int main(int argc, char* argv[]) {
+    bool json_output = (argc > 1 && fl::strcmp(argv[1], "baseline") == 0);
+    if (!loadJpeg()) {
+        fl::printf("ERROR: could not read tests/data/codec/progressive.jpg\n");
+        return 1;
+    }
+    const u16 sizes[] = {16, 32};
+
+    if (!json_output) {
+        fl::printf("\n=== 128x128 JPEG onto an LED matrix, %d decodes per case ===\n\n", ROUNDS);
+    }
+    for (u16 size : sizes) {
+        XYMap map = XYMap::constructSerpentine(size, size);
+        fl::vector<CRGB> leds(map.getTotal());
+        struct Case {
+            const char* name;
+            u32 elapsed;
+        };
+        runFrameDownscale(map, leds.data());  // Warm up
+        const Case cases[] = {
+            {"frame_downscale", runFrameDownscale(map, leds.data())},
+            {"leds_auto", runLeds(map, leds.data(), Jpeg::Scale::Auto)},
+            {"leds_full", runLeds(map, leds.data(), Jpeg::Scale::Full)},
+        };
+        for (const Case& c : cases) {
+            if (json_output) {
+                char target[64];
+                fl::snprintf(target, sizeof(target), "jpeg_%s_%d", c.name, size);
+                ProfileResultBuilder::print_result("baseline", target, ROUNDS, c.elapsed);
+            } else {
+                fl::printf("%2dx%-2d %-16s %8.2f us/decode\n", size, size, c.name,
+                           static_cast<double>(c.elapsed) / ROUNDS);
+            }
+        }
+    }
+    if (!json_output) {
+        fl::printf("=====================================\n");
+    }
+    return 0;
+}
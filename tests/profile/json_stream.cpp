@@ -0,0 +1,262 @@
+// ok standalone
+// Memory and speed comparison for a ScreenMap-style document (strips with
+// x/y coordinate arrays) deserialized into structs:
+//   dom:        json::parse() then read values out of the tree
+//   bind:       JsonBinder over the whole document, no DOM
+//   stream_256: JsonReader fed 256-byte chunks (as from an HTTP body), each
+//               strip handed to a JsonEach callback instead of stored
+// Peak heap is reported on glibc hosts.
+
+#include "FastLED.h"
+#include "fl/stl/cstring.h"
+#include "fl/stl/json.h"
+#include "fl/stl/json_bind.h"
+#include "fl/stl/json_reader.h"
+#include "fl/stl/stdio.h"
+#include "fl/stl/string.h"
+#include "fl/stl/vector.h"
+#include "profile_result.h"
+
+using namespace fl;
+
+static const int NUM_STRIPS = 64;
+static const int LEDS_PER_STRIP = 100;
+static const int ITERATIONS = 20;
+
+struct Strip {
+    fl::string id;
+    int length = 0;
+    float diameter = 0.0f;
+    fl::vector<float> x;
+    fl::vector<float> y;
+};
+
+namespace fl {
+template <>
+struct JsonFields<Strip> {
+    template <typename V>
+    static void visit(Strip& s, V& v) {
+        v("id", s.id);
+        v("length", s.length);
+        v("diameter", s.diameter);
+        v("x", s.x);
+        v("y", s.y);
+    }
+};
+} // namespace fl
+
+struct BindRoot {
+    fl::vector<Strip> strips;
+};
+
+namespace fl {
+template <>
+struct JsonFields<BindRoot> {
+    template <typename V>
+    static void visit(BindRoot& r, V& v) {
+        v("strips", r.strips);
+    }
+};
+} // namespace fl
+
+// ============================================================================
+// Heap tracking (glibc: interpose malloc/free/realloc; fl::realloc and
+// operator new both end up here)
+// ============================================================================
+
+namespace {
+
+size_t g_current = 0;
+size_t g_peak = 0;
+bool g_tracking = false;
+
+void trackAlloc(size_t size) {
+    if (!g_tracking) return;
+    g_current += size;
+    if (g_current > g_peak) g_peak = g_current;
+}
+
+void trackFree(size_t size) {
+    if (!g_tracking) return;
+    g_current = size > g_current ? 0 : g_current - size;
+}
+
+} // namespace
+
+#if defined(__GLIBC__)
+#include <malloc.h>  // ok include
+
+#define JSON_STREAM_HEAP_TRACKING 1
+
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void __libc_free(void* ptr);
+
+void* malloc(size_t size) {
+    void* ptr = __libc_malloc(size);
+    if (ptr) trackAlloc(malloc_usable_size(ptr));
+    return ptr;
+}
+
+void* calloc(size_t count, size_t size) {
+    void* ptr = __libc_calloc(count, size);
+    if (ptr) trackAlloc(malloc_usable_size(ptr));
+    return ptr;
+}
+
+void* realloc(void* ptr, size_t size) {
+    const size_t old = ptr ? malloc_usable_size(ptr) : 0;
+    void* moved = __libc_realloc(ptr, size);
+    if (moved || size == 0) trackFree(old);
+    if (moved) trackAlloc(malloc_usable_size(moved));
+    return moved;
+}
+
+void free(void* ptr) {
+    if (ptr) trackFree(malloc_usable_size(ptr));
+    __libc_free(ptr);
+}
+} // extern "C"
+#endif
+
+// ============================================================================
+// Cases
+// ============================================================================
+
+static fl::string makeDocument() {
+    fl::string doc = "{\"version\":\"1.0\",\"strips\":[";
+    for (int s = 0; s < NUM_STRIPS; s++) {
+        if (s) doc += ",";
+        doc += "{\"id\":\"strip_";
+        doc += fl::to_string(s);
+        doc += "\",\"type\":\"WS2812B\",\"length\":";
+        doc += fl::to_string(LEDS_PER_STRIP);
+        doc += ",\"x\":[";
+        for (int i = 0; i < LEDS_PER_STRIP; i++) {
+            if (i) doc += ",";
+            doc += fl::to_string(i);
+            doc += ".5";
+        }
+        doc += "],\"y\":[";
+        for (int i = 0; i < LEDS_PER_STRIP; i++) {
+            if (i) doc += ",";
+            doc += fl::to_string(s);
+        }
+        doc += "],\"diameter\":0.5}";
+    }
+    doc += "]}";
+    return doc;
+}
+
+volatile float g_sink = 0.0f;
+
+static float runDom(const fl::string& doc) {
+    json root = json::parse(doc);
+    fl::vector<Strip> strips;
+    const json list = root["strips"];
+    for (size_t s = 0; s < list.size(); s++) {
+        const json src = list[s];
+        Strip strip;
+        strip.id = src["id"].as_string().value_or("");
+        strip.length = static_cast<int>(src["length"].as_int().value_or(0));
+        strip.diameter = src["diameter"].as_float().value_or(0.0f);
+        const json xs = src["x"];
+        const json ys = src["y"];
+        for (size_t i = 0; i < xs.size(); i++) strip.x.push_back(xs[i].as_float().value_or(0.0f));
+        for (size_t i = 0; i < ys.size(); i++) strip.y.push_back(ys[i].as_float().value_or(0.0f));
+        strips.push_back(fl::move(strip));
+    }
+    return strips.back().x.back();
+}
+
+static float runBind(const fl::string& doc) {
+    BindRoot root;
+    JsonBinder::parse(fl::string_view(doc.c_str(), doc.size()), root);
+    return root.strips.back().x.back();
+}
+
+struct StreamRoot {
+    JsonEach<Strip> strips;
+};
+
+namespace fl {
+template <>
+struct JsonFields<StreamRoot> {
+    template <typename V>
+    static void visit(StreamRoot& r, V& v) {
+        v("strips", r.strips);
+    }
+};
+} // namespace fl
+
+static float runStream(const fl::string& doc) {
+    float last = 0.0f;
+    StreamRoot root{JsonEach<Strip>([&last](Strip& s) { last = s.x.back(); })};
+    JsonReader reader;
+    JsonBinder binder(root);
+    const fl::string_view text(doc.c_str(), doc.size());
+    for (size_t pos = 0; pos < text.size(); pos += 256) {
+        reader.feed(text.substr(pos, fl::min<size_t>(256, text.size() - pos)));
+        binder.pump(reader);
+    }
+    reader.finish();
+    binder.pump(reader);
+    return last;
+}
+
+int main(int argc, char* argv[]) {
+    bool json_output = (argc > 1 && fl::strcmp(argv[1], "baseline") == 0);
+
+    struct Case {
+        const char* name;
+        float (*fn)(const fl::string&);
+    };
+    const Case cases[] = {
+        {"dom", runDom},
+        {"bind", runBind},
+        {"stream_256", runStream},
+    };
+
+    const fl::string doc = makeDocument();
+
+    if (!json_output) {
+        fl::printf("\n=== ScreenMap JSON, %d strips x %d LEDs (%u bytes) ===\n\n",
+                   NUM_STRIPS, LEDS_PER_STRIP, static_cast<unsigned>(doc.size()));
+    }
+    for (const Case& c : cases) {
+        g_current = 0;
+        g_peak = 0;
+        g_tracking = true;
+        g_sink = c.fn(doc);
+        g_tracking = false;
+        const size_t peak = g_peak;
+
+        u32 t0 = ::micros();
+        for (int i = 0; i < ITERATIONS; i++) {
+            g_sink = c.fn(doc);
+        }
+        u32 elapsed_us = ::micros() - t0;
+        if (json_output) {
+            char target[64];
+            fl::snprintf(target, sizeof(target), "json_stream_%s", c.name);
+            ProfileResultBuilder::print_result("baseline", target, ITERATIONS, elapsed_us);
+        } else {
+#if defined(JSON_STREAM_HEAP_TRACKING)
+            fl::printf("%-12s %9.1f us/parse   peak heap %8u bytes (%.2fx document)\n",
+                       c.name, static_cast<double>(elapsed_us) / ITERATIONS,
+                       static_cast<unsigned>(peak),
+                       static_cast<double>(peak) / static_cast<double>(doc.size()));
+#else
+            (void)peak;
+            fl::printf("%-12s %9.1f us/parse\n", c.name,
+                       static_cast<double>(elapsed_us) / ITERATIONS);
+#endif
+        }
+    }
+    if (!json_output) {
+        fl::printf("=========================================\n");
+    }
+    return 0;
+}
@@ -0,0 +1,88 @@
+// ok standalone
+// Producer-side cost of one driver-style log line:
+//   async_text: FL_LOG_ASYNC path - format into fl::string, copy into AsyncLogQueue
+//   deferred:   BinaryLogQueue push - format pointer + raw arguments only
+// The consumer drains between batches and is not timed.
+
+#include "FastLED.h"
+#include "fl/log/async_log_queue.h"
+#include "fl/log/binary_log_queue.h"
+#include "fl/stl/cstring.h"
+#include "fl/stl/sstream.h"
+#include "fl/stl/stdio.h"
+#include "profile_result.h"
+
+using namespace fl;
+
+static const int BATCH = 32;
+static const int BATCHES = 4000;
+
+static AsyncLogQueue<128, 4096> gTextQueue;
+static BinaryLogQueue<64, 16> gBinaryQueue;
+
+static u32 runText() {
+    u32 elapsed = 0;
+    const char* msg;
+    u16 len;
+    for (int b = 0; b < BATCHES; b++) {
+        u32 t0 = ::micros();
+        for (int i = 0; i < BATCH; i++) {
+            gTextQueue.push((fl::sstream() << "ch" << i << " done, " << b << " symbols, "
+                                           << 1.25f << " us").str());
+        }
+        elapsed += ::micros() - t0;
+        while (gTextQueue.tryPop(&msg, &len)) {
+            gTextQueue.commit();
+        }
+    }
+    return elapsed;
+}
+
+static u32 runDeferred() {
+    u32 elapsed = 0;
+    BinaryLogRecord record;
+    for (int b = 0; b < BATCHES; b++) {
+        u32 t0 = ::micros();
+        for (int i = 0; i < BATCH; i++) {
+            gBinaryQueue.push(2, "ch%d done, %d symbols, %f us", i, b, 1.25f);
+        }
+        elapsed += ::micros() - t0;
+        while (gBinaryQueue.tryPop(&record)) {
+        }
+    }
+    return elapsed;
+}
+
+int main(int argc, char* argv[]) {
+    bool json_output = (argc > 1 && fl::strcmp(argv[1], "baseline") == 0);
+    const int calls = BATCH * BATCHES;
+
+    struct Case {
+        const char* name;
+        u32 (*fn)();
+    };
+    const Case cases[] = {
+        {"async_text", runText},
+        {"deferred", runDeferred},
+    };
+
+    if (!json_output) {
+        fl::printf("\n=== Log producer cost, %d calls ===\n\n", calls);
+    }
+    for (const Case& c : cases) {
+        c.fn();  // Warm up
+        u32 elapsed_us = c.fn();
+        if (json_output) {
+            char target[64];
+            fl::snprintf(target, sizeof(target), "log_deferred_%s", c.name);
+            ProfileResultBuilder::print_result("baseline", target, calls, elapsed_us);
+        } else {
+            fl::printf("%-12s %8.1f ns/call\n", c.name,
+                       static_cast<double>(elapsed_us) * 1000.0 / calls);
+        }
+    }
+    if (!json_output) {
+        fl::printf("=========================================\n");
+    }
+    return 0;
+}
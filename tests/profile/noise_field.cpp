@@ -0,0 +1,127 @@
+// Performance comparison: a 128x64 inoise16() field sampled point by point
+// vs fill_noise_field(), for 16-bit and palette output.
+// ok standalone
+
+#include "FastLED.h"
+#include "noise.h"
+#include "fl/stl/cstring.h"
+#include "fl/stl/stdio.h"
+#include "profile_result.h"
+
+using namespace fl;
+
+static const int W = 128;
+static const int H = 64;
+static const int WARMUP_FRAMES = 10;
+static const int FRAMES = 200;
+
+volatile u16 g_sink = 0;
+
+static u16 g_data[W * H];
+static CRGB g_leds[W * H];
+
+static NoiseField makeField(int frame) {
+    NoiseField field;
+    field.width = W;
+    field.height = H;
+    field.x = 0x00100000u;
+    field.scale_x = 7680;  // ~8.5 pixels per lattice cell, NoisePalette's scale
+    field.y = 0x00200000u;
+    field.scale_y = 7680;
+    field.z = static_cast<u32>(frame) * 1200;
+    return field;
+}
+
+__attribute__((noinline)) static void runPointwise(int frames) {
+    u16 local_sink = 0;
+    for (int f = 0; f < frames; f++) {
+        const NoiseField field = makeField(f);
+        for (int j = 0; j < H; j++) {
+            const u32 y = field.y + j * field.scale_y;
+            for (int i = 0; i < W; i++) {
+                g_data[j * W + i] = inoise16(field.x + i * field.scale_x, y, field.z);
+            }
+        }
+        local_sink ^= g_data[f % (W * H)];
+        asm volatile("" : "+r"(local_sink) : : "memory");
+    }
+    g_sink = local_sink;
+}
+
+__attribute__((noinline)) static void runField(int frames) {
+    u16 local_sink = 0;
+    for (int f = 0; f < frames; f++) {
+        fill_noise_field(g_data, makeField(f));
+        local_sink ^= g_data[f % (W * H)];
+        asm volatile("" : "+r"(local_sink) : : "memory");
+    }
+    g_sink = local_sink;
+}
+
+__attribute__((noinline)) static void runPalettePointwise(int frames) {
+    u16 local_sink = 0;
+    const CRGBPalette16 palette = LavaColors_p;
+    for (int f = 0; f < frames; f++) {
+        const NoiseField field = makeField(f);
+        for (int j = 0; j < H; j++) {
+            const u32 y = field.y + j * field.scale_y;
+            for (int i = 0; i < W; i++) {
+                u16 n = inoise16(field.x + i * field.scale_x, y, field.z);
+                g_leds[j * W + i] = ColorFromPalette(palette, n >> 8);
+            }
+        }
+        local_sink ^= g_leds[f % (W * H)].r;
+        asm volatile("" : "+r"(local_sink) : : "memory");
+    }
+    g_sink = local_sink;
+}
+
+__attribute__((noinline)) static void runPaletteField(int frames) {
+    u16 local_sink = 0;
+    const CRGBPalette16 palette = LavaColors_p;
+    for (int f = 0; f < frames; f++) {
+        fill_noise_field(g_leds, makeField(f), palette);
+        local_sink ^= g_leds[f % (W * H)].r;
+        asm volatile("" : "+r"(local_sink) : : "memory");
+    }
+    g_sink = local_sink;
+}
+
+int main(int argc, char *argv[]) {
+    bool json_output = (argc > 1 && fl::strcmp(argv[1], "baseline") == 0);
+
+    struct Case {
+        const char *name;
+        void (*fn)(int);
+    };
+    const Case cases[] = {
+        {"inoise16_pointwise", runPointwise},
+        {"fill_noise_field_u16", runField},
+        {"palette_pointwise", runPalettePointwise},
+        {"fill_noise_field_palette", runPaletteField},
+    };
+
+    if (!json_output) {
+        fl::printf("\n=== inoise16 field %dx%d ===\n\n", W, H);
+    }
+    for (const Case &c : cases) {
+        c.fn(WARMUP_FRAMES);
+        u32 t0 = ::micros();
+        c.fn(FRAMES);
+        u32 elapsed_us = ::micros() - t0;
+        if (json_output) {
+            char target[64];
+            fl::snprintf(target, sizeof(target), "noise_field_%dx%d_%s", W, H,
+                         c.name);
+            ProfileResultBuilder::print_result("baseline", target, FRAMES,
+                                               elapsed_us);
+        } else {
+            fl::printf("%-26s %8.2f us/frame\n", c.name,
+                       static_cast<double>(elapsed_us) / FRAMES);
+        }
+    }
+    if (!json_output) {
+        fl::printf("=========================================\n");
+    }
+    return 0;
+}
@@ -0,0 +1,68 @@
+// Performance comparison: NoisePalette on a 128x64 panel rendered on the
+// calling thread vs split into row bands on fl::task::WorkerPool.
+// ok standalone
+
+#include "FastLED.h"
+#include "fl/fx/2d/noisepalette.h"
+#include "fl/task/worker_pool.h"
+#include "fl/stl/cstring.h"
+#include "fl/stl/stdio.h"
+#include "profile_result.h"
+
+using namespace fl;
+
+static const int W = 128;
+static const int H = 64;
+static const int WARMUP_FRAMES = 20;
+static const int FRAMES = 500;
+
+volatile u8 g_sink = 0;
+
+static CRGB g_leds[W * H];
+
+__attribute__((noinline)) static void run(NoisePalette &fx, u8 bands,
+                                          int frames) {
+    u8 local_sink = 0;
+    for (int i = 0; i < frames; i++) {
+        Fx::DrawContext ctx(static_cast<u32>(i * 16), g_leds);
+        ctx.bands = bands;
+        fx.draw(ctx);
+        local_sink ^= g_leds[i % (W * H)].r;
+        asm volatile("" : "+r"(local_sink) : : "memory");
+    }
+    g_sink = local_sink;
+}
+
+int main(int argc, char *argv[]) {
+    bool json_output = (argc > 1 && fl::strcmp(argv[1], "baseline") == 0);
+
+    const int cores = fl::task::WorkerPool::instance().concurrency();
+    const u8 bandCounts[] = {1, static_cast<u8>(cores > 1 ? cores : 2)};
+
+    if (!json_output) {
+        fl::printf("\n=== NoisePalette %dx%d row bands (%d threads) ===\n\n", W,
+                   H, cores);
+    }
+    XYMap xy = XYMap::constructRectangularGrid(W, H);
+    for (u8 bands : bandCounts) {
+        NoisePalette fx(xy);
+        run(fx, bands, WARMUP_FRAMES);
+        u32 t0 = ::micros();
+        run(fx, bands, FRAMES);
+        u32 elapsed_us = ::micros() - t0;
+        if (json_output) {
+            char target[48];
+            fl::snprintf(target, sizeof(target), "noisepalette_%dx%d_bands%d",
+                         W, H, bands);
+            ProfileResultBuilder::print_result("baseline", target, FRAMES,
+                                               elapsed_us);
+        } else {
+            fl::printf("bands=%d  %8.2f us/frame\n", bands,
+                       static_cast<double>(elapsed_us) / FRAMES);
+        }
+    }
+    if (!json_output) {
+        fl::printf("=========================================\n");
+    }
+    return 0;
+}
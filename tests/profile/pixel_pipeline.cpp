@@ -0,0 +1,96 @@
+// ok standalone
+// WS2812 RGB encode throughput, 10k LEDs per frame:
+//   iterator: PixelIteratorAny::writeWS2812 (per-byte virtual dispatch)
+//   pipeline: runPixelPipeline (stage set resolved once per frame)
+// Each path runs with and without temporal dithering at 50% brightness.
+
+#include "FastLED.h"
+#include "fl/chipsets/encoders/pixel_pipeline.h"
+#include "fl/gfx/pixel_iterator_any.h"
+#include "fl/stl/cstring.h"
+#include "fl/stl/stdio.h"
+#include "fl/stl/vector.h"
+#include "pixel_controller.h"
+#include "profile_result.h"
+
+using namespace fl;
+
+static const int NUM_LEDS = 10000;
+static const int FRAMES = 200;
+
+static fl::vector<CRGB> gLeds;
+static fl::vector<u8> gOut;
+static EDitherMode gDither = DISABLE_DITHER;
+
+static ColorAdjustment halfBrightness() {
+    ColorAdjustment adj = ColorAdjustment::noAdjustment();
+    adj.premixed = CRGB(128, 128, 128);
+    return adj;
+}
+
+static u32 runIterator() {
+    u32 t0 = ::micros();
+    for (int f = 0; f < FRAMES; f++) {
+        PixelController<RGB> pixels(gLeds.data(), NUM_LEDS, halfBrightness(), gDither);
+        PixelIteratorAny iterator(pixels, GRB, RgbwInvalid());
+        gOut.clear();
+        iterator.get().writeWS2812(&gOut);
+    }
+    return ::micros() - t0;
+}
+
+static u32 runPipeline() {
+    u32 t0 = ::micros();
+    for (int f = 0; f < FRAMES; f++) {
+        PixelController<RGB> pixels(gLeds.data(), NUM_LEDS, halfBrightness(), gDither);
+        PixelPipelineParams params;
+        makePixelPipelineParams(pixels, &params);
+        gOut.resize(static_cast<fl::size>(NUM_LEDS) * 3);
+        runPixelPipeline(params, GRB, gOut.data());
+    }
+    return ::micros() - t0;
+}
+
+int main(int argc, char* argv[]) {
+    bool json_output = (argc > 1 && fl::strcmp(argv[1], "baseline") == 0);
+
+    gLeds.resize(NUM_LEDS);
+    for (int i = 0; i < NUM_LEDS; i++) {
+        gLeds[i] = CRGB(static_cast<u8>(i * 7), static_cast<u8>(i * 13), static_cast<u8>(i));
+    }
+    gOut.reserve(static_cast<fl::size>(NUM_LEDS) * 3);
+
+    struct Case {
+        const char* name;
+        EDitherMode dither;
+        u32 (*fn)();
+    };
+    const Case cases[] = {
+        {"iterator", DISABLE_DITHER, runIterator},
+        {"pipeline", DISABLE_DITHER, runPipeline},
+        {"iterator_dither", BINARY_DITHER, runIterator},
+        {"pipeline_dither", BINARY_DITHER, runPipeline},
+    };
+
+    if (!json_output) {
+        fl::printf("\n=== WS2812 encode, %d LEDs x %d frames ===\n\n", NUM_LEDS, FRAMES);
+    }
+    for (const Case& c : cases) {
+        gDither = c.dither;
+        c.fn();  // Warm up
+        u32 elapsed_us = c.fn();
+        if (json_output) {
+            char target[64];
+            fl::snprintf(target, sizeof(target), "pixel_pipeline_%s", c.name);
+            ProfileResultBuilder::print_result("baseline", target, FRAMES, elapsed_us);
+        } else {
+            fl::printf("%-16s %8.1f us/frame  %6.2f ns/LED\n", c.name,
+                       static_cast<double>(elapsed_us) / FRAMES,
+                       static_cast<double>(elapsed_us) * 1000.0 / FRAMES / NUM_LEDS);
+        }
+    }
+    if (!json_output) {
+        fl::printf("=========================================\n");
+    }
+    return 0;
+}
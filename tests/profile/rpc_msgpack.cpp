@@ -0,0 +1,130 @@
+// Performance comparison: one 4096-LED frame pushed through fl::Rpc as a
+// JSON request (base64 pixels) vs a MessagePack request (bin pixels).
+// Times the receiving side only: decode the wire bytes, bind the arguments,
+// run the handler and encode the response.
+// ok standalone
+
+#include "FastLED.h"
+#include "fl/remote/rpc/base64.h"
+#include "fl/remote/rpc/msgpack.h"
+#include "fl/remote/rpc/rpc.h"
+#include "fl/stl/cstring.h"
+#include "fl/stl/json.h"
+#include "fl/stl/stdio.h"
+#include "fl/stl/vector.h"
+#include "profile_result.h"
+
+using namespace fl;
+
+static const int NUM_LEDS = 4096;
+static const int WARMUP_FRAMES = 10;
+static const int FRAMES = 200;
+
+volatile u32 g_sink = 0;
+
+static CRGB g_leds[NUM_LEDS];
+
+static void bindShow(Rpc& rpc) {
+    rpc.bind("leds.show", [](int offset, span<const u8> rgb) {
+        const fl::size count = rgb.size() / 3;
+        fl::memcpy(g_leds + offset, rgb.data(), count * 3);
+        return static_cast<int>(count);
+    });
+}
+
+static vector<u8> makePixels() {
+    vector<u8> pixels(NUM_LEDS * 3);
+    for (fl::size i = 0; i < pixels.size(); i++) {
+        pixels[i] = static_cast<u8>(i * 7);
+    }
+    return pixels;
+}
+
+__attribute__((noinline)) static void runJson(int frames) {
+    static Rpc rpc;
+    static string wire;
+    if (wire.empty()) {
+        bindShow(rpc);
+        json params = json::array();
+        params.push_back(0);
+        params.push_back(base64_encode(makePixels()));
+        json request = json::object();
+        request.set("method", "leds.show");
+        request.set("params", params);
+        request.set("id", 1);
+        wire = request.to_string();
+    }
+    u32 local_sink = 0;
+    for (int f = 0; f < frames; f++) {
+        json response = rpc.handle(json::parse(wire));
+        local_sink += response.to_string().size();
+        asm volatile("" : "+r"(local_sink) : : "memory");
+    }
+    g_sink = local_sink;
+}
+
+__attribute__((noinline)) static void runMsgPack(int frames) {
+    static Rpc rpc;
+    static vector<u8> wire;
+    static vector<u8> response;
+    if (wire.empty()) {
+        bindShow(rpc);
+        rpc.setMsgPackEnabled(true);
+        MsgPackWriter w;
+        w.writeMapHeader(3);
+        w.writeString("method");
+        w.writeString("leds.show");
+        w.writeString("params");
+        w.writeArrayHeader(2);
+        w.writeInt(0);
+        w.writeBinary(makePixels());
+        w.writeString("id");
+        w.writeInt(1);
+        wire = w.buffer();
+    }
+    u32 local_sink = 0;
+    for (int f = 0; f < frames; f++) {
+        rpc.handleMsgPack(wire, &response);
+        local_sink += response.size();
+        asm volatile("" : "+r"(local_sink) : : "memory");
+    }
+    g_sink = local_sink;
+}
+
+int main(int argc, char *argv[]) {
+    bool json_output = (argc > 1 && fl::strcmp(argv[1], "baseline") == 0);
+
+    struct Case {
+        const char *name;
+        void (*fn)(int);
+    };
+    const Case cases[] = {
+        {"json_base64", runJson},
+        {"msgpack_bin", runMsgPack},
+    };
+
+    if (!json_output) {
+        fl::printf("\n=== RPC frame upload, %d LEDs (%d bytes) ===\n\n",
+                   NUM_LEDS, NUM_LEDS * 3);
+    }
+    for (const Case &c : cases) {
+        c.fn(WARMUP_FRAMES);
+        u32 t0 = ::micros();
+        c.fn(FRAMES);
+        u32 elapsed_us = ::micros() - t0;
+        if (json_output) {
+            char target[64];
+            fl::snprintf(target, sizeof(target), "rpc_frame_%d_%s", NUM_LEDS,
+                         c.name);
+            ProfileResultBuilder::print_result("baseline", target, FRAMES,
+                                               elapsed_us);
+        } else {
+            fl::printf("%-14s %8.2f us/frame\n", c.name,
+                       static_cast<double>(elapsed_us) / FRAMES);
+        }
+    }
+    if (!json_output) {
+        fl::printf("=========================================\n");
+    }
+    return 0;
+}
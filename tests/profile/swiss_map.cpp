@@ -0,0 +1,97 @@
+// ok standalone
+// Lookup cost, fl::unordered_map vs fl::swiss_map:
+//   hit:  find() of keys that are present
+//   miss: find() of keys that are absent
+// Run with int keys and with fl::string keys (the RPC registry's key type)
+// at 64, 1k and 10k entries.
+
+#include "FastLED.h"
+#include "fl/stl/cstring.h"
+#include "fl/stl/stdio.h"
+#include "fl/stl/string.h"
+#include "fl/stl/swiss_map.h"
+#include "fl/stl/unordered_map.h"
+#include "fl/stl/vector.h"
+#include "profile_result.h"
+
+using namespace fl;
+
+static const int LOOKUPS = 200000;
+static volatile int gSink = 0;
+
+template <typename Map, typename K>
+static u32 runLookups(const Map& map, const fl::vector<K>& keys) {
+    int found = 0;
+    const int n = static_cast<int>(keys.size());
+    u32 t0 = ::micros();
+    for (int i = 0; i < LOOKUPS; i++) {
+        found += map.find_value(keys[i % n]) != nullptr ? 1 : 0;
+    }
+    u32 elapsed = ::micros() - t0;
+    gSink = gSink + found;
+    return elapsed;
+}
+
+static int intKey(int i) { return i * 2654435 + 7; }
+static fl::string stringKey(int i) { return fl::string("effect.param.") + fl::to_string(i); }
+
+template <typename K> struct Bench {
+    const char* keyName;
+    K (*makeKey)(int);
+
+    void run(int count, bool json_output) {
+        fl::vector<K> hits;
+        fl::vector<K> misses;
+        unordered_map<K, int> classic;
+        swiss_map<K, int> swiss;
+        for (int i = 0; i < count; i++) {
+            hits.push_back(makeKey(i));
+            misses.push_back(makeKey(i + count));
+            classic[hits.back()] = i;
+            swiss[hits.back()] = i;
+        }
+        struct Case {
+            const char* name;
+            u32 elapsed;
+        };
+        runLookups(classic, hits);  // Warm up
+        runLookups(swiss, hits);
+        const Case cases[] = {
+            {"unordered_hit", runLookups(classic, hits)},
+            {"swiss_hit", runLookups(swiss, hits)},
+            {"unordered_miss", runLookups(classic, misses)},
+            {"swiss_miss", runLookups(swiss, misses)},
+        };
+        for (const Case& c : cases) {
+            if (json_output) {
+                char target[64];
+                fl::snprintf(target, sizeof(target), "hashmap_%s_%s_%d", keyName, c.name, count);
+                ProfileResultBuilder::print_result("baseline", target, LOOKUPS, c.elapsed);
+            } else {
+                fl::printf("%-7s %6d %-15s %8.2f ns/lookup\n", keyName, count, c.name,
+                           static_cast<double>(c.elapsed) * 1000.0 / LOOKUPS);
+            }
+        }
+    }
+};
+
+int main(int argc, char* argv[]) {
+    bool json_output = (argc > 1 && fl::strcmp(argv[1], "baseline") == 0);
+    const int sizes[] = {64, 1000, 10000};
+
+    if (!json_output) {
+        fl::printf("\n=== Hash map lookups, %d per case ===\n\n", LOOKUPS);
+    }
+    Bench<int> ints = {"int", intKey};
+    Bench<fl::string> strings = {"string", stringKey};
+    for (int count : sizes) {
+        ints.run(count, json_output);
+    }
+    for (int count : sizes) {
+        strings.run(count, json_output);
+    }
+    if (!json_output) {
+        fl::printf("=====================================\n");
+    }
+    return 0;
+}
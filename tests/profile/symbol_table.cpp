@@ -0,0 +1,149 @@
+// ok standalone
+// Interning a working set of 256 long names (RPC-style dotted paths):
+//   interner_build / symbols_build: first-time interning, cold tables
+//   interner_hit   / symbols_hit:   re-interning names already present
+//   string_eq      / symbol_eq:     comparing two interned names
+// Names are longer than the fl::string inline buffer so StringInterner
+// really interns them.
+
+#include "FastLED.h"
+#include "fl/stl/cstring.h"
+#include "fl/stl/stdio.h"
+#include "fl/stl/string.h"
+#include "fl/stl/string_interner.h"
+#include "fl/stl/string_view.h"
+#include "fl/stl/vector.h"
+#include "profile_result.h"
+
+using namespace fl;
+
+static const int NAMES = 256;
+static const int ROUNDS = 200;
+static volatile u32 gSink = 0;
+
+static fl::vector<fl::string> gNames;
+
+static u32 runInternerBuild() {
+    u32 t0 = ::micros();
+    for (int r = 0; r < ROUNDS; r++) {
+        StringInterner interner;
+        for (int i = 0; i < NAMES; i++) {
+            gSink = gSink + static_cast<u32>(interner.intern(gNames[i]).size());
+        }
+    }
+    return ::micros() - t0;
+}
+
+static u32 runSymbolsBuild() {
+    u32 t0 = ::micros();
+    for (int r = 0; r < ROUNDS; r++) {
+        SymbolTable table;
+        for (int i = 0; i < NAMES; i++) {
+            gSink = gSink + table.intern(string_view(gNames[i].c_str(), gNames[i].size())).id();
+        }
+    }
+    return ::micros() - t0;
+}
+
+static u32 runInternerHit() {
+    StringInterner interner;
+    for (int i = 0; i < NAMES; i++) {
+        interner.intern(gNames[i]);
+    }
+    u32 t0 = ::micros();
+    for (int r = 0; r < ROUNDS; r++) {
+        for (int i = 0; i < NAMES; i++) {
+            gSink = gSink + static_cast<u32>(interner.intern(gNames[i]).size());
+        }
+    }
+    return ::micros() - t0;
+}
+
+static u32 runSymbolsHit() {
+    SymbolTable table;
+    for (int i = 0; i < NAMES; i++) {
+        table.intern(string_view(gNames[i].c_str(), gNames[i].size()));
+    }
+    u32 t0 = ::micros();
+    for (int r = 0; r < ROUNDS; r++) {
+        for (int i = 0; i < NAMES; i++) {
+            gSink = gSink + table.intern(string_view(gNames[i].c_str(), gNames[i].size())).id();
+        }
+    }
+    return ::micros() - t0;
+}
+
+static u32 runStringEq() {
+    StringInterner interner;
+    fl::vector<fl::string> names;
+    for (int i = 0; i < NAMES; i++) {
+        names.push_back(interner.intern(gNames[i]));
+    }
+    u32 t0 = ::micros();
+    for (int r = 0; r < ROUNDS; r++) {
+        for (int i = 0; i < NAMES; i++) {
+            gSink = gSink + (names[i] == names[(i + r) % NAMES] ? 1u : 0u);
+        }
+    }
+    return ::micros() - t0;
+}
+
+static u32 runSymbolEq() {
+    SymbolTable table;
+    fl::vector<Symbol> names;
+    for (int i = 0; i < NAMES; i++) {
+        names.push_back(table.intern(string_view(gNames[i].c_str(), gNames[i].size())));
+    }
+    u32 t0 = ::micros();
+    for (int r = 0; r < ROUNDS; r++) {
+        for (int i = 0; i < NAMES; i++) {
+            gSink = gSink + (names[i] == names[(i + r) % NAMES] ? 1u : 0u);
+        }
+    }
+    return ::micros() - t0;
+}
+
+int main(int argc, char* argv[]) {
+    bool json_output = (argc > 1 && fl::strcmp(argv[1], "baseline") == 0);
+
+    for (int i = 0; i < NAMES; i++) {
+        char name[128];
+        fl::snprintf(name, sizeof(name),
+                     "controller.segment_%03d.effects.palette_blend.parameters.brightness_curve", i);
+        gNames.push_back(fl::string(name));
+    }
+
+    struct Case {
+        const char* name;
+        u32 (*fn)();
+    };
+    const Case cases[] = {
+        {"interner_build", runInternerBuild},
+        {"symbols_build", runSymbolsBuild},
+        {"interner_hit", runInternerHit},
+        {"symbols_hit", runSymbolsHit},
+        {"string_eq", runStringEq},
+        {"symbol_eq", runSymbolEq},
+    };
+
+    const u32 calls = static_cast<u32>(NAMES) * ROUNDS;
+    if (!json_output) {
+        fl::printf("\n=== Interning %d names x %d rounds ===\n\n", NAMES, ROUNDS);
+    }
+    for (const Case& c : cases) {
+        c.fn();  // Warm up
+        u32 elapsed_us = c.fn();
+        if (json_output) {
+            char target[64];
+            fl::snprintf(target, sizeof(target), "symbol_table_%s", c.name);
+            ProfileResultBuilder::print_result("baseline", target, calls, elapsed_us);
+        } else {
+            fl::printf("%-16s %8.2f ns/op\n", c.name,
+                       static_cast<double>(elapsed_us) * 1000.0 / calls);
+        }
+    }
+    if (!json_output) {
+        fl::printf("=====================================\n");
+    }
+    return 0;
+}
@@ -0,0 +1,92 @@
+// ok standalone
+// fl::task::Scheduler cost as the number of interval tasks grows (10..10k):
+//   update: one update() with every task idle (intervals far in the future)
+//   add:    registering a task with every_ms().then()
+//   cancel: canceling a registered task
+// With the deadline heap, idle update() stays flat as tasks are added and
+// add/cancel grow with log n.
+
+#include "FastLED.h"
+#include "fl/stl/cstring.h"
+#include "fl/stl/stdio.h"
+#include "fl/stl/vector.h"
+#include "fl/task/scheduler.h"
+#include "fl/task/task.h"
+#include "profile_result.h"
+
+using namespace fl;
+
+static const int UPDATES = 20000;
+static volatile int gRuns = 0;
+
+static void addTasks(fl::vector<task::Handle>& tasks, int count) {
+    for (int i = 0; i < count; i++) {
+        // Spread the deadlines so the heap is not trivially ordered.
+        tasks.push_back(task::every_ms(60000 + (i * 7919) % 60000).then([]() { gRuns = gRuns + 1; }));
+    }
+}
+
+struct Timing {
+    u32 update_us;
+    u32 add_us;
+    u32 cancel_us;
+};
+
+static Timing runCase(int count) {
+    task::Scheduler& scheduler = task::Scheduler::instance();
+    scheduler.clear_all_tasks();
+    fl::vector<task::Handle> tasks;
+    tasks.reserve(count);
+
+    Timing timing;
+    u32 t0 = ::micros();
+    addTasks(tasks, count);
+    timing.add_us = ::micros() - t0;
+
+    scheduler.update();  // First run of every task, then all are idle
+    t0 = ::micros();
+    for (int i = 0; i < UPDATES; i++) {
+        scheduler.update();
+    }
+    timing.update_us = ::micros() - t0;
+
+    t0 = ::micros();
+    for (int i = 0; i < count; i++) {
+        tasks[(i * 7919) % count].cancel();
+    }
+    timing.cancel_us = ::micros() - t0;
+    scheduler.clear_all_tasks();
+    return timing;
+}
+
+int main(int argc, char* argv[]) {
+    bool json_output = (argc > 1 && fl::strcmp(argv[1], "baseline") == 0);
+    const int sizes[] = {10, 100, 1000, 10000};
+
+    if (!json_output) {
+        fl::printf("\n=== fl::task::Scheduler, %d idle updates per size ===\n\n", UPDATES);
+        fl::printf("%8s %14s %12s %12s\n", "tasks", "update ns", "add ns", "cancel ns");
+    }
+    for (int count : sizes) {
+        runCase(count);  // Warm up
+        Timing timing = runCase(count);
+        if (json_output) {
+            char target[64];
+            fl::snprintf(target, sizeof(target), "task_scheduler_update_%d", count);
+            ProfileResultBuilder::print_result("baseline", target, UPDATES, timing.update_us);
+            fl::snprintf(target, sizeof(target), "task_scheduler_add_%d", count);
+            ProfileResultBuilder::print_result("baseline", target, count, timing.add_us);
+            fl::snprintf(target, sizeof(target), "task_scheduler_cancel_%d", count);
+            ProfileResultBuilder::print_result("baseline", target, count, timing.cancel_us);
+        } else {
+            fl::printf("%8d %14.1f %12.1f %12.1f\n", count,
+                       static_cast<double>(timing.update_us) * 1000.0 / UPDATES,
+                       static_cast<double>(timing.add_us) * 1000.0 / count,
+                       static_cast<double>(timing.cancel_us) * 1000.0 / count);
+        }
+    }
+    if (!json_output) {
+        fl::printf("=====================================================\n");
+    }
+    return 0;
+}
@@ -0,0 +1,139 @@
+// ok standalone
+// Wave8 fused multi-lane encoder vs. the two-pass expand + transpose path.
+//
+// Two-pass: wave8_expand_byte() every lane into a Wave8Byte staging array,
+// then transpose the staged waveforms into DMA order. Fused: wave8EncodeLanes()
+// goes straight from lane bytes to DMA words (BF1 + u32x4 mask stage).
+//
+// Usage:
+//   ./wave8_fused_encode.exe baseline    # JSON output
+//   ./wave8_fused_encode.exe             # Human-readable report
+
+#include "FastLED.h"
+#include "fl/channels/wave8.h"
+#include "fl/channels/detail/wave8.hpp"
+#include "fl/chipsets/led_timing.h"
+#include "fl/math/transposition.h"
+#include "fl/stl/cstring.h"
+#include "fl/stl/int.h"
+#include "fl/stl/span.h"
+#include "fl/stl/stdio.h"
+#include "fl/stl/vector.h"
+#include "profile_result.h"
+
+using namespace fl;
+
+static const int NUM_LEDS = 256;
+static const int BYTES_PER_LANE = NUM_LEDS * 3;
+static const int WARMUP_FRAMES = 20;
+static const int PROFILE_FRAMES = 500;
+
+volatile u32 g_sink = 0;
+
+struct Frame {
+    fl::vector<fl::vector<u8>> laneData;
+    fl::vector<fl::span<const u8>> lanes;
+    fl::vector<u32> output;  // u32 storage keeps the DMA buffer 4-byte aligned
+
+    explicit Frame(u8 width) : laneData(width) {
+        u32 seed = 0xC0FFEEu;
+        for (u8 l = 0; l < width; l++) {
+            laneData[l].resize(BYTES_PER_LANE);
+            for (int i = 0; i < BYTES_PER_LANE; i++) {
+                seed = seed * 1664525u + 1013904223u;
+                laneData[l][i] = static_cast<u8>(seed >> 24);
+            }
+            lanes.push_back(fl::span<const u8>(laneData[l].data(), BYTES_PER_LANE));
+        }
+        output.resize(wave8EncodedSize(BYTES_PER_LANE, width) / 4);
+    }
+
+    u8 *out() { return fl::bit_cast_ptr<u8>(output.data()); }
+};
+
+__attribute__((noinline))
+void encode_two_pass(Frame &frame, u8 width, const Wave8ByteExpansionLut &lut) {
+    Wave8Byte staging[16];
+    u8 *out = frame.out();
+    const size_t blockSize = width * sizeof(Wave8Byte);
+    for (int i = 0; i < BYTES_PER_LANE; i++) {
+        for (u8 l = 0; l < width; l++) {
+            detail::wave8_expand_byte(frame.laneData[l][i], lut, &staging[l]);
+        }
+        if (width == 16) {
+            detail::wave8_transpose_16(staging, out);
+        } else {
+            transpose_wave8byte_parlio(fl::bit_cast_ptr<const u8>(staging), 8, out);
+        }
+        out += blockSize;
+    }
+    g_sink = g_sink + frame.out()[7];
+}
+
+__attribute__((noinline))
+void encode_fused(Frame &frame, u8 width, const Wave8ByteExpansionLut &lut) {
+    fl::span<u8> out(frame.out(), wave8EncodedSize(BYTES_PER_LANE, width));
+    wave8EncodeLanes(frame.lanes, width, lut, out);
+    g_sink = g_sink + frame.out()[7];
+}
+
+typedef void (*encode_fn)(Frame &, u8, const Wave8ByteExpansionLut &);
+
+static u32 time_frames(encode_fn fn, Frame &frame, u8 width,
+                       const Wave8ByteExpansionLut &lut) {
+    for (int i = 0; i < WARMUP_FRAMES; i++) {
+        fn(frame, width, lut);
+    }
+    u32 t0 = ::micros();
+    for (int i = 0; i < PROFILE_FRAMES; i++) {
+        fn(frame, width, lut);
+    }
+    return ::micros() - t0;
+}
+
+int main(int argc, char *argv[]) {
+    bool json_output = (argc > 1 && fl::strcmp(argv[1], "baseline") == 0);
+
+    ChipsetTiming timing;
+    timing.T1 = 400;
+    timing.T2 = 450;
+    timing.T3 = 400;
+    const Wave8ByteExpansionLut lut =
+        buildWave8ByteExpansionLUT(buildWave8ExpansionLUT(timing));
+
+    const u8 widths[2] = {8, 16};
+    for (int w = 0; w < 2; w++) {
+        const u8 width = widths[w];
+        Frame frame(width);
+
+        // Sanity: both paths must produce identical DMA bytes.
+        fl::vector<u32> reference(frame.output.size());
+        encode_two_pass(frame, width, lut);
+        fl::memcpy(reference.data(), frame.output.data(), reference.size() * 4);
+        encode_fused(frame, width, lut);
+        if (fl::memcmp(reference.data(), frame.output.data(), reference.size() * 4) != 0) {
+            fl::printf("ERROR: fused output differs from two-pass (width=%d)\n", width);
+            return 1;
+        }
+
+        const u32 twoPassUs = time_frames(&encode_two_pass, frame, width, lut);
+        const u32 fusedUs = time_frames(&encode_fused, frame, width, lut);
+
+        if (json_output) {
+            ProfileResultBuilder twoPass("two_pass", width == 16 ? "wave8_encode_16" : "wave8_encode_8");
+            twoPass.add_timing(PROFILE_FRAMES, twoPassUs);
+            twoPass.print();
+            ProfileResultBuilder fused("fused_simd", width == 16 ? "wave8_encode_16" : "wave8_encode_8");
+            fused.add_timing(PROFILE_FRAMES, fusedUs);
+            fused.set("speedup", static_cast<double>(twoPassUs) / (fusedUs ? fusedUs : 1));
+            fused.print();
+        } else {
+            fl::printf("%2d lanes x %d LEDs: two-pass %.1f us/frame, fused %.1f us/frame (%.2fx)\n",
+                       width, NUM_LEDS,
+                       static_cast<double>(twoPassUs) / PROFILE_FRAMES,
+                       static_cast<double>(fusedUs) / PROFILE_FRAMES,
+                       static_cast<double>(twoPassUs) / (fusedUs ? fusedUs : 1));
+        }
+    }
+    return 0;
+}